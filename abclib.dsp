@@ -239,6 +239,10 @@ SOURCE=.\src\base\abci\abcCut.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\base\abci\abcCutBench.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\base\abci\abcDar.c
 # End Source File
 # Begin Source File
@@ -2087,6 +2091,10 @@ SOURCE=.\src\sat\bmc\bmcClp.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\sat\bmc\bmcCnfInc.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\sat\bmc\bmcEco.c
 # End Source File
 # Begin Source File
@@ -2147,6 +2155,10 @@ SOURCE=.\src\sat\bmc\bmcMulti.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\sat\bmc\bmcPort.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\sat\bmc\bmcUnroll.c
 # End Source File
 # End Group
@@ -2187,6 +2199,10 @@ SOURCE=.\src\sat\satoko\utils\heap.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\sat\satoko\inprocess.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\sat\satoko\utils\mem.h
 # End Source File
 # Begin Source File
@@ -3119,6 +3135,10 @@ SOURCE=.\src\opt\dau\dauCanon.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\opt\dau\dauCache.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\opt\dau\dauCore.c
 # End Source File
 # Begin Source File
@@ -3163,6 +3183,10 @@ SOURCE=.\src\opt\dau\dauNpn2.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\opt\dau\dauStore.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\opt\dau\dauTree.c
 # End Source File
 # End Group
@@ -4155,6 +4179,14 @@ SOURCE=.\src\misc\util\utilNam.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\misc\util\utilPool.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\src\misc\util\utilPool.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\misc\util\utilPth.c
 # End Source File
 # Begin Source File
@@ -4167,6 +4199,14 @@ SOURCE=.\src\misc\util\utilSignal.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\misc\util\utilSimd.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\src\misc\util\utilSimd.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\misc\util\utilSort.c
 # End Source File
 # Begin Source File
@@ -5099,6 +5139,10 @@ SOURCE=.\src\aig\gia\giaKf.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\gia\giaLevel.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\gia\giaLf.c
 # End Source File
 # Begin Source File
@@ -5159,6 +5203,10 @@ SOURCE=.\src\aig\gia\giaPack.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\gia\giaPar.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\gia\giaPat.c
 # End Source File
 # Begin Source File
@@ -5167,6 +5215,10 @@ SOURCE=.\src\aig\gia\giaPat2.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\gia\giaPatStore.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\gia\giaPf.c
 # End Source File
 # Begin Source File
@@ -5275,6 +5327,14 @@ SOURCE=.\src\aig\gia\giaSimBase.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\gia\giaSnap.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\src\aig\gia\giaSoa.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\gia\giaSort.c
 # End Source File
 # Begin Source File
@@ -6011,6 +6071,10 @@ SOURCE=.\src\proof\pdr\pdrMan.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\proof\pdr\pdrPar.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\proof\pdr\pdrSat.c
 # End Source File
 # Begin Source File
@@ -45,6 +45,8 @@ ABC_NAMESPACE_HEADER_START
 #define GIA_NONE 0x1FFFFFFF
 #define GIA_VOID 0x0FFFFFFF
 
+#define GIA_PAT_STORE_DEFAULT 1024  // the default capacity of the pattern store
+
 ////////////////////////////////////////////////////////////////////////
 ///                         BASIC TYPES                              ///
 ////////////////////////////////////////////////////////////////////////
@@ -53,6 +55,18 @@ typedef struct Gia_MmFixed_t_        Gia_MmFixed_t;
 typedef struct Gia_MmFlex_t_         Gia_MmFlex_t;     
 typedef struct Gia_MmStep_t_         Gia_MmStep_t;     
 typedef struct Gia_Dat_t_            Gia_Dat_t;
+typedef struct Gia_LevMan_t_         Gia_LevMan_t;
+
+typedef struct Gia_MmFlexMark_t_ Gia_MmFlexMark_t;
+struct Gia_MmFlexMark_t_
+{
+    int            nChunks;       // the number of chunks
+    char *         pCurrent;      // the current pointer to free memory
+    char *         pEnd;          // the first entry outside the free memory
+    int            nEntriesUsed;  // the number of entries allocated
+    int            nMemoryUsed;   // memory used in the allocated entries
+    int            nMemoryAlloc;  // memory allocated
+};
 
 typedef struct Gia_Rpr_t_ Gia_Rpr_t;
 struct Gia_Rpr_t_
@@ -109,8 +123,9 @@ struct Gia_Man_t_
     int            nBufs;         // the number of buffers
     Vec_Int_t *    vCis;          // the vector of CIs (PIs + LOs)
     Vec_Int_t *    vCos;          // the vector of COs (POs + LIs)
-    Vec_Int_t      vHash;         // hash links
+    Vec_Int_t      vHash;         // old hash table (while resizing)
     Vec_Int_t      vHTable;       // hash table
+    int            iHashMove;     // the next slot of the old hash table to move
     int            fAddStrash;    // performs additional structural hashing
     int            fSweeper;      // sweeper is running
     int            fGiaSimple;    // simple mode (no const-propagation and strashing)
@@ -119,6 +134,7 @@ struct Gia_Man_t_
     int *          pLutRefs;      // the reference count
     Vec_Int_t *    vLevels;       // levels of the nodes
     int            nLevels;       // the mamixum level
+    Gia_LevMan_t * pLevInc;       // incremental levelization
     int            nConstrs;      // the number of constraints
     int            nTravIds;      // the current traversal ID
     int            nFront;        // frontier size 
@@ -210,6 +226,7 @@ struct Gia_Man_t_
     int            nSimWordsT;
     int            iPastPiMax;
     int            nSimWordsMax;
+    int            nSimThreads;   // the number of threads for pattern simulation
     Vec_Wrd_t *    vSims;
     Vec_Wrd_t *    vSimsT;
     Vec_Wrd_t *    vSimsPi;
@@ -218,11 +235,24 @@ struct Gia_Man_t_
     Vec_Int_t *    vClassNew;
     Vec_Int_t *    vPats;
     Vec_Bit_t *    vPolars;
+    // persistent store of distinguishing patterns
+    Vec_Wrd_t *    vPatStore;     // CI values of the patterns (CI-major)
+    int            nPatStoreWords;// the number of words per CI
+    int            nPatStore;     // the number of stored patterns
+    int            iPatStore;     // the next pattern to be written
     // incremental simulation
     int            fIncrSim;
     int            iNextPi;
     int            iTimeStamp;
     Vec_Int_t *    vTimeStamps;
+    // structure-of-arrays view
+    int            nSoaObjs;      // the number of objects in the view
+    int *          pSoaFan0;      // the first fanin literal (-1 for CIs and const0)
+    int *          pSoaFan1;      // the second fanin literal (-1 for non-ANDs)
+    unsigned *     pSoaValues;    // the values of the objects
+    unsigned char* pSoaMarks;     // fMark0 (bit 0) and fMark1 (bit 1) of the objects
+    // scratch arena
+    Gia_MmFlex_t * pArena;        // bump allocator for the per-pass scratch data
     // truth table computation for small functions
     int            nTtVars;       // truth table variables
     int            nTtWords;      // truth table words
@@ -256,6 +286,8 @@ struct Gia_Man_t_
     Vec_Ptr_t *    vLutsRankings;     // LUTs rankings of inputs
 };
 
+// transformation applied to the parts by Gia_ManParTransform()
+typedef Gia_Man_t * (*Gia_ParFunc_t)( Gia_Man_t * p, void * pUser );
 
 typedef struct Gps_Par_t_ Gps_Par_t;
 struct Gps_Par_t_
@@ -377,6 +409,9 @@ struct Jf_Par_t_
     word           Edge;
     word           Clause;
     word           Mux7;
+    word           Cuts;
+    word           CutMem;
+    abctime        CutTime;
     word           WordMapDelay;
     word           WordMapArea;
     word           WordMapDelayTarget;
@@ -669,9 +704,30 @@ static inline void         Gia_ObjSetTimeSlackObj( Gia_Man_t * p, Gia_Obj_t * pO
 
 static inline int          Gia_ObjSimWords( Gia_Man_t * p )                    { return Vec_WrdSize( p->vSimsPi ) / Gia_ManPiNum( p );          }
 static inline word *       Gia_ObjSimPi( Gia_Man_t * p, int PiId )             { return Vec_WrdEntryP( p->vSimsPi, PiId * Gia_ObjSimWords(p) ); }
+static inline int          Gia_ManPatStoreNum( Gia_Man_t * p )                 { return p->nPatStore;                                           }
+static inline word *       Gia_ManPatStoreCi( Gia_Man_t * p, int iCi )         { return Vec_WrdEntryP( p->vPatStore, iCi * p->nPatStoreWords ); }
 static inline word *       Gia_ObjSim( Gia_Man_t * p, int Id )                 { return Vec_WrdEntryP( p->vSims, Id * Gia_ObjSimWords(p) );     }
 static inline word *       Gia_ObjSimObj( Gia_Man_t * p, Gia_Obj_t * pObj )    { return Gia_ObjSim( p, Gia_ObjId(p, pObj) );                    }
 
+static inline int          Gia_ManHasSoa( Gia_Man_t * p )                      { return p->pSoaFan0 != NULL && p->nSoaObjs == p->nObjs;                         }
+static inline int          Gia_ObjSoaFaninLit0( Gia_Man_t * p, int Id )        { return p->pSoaFan0[Id];                                        }
+static inline int          Gia_ObjSoaFaninLit1( Gia_Man_t * p, int Id )        { return p->pSoaFan1[Id];                                        }
+static inline int          Gia_ObjSoaFaninId0( Gia_Man_t * p, int Id )         { return Abc_Lit2Var(p->pSoaFan0[Id]);                           }
+static inline int          Gia_ObjSoaFaninId1( Gia_Man_t * p, int Id )         { return Abc_Lit2Var(p->pSoaFan1[Id]);                           }
+static inline int          Gia_ObjSoaFaninC0( Gia_Man_t * p, int Id )          { return Abc_LitIsCompl(p->pSoaFan0[Id]);                        }
+static inline int          Gia_ObjSoaFaninC1( Gia_Man_t * p, int Id )          { return Abc_LitIsCompl(p->pSoaFan1[Id]);                        }
+static inline int          Gia_ObjSoaIsAnd( Gia_Man_t * p, int Id )            { return p->pSoaFan1[Id] >= 0;                                   }
+static inline int          Gia_ObjSoaIsXor( Gia_Man_t * p, int Id )            { return Gia_ObjSoaIsAnd(p, Id) && p->pSoaFan0[Id] > p->pSoaFan1[Id] && Abc_Lit2Var(p->pSoaFan0[Id]) != Abc_Lit2Var(p->pSoaFan1[Id]); }
+static inline int          Gia_ObjSoaIsCo( Gia_Man_t * p, int Id )             { return p->pSoaFan0[Id] >= 0 && p->pSoaFan1[Id] < 0;            }
+static inline unsigned     Gia_ObjSoaValue( Gia_Man_t * p, int Id )            { return p->pSoaValues[Id];                                      }
+static inline void         Gia_ObjSoaSetValue( Gia_Man_t * p, int Id, unsigned v ) { p->pSoaValues[Id] = v;                                     }
+static inline int          Gia_ObjSoaMark0( Gia_Man_t * p, int Id )            { return p->pSoaMarks[Id] & 1;                                   }
+static inline int          Gia_ObjSoaMark1( Gia_Man_t * p, int Id )            { return (p->pSoaMarks[Id] >> 1) & 1;                            }
+static inline void         Gia_ObjSoaSetMark0( Gia_Man_t * p, int Id )         { p->pSoaMarks[Id] |= 1;                                         }
+static inline void         Gia_ObjSoaSetMark1( Gia_Man_t * p, int Id )         { p->pSoaMarks[Id] |= 2;                                         }
+static inline void         Gia_ObjSoaCleanMark0( Gia_Man_t * p, int Id )       { p->pSoaMarks[Id] &= ~1;                                        }
+static inline void         Gia_ObjSoaCleanMark1( Gia_Man_t * p, int Id )       { p->pSoaMarks[Id] &= ~2;                                        }
+
 // AIG construction
 extern void Gia_ObjAddFanout( Gia_Man_t * p, Gia_Obj_t * pObj, Gia_Obj_t * pFanout );
 static inline Gia_Obj_t * Gia_ManAppendObj( Gia_Man_t * p )  
@@ -694,7 +750,6 @@ static inline Gia_Obj_t * Gia_ManAppendObj( Gia_Man_t * p )
         }
         p->nObjsAlloc = nObjNew;
     }
-    if ( Vec_IntSize(&p->vHTable) ) Vec_IntPush( &p->vHash, 0 );
     return Gia_ManObj( p, p->nObjs++ );
 }
 static inline int Gia_ManAppendCi( Gia_Man_t * p )  
@@ -1213,6 +1268,12 @@ static inline int         Gia_ObjCellId( Gia_Man_t * p, int iLit )          { re
     for ( i = 0; (i < p->nObjs) && ((pObj) = Gia_ManObj(p, i)); i++ )      if ( !Gia_ObjIsAnd(pObj) ) {} else
 #define Gia_ManForEachAndId( p, i )                                     \
     for ( i = 0; (i < p->nObjs); i++ )                                     if ( !Gia_ObjIsAnd(Gia_ManObj(p, i)) ) {} else
+#define Gia_ManForEachAndSoa( p, i )                                    \
+    for ( i = 1; (i < p->nSoaObjs); i++ )                                  if ( !Gia_ObjSoaIsAnd(p, i) ) {} else
+#define Gia_ManForEachAndSoaReverse( p, i )                             \
+    for ( i = p->nSoaObjs - 1; (i > 0); i-- )                              if ( !Gia_ObjSoaIsAnd(p, i) ) {} else
+#define Gia_ManForEachCoSoa( p, i )                                     \
+    for ( i = 1; (i < p->nSoaObjs); i++ )                                  if ( !Gia_ObjSoaIsCo(p, i) ) {} else
 #define Gia_ManForEachMuxId( p, i )                                     \
     for ( i = 0; (i < p->nObjs); i++ )                                     if ( !Gia_ObjIsMuxId(p, i) ) {} else
 #define Gia_ManForEachCand( p, pObj, i )                                \
@@ -1271,10 +1332,14 @@ static inline int         Gia_ObjCellId( Gia_Man_t * p, int iLit )          { re
 
 /*=== giaAiger.c ===========================================================*/
 extern int                 Gia_FileSize( char * pFileName );
+extern char *              Gia_FileMap( char * pFileName, size_t * pnFileSize );
+extern void                Gia_FileUnmap( char * pContents, size_t nFileSize );
 extern Gia_Man_t *         Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck );
+extern Gia_Man_t *         Gia_AigerReadGz( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck );
 extern Gia_Man_t *         Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck );
 extern void                Gia_AigerWrite( Gia_Man_t * p, char * pFileName, int fWriteSymbols, int fCompact, int fWriteNewLine );
 extern void                Gia_AigerWriteS( Gia_Man_t * p, char * pFileName, int fWriteSymbols, int fCompact, int fWriteNewLine, int fSkipComment );
+extern void                Gia_AigerWriteMt( Gia_Man_t * p, char * pFileName, int fWriteSymbols, int fCompact, int fWriteNewLine, int fSkipComment, int nThreads );
 extern void                Gia_DumpAiger( Gia_Man_t * p, char * pFilePrefix, int iFileNum, int nFileNumDigits );
 extern Vec_Str_t *         Gia_AigerWriteIntoMemoryStr( Gia_Man_t * p );
 extern Vec_Str_t *         Gia_AigerWriteIntoMemoryStrPart( Gia_Man_t * p, Vec_Int_t * vCis, Vec_Int_t * vAnds, Vec_Int_t * vCos, int nRegs );
@@ -1466,6 +1531,7 @@ extern void                Gia_ObjAddFanout( Gia_Man_t * p, Gia_Obj_t * pObj, Gi
 extern void                Gia_ObjRemoveFanout( Gia_Man_t * p, Gia_Obj_t * pObj, Gia_Obj_t * pFanout );
 extern void                Gia_ManFanoutStart( Gia_Man_t * p );
 extern void                Gia_ManFanoutStop( Gia_Man_t * p );
+extern void                Gia_ObjCollectFanouts( Gia_Man_t * p, Gia_Obj_t * pObj, Vec_Int_t * vFanouts );
 extern void                Gia_ManStaticFanoutStart( Gia_Man_t * p );
 extern void                Gia_ManStaticFanoutStop( Gia_Man_t * p );
 extern void                Gia_ManStaticMappingFanoutStart( Gia_Man_t * p, Vec_Int_t ** pvIndex );
@@ -1490,10 +1556,18 @@ extern Gia_Man_t *         Gia_ManPerformFx( Gia_Man_t * p, int nNewNodesMax, in
 extern void                Gia_ManHashAlloc( Gia_Man_t * p ); 
 extern void                Gia_ManHashStart( Gia_Man_t * p ); 
 extern void                Gia_ManHashStop( Gia_Man_t * p );
+extern void                Gia_ManHashResize( Gia_Man_t * p );
 extern int                 Gia_ManHashXorReal( Gia_Man_t * p, int iLit0, int iLit1 );
 extern int                 Gia_ManHashMuxReal( Gia_Man_t * p, int iLitC, int iLit1, int iLit0 );
 extern int                 Gia_ManHashAnd( Gia_Man_t * p, int iLit0, int iLit1 ); 
 extern int                 Gia_ManHashOr( Gia_Man_t * p, int iLit0, int iLit1 ); 
+extern int                 Gia_ManHashConcIsSupported();
+extern void                Gia_ManHashConcStart( Gia_Man_t * p, int nObjsMax );
+extern int                 Gia_ManHashAndConc( Gia_Man_t * p, int iLit0, int iLit1 );
+extern int                 Gia_ManHashOrConc( Gia_Man_t * p, int iLit0, int iLit1 );
+extern int                 Gia_ManHashXorConc( Gia_Man_t * p, int iLit0, int iLit1 );
+extern int                 Gia_ManHashMuxConc( Gia_Man_t * p, int iLitC, int iLit1, int iLit0 );
+extern int                 Gia_ManHashLookupConc( Gia_Man_t * p, int iLit0, int iLit1 );
 extern int                 Gia_ManHashXor( Gia_Man_t * p, int iLit0, int iLit1 ); 
 extern int                 Gia_ManHashMux( Gia_Man_t * p, int iCtrl, int iData1, int iData0 );
 extern int                 Gia_ManHashMaj( Gia_Man_t * p, int iData0, int iData1, int iData2 );
@@ -1554,6 +1628,18 @@ extern void                Gia_ManReportImprovement( Gia_Man_t * p, Gia_Man_t *
 extern void                Gia_ManPrintNpnClasses( Gia_Man_t * p );
 extern void                Gia_ManDumpVerilog( Gia_Man_t * p, char * pFileName, Vec_Int_t * vObjs, int fVerBufs, int fInter, int fInterComb, int fAssign, int fReverse );
 extern void                Gia_ManDumpVerilogNand( Gia_Man_t * p, char * pFileName );
+/*=== giaLevel.c ===========================================================*/
+extern void                Gia_ManLevelIncStart( Gia_Man_t * p );
+extern void                Gia_ManLevelIncStop( Gia_Man_t * p );
+extern int                 Gia_ManLevelIncMax( Gia_Man_t * p );
+extern int                 Gia_ManLevelIncReverse( Gia_Man_t * p, int iObj );
+extern int                 Gia_ManLevelIncRequired( Gia_Man_t * p, int iObj );
+extern int                 Gia_ManLevelIncSlack( Gia_Man_t * p, int iObj );
+extern void                Gia_ManLevelIncUpdate( Gia_Man_t * p, int iObj );
+extern void                Gia_ManLevelIncUpdateR( Gia_Man_t * p, int iObj );
+extern void                Gia_ManLevelIncAddObj( Gia_Man_t * p, int iObj );
+extern void                Gia_ManLevelIncPatchFanin( Gia_Man_t * p, int iObj, int iFanin, int iLitNew );
+extern int                 Gia_ManLevelIncVerify( Gia_Man_t * p, int fVerbose );
 /*=== giaMem.c ===========================================================*/
 extern Gia_MmFixed_t *     Gia_MmFixedStart( int nEntrySize, int nEntriesMax );
 extern void                Gia_MmFixedStop( Gia_MmFixed_t * p, int fVerbose );
@@ -1567,6 +1653,20 @@ extern void                Gia_MmFlexStop( Gia_MmFlex_t * p, int fVerbose );
 extern char *              Gia_MmFlexEntryFetch( Gia_MmFlex_t * p, int nBytes );
 extern void                Gia_MmFlexRestart( Gia_MmFlex_t * p );
 extern int                 Gia_MmFlexReadMemUsage( Gia_MmFlex_t * p );
+extern void                Gia_MmFlexMark( Gia_MmFlex_t * p, Gia_MmFlexMark_t * pMark );
+extern void                Gia_MmFlexRelease( Gia_MmFlex_t * p, Gia_MmFlexMark_t * pMark );
+extern Gia_MmFlex_t *      Gia_ManArena( Gia_Man_t * p );
+extern void                Gia_ManArenaStop( Gia_Man_t * p );
+extern void                Gia_ManArenaReset( Gia_Man_t * p );
+extern void                Gia_ManArenaMark( Gia_Man_t * p, Gia_MmFlexMark_t * pMark );
+extern void                Gia_ManArenaRelease( Gia_Man_t * p, Gia_MmFlexMark_t * pMark );
+extern void *              Gia_ManArenaAlloc( Gia_Man_t * p, int nBytes );
+extern int                 Gia_ManArenaMemory( Gia_Man_t * p );
+extern Vec_Int_t *         Gia_ManArenaVecIntAlloc( Gia_Man_t * p, int nCap );
+extern Vec_Int_t *         Gia_ManArenaVecIntStart( Gia_Man_t * p, int nSize );
+extern void                Gia_ManArenaVecIntGrow( Gia_Man_t * p, Vec_Int_t * v );
+extern Vec_Wrd_t *         Gia_ManArenaVecWrdStart( Gia_Man_t * p, int nSize );
+static inline void         Gia_ManArenaVecIntPush( Gia_Man_t * p, Vec_Int_t * v, int Entry ) { if ( v->nSize == v->nCap ) Gia_ManArenaVecIntGrow( p, v ); v->pArray[v->nSize++] = Entry; }
 extern Gia_MmStep_t *      Gia_MmStepStart( int nSteps );
 extern void                Gia_MmStepStop( Gia_MmStep_t * p, int fVerbose );
 extern char *              Gia_MmStepEntryFetch( Gia_MmStep_t * p, int nBytes );
@@ -1589,8 +1689,20 @@ extern void                Gia_ManCountMuxXor( Gia_Man_t * p, int * pnMuxes, int
 extern void                Gia_ManPrintMuxStats( Gia_Man_t * p );
 extern Gia_Man_t *         Gia_ManDupMuxes( Gia_Man_t * p, int Limit );
 extern Gia_Man_t *         Gia_ManDupNoMuxes( Gia_Man_t * p, int fSkipBufs );
+/*=== giaPar.c ===========================================================*/
+extern Vec_Wec_t *         Gia_ManParGroupCos( Gia_Man_t * p, int nGroups );
+extern Gia_Man_t *         Gia_ManParTransform( Gia_Man_t * p, Vec_Wec_t * vGroups, Gia_ParFunc_t pFunc, void * pUser, int nThreads, int fVerbose );
+extern Gia_Man_t *         Gia_ManDupDfsPar( Gia_Man_t * p, int nGroups, int nThreads );
+extern Gia_Man_t *         Gia_ManBalancePar( Gia_Man_t * p, int fSimpleAnd, int fStrict, int nGroups, int nThreads, int fVerbose );
 /*=== giaPat.c ===========================================================*/
 extern void                Gia_SatVerifyPattern( Gia_Man_t * p, Gia_Obj_t * pRoot, Vec_Int_t * vCex, Vec_Int_t * vVisit );
+/*=== giaPatStore.c ===========================================================*/
+extern void                Gia_ManPatStoreStart( Gia_Man_t * p, int nPatsMax );
+extern void                Gia_ManPatStoreStop( Gia_Man_t * p );
+extern int                 Gia_ManPatStoreAdd( Gia_Man_t * p, Vec_Int_t * vLits );
+extern int                 Gia_ManPatStoreSameCis( Gia_Man_t * pNew, Gia_Man_t * pOld );
+extern void                Gia_ManPatStoreTransfer( Gia_Man_t * pNew, Gia_Man_t * pOld, int fSameCis );
+extern int                 Gia_ManPatStoreLoad( Gia_Man_t * p, int iPatStart, int nPats, word * pSims, int nWords, int iBitStart );
 /*=== giaRetime.c ===========================================================*/
 extern Gia_Man_t *         Gia_ManRetimeForward( Gia_Man_t * p, int nMaxIters, int fVerbose );
 /*=== giaSat.c ============================================================*/
@@ -1611,6 +1723,16 @@ extern Gia_Man_t *         Gia_ManMapShrink6( Gia_Man_t * p, int nFanoutMax, int
 extern Gia_Man_t *         Gia_ManExtractWindow( Gia_Man_t * p, int LevelMax, int nTimeWindow, int fVerbose );
 extern Gia_Man_t *         Gia_ManPerformSopBalanceWin( Gia_Man_t * p, int LevelMax, int nTimeWindow, int nCutNum, int nRelaxRatio, int fVerbose );
 extern Gia_Man_t *         Gia_ManPerformDsdBalanceWin( Gia_Man_t * p, int LevelMax, int nTimeWindow, int nLutSize, int nCutNum, int nRelaxRatio, int fVerbose );
+/*=== giaSnap.c ===========================================================*/
+extern int                 Gia_ManSnapWrite( Gia_Man_t * p, char * pFileName );
+extern int                 Gia_ManSnapIsFile( char * pFileName );
+extern Gia_Man_t *         Gia_ManSnapReadFromMemory( char * pContents, size_t nFileSize );
+extern Gia_Man_t *         Gia_ManSnapRead( char * pFileName );
+/*=== giaSoa.c ============================================================*/
+extern void                Gia_ManSoaStart( Gia_Man_t * p );
+extern void                Gia_ManSoaStop( Gia_Man_t * p, int fUpdate );
+extern void                Gia_ManSoaLoadValues( Gia_Man_t * p );
+extern void                Gia_ManSoaStoreValues( Gia_Man_t * p );
 /*=== giaSort.c ============================================================*/
 extern int *               Gia_SortFloats( float * pArray, int * pPerm, int nSize );
 /*=== giaSim.c ============================================================*/
@@ -1636,6 +1758,10 @@ extern int                 Gia_ManIncrSimCheckEqual( Gia_Man_t * p, int iLit0, i
 /*=== giaSimBase.c ============================================================*/
 extern Vec_Wrd_t *         Gia_ManSimPatSim( Gia_Man_t * p );
 extern Vec_Wrd_t *         Gia_ManSimPatSimOut( Gia_Man_t * pGia, Vec_Wrd_t * vSimsPi, int fOuts );
+extern Vec_Wrd_t *         Gia_ManSimPatSimIn( Gia_Man_t * pGia, Vec_Wrd_t * vSims, int fIns, Vec_Int_t * vAnds );
+extern Vec_Wrd_t *         Gia_ManSimPatSimC( Gia_Man_t * pGia, Vec_Wrd_t * vSims, Vec_Wrd_t * vSimsCiC );
+extern void                Gia_ManSimPatSimRange( Gia_Man_t * p, int nWords, Vec_Wrd_t * vSims, int wStart, int wStop );
+extern void                Gia_ManSimPatSimMt( Gia_Man_t * p, int nWords, Vec_Wrd_t * vSims, int nThreads );
 extern void                Gia_ManSim2ArrayOne( Vec_Wrd_t * vSimsPi, Vec_Int_t * vRes );
 extern Vec_Wec_t *         Gia_ManSim2Array( Vec_Ptr_t * vSims );
 extern Vec_Wrd_t *         Gia_ManArray2SimOne( Vec_Int_t * vRes );
@@ -21,8 +21,26 @@
 
 #include "gia.h"
 #include "misc/tim/tim.h"
+#include "misc/zlib/zlib.h"
 #include "base/main/main.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 #define XAIG_VERBOSE 0
@@ -31,6 +49,44 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define GIA_AIGER_GZ_BUFFER (1 << 16)
+
+// reader of a compressed AIGER file; the AND gates are decoded from
+// a small buffer, only the remaining text/extensions are kept in memory
+typedef struct Gia_AigerGz_t_ Gia_AigerGz_t;
+struct Gia_AigerGz_t_
+{
+    gzFile          File;       // the compressed file
+    unsigned char * pBuffer;    // the buffer of decompressed data
+    unsigned char * pCur;       // the current position in the buffer
+    unsigned char * pStop;      // the end of data in the buffer
+    Vec_Str_t *     vText;      // the header, the CO literals and the data after the AND gates
+};
+
+#define GIA_AIGER_OUT_BUFFER (1 << 20)
+#define GIA_AIGER_CHUNK      (1 << 16)
+#define GIA_AIGER_THR_MAX    100
+
+// buffered output into a plain or a compressed file
+typedef struct Gia_AigerOut_t_ Gia_AigerOut_t;
+struct Gia_AigerOut_t_
+{
+    FILE *          pFile;      // the plain file
+    gzFile          pGz;        // the compressed file
+    Vec_Str_t *     vBuffer;    // the data not written yet
+};
+
+// the range of objects encoded by one thread
+typedef struct Gia_AigerChunk_t_ Gia_AigerChunk_t;
+struct Gia_AigerChunk_t_
+{
+    Gia_Man_t *     p;          // the AIG
+    int             iStart;     // the first object
+    int             iStop;      // the object following the last one
+    unsigned char * pBuffer;    // the encoded AND gates
+    int             nBytes;     // the number of bytes used
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -83,6 +139,113 @@ void Gia_FileWriteBufferSize( FILE * pFile, int nSize )
     fwrite( Buffer, 1, 4, pFile );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Maps the file into memory.]
+
+  Description [The mapping is private and writable, because the reader
+  modifies the contents in place; only the touched pages are copied.
+  Returns NULL if the file cannot be mapped, in which case the caller
+  should read it into memory.  The file is not mapped if its size is
+  a multiple of the page size, to guarantee that the contents are
+  followed by a zero byte.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+char * Gia_FileMap( char * pFileName, size_t * pnFileSize )
+{
+#ifndef _WIN32
+    struct stat Stat;
+    char * pContents;
+    long nPageSize = sysconf( _SC_PAGESIZE );
+    int fd = open( pFileName, O_RDONLY );
+    if ( fd < 0 )
+        return NULL;
+    if ( fstat( fd, &Stat ) != 0 || Stat.st_size == 0 || (nPageSize > 0 && Stat.st_size % nPageSize == 0) )
+    {
+        close( fd );
+        return NULL;
+    }
+    pContents = (char *)mmap( NULL, (size_t)Stat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0 );
+    close( fd );
+    if ( pContents == (char *)MAP_FAILED )
+        return NULL;
+#ifdef MADV_SEQUENTIAL
+    madvise( pContents, (size_t)Stat.st_size, MADV_SEQUENTIAL );
+#endif
+    *pnFileSize = (size_t)Stat.st_size;
+    return pContents;
+#else
+    return NULL;
+#endif
+}
+void Gia_FileUnmap( char * pContents, size_t nFileSize )
+{
+#ifndef _WIN32
+    munmap( pContents, nFileSize );
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Streaming of the compressed AIGER file.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_AigerGzRefill( Gia_AigerGz_t * p )
+{
+    int nRead = gzread( p->File, p->pBuffer, GIA_AIGER_GZ_BUFFER );
+    p->pCur  = p->pBuffer;
+    p->pStop = p->pBuffer + Abc_MaxInt( nRead, 0 );
+    return nRead > 0;
+}
+static inline int Gia_AigerGzGetc( Gia_AigerGz_t * p )
+{
+    if ( p->pCur == p->pStop && !Gia_AigerGzRefill(p) )
+        return -1;
+    return *p->pCur++;
+}
+static inline unsigned Gia_AigerGzReadUnsigned( Gia_AigerGz_t * p )
+{
+    unsigned x = 0, i = 0;
+    int ch;
+    if ( p->pStop - p->pCur >= 5 ) // the longest encoding of a 32-bit number
+        return Gia_AigerReadUnsigned( &p->pCur );
+    while ( (ch = Gia_AigerGzGetc(p)) != -1 && (ch & 0x80) )
+        x |= (ch & 0x7f) << (7 * i++);
+    return ch == -1 ? x : x | (ch << (7 * i));
+}
+static int Gia_AigerGzReadLine( Gia_AigerGz_t * p )
+{
+    int ch;
+    while ( (ch = Gia_AigerGzGetc(p)) != -1 )
+    {
+        Vec_StrPush( p->vText, (char)ch );
+        if ( ch == '\n' )
+            return 1;
+    }
+    return 0;
+}
+static void Gia_AigerGzReadRest( Gia_AigerGz_t * p )
+{
+    do Vec_StrPushBuffer( p->vText, (char *)p->pCur, (int)(p->pStop - p->pCur) );
+    while ( Gia_AigerGzRefill(p) );
+}
+static inline void Gia_AigerGzTerminate( Gia_AigerGz_t * p )
+{
+    // keep a zero byte after the text, which the reader relies on
+    Vec_StrPush( p->vText, '\0' );
+    Vec_StrShrink( p->vText, Vec_StrSize(p->vText) - 1 );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Create the array of literals to be written.]
@@ -141,7 +304,7 @@ Vec_Str_t * Gia_AigerWriteLiterals( Vec_Int_t * vLits )
         Pos = Gia_AigerWriteUnsignedBuffer( (unsigned char *)Vec_StrArray(vBinary), Pos, Diff );
         LitPrev = Lit;
         if ( Pos + 10 > vBinary->nCap )
-            Vec_StrGrow( vBinary, vBinary->nCap+1 );
+            Vec_StrGrow( vBinary, 2 * vBinary->nCap + 10 );
     }
     vBinary->nSize = Pos;
 /*
@@ -173,7 +336,7 @@ Vec_Str_t * Gia_AigerWriteLiterals( Vec_Int_t * vLits )
   SeeAlso     []
 
 ***********************************************************************/
-Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck )
+static Gia_Man_t * Gia_AigerReadFromMemoryInt( char * pContents, size_t nFileSize, Gia_AigerGz_t * pGz, int fGiaSimple, int fSkipStrash, int fCheck )
 {
     Gia_Man_t * pNew, * pTemp;
     Vec_Ptr_t * vNamesIn = NULL, * vNamesOut = NULL, * vNamesRegIn = NULL, * vNamesRegOut = NULL, * vNamesNode = NULL;
@@ -289,8 +452,16 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
     for ( i = 0; i < nAnds; i++ )
     {
         uLit = ((i + 1 + nInputs + nLatches) << 1);
-        uLit1 = uLit  - Gia_AigerReadUnsigned( &pCur );
-        uLit0 = uLit1 - Gia_AigerReadUnsigned( &pCur );
+        if ( pGz )
+        {
+            uLit1 = uLit  - Gia_AigerGzReadUnsigned( pGz );
+            uLit0 = uLit1 - Gia_AigerGzReadUnsigned( pGz );
+        }
+        else
+        {
+            uLit1 = uLit  - Gia_AigerReadUnsigned( &pCur );
+            uLit0 = uLit1 - Gia_AigerReadUnsigned( &pCur );
+        }
 //        assert( uLit1 > uLit0 );
         iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), uLit0 & 1 );
         iNode1 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit1 >> 1), uLit1 & 1 );
@@ -308,6 +479,19 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
     if ( !fGiaSimple && !fSkipStrash )
         Gia_ManHashStop( pNew );
 
+    // append the data following the AND gates to the text of the compressed file
+    if ( pGz )
+    {
+        size_t iDrivers = pDrivers - (unsigned char *)pContents;
+        size_t iCur     = pCur     - (unsigned char *)pContents;
+        Gia_AigerGzReadRest( pGz );
+        Gia_AigerGzTerminate( pGz );
+        pContents = Vec_StrArray( pGz->vText );
+        nFileSize = (size_t)Vec_StrSize( pGz->vText );
+        pDrivers  = (unsigned char *)pContents + iDrivers;
+        pCur      = (unsigned char *)pContents + iCur;
+    }
+
     // remember the place where symbols begin
     pSymbols = pCur;
 
@@ -1013,29 +1197,123 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
 
   SeeAlso     []
 
+***********************************************************************/
+Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck )
+{
+    return Gia_AigerReadFromMemoryInt( pContents, (size_t)nFileSize, NULL, fGiaSimple, fSkipStrash, fCheck );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the AIG from the compressed file.]
+
+  Description [The header and the CO literals are read as text lines,
+  the AND gates are decoded while the file is decompressed, and only
+  the rest of the file (symbols, comments, extensions) is kept in memory.
+  The modified AIGER format with binary CO literals is decompressed
+  into memory as a whole.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Gia_AigerReadGz( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck )
+{
+    Gia_AigerGz_t Gz, * p = &Gz;
+    Gia_Man_t * pNew = NULL;
+    int i, nLines = 0, nNums[9] = {0}, nRead;
+    memset( p, 0, sizeof(Gia_AigerGz_t) );
+    p->File = gzopen( pFileName, "rb" );
+    if ( p->File == NULL )
+    {
+        printf( "Gia_AigerReadGz(): Cannot open input file \"%s\".\n", pFileName );
+        return NULL;
+    }
+    p->pBuffer = ABC_ALLOC( unsigned char, GIA_AIGER_GZ_BUFFER );
+    p->pCur = p->pStop = p->pBuffer;
+    p->vText = Vec_StrAlloc( 1 << 16 );
+    if ( !Gia_AigerGzReadLine(p) )
+        printf( "Gia_AigerReadGz(): The file \"%s\" is empty or truncated.\n", pFileName );
+    else if ( strncmp(Vec_StrArray(p->vText), "aig ", 4) )
+    {
+        Gia_AigerGzReadRest( p );
+        Gia_AigerGzTerminate( p );
+        pNew = Gia_AigerReadFromMemoryInt( Vec_StrArray(p->vText), (size_t)Vec_StrSize(p->vText), NULL, fGiaSimple, fSkipStrash, fCheck );
+    }
+    else
+    {
+        // the number of CO literals is L + O + B + C + J + F
+        Gia_AigerGzTerminate( p );
+        nRead = sscanf( Vec_StrArray(p->vText), "aig %d %d %d %d %d %d %d %d %d", nNums, nNums+1, nNums+2, nNums+3, nNums+4, nNums+5, nNums+6, nNums+7, nNums+8 );
+        for ( i = 2; i < nRead; i++ )
+            if ( i != 4 )
+                nLines += nNums[i];
+        for ( i = 0; i < nLines; i++ )
+            if ( !Gia_AigerGzReadLine(p) )
+                break;
+        Gia_AigerGzTerminate( p );
+        if ( i < nLines )
+            printf( "Gia_AigerReadGz(): The file \"%s\" is truncated.\n", pFileName );
+        else
+            pNew = Gia_AigerReadFromMemoryInt( Vec_StrArray(p->vText), (size_t)Vec_StrSize(p->vText), p, fGiaSimple, fSkipStrash, fCheck );
+    }
+    gzclose( p->File );
+    ABC_FREE( p->pBuffer );
+    Vec_StrFree( p->vText );
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the AIG in the binary AIGER format.]
+
+  Description [Files ending in ".gz" are decompressed on the fly.
+  Other files are mapped into memory, if possible, which avoids
+  copying the contents into a separate buffer.]
+
+  SideEffects []
+
+  SeeAlso     []
+
 ***********************************************************************/
 Gia_Man_t * Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck )
 {
     FILE * pFile;
     Gia_Man_t * pNew;
     char * pName, * pContents;
-    int nFileSize;
-    int RetValue;
+    size_t nFileSize = 0;
+    int fGzip, RetValue;
 
     // read the file into the buffer
     Gia_FileFixName( pFileName );
-    nFileSize = Gia_FileSize( pFileName );
-    pFile = fopen( pFileName, "rb" );
-    pContents = ABC_ALLOC( char, nFileSize );
-    RetValue = fread( pContents, nFileSize, 1, pFile );
-    fclose( pFile );
-
-    pNew = Gia_AigerReadFromMemory( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck );
-    ABC_FREE( pContents );
+    fGzip = strlen(pFileName) > 3 && !strcmp(pFileName + strlen(pFileName) - 3, ".gz");
+    if ( fGzip )
+        pNew = Gia_AigerReadGz( pFileName, fGiaSimple, fSkipStrash, fCheck );
+    else if ( (pContents = Gia_FileMap( pFileName, &nFileSize )) )
+    {
+        pNew = Gia_AigerReadFromMemoryInt( pContents, nFileSize, NULL, fGiaSimple, fSkipStrash, fCheck );
+        Gia_FileUnmap( pContents, nFileSize );
+    }
+    else
+    {
+        nFileSize = (size_t)Gia_FileSize( pFileName );
+        pFile = fopen( pFileName, "rb" );
+        if ( pFile == NULL )
+            return NULL;
+        pContents = ABC_ALLOC( char, nFileSize + 1 );
+        RetValue = fread( pContents, nFileSize, 1, pFile );
+        pContents[nFileSize] = 0;
+        fclose( pFile );
+        pNew = Gia_AigerReadFromMemoryInt( pContents, nFileSize, NULL, fGiaSimple, fSkipStrash, fCheck );
+        ABC_FREE( pContents );
+    }
     if ( pNew )
     {
         ABC_FREE( pNew->pName );
         pName = Gia_FileNameGeneric( pFileName );
+        if ( fGzip && strrchr(pName, '.') )
+            *strrchr(pName, '.') = 0;
         pNew->pName = Abc_UtilStrsav( pName );
         ABC_FREE( pName );
 
@@ -1208,25 +1486,195 @@ Vec_Str_t * Gia_AigerWriteIntoMemoryStrPart( Gia_Man_t * p, Vec_Int_t * vCis, Ve
 
 /**Function*************************************************************
 
-  Synopsis    [Writes the AIG in the binary AIGER format.]
+  Synopsis    [Buffered output into a plain or a compressed file.]
 
   Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Gia_AigerOut_t * Gia_AigerOutStart( char * pFileName )
+{
+    Gia_AigerOut_t * p;
+    FILE * pFile = NULL;
+    gzFile pGz = NULL;
+    int nLength = strlen( pFileName );
+    if ( nLength > 3 && !strcmp(pFileName + nLength - 3, ".gz") )
+        pGz = gzopen( pFileName, "wb" );
+    else
+        pFile = fopen( pFileName, "wb" );
+    if ( pFile == NULL && pGz == NULL )
+        return NULL;
+    p = ABC_CALLOC( Gia_AigerOut_t, 1 );
+    p->pFile   = pFile;
+    p->pGz     = pGz;
+    p->vBuffer = Vec_StrAlloc( GIA_AIGER_OUT_BUFFER );
+    return p;
+}
+static void Gia_AigerOutWriteDirect( Gia_AigerOut_t * p, char * pData, size_t nSize )
+{
+    if ( p->pFile )
+        fwrite( pData, 1, nSize, p->pFile );
+    else while ( nSize > 0 )
+    {
+        unsigned nPart = nSize > (1 << 30) ? (1 << 30) : (unsigned)nSize;
+        gzwrite( p->pGz, pData, nPart );
+        pData += nPart;
+        nSize -= nPart;
+    }
+}
+static void Gia_AigerOutFlush( Gia_AigerOut_t * p )
+{
+    Gia_AigerOutWriteDirect( p, Vec_StrArray(p->vBuffer), (size_t)Vec_StrSize(p->vBuffer) );
+    Vec_StrClear( p->vBuffer );
+}
+static void Gia_AigerOutWrite( Gia_AigerOut_t * p, void * pData, size_t nSize )
+{
+    if ( Vec_StrSize(p->vBuffer) + nSize > GIA_AIGER_OUT_BUFFER )
+        Gia_AigerOutFlush( p );
+    if ( nSize >= GIA_AIGER_OUT_BUFFER )
+        Gia_AigerOutWriteDirect( p, (char *)pData, nSize );
+    else
+        Vec_StrPushBuffer( p->vBuffer, (char *)pData, (int)nSize );
+}
+static void Gia_AigerOutPrintf( Gia_AigerOut_t * p, const char * pFormat, ... )
+{
+    char Buffer[1000], * pBuffer = Buffer;
+    int nSize;
+    va_list args;
+    va_start( args, pFormat );
+    nSize = vsnprintf( Buffer, sizeof(Buffer), pFormat, args );
+    va_end( args );
+    if ( nSize >= (int)sizeof(Buffer) )
+    {
+        pBuffer = ABC_ALLOC( char, nSize + 1 );
+        va_start( args, pFormat );
+        vsnprintf( pBuffer, nSize + 1, pFormat, args );
+        va_end( args );
+    }
+    Gia_AigerOutWrite( p, pBuffer, (size_t)nSize );
+    if ( pBuffer != Buffer )
+        ABC_FREE( pBuffer );
+}
+static void Gia_AigerOutWriteSize( Gia_AigerOut_t * p, int nSize )
+{
+    unsigned char Buffer[5];
+    Gia_AigerWriteInt( Buffer, nSize );
+    Gia_AigerOutWrite( p, Buffer, 4 );
+}
+static void Gia_AigerOutStop( Gia_AigerOut_t * p )
+{
+    Gia_AigerOutFlush( p );
+    if ( p->pFile )
+        fclose( p->pFile );
+    else
+        gzclose( p->pGz );
+    Vec_StrFree( p->vBuffer );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Encodes the AND gates in chunks using several threads.]
+
+  Description [Each chunk covers a range of object IDs.  Because the deltas
+  are computed relative to the node's own literal, the chunks are encoded
+  independently and written in order, which gives the same output as
+  the sequential encoding.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void * Gia_AigerEncodeChunk( void * pArg )
+{
+    Gia_AigerChunk_t * pChunk = (Gia_AigerChunk_t *)pArg;
+    Gia_Man_t * p = pChunk->p;
+    Gia_Obj_t * pObj;
+    unsigned uLit0, uLit1, uLit;
+    int i, Pos = 0;
+    for ( i = pChunk->iStart; i < pChunk->iStop; i++ )
+    {
+        pObj = Gia_ManObj( p, i );
+        if ( !Gia_ObjIsAnd(pObj) )
+            continue;
+        uLit  = Abc_Var2Lit( i, 0 );
+        uLit0 = Gia_ObjFaninLit0( pObj, i );
+        uLit1 = Gia_ObjFaninLit1( pObj, i );
+        assert( p->fGiaSimple || Gia_ManBufNum(p) || uLit0 < uLit1 );
+        Pos = Gia_AigerWriteUnsignedBuffer( pChunk->pBuffer, Pos, uLit  - uLit1 );
+        Pos = Gia_AigerWriteUnsignedBuffer( pChunk->pBuffer, Pos, uLit1 - uLit0 );
+    }
+    pChunk->nBytes = Pos;
+    return NULL;
+}
+static void Gia_AigerWriteAnds( Gia_Man_t * p, Gia_AigerOut_t * pOut, int nThreads )
+{
+    Gia_AigerChunk_t Chunks[GIA_AIGER_THR_MAX];
+    int i, k, nChunks, iObj = 1 + Gia_ManCiNum(p), nObjs = Gia_ManObjNum(p) - Gia_ManCoNum(p);
+    nThreads = Abc_MaxInt( 1, Abc_MinInt(nThreads, GIA_AIGER_THR_MAX) );
+    nThreads = Abc_MinInt( nThreads, Abc_MaxInt(1, (nObjs - iObj + GIA_AIGER_CHUNK - 1) / GIA_AIGER_CHUNK) );
+    // each object produces at most two 5-byte numbers
+    for ( k = 0; k < nThreads; k++ )
+    {
+        Chunks[k].p = p;
+        Chunks[k].pBuffer = ABC_ALLOC( unsigned char, 10 * GIA_AIGER_CHUNK );
+    }
+    while ( iObj < nObjs )
+    {
+        for ( nChunks = 0; nChunks < nThreads && iObj < nObjs; nChunks++, iObj += GIA_AIGER_CHUNK )
+        {
+            Chunks[nChunks].iStart = iObj;
+            Chunks[nChunks].iStop  = Abc_MinInt( iObj + GIA_AIGER_CHUNK, nObjs );
+        }
+#ifdef ABC_USE_PTHREADS
+        if ( nChunks > 1 )
+        {
+            pthread_t WorkerThread[GIA_AIGER_THR_MAX];
+            int status;
+            for ( k = 1; k < nChunks; k++ )
+            {
+                status = pthread_create( WorkerThread + k, NULL, Gia_AigerEncodeChunk, (void *)(Chunks + k) );
+                assert( status == 0 );
+            }
+            Gia_AigerEncodeChunk( (void *)Chunks );
+            for ( k = 1; k < nChunks; k++ )
+                pthread_join( WorkerThread[k], NULL );
+        }
+        else
+#endif
+        for ( k = 0; k < nChunks; k++ )
+            Gia_AigerEncodeChunk( (void *)(Chunks + k) );
+        for ( k = 0; k < nChunks; k++ )
+            Gia_AigerOutWrite( pOut, Chunks[k].pBuffer, (size_t)Chunks[k].nBytes );
+    }
+    for ( i = 0; i < nThreads; i++ )
+        ABC_FREE( Chunks[i].pBuffer );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the AIG in the binary AIGER format.]
+
+  Description [The AND gates are encoded by several threads.  If the file
+  name ends in ".gz", the output is compressed while it is written.]
   
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int fCompact, int fWriteNewLine, int fSkipComment )
+void Gia_AigerWriteMt( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int fCompact, int fWriteNewLine, int fSkipComment, int nThreads )
 {
     int fVerbose = XAIG_VERBOSE;
-    FILE * pFile;
+    Gia_AigerOut_t * pOut;
     Gia_Man_t * p;
     Gia_Obj_t * pObj;
     Vec_Str_t * vStrExt;
-    int i, nBufferSize, Pos;
-    unsigned char * pBuffer;
-    unsigned uLit0, uLit1, uLit;
+    int i;
     assert( pInit->nXors == 0 && pInit->nMuxes == 0 );
 
     if ( Gia_ManCoNum(pInit) == 0 )
@@ -1236,8 +1684,8 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
     }
 
     // start the output stream
-    pFile = fopen( pFileName, "wb" );
-    if ( pFile == NULL )
+    pOut = Gia_AigerOutStart( pFileName );
+    if ( pOut == NULL )
     {
         fprintf( stdout, "Gia_AigerWrite(): Cannot open the output file \"%s\".\n", pFileName );
         return;
@@ -1257,7 +1705,7 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
         p = pInit;
 
     // write the header "M I L O A" where M = I + L + A
-    fprintf( pFile, "aig%s %u %u %u %u %u", 
+    Gia_AigerOutPrintf( pOut, "aig%s %u %u %u %u %u", 
         fCompact? "2" : "",
         Gia_ManCiNum(p) + Gia_ManAndNum(p), 
         Gia_ManPiNum(p),
@@ -1266,55 +1714,31 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
         Gia_ManAndNum(p) );
     // write the extended header "B C J F"
     if ( Gia_ManConstrNum(p) )
-        fprintf( pFile, " %u %u", Gia_ManPoNum(p) - Gia_ManConstrNum(p), Gia_ManConstrNum(p) );
-    fprintf( pFile, "\n" ); 
+        Gia_AigerOutPrintf( pOut, " %u %u", Gia_ManPoNum(p) - Gia_ManConstrNum(p), Gia_ManConstrNum(p) );
+    Gia_AigerOutPrintf( pOut, "\n" ); 
 
     Gia_ManInvertConstraints( p );
     if ( !fCompact ) 
     {
         // write latch drivers
         Gia_ManForEachRi( p, pObj, i )
-            fprintf( pFile, "%u\n", Gia_ObjFaninLit0p(p, pObj) );
+            Gia_AigerOutPrintf( pOut, "%u\n", Gia_ObjFaninLit0p(p, pObj) );
         // write PO drivers
         Gia_ManForEachPo( p, pObj, i )
-            fprintf( pFile, "%u\n", Gia_ObjFaninLit0p(p, pObj) );
+            Gia_AigerOutPrintf( pOut, "%u\n", Gia_ObjFaninLit0p(p, pObj) );
     }
     else
     {
         Vec_Int_t * vLits = Gia_AigerCollectLiterals( p );
         Vec_Str_t * vBinary = Gia_AigerWriteLiterals( vLits );
-        fwrite( Vec_StrArray(vBinary), 1, Vec_StrSize(vBinary), pFile );
+        Gia_AigerOutWrite( pOut, Vec_StrArray(vBinary), Vec_StrSize(vBinary) );
         Vec_StrFree( vBinary );
         Vec_IntFree( vLits );
     }
     Gia_ManInvertConstraints( p );
 
-    // write the nodes into the buffer
-    Pos = 0;
-    nBufferSize = 8 * Gia_ManAndNum(p) + 100; // skeptically assuming 3 chars per one AIG edge
-    pBuffer = ABC_ALLOC( unsigned char, nBufferSize );
-    Gia_ManForEachAnd( p, pObj, i )
-    {
-        uLit  = Abc_Var2Lit( i, 0 );
-        uLit0 = Gia_ObjFaninLit0( pObj, i );
-        uLit1 = Gia_ObjFaninLit1( pObj, i );
-        assert( p->fGiaSimple || Gia_ManBufNum(p) || uLit0 < uLit1 );
-        Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit  - uLit1 );
-        Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit1 - uLit0 );
-        if ( Pos > nBufferSize - 10 )
-        {
-            printf( "Gia_AigerWrite(): AIGER generation has failed because the allocated buffer is too small.\n" );
-            fclose( pFile );
-            if ( p != pInit )
-                Gia_ManStop( p );
-            return;
-        }
-    }
-    assert( Pos < nBufferSize );
-
-    // write the buffer
-    fwrite( pBuffer, 1, Pos, pFile );
-    ABC_FREE( pBuffer );
+    // write the nodes
+    Gia_AigerWriteAnds( p, pOut, nThreads );
 
     // write the symbol table
     if ( p->vNamesIn && p->vNamesOut )
@@ -1323,13 +1747,13 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
         assert( Vec_PtrSize(p->vNamesOut) == Gia_ManCoNum(p) );
         // write PIs
         Gia_ManForEachPi( p, pObj, i )
-            fprintf( pFile, "i%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesIn, i) );
+            Gia_AigerOutPrintf( pOut, "i%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesIn, i) );
         // write latches
         Gia_ManForEachRo( p, pObj, i )
-            fprintf( pFile, "l%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesIn, Gia_ManPiNum(p) + i) );
+            Gia_AigerOutPrintf( pOut, "l%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesIn, Gia_ManPiNum(p) + i) );
         // write POs
         Gia_ManForEachPo( p, pObj, i )
-            fprintf( pFile, "o%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesOut, i) );
+            Gia_AigerOutPrintf( pOut, "o%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesOut, i) );
     }
     if ( p->vNamesNode && Vec_PtrSize(p->vNamesNode) != Gia_ManObjNum(p) )
         Abc_Print( 0, "The size of the node name array does not match the number of objects. Names are not written.\n" );
@@ -1337,38 +1761,38 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
     {
         Gia_ManForEachAnd( p, pObj, i )
             if ( Vec_PtrEntry(p->vNamesNode, i) )
-                fprintf( pFile, "n%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesNode, i) );
+                Gia_AigerOutPrintf( pOut, "n%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesNode, i) );
     }
 
     // write the comment
     if ( fWriteNewLine ) 
-        fprintf( pFile, "c\n" );
+        Gia_AigerOutPrintf( pOut, "c\n" );
     else
-        fprintf( pFile, "c" );
+        Gia_AigerOutPrintf( pOut, "c" );
 
     // write additional AIG
     if ( p->pAigExtra )
     {
-        fprintf( pFile, "a" );
+        Gia_AigerOutPrintf( pOut, "a" );
         vStrExt = Gia_AigerWriteIntoMemoryStr( p->pAigExtra );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerOutWriteSize( pOut, Vec_StrSize(vStrExt) );
+        Gia_AigerOutWrite( pOut, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
         if ( fVerbose ) printf( "Finished writing extension \"a\".\n" );
     }
     // write constraints
     if ( p->nConstrs )
     {
-        fprintf( pFile, "c" );
-        Gia_FileWriteBufferSize( pFile, 4 );
-        Gia_FileWriteBufferSize( pFile, p->nConstrs );
+        Gia_AigerOutPrintf( pOut, "c" );
+        Gia_AigerOutWriteSize( pOut, 4 );
+        Gia_AigerOutWriteSize( pOut, p->nConstrs );
     }
     // write timing information
     if ( p->nAnd2Delay )
     {
-        fprintf( pFile, "d" );
-        Gia_FileWriteBufferSize( pFile, 4 );
-        Gia_FileWriteBufferSize( pFile, p->nAnd2Delay );
+        Gia_AigerOutPrintf( pOut, "d" );
+        Gia_AigerOutWriteSize( pOut, 4 );
+        Gia_AigerOutWriteSize( pOut, p->nAnd2Delay );
     }
     if ( p->pManTime )
     {
@@ -1376,18 +1800,18 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
         pTimes = Tim_ManGetArrTimes( (Tim_Man_t *)p->pManTime );
         if ( pTimes )
         {
-            fprintf( pFile, "i" );
-            Gia_FileWriteBufferSize( pFile, 4*Tim_ManPiNum((Tim_Man_t *)p->pManTime) );
-            fwrite( pTimes, 1, 4*Tim_ManPiNum((Tim_Man_t *)p->pManTime), pFile );
+            Gia_AigerOutPrintf( pOut, "i" );
+            Gia_AigerOutWriteSize( pOut, 4*Tim_ManPiNum((Tim_Man_t *)p->pManTime) );
+            Gia_AigerOutWrite( pOut, pTimes, 4*Tim_ManPiNum((Tim_Man_t *)p->pManTime) );
             ABC_FREE( pTimes );
             if ( fVerbose ) printf( "Finished writing extension \"i\".\n" );
         }
         pTimes = Tim_ManGetReqTimes( (Tim_Man_t *)p->pManTime );
         if ( pTimes )
         {
-            fprintf( pFile, "o" );
-            Gia_FileWriteBufferSize( pFile, 4*Tim_ManPoNum((Tim_Man_t *)p->pManTime) );
-            fwrite( pTimes, 1, 4*Tim_ManPoNum((Tim_Man_t *)p->pManTime), pFile );
+            Gia_AigerOutPrintf( pOut, "o" );
+            Gia_AigerOutWriteSize( pOut, 4*Tim_ManPoNum((Tim_Man_t *)p->pManTime) );
+            Gia_AigerOutWrite( pOut, pTimes, 4*Tim_ManPoNum((Tim_Man_t *)p->pManTime) );
             ABC_FREE( pTimes );
             if ( fVerbose ) printf( "Finished writing extension \"o\".\n" );
         }
@@ -1396,35 +1820,35 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
     if ( p->pReprs && p->pNexts )
     {
         extern Vec_Str_t * Gia_WriteEquivClasses( Gia_Man_t * p );
-        fprintf( pFile, "e" );
+        Gia_AigerOutPrintf( pOut, "e" );
         vStrExt = Gia_WriteEquivClasses( p );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerOutWriteSize( pOut, Vec_StrSize(vStrExt) );
+        Gia_AigerOutWrite( pOut, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
     }
     // write flop classes
     if ( p->vFlopClasses )
     {
-        fprintf( pFile, "f" );
-        Gia_FileWriteBufferSize( pFile, 4*Gia_ManRegNum(p) );
+        Gia_AigerOutPrintf( pOut, "f" );
+        Gia_AigerOutWriteSize( pOut, 4*Gia_ManRegNum(p) );
         assert( Vec_IntSize(p->vFlopClasses) == Gia_ManRegNum(p) );
-        fwrite( Vec_IntArray(p->vFlopClasses), 1, 4*Gia_ManRegNum(p), pFile );
+        Gia_AigerOutWrite( pOut, Vec_IntArray(p->vFlopClasses), 4*Gia_ManRegNum(p) );
     }
     // write gate classes
     if ( p->vGateClasses )
     {
-        fprintf( pFile, "g" );
-        Gia_FileWriteBufferSize( pFile, 4*Gia_ManObjNum(p) );
+        Gia_AigerOutPrintf( pOut, "g" );
+        Gia_AigerOutWriteSize( pOut, 4*Gia_ManObjNum(p) );
         assert( Vec_IntSize(p->vGateClasses) == Gia_ManObjNum(p) );
-        fwrite( Vec_IntArray(p->vGateClasses), 1, 4*Gia_ManObjNum(p), pFile );
+        Gia_AigerOutWrite( pOut, Vec_IntArray(p->vGateClasses), 4*Gia_ManObjNum(p) );
     }
     // write hierarchy info
     if ( p->pManTime )
     {
-        fprintf( pFile, "h" );
+        Gia_AigerOutPrintf( pOut, "h" );
         vStrExt = Tim_ManSave( (Tim_Man_t *)p->pManTime, 1 );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerOutWriteSize( pOut, Vec_StrSize(vStrExt) );
+        Gia_AigerOutWrite( pOut, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
         if ( fVerbose ) printf( "Finished writing extension \"h\".\n" );
     }
@@ -1432,10 +1856,10 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
     if ( p->vPacking )
     {
         extern Vec_Str_t * Gia_WritePacking( Vec_Int_t * vPacking );
-        fprintf( pFile, "k" );
+        Gia_AigerOutPrintf( pOut, "k" );
         vStrExt = Gia_WritePacking( p->vPacking );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerOutWriteSize( pOut, Vec_StrSize(vStrExt) );
+        Gia_AigerOutWrite( pOut, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
         if ( fVerbose ) printf( "Finished writing extension \"k\".\n" );
     }
@@ -1444,11 +1868,11 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
     {
         Vec_Int_t * vPairs = Gia_ManEdgeToArray( p );
         int i;
-        fprintf( pFile, "w" );
-        Gia_FileWriteBufferSize( pFile, 4*(Vec_IntSize(vPairs)+1) );
-        Gia_FileWriteBufferSize( pFile, Vec_IntSize(vPairs)/2 );
+        Gia_AigerOutPrintf( pOut, "w" );
+        Gia_AigerOutWriteSize( pOut, 4*(Vec_IntSize(vPairs)+1) );
+        Gia_AigerOutWriteSize( pOut, Vec_IntSize(vPairs)/2 );
         for ( i = 0; i < Vec_IntSize(vPairs); i++ )
-            Gia_FileWriteBufferSize( pFile, Vec_IntEntry(vPairs, i) );
+            Gia_AigerOutWriteSize( pOut, Vec_IntEntry(vPairs, i) );
         Vec_IntFree( vPairs );
     }
     // write mapping
@@ -1457,10 +1881,10 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
         extern Vec_Str_t * Gia_AigerWriteMapping( Gia_Man_t * p );
         extern Vec_Str_t * Gia_AigerWriteMappingSimple( Gia_Man_t * p );
         extern Vec_Str_t * Gia_AigerWriteMappingDoc( Gia_Man_t * p );
-        fprintf( pFile, "m" );
+        Gia_AigerOutPrintf( pOut, "m" );
         vStrExt = Gia_AigerWriteMappingDoc( p );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerOutWriteSize( pOut, Vec_StrSize(vStrExt) );
+        Gia_AigerOutWrite( pOut, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
         if ( fVerbose ) printf( "Finished writing extension \"m\".\n" );
     }
@@ -1468,10 +1892,10 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
     if ( Gia_ManHasCellMapping(p) )
     {
         extern Vec_Str_t * Gia_AigerWriteCellMappingDoc( Gia_Man_t * p );
-        fprintf( pFile, "M" );
+        Gia_AigerOutPrintf( pOut, "M" );
         vStrExt = Gia_AigerWriteCellMappingDoc( p );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerOutWriteSize( pOut, Vec_StrSize(vStrExt) );
+        Gia_AigerOutWrite( pOut, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
         if ( fVerbose ) printf( "Finished writing extension \"M\".\n" );
 
@@ -1479,101 +1903,101 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
     // write placement
     if ( p->pPlacement )
     {
-        fprintf( pFile, "p" );
-        Gia_FileWriteBufferSize( pFile, 4*Gia_ManObjNum(p) );
-        fwrite( p->pPlacement, 1, 4*Gia_ManObjNum(p), pFile );
+        Gia_AigerOutPrintf( pOut, "p" );
+        Gia_AigerOutWriteSize( pOut, 4*Gia_ManObjNum(p) );
+        Gia_AigerOutWrite( pOut, p->pPlacement, 4*Gia_ManObjNum(p) );
     }
     // write register classes
     if ( p->vRegClasses )
     {
         int i;
-        fprintf( pFile, "r" );
-        Gia_FileWriteBufferSize( pFile, 4*(Vec_IntSize(p->vRegClasses)+1) );
-        Gia_FileWriteBufferSize( pFile, Vec_IntSize(p->vRegClasses) );
+        Gia_AigerOutPrintf( pOut, "r" );
+        Gia_AigerOutWriteSize( pOut, 4*(Vec_IntSize(p->vRegClasses)+1) );
+        Gia_AigerOutWriteSize( pOut, Vec_IntSize(p->vRegClasses) );
         for ( i = 0; i < Vec_IntSize(p->vRegClasses); i++ )
-            Gia_FileWriteBufferSize( pFile, Vec_IntEntry(p->vRegClasses, i) );
+            Gia_AigerOutWriteSize( pOut, Vec_IntEntry(p->vRegClasses, i) );
     }
     // write register inits
     if ( p->vRegInits )
     {
         int i;
-        fprintf( pFile, "s" );
-        Gia_FileWriteBufferSize( pFile, 4*(Vec_IntSize(p->vRegInits)+1) );
-        Gia_FileWriteBufferSize( pFile, Vec_IntSize(p->vRegInits) );
+        Gia_AigerOutPrintf( pOut, "s" );
+        Gia_AigerOutWriteSize( pOut, 4*(Vec_IntSize(p->vRegInits)+1) );
+        Gia_AigerOutWriteSize( pOut, Vec_IntSize(p->vRegInits) );
         for ( i = 0; i < Vec_IntSize(p->vRegInits); i++ )
-            Gia_FileWriteBufferSize( pFile, Vec_IntEntry(p->vRegInits, i) );
+            Gia_AigerOutWriteSize( pOut, Vec_IntEntry(p->vRegInits, i) );
     }
     // write configuration data
     if ( p->vConfigs )
     {
-        fprintf( pFile, "b" );
+        Gia_AigerOutPrintf( pOut, "b" );
         assert( p->pCellStr != NULL );
-        Gia_FileWriteBufferSize( pFile, 4*Vec_IntSize(p->vConfigs) + strlen(p->pCellStr) + 1 );
-        fwrite( p->pCellStr, 1, strlen(p->pCellStr) + 1, pFile );
-//        fwrite( Vec_IntArray(p->vConfigs), 1, 4*Vec_IntSize(p->vConfigs), pFile );
+        Gia_AigerOutWriteSize( pOut, 4*Vec_IntSize(p->vConfigs) + strlen(p->pCellStr) + 1 );
+        Gia_AigerOutWrite( pOut, p->pCellStr, strlen(p->pCellStr) + 1 );
+//        Gia_AigerOutWrite( pOut, Vec_IntArray(p->vConfigs), 4*Vec_IntSize(p->vConfigs) );
         for ( i = 0; i < Vec_IntSize(p->vConfigs); i++ )
-            Gia_FileWriteBufferSize( pFile, Vec_IntEntry(p->vConfigs, i) );
+            Gia_AigerOutWriteSize( pOut, Vec_IntEntry(p->vConfigs, i) );
     }
     // write choices
     if ( Gia_ManHasChoices(p) )
     {
         int i, nPairs = 0;
-        fprintf( pFile, "q" );
+        Gia_AigerOutPrintf( pOut, "q" );
         for ( i = 0; i < Gia_ManObjNum(p); i++ )
             nPairs += (Gia_ObjSibl(p, i) > 0);
-        Gia_FileWriteBufferSize( pFile, 4*(nPairs * 2 + 1) );
-        Gia_FileWriteBufferSize( pFile, nPairs );
+        Gia_AigerOutWriteSize( pOut, 4*(nPairs * 2 + 1) );
+        Gia_AigerOutWriteSize( pOut, nPairs );
         for ( i = 0; i < Gia_ManObjNum(p); i++ )
             if ( Gia_ObjSibl(p, i) )
             {
                 assert( i > Gia_ObjSibl(p, i) );
-                Gia_FileWriteBufferSize( pFile, i );
-                Gia_FileWriteBufferSize( pFile, Gia_ObjSibl(p, i) );
+                Gia_AigerOutWriteSize( pOut, i );
+                Gia_AigerOutWriteSize( pOut, Gia_ObjSibl(p, i) );
             }
         if ( fVerbose ) printf( "Finished writing extension \"q\".\n" );
     }
     // write switching activity
     if ( p->pSwitching )
     {
-        fprintf( pFile, "u" );
-        Gia_FileWriteBufferSize( pFile, Gia_ManObjNum(p) );
-        fwrite( p->pSwitching, 1, Gia_ManObjNum(p), pFile );
+        Gia_AigerOutPrintf( pOut, "u" );
+        Gia_AigerOutWriteSize( pOut, Gia_ManObjNum(p) );
+        Gia_AigerOutWrite( pOut, p->pSwitching, Gia_ManObjNum(p) );
     }
 /*
     // write timing information
     if ( p->pManTime )
     {
-        fprintf( pFile, "t" );
+        Gia_AigerOutPrintf( pOut, "t" );
         vStrExt = Tim_ManSave( (Tim_Man_t *)p->pManTime, 0 );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerOutWriteSize( pOut, Vec_StrSize(vStrExt) );
+        Gia_AigerOutWrite( pOut, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
     }
 */
     // write object classes
     if ( p->vObjClasses )
     {
-        fprintf( pFile, "v" );
-        Gia_FileWriteBufferSize( pFile, 4*Gia_ManObjNum(p) );
+        Gia_AigerOutPrintf( pOut, "v" );
+        Gia_AigerOutWriteSize( pOut, 4*Gia_ManObjNum(p) );
         assert( Vec_IntSize(p->vObjClasses) == Gia_ManObjNum(p) );
-        fwrite( Vec_IntArray(p->vObjClasses), 1, 4*Gia_ManObjNum(p), pFile );
+        Gia_AigerOutWrite( pOut, Vec_IntArray(p->vObjClasses), 4*Gia_ManObjNum(p) );
     }
     // write name
     if ( p->pName )
     {
-        fprintf( pFile, "n" );
-        Gia_FileWriteBufferSize( pFile, strlen(p->pName)+1 );
-        fwrite( p->pName, 1, strlen(p->pName), pFile );
-        fprintf( pFile, "%c", '\0' );
+        Gia_AigerOutPrintf( pOut, "n" );
+        Gia_AigerOutWriteSize( pOut, strlen(p->pName)+1 );
+        Gia_AigerOutWrite( pOut, p->pName, strlen(p->pName) );
+        Gia_AigerOutPrintf( pOut, "%c", '\0' );
     }
     // write comments
     if ( fWriteNewLine )
-        fprintf( pFile, "c\n" );
+        Gia_AigerOutPrintf( pOut, "c\n" );
     if ( !fSkipComment ) {
-        fprintf( pFile, "\nThis file was produced by the GIA package in ABC on %s\n", Gia_TimeStamp() );
-        fprintf( pFile, "For information about AIGER format, refer to %s\n", "http://fmv.jku.at/aiger" );
+        Gia_AigerOutPrintf( pOut, "\nThis file was produced by the GIA package in ABC on %s\n", Gia_TimeStamp() );
+        Gia_AigerOutPrintf( pOut, "For information about AIGER format, refer to %s\n", "http://fmv.jku.at/aiger" );
     }
-    fclose( pFile );
+    Gia_AigerOutStop( pOut );
     if ( p != pInit )
     {
         Gia_ManTransferTiming( pInit, p );
@@ -1581,6 +2005,22 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
     }
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Writes the AIG in the binary AIGER format.]
+
+  Description []
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int fCompact, int fWriteNewLine, int fSkipComment )
+{
+    Gia_AigerWriteMt( pInit, pFileName, fWriteSymbols, fCompact, fWriteNewLine, fSkipComment, 1 );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Writes the AIG in the binary AIGER format.]
@@ -74,12 +74,12 @@ void Gia_ManFanoutStart( Gia_Man_t * p )
         p->nFansAlloc = (1<<12);
     p->pFanData = ABC_ALLOC( int, 5 * p->nFansAlloc );
     memset( p->pFanData, 0, sizeof(int) * 5 * p->nFansAlloc );
-    // add fanouts for all objects
+    // add fanouts for all objects (the constant and the CIs have no fanins)
     Gia_ManForEachObj( p, pObj, i )
     {
-        if ( Gia_ObjChild0(pObj) )
+        if ( Gia_ObjIsAnd(pObj) || Gia_ObjIsCo(pObj) )
             Gia_ObjAddFanout( p, Gia_ObjFanin0(pObj), pObj );
-        if ( Gia_ObjChild1(pObj) )
+        if ( Gia_ObjIsAnd(pObj) )
             Gia_ObjAddFanout( p, Gia_ObjFanin1(pObj), pObj );
     }
 }
@@ -197,6 +197,35 @@ void Gia_ObjRemoveFanout( Gia_Man_t * p, Gia_Obj_t * pObj, Gia_Obj_t * pFanout )
 
 
 
+/**Function*************************************************************
+
+  Synopsis    [Collects the fanouts of the node.]
+
+  Description [Walks the circular list of fanouts, so that the reference
+  counters of the objects do not have to be computed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ObjCollectFanouts( Gia_Man_t * p, Gia_Obj_t * pObj, Vec_Int_t * vFanouts )
+{
+    int iFirst, iFan;
+    assert( p->pFanData );
+    Vec_IntClear( vFanouts );
+    if ( Gia_ObjId(p, pObj) >= p->nFansAlloc )
+        return;
+    iFirst = Gia_ObjFanout0Int( p, Gia_ObjId(p, pObj) );
+    if ( iFirst == 0 )
+        return;
+    iFan = iFirst;
+    do {
+        Vec_IntPush( vFanouts, iFan >> 1 );
+        iFan = Gia_ObjFanoutNext( p, iFan );
+    } while ( iFan != iFirst );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Compute the map of all edges.]
@@ -27,6 +27,10 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#if defined(__GNUC__) || defined(__clang__)
+#define GIA_HASH_ATOMICS
+#endif
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -35,38 +39,112 @@ ABC_NAMESPACE_IMPL_START
 
   Synopsis    [Returns the place where this node is stored (or should be stored).]
 
-  Description []
+  Description [The table uses open addressing with linear probing.
+  Each slot contains two integers: the 32-bit hash key of the fanin literals 
+  and the object ID (0 if the slot is empty).  Only the slots whose keys match 
+  are compared against the object array, so a miss does not touch the objects. 
+  The returned pointer points to the object ID of the slot.  If the node is 
+  not found, the key is already written into the empty slot, and the caller 
+  only needs to assign the object ID.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-static inline int Gia_ManHashOne( int iLit0, int iLit1, int iLitC, int TableSize ) 
+static inline unsigned Gia_ManHashKey( int iLit0, int iLit1, int iLitC ) 
+{
+    word Key = ((word)(unsigned)iLit1 << 32) | (word)(unsigned)iLit0;
+    Key ^= (word)(unsigned)iLitC * ABC_CONST(0x9E3779B97F4A7C15);
+    Key ^= Key >> 33;
+    Key *= ABC_CONST(0xFF51AFD7ED558CCD);
+    Key ^= Key >> 33;
+    return (unsigned)Key;
+}
+static inline int Gia_ManHashSlotNum( Vec_Int_t * vTable )
+{
+    return Vec_IntSize(vTable) / 2;
+}
+static inline int * Gia_ManHashFindTable( Gia_Man_t * p, Vec_Int_t * vTable, unsigned Key, int iLit0, int iLit1, int iLitC )
 {
-    unsigned Key = iLitC * 2011;
-    Key += Abc_Lit2Var(iLit0) * 7937;
-    Key += Abc_Lit2Var(iLit1) * 2971;
-    Key += Abc_LitIsCompl(iLit0) * 911;
-    Key += Abc_LitIsCompl(iLit1) * 353;
-    return (int)(Key % TableSize);
+    int Mask = Gia_ManHashSlotNum(vTable) - 1;
+    int * pTable = Vec_IntArray(vTable);
+    int iSlot = (int)(Key & Mask), iThis;
+    for ( ; (iThis = pTable[2*iSlot+1]); iSlot = (iSlot + 1) & Mask )
+    {
+        Gia_Obj_t * pThis;
+        if ( (unsigned)pTable[2*iSlot] != Key )
+            continue;
+        pThis = Gia_ManObj( p, iThis );
+        if ( Gia_ObjFaninLit0(pThis, iThis) == iLit0 && Gia_ObjFaninLit1(pThis, iThis) == iLit1 && (p->pMuxes == NULL || Gia_ObjFaninLit2p(p, pThis) == iLitC) )
+            break;
+    }
+    return pTable + 2*iSlot + 1;
 }
 static inline int * Gia_ManHashFind( Gia_Man_t * p, int iLit0, int iLit1, int iLitC )
 {
-    int iThis, * pPlace = Vec_IntEntryP( &p->vHTable, Gia_ManHashOne( iLit0, iLit1, iLitC, Vec_IntSize(&p->vHTable) ) );
-    assert( Vec_IntSize(&p->vHash) == Gia_ManObjNum(p) );
+    unsigned Key = Gia_ManHashKey( iLit0, iLit1, iLitC );
+    int * pPlace = Gia_ManHashFindTable( p, &p->vHTable, Key, iLit0, iLit1, iLitC );
     assert( p->pMuxes || iLit0 < iLit1 );
     assert( iLit0 < iLit1 || (!Abc_LitIsCompl(iLit0) && !Abc_LitIsCompl(iLit1)) );
     assert( iLitC == -1 || !Abc_LitIsCompl(iLit1) );
-    for ( ; (iThis = *pPlace); pPlace = Vec_IntEntryP(&p->vHash, iThis) )
+    if ( *pPlace == 0 && Vec_IntSize(&p->vHash) > 0 ) 
     {
-        Gia_Obj_t * pThis = Gia_ManObj( p, iThis );
-        if ( Gia_ObjFaninLit0(pThis, iThis) == iLit0 && Gia_ObjFaninLit1(pThis, iThis) == iLit1 && (p->pMuxes == NULL || Gia_ObjFaninLit2p(p, pThis) == iLitC) )
-            break;
+        // the table is being resized and the node may still be in the old table
+        int * pPlaceOld = Gia_ManHashFindTable( p, &p->vHash, Key, iLit0, iLit1, iLitC );
+        if ( *pPlaceOld )
+            return pPlaceOld;
     }
+    if ( *pPlace == 0 )
+        pPlace[-1] = (int)Key;
     return pPlace;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Moves several slots of the old table into the new one.]
+
+  Description [During resizing, the old table is kept in p->vHash and its
+  entries are moved a few slots at a time on every insertion.  Moving 
+  GIA_HASH_MOVE slots per insertion guarantees that the old table is empty
+  before the new one becomes half-full.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#define GIA_HASH_MOVE 8
+static inline void Gia_ManHashMove( Gia_Man_t * p, int nSlots )
+{
+    int Mask = Gia_ManHashSlotNum(&p->vHTable) - 1;
+    int * pTable = Vec_IntArray(&p->vHTable);
+    int * pOld = Vec_IntArray(&p->vHash);
+    int nSlotsOld = Gia_ManHashSlotNum(&p->vHash);
+    int iStop = Abc_MinInt( p->iHashMove + nSlots, nSlotsOld );
+    for ( ; p->iHashMove < iStop; p->iHashMove++ )
+    {
+        int Key = pOld[2*p->iHashMove], iObj = pOld[2*p->iHashMove+1], iSlot;
+        if ( iObj == 0 )
+            continue;
+        for ( iSlot = (int)((unsigned)Key & Mask); pTable[2*iSlot+1]; iSlot = (iSlot + 1) & Mask );
+        pTable[2*iSlot]   = Key;
+        pTable[2*iSlot+1] = iObj;
+    }
+    if ( p->iHashMove == nSlotsOld )
+    {
+        Vec_IntErase( &p->vHash );
+        p->iHashMove = 0;
+    }
+}
+static inline void Gia_ManHashGrow( Gia_Man_t * p )
+{
+    if ( Vec_IntSize(&p->vHash) > 0 )
+        Gia_ManHashMove( p, GIA_HASH_MOVE );
+    else if ( 2 * Gia_ManAndNum(p) >= Gia_ManHashSlotNum(&p->vHTable) )
+        Gia_ManHashResize( p );
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -104,11 +182,12 @@ int Gia_ManHashLookup( Gia_Man_t * p, Gia_Obj_t * p0, Gia_Obj_t * p1 )
 ***********************************************************************/
 void Gia_ManHashAlloc( Gia_Man_t * p )  
 {
+    int nEntries = Gia_ManAndNum(p) ? Gia_ManAndNum(p) + 1000 : p->nObjsAlloc;
     assert( Vec_IntSize(&p->vHTable) == 0 );
-    Vec_IntFill( &p->vHTable, Abc_PrimeCudd( Gia_ManAndNum(p) ? Gia_ManAndNum(p) + 1000 : p->nObjsAlloc ), 0 );
-    Vec_IntGrow( &p->vHash, Abc_MaxInt(Vec_IntSize(&p->vHTable), Gia_ManObjNum(p)) );
-    Vec_IntFill( &p->vHash, Gia_ManObjNum(p), 0 );
-//printf( "Alloced table with %d entries.\n", Vec_IntSize(&p->vHTable) );
+    Vec_IntFill( &p->vHTable, 2 * (1 << Abc_Base2Log(2 * Abc_MaxInt(nEntries, 16))), 0 );
+    Vec_IntErase( &p->vHash );
+    p->iHashMove = 0;
+//printf( "Alloced table with %d entries.\n", Gia_ManHashSlotNum(&p->vHTable) );
 }
 
 /**Function*************************************************************
@@ -150,13 +229,16 @@ void Gia_ManHashStop( Gia_Man_t * p )
 {
     Vec_IntErase( &p->vHTable );
     Vec_IntErase( &p->vHash );
+    p->iHashMove = 0;
 }
 
 /**Function*************************************************************
 
   Synopsis    [Resizes the hash table.]
 
-  Description []
+  Description [Allocates a table twice larger than needed for the current 
+  entries and starts moving the entries incrementally.  The keys are stored 
+  in the table, so moving does not access the objects.]
                
   SideEffects []
 
@@ -165,39 +247,26 @@ void Gia_ManHashStop( Gia_Man_t * p )
 ***********************************************************************/
 void Gia_ManHashResize( Gia_Man_t * p )
 {
-    int i, iThis, iNext, Counter, Counter2, * pPlace;
-    Vec_Int_t vOld = p->vHTable;
-    assert( Vec_IntSize(&vOld) > 0 );
-    // replace the table
+    int nSlots = 1 << Abc_Base2Log( 4 * Abc_MaxInt(Gia_ManAndNum(p), 16) );
+    assert( Vec_IntSize(&p->vHTable) > 0 );
+    // finish the previous resizing, if any
+    if ( Vec_IntSize(&p->vHash) > 0 )
+        Gia_ManHashMove( p, Gia_ManHashSlotNum(&p->vHash) );
+    assert( Vec_IntSize(&p->vHash) == 0 );
+    // the current table becomes the old one
+    p->vHash = p->vHTable;
     Vec_IntZero( &p->vHTable );
-    Vec_IntFill( &p->vHTable, Abc_PrimeCudd( 2 * Gia_ManAndNum(p) ), 0 ); 
-    // rehash the entries from the old table
-    Counter = 0;
-    Vec_IntForEachEntry( &vOld, iThis, i )
-        for ( iNext = Vec_IntEntry(&p->vHash, iThis);  
-              iThis;  iThis = iNext,   
-              iNext = Vec_IntEntry(&p->vHash, iThis)  )
-        {
-            Gia_Obj_t * pThis0 = Gia_ManObj( p, iThis );
-            Vec_IntWriteEntry( &p->vHash, iThis, 0 );
-            pPlace = Gia_ManHashFind( p, Gia_ObjFaninLit0(pThis0, iThis), Gia_ObjFaninLit1(pThis0, iThis), Gia_ObjFaninLit2p(p, pThis0) );
-            assert( *pPlace == 0 ); // should not be there
-            *pPlace = iThis;
-            assert( *pPlace != 0 );
-            Counter++;
-        }
-    Counter2 = Gia_ManAndNum(p) - Gia_ManBufNum(p);
-    assert( Counter == Counter2 );
+    Vec_IntFill( &p->vHTable, 2 * nSlots, 0 );
+    p->iHashMove = 0;
 //    if ( p->fVerbose )
-//        printf( "Resizing GIA hash table: %d -> %d.\n", Vec_IntSize(&vOld), Vec_IntSize(&p->vHTable) );
-    Vec_IntErase( &vOld );
+//        printf( "Resizing GIA hash table: %d -> %d.\n", Gia_ManHashSlotNum(&p->vHash), Gia_ManHashSlotNum(&p->vHTable) );
 }
 
 /**Function********************************************************************
 
   Synopsis    [Profiles the hash table.]
 
-  Description []
+  Description [Prints the distribution of probe lengths.]
 
   SideEffects []
 
@@ -206,21 +275,24 @@ void Gia_ManHashResize( Gia_Man_t * p )
 ******************************************************************************/
 void Gia_ManHashProfile( Gia_Man_t * p )
 {
-    int iEntry;
-    int i, Counter, Limit;
-    printf( "Table size = %d. Entries = %d. ", Vec_IntSize(&p->vHTable), Gia_ManAndNum(p) );
+    int Counts[17] = {0};
+    int * pTable = Vec_IntArray(&p->vHTable);
+    int nSlots = Gia_ManHashSlotNum(&p->vHTable);
+    int i, Dist, Counter = 0;
+    printf( "Table size = %d. Entries = %d. ", nSlots, Gia_ManAndNum(p) );
     printf( "Hits = %d. Misses = %d.\n", (int)p->nHashHit, (int)p->nHashMiss );
-    Limit = Abc_MinInt( 1000, Vec_IntSize(&p->vHTable) );
-    for ( i = 0; i < Limit; i++ )
+    for ( i = 0; i < nSlots; i++ )
     {
-        Counter = 0;
-        for ( iEntry = Vec_IntEntry(&p->vHTable, i); 
-              iEntry; 
-              iEntry = iEntry? Vec_IntEntry(&p->vHash, iEntry) : 0 )
-            Counter++;
-        if ( Counter ) 
-            printf( "%d ", Counter );
+        if ( pTable[2*i+1] == 0 )
+            continue;
+        Dist = (i - (int)((unsigned)pTable[2*i] & (nSlots - 1)) + nSlots) & (nSlots - 1);
+        Counts[Abc_MinInt(Dist, 16)]++;
+        Counter++;
     }
+    printf( "Probe lengths (%d entries): ", Counter );
+    for ( i = 0; i < 17; i++ )
+        if ( Counts[i] ) 
+            printf( "%s%d=%d ", i == 16 ? ">=" : "", i, Counts[i] );
     printf( "\n" );
 }
 
@@ -478,8 +550,7 @@ int Gia_ManHashXorReal( Gia_Man_t * p, int iLit0, int iLit1 )
         return 0;
     if ( iLit0 == Abc_LitNot(iLit1) )
         return 1;
-    if ( (p->nObjs & 0xFF) == 0 && 2 * Vec_IntSize(&p->vHTable) < Gia_ManAndNum(p) )
-        Gia_ManHashResize( p );
+    Gia_ManHashGrow( p );
     if ( iLit0 < iLit1 )
         iLit0 ^= iLit1, iLit1 ^= iLit0, iLit0 ^= iLit1;
     if ( Abc_LitIsCompl(iLit0) )
@@ -494,15 +565,7 @@ int Gia_ManHashXorReal( Gia_Man_t * p, int iLit0, int iLit1 )
             return Abc_Var2Lit( *pPlace, fCompl );
         }
         p->nHashMiss++;
-        if ( Vec_IntSize(&p->vHash) < Vec_IntCap(&p->vHash) )
-            *pPlace = Abc_Lit2Var( Gia_ManAppendXorReal( p, iLit0, iLit1 ) );
-        else
-        {
-            int iNode = Gia_ManAppendXorReal( p, iLit0, iLit1 );
-            pPlace = Gia_ManHashFind( p, iLit0, iLit1, -1 );
-            assert( *pPlace == 0 );
-            *pPlace = Abc_Lit2Var( iNode );
-        }
+        *pPlace = Abc_Lit2Var( Gia_ManAppendXorReal( p, iLit0, iLit1 ) );
         return Abc_Var2Lit( *pPlace, fCompl );
     }
 }
@@ -541,6 +604,7 @@ int Gia_ManHashMuxReal( Gia_Man_t * p, int iLitC, int iLit1, int iLit0 )
         iLit0 ^= iLit1, iLit1 ^= iLit0, iLit0 ^= iLit1, iLitC = Abc_LitNot(iLitC);
     if ( Abc_LitIsCompl(iLit1) )
         iLit0 = Abc_LitNot(iLit0), iLit1 = Abc_LitNot(iLit1), fCompl = 1;
+    Gia_ManHashGrow( p );
     {
         int *pPlace = Gia_ManHashFind( p, iLit0, iLit1, iLitC );
         if ( *pPlace )
@@ -549,15 +613,7 @@ int Gia_ManHashMuxReal( Gia_Man_t * p, int iLitC, int iLit1, int iLit0 )
             return Abc_Var2Lit( *pPlace, fCompl );
         }
         p->nHashMiss++;
-        if ( Vec_IntSize(&p->vHash) < Vec_IntCap(&p->vHash) )
-            *pPlace = Abc_Lit2Var( Gia_ManAppendMuxReal( p, iLitC, iLit1, iLit0 ) );
-        else
-        {
-            int iNode = Gia_ManAppendMuxReal( p, iLitC, iLit1, iLit0 );
-            pPlace = Gia_ManHashFind( p, iLit0, iLit1, iLitC );
-            assert( *pPlace == 0 );
-            *pPlace = Abc_Lit2Var( iNode );
-        }
+        *pPlace = Abc_Lit2Var( Gia_ManAppendMuxReal( p, iLitC, iLit1, iLit0 ) );
         return Abc_Var2Lit( *pPlace, fCompl );
     }
 }
@@ -588,8 +644,7 @@ int Gia_ManHashAnd( Gia_Man_t * p, int iLit0, int iLit1 )
         assert( Vec_IntSize(&p->vHTable) == 0 );
         return Gia_ManAppendAnd( p, iLit0, iLit1 );
     }
-    if ( (p->nObjs & 0xFF) == 0 && 2 * Vec_IntSize(&p->vHTable) < Gia_ManAndNum(p) )
-        Gia_ManHashResize( p );
+    Gia_ManHashGrow( p );
     if ( p->fAddStrash )
     {
         Gia_Obj_t * pObj = Gia_ManAddStrash( p, Gia_ObjFromLit(p, iLit0), Gia_ObjFromLit(p, iLit1) );
@@ -606,15 +661,7 @@ int Gia_ManHashAnd( Gia_Man_t * p, int iLit0, int iLit1 )
             return Abc_Var2Lit( *pPlace, 0 );
         }
         p->nHashMiss++;
-        if ( Vec_IntSize(&p->vHash) < Vec_IntCap(&p->vHash) )
-            *pPlace = Abc_Lit2Var( Gia_ManAppendAnd( p, iLit0, iLit1 ) );
-        else
-        {
-            int iNode = Gia_ManAppendAnd( p, iLit0, iLit1 );
-            pPlace = Gia_ManHashFind( p, iLit0, iLit1, -1 );
-            assert( *pPlace == 0 );
-            *pPlace = Abc_Lit2Var( iNode );
-        }
+        *pPlace = Abc_Lit2Var( Gia_ManAppendAnd( p, iLit0, iLit1 ) );
         return Abc_Var2Lit( *pPlace, 0 );
     }
 }
@@ -623,6 +670,274 @@ int Gia_ManHashOr( Gia_Man_t * p, int iLit0, int iLit1 )
     return Abc_LitNot(Gia_ManHashAnd( p, Abc_LitNot(iLit0), Abc_LitNot(iLit1) ));
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Atomic access to the slots of the hash table.]
+
+  Description [Without atomic built-ins, concurrent hashing is not supported
+  and these are plain memory accesses.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Gia_ManHashConcLoad( int * pVal )
+{
+#if defined(GIA_HASH_ATOMICS)
+    return __atomic_load_n( pVal, __ATOMIC_ACQUIRE );
+#else
+    return *pVal;
+#endif
+}
+static inline void Gia_ManHashConcStore( int * pVal, int Val )
+{
+#if defined(GIA_HASH_ATOMICS)
+    __atomic_store_n( pVal, Val, __ATOMIC_RELEASE );
+#else
+    *pVal = Val;
+#endif
+}
+static inline int Gia_ManHashConcCas( int * pVal, int Old, int New )
+{
+#if defined(GIA_HASH_ATOMICS)
+    return __atomic_compare_exchange_n( pVal, &Old, New, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE );
+#else
+    if ( *pVal != Old )
+        return 0;
+    *pVal = New;
+    return 1;
+#endif
+}
+static inline int Gia_ManHashConcFetchInc( int * pVal )
+{
+#if defined(GIA_HASH_ATOMICS)
+    return __atomic_fetch_add( pVal, 1, __ATOMIC_RELAXED );
+#else
+    return (*pVal)++;
+#endif
+}
+int Gia_ManHashConcIsSupported()
+{
+#if defined(GIA_HASH_ATOMICS)
+    return 1;
+#else
+    return 0;
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prepares the manager for concurrent structural hashing.]
+
+  Description [Reserves the storage for nObjsMax objects (including the MUX
+  fanins and the levels, if present) and allocates a hash table large enough
+  for them, so that nothing is reallocated while several threads call
+  Gia_ManHashAndConc() and friends.  The nodes already in the manager are
+  hashed.  When the threads are done, the table is the usual hash table of
+  the manager, used by Gia_ManHashAnd() and released by Gia_ManHashStop().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManHashConcStart( Gia_Man_t * p, int nObjsMax )
+{
+    Gia_Obj_t * pObj;
+    int * pPlace, i;
+    assert( p->pFanData == NULL );
+    assert( !p->fGiaSimple && !p->fSweeper && !p->fAddStrash );
+    assert( Vec_IntSize(&p->vHTable) == 0 );
+    if ( p->nObjsAlloc < nObjsMax )
+    {
+        p->pObjs = ABC_REALLOC( Gia_Obj_t, p->pObjs, nObjsMax );
+        memset( p->pObjs + p->nObjsAlloc, 0, sizeof(Gia_Obj_t) * (nObjsMax - p->nObjsAlloc) );
+        if ( p->pMuxes )
+        {
+            p->pMuxes = ABC_REALLOC( unsigned, p->pMuxes, nObjsMax );
+            memset( p->pMuxes + p->nObjsAlloc, 0, sizeof(unsigned) * (nObjsMax - p->nObjsAlloc) );
+        }
+        p->nObjsAlloc = nObjsMax;
+    }
+    if ( p->vLevels )
+        Vec_IntFillExtra( p->vLevels, p->nObjsAlloc, 0 );
+    Vec_IntFill( &p->vHTable, 2 * (1 << Abc_Base2Log(2 * Abc_MaxInt(p->nObjsAlloc, 16))), 0 );
+    Vec_IntErase( &p->vHash );
+    p->iHashMove = 0;
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        pPlace = Gia_ManHashFind( p, Gia_ObjFaninLit0(pObj, i), Gia_ObjFaninLit1(pObj, i), Gia_ObjFaninLit2(p, i) );
+        assert( *pPlace == 0 );
+        *pPlace = i;
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Finds or adds a node; may be called by several threads at once.]
+
+  Description [The fanin literals are normalized as in the single-threaded
+  hashing.  A thread that does not find the node reserves the empty slot
+  by changing its object ID from 0 to -1, takes the next object ID, creates
+  the node with its level, and publishes it by writing its ID into the slot.
+  A thread that sees a reserved slot waits until it is published, because
+  it may be the same node.  The slots are never cleared, so the probing
+  sequences remain valid.  A node is created after its fanins are published,
+  so the objects remain in a topological order, while the order of the nodes
+  added by different threads depends on the scheduling.  Returns -1 if the
+  reserved storage is exhausted.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_ManHashConcInt( Gia_Man_t * p, int iLit0, int iLit1, int iLitC )
+{
+    Gia_Obj_t * pObj;
+    int * pTable = Vec_IntArray(&p->vHTable);
+    int Mask = Gia_ManHashSlotNum(&p->vHTable) - 1;
+    unsigned Key = Gia_ManHashKey( iLit0, iLit1, iLitC );
+    int iSlot, iThis;
+    for ( iSlot = (int)(Key & Mask); ; iSlot = (iSlot + 1) & Mask )
+    {
+        while ( (iThis = Gia_ManHashConcLoad(pTable + 2*iSlot+1)) == -1 )
+            ;
+        if ( iThis == 0 )
+        {
+            if ( !Gia_ManHashConcCas(pTable + 2*iSlot+1, 0, -1) )
+            {
+                iSlot = (iSlot - 1) & Mask; // look at this slot again
+                continue;
+            }
+            iThis = Gia_ManHashConcFetchInc( &p->nObjs );
+            if ( iThis >= p->nObjsAlloc )
+            {
+                Gia_ManHashConcStore( pTable + 2*iSlot+1, 0 );
+                return -1;
+            }
+            pObj = p->pObjs + iThis;
+            pObj->iDiff0  = (unsigned)(iThis - Abc_Lit2Var(iLit0));
+            pObj->fCompl0 = (unsigned)(Abc_LitIsCompl(iLit0));
+            pObj->iDiff1  = (unsigned)(iThis - Abc_Lit2Var(iLit1));
+            pObj->fCompl1 = (unsigned)(Abc_LitIsCompl(iLit1));
+            if ( iLitC >= 0 )
+                p->pMuxes[iThis] = iLitC;
+            if ( p->vLevels )
+                Gia_ObjSetGateLevel( p, pObj );
+            pTable[2*iSlot] = (int)Key;
+            Gia_ManHashConcStore( pTable + 2*iSlot+1, iThis );
+            return Abc_Var2Lit( iThis, 0 );
+        }
+        if ( (unsigned)pTable[2*iSlot] != Key )
+            continue;
+        pObj = p->pObjs + iThis;
+        if ( Gia_ObjFaninLit0(pObj, iThis) == iLit0 && Gia_ObjFaninLit1(pObj, iThis) == iLit1 && (p->pMuxes == NULL || Gia_ObjFaninLit2(p, iThis) == iLitC) )
+            return Abc_Var2Lit( iThis, 0 );
+    }
+}
+int Gia_ManHashAndConc( Gia_Man_t * p, int iLit0, int iLit1 )
+{
+    if ( iLit0 < 2 )
+        return iLit0 ? iLit1 : 0;
+    if ( iLit1 < 2 )
+        return iLit1 ? iLit0 : 0;
+    if ( iLit0 == iLit1 )
+        return iLit1;
+    if ( iLit0 == Abc_LitNot(iLit1) )
+        return 0;
+    if ( iLit0 > iLit1 )
+        iLit0 ^= iLit1, iLit1 ^= iLit0, iLit0 ^= iLit1;
+    return Gia_ManHashConcInt( p, iLit0, iLit1, -1 );
+}
+int Gia_ManHashOrConc( Gia_Man_t * p, int iLit0, int iLit1 )
+{
+    int iLit = Gia_ManHashAndConc( p, Abc_LitNot(iLit0), Abc_LitNot(iLit1) );
+    return iLit < 0 ? -1 : Abc_LitNot(iLit);
+}
+int Gia_ManHashXorConc( Gia_Man_t * p, int iLit0, int iLit1 )
+{
+    int iLit, fCompl = 0;
+    assert( p->pMuxes != NULL );
+    if ( iLit0 < 2 )
+        return iLit0 ? Abc_LitNot(iLit1) : iLit1;
+    if ( iLit1 < 2 )
+        return iLit1 ? Abc_LitNot(iLit0) : iLit0;
+    if ( iLit0 == iLit1 )
+        return 0;
+    if ( iLit0 == Abc_LitNot(iLit1) )
+        return 1;
+    if ( iLit0 < iLit1 )
+        iLit0 ^= iLit1, iLit1 ^= iLit0, iLit0 ^= iLit1;
+    if ( Abc_LitIsCompl(iLit0) )
+        iLit0 = Abc_LitNot(iLit0), fCompl ^= 1;
+    if ( Abc_LitIsCompl(iLit1) )
+        iLit1 = Abc_LitNot(iLit1), fCompl ^= 1;
+    iLit = Gia_ManHashConcInt( p, iLit0, iLit1, -1 );
+    return iLit < 0 ? -1 : Abc_LitNotCond( iLit, fCompl );
+}
+int Gia_ManHashMuxConc( Gia_Man_t * p, int iLitC, int iLit1, int iLit0 )
+{
+    int iLit, fCompl = 0;
+    assert( p->pMuxes != NULL );
+    if ( iLitC < 2 )
+        return iLitC ? iLit1 : iLit0;
+    if ( iLit0 < 2 )
+        return iLit0 ? Gia_ManHashOrConc(p, Abc_LitNot(iLitC), iLit1) : Gia_ManHashAndConc(p, iLitC, iLit1);
+    if ( iLit1 < 2 )
+        return iLit1 ? Gia_ManHashOrConc(p, iLitC, iLit0) : Gia_ManHashAndConc(p, Abc_LitNot(iLitC), iLit0);
+    if ( iLit0 == iLit1 )
+        return iLit0;
+    if ( iLitC == iLit0 || iLitC == Abc_LitNot(iLit1) )
+        return Gia_ManHashAndConc(p, iLit0, iLit1);
+    if ( iLitC == iLit1 || iLitC == Abc_LitNot(iLit0) )
+        return Gia_ManHashOrConc(p, iLit0, iLit1);
+    if ( Abc_Lit2Var(iLit0) == Abc_Lit2Var(iLit1) )
+        return Gia_ManHashXorConc( p, iLitC, iLit0 );
+    if ( iLit0 > iLit1 )
+        iLit0 ^= iLit1, iLit1 ^= iLit0, iLit0 ^= iLit1, iLitC = Abc_LitNot(iLitC);
+    if ( Abc_LitIsCompl(iLit1) )
+        iLit0 = Abc_LitNot(iLit0), iLit1 = Abc_LitNot(iLit1), fCompl = 1;
+    iLit = Gia_ManHashConcInt( p, iLit0, iLit1, iLitC );
+    return iLit < 0 ? -1 : Abc_LitNotCond( iLit, fCompl );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Looks up an AND node while other threads may be adding nodes.]
+
+  Description [Returns 0 if the node is not found.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManHashLookupConc( Gia_Man_t * p, int iLit0, int iLit1 )
+{
+    Gia_Obj_t * pObj;
+    int * pTable = Vec_IntArray(&p->vHTable);
+    int Mask = Gia_ManHashSlotNum(&p->vHTable) - 1;
+    int iSlot, iThis;
+    unsigned Key;
+    if ( iLit0 > iLit1 )
+        iLit0 ^= iLit1, iLit1 ^= iLit0, iLit0 ^= iLit1;
+    Key = Gia_ManHashKey( iLit0, iLit1, -1 );
+    for ( iSlot = (int)(Key & Mask); ; iSlot = (iSlot + 1) & Mask )
+    {
+        while ( (iThis = Gia_ManHashConcLoad(pTable + 2*iSlot+1)) == -1 )
+            ;
+        if ( iThis == 0 )
+            return 0;
+        if ( (unsigned)pTable[2*iSlot] != Key )
+            continue;
+        pObj = p->pObjs + iThis;
+        if ( Gia_ObjFaninLit0(pObj, iThis) == iLit0 && Gia_ObjFaninLit1(pObj, iThis) == iLit1 && (p->pMuxes == NULL || Gia_ObjFaninLit2(p, iThis) == -1) )
+            return Abc_Var2Lit( iThis, 0 );
+    }
+}
+
 /**Function*************************************************************
 
   Synopsis    []
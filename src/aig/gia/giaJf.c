@@ -57,6 +57,8 @@ struct Jf_Man_t_
     Sdm_Man_t *      pDsd;        // extern DSD manager
     Vec_Int_t *      vCnfs;       // costs of elementary CNFs
     Vec_Mem_t *      vTtMem;      // truth table memory and hash table
+    Dau_TtStore_t *  pTtStore;    // shared truth tables (or NULL)
+    int              nTtStart;    // shared truth tables added before this manager
     Vec_Int_t        vCuts;       // cuts for each node
     Vec_Int_t        vArr;        // arrival time
     Vec_Int_t        vDep;        // departure time
@@ -365,6 +367,7 @@ void Jf_ManProfileClasses( Jf_Man_t * p )
 Jf_Man_t * Jf_ManAlloc( Gia_Man_t * pGia, Jf_Par_t * pPars )
 {
     Jf_Man_t * p;
+    extern void * Abc_FrameReadTtStore();
     assert( pPars->nLutSize <= JF_LEAF_MAX );
     assert( pPars->nCutNum <= JF_CUT_MAX );
     Vec_IntFreeP( &pGia->vMapping );
@@ -372,7 +375,11 @@ Jf_Man_t * Jf_ManAlloc( Gia_Man_t * pGia, Jf_Par_t * pPars )
     p->pGia      = pGia;
     p->pPars     = pPars;
     if ( pPars->fCutMin && !pPars->fFuncDsd )
-        p->vTtMem = Vec_MemAllocForTT( pPars->nLutSize, 0 );
+    {
+        p->pTtStore = (Dau_TtStore_t *)Abc_FrameReadTtStore();
+        p->vTtMem = p->pTtStore ? Dau_TtStoreMem( p->pTtStore, pPars->nLutSize ) : Vec_MemAllocForTT( pPars->nLutSize, 0 );
+        p->nTtStart = p->pTtStore ? Vec_MemEntryNum( p->vTtMem ) : 0;
+    }
     else if ( pPars->fCutMin && pPars->fFuncDsd )
     {
         p->pDsd = Sdm_ManRead();
@@ -399,7 +406,10 @@ void Jf_ManFree( Jf_Man_t * p )
         Sdm_ManPrintDsdStats( p->pDsd, 0 );
     if ( p->pPars->fVerbose && p->vTtMem )
     {
-        printf( "Unique truth tables = %d. Memory = %.2f MB   ", Vec_MemEntryNum(p->vTtMem), Vec_MemMemory(p->vTtMem) / (1<<20) ); 
+        if ( p->pTtStore )
+            printf( "Unique truth tables = %d (%d shared). Memory = %.2f MB   ", Vec_MemEntryNum(p->vTtMem) - p->nTtStart, Vec_MemEntryNum(p->vTtMem), Vec_MemMemoryFrom(p->vTtMem, p->nTtStart) / (1<<20) ); 
+        else
+            printf( "Unique truth tables = %d. Memory = %.2f MB   ", Vec_MemEntryNum(p->vTtMem), Vec_MemMemory(p->vTtMem) / (1<<20) ); 
         Abc_PrintTime( 1, "Time", Abc_Clock() - p->clkStart );
     }
     if ( p->pPars->fVeryVerbose && p->pPars->fCutMin && p->pPars->fFuncDsd )
@@ -412,7 +422,7 @@ void Jf_ManFree( Jf_Man_t * p )
     ABC_FREE( p->vDep.pArray );
     ABC_FREE( p->vFlow.pArray );
     ABC_FREE( p->vRefs.pArray );
-    if ( p->pPars->fCutMin && !p->pPars->fFuncDsd )
+    if ( p->pPars->fCutMin && !p->pPars->fFuncDsd && p->pTtStore == NULL )
     {
         Vec_MemHashFree( p->vTtMem );
         Vec_MemFree( p->vTtMem );
@@ -1083,7 +1093,16 @@ int Jf_TtComputeForCut( Jf_Man_t * p, int iFuncLit0, int iFuncLit1, int * pCut0,
     Abc_TtAnd( uTruth, uTruth0, uTruth1, nWords, fCompl );
     pCutOut[0]     = Abc_TtMinBase( uTruth, pCutOut + 1, pCutOut[0], LutSize );
     assert( (uTruth[0] & 1) == 0 );
-    truthId        = Vec_MemHashInsert(p->vTtMem, uTruth);
+    if ( p->pTtStore )
+        truthId    = Dau_TtStoreInsert(p->pTtStore, LutSize, uTruth);
+    else
+        truthId    = Vec_MemHashInsert(p->vTtMem, uTruth);
+    if ( truthId == -1 ) // the shared store is full, continue with a private copy
+    {
+        p->vTtMem   = Dau_TtStoreMemDup( p->pTtStore, LutSize );
+        p->pTtStore = NULL;
+        truthId     = Vec_MemHashInsert(p->vTtMem, uTruth);
+    }
     return Abc_Var2Lit( truthId, fCompl );
 }
 
@@ -1240,6 +1259,7 @@ void Jf_ObjComputeCuts( Jf_Man_t * p, Gia_Obj_t * pObj, int fEdge )
 void Jf_ManComputeCuts( Jf_Man_t * p, int fEdge )
 {
     Gia_Obj_t * pObj; int i;
+    abctime clk = Abc_Clock();
     if ( p->pPars->fVerbose )
     {
         printf( "Aig: CI = %d  CO = %d  AND = %d    ", Gia_ManCiNum(p->pGia), Gia_ManCoNum(p->pGia), Gia_ManAndNum(p->pGia) );
@@ -1256,6 +1276,9 @@ void Jf_ManComputeCuts( Jf_Man_t * p, int fEdge )
         else if ( Gia_ObjIsAnd(pObj) )
             Jf_ObjComputeCuts( p, pObj, fEdge );
     }
+    p->pPars->Cuts    = (word)p->CutCount[3];
+    p->pPars->CutMem  = (word)Vec_ReportMemory(&p->pMem);
+    p->pPars->CutTime = Abc_Clock() - clk;
     if ( p->pPars->fVerbose )
     {
         printf( "CutPair = %lu  ", (long)p->CutCount[0] );
@@ -1736,7 +1759,7 @@ Gia_Man_t * Jf_ManPerformMapping( Gia_Man_t * pGia, Jf_Par_t * pPars )
         Jf_ManPropagateEla( p, 1 );                 Jf_ManPrintStats( p, "Edge " );
     }
     if ( p->pPars->fVeryVerbose && p->pPars->fCutMin && !p->pPars->fFuncDsd )
-        Vec_MemDumpTruthTables( p->vTtMem, Gia_ManName(p->pGia), p->pPars->nLutSize );
+        Vec_MemDumpTruthTablesFrom( p->vTtMem, Gia_ManName(p->pGia), p->pPars->nLutSize, p->nTtStart );
     if ( p->pPars->fPureAig )
         pNew = Jf_ManDeriveGia(p);
     else if ( p->pPars->fCutMin )
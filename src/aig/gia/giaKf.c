@@ -1139,6 +1139,7 @@ void Kf_ManPrintStats( Kf_Man_t * p, char * pTitle )
 void Kf_ManComputeMapping( Kf_Man_t * p )
 {
     Gia_Obj_t * pObj; int i, iPi;
+    abctime clk = Abc_Clock();
     if ( p->pPars->fVerbose )
     {
         printf( "Aig: CI = %d  CO = %d  AND = %d    ", Gia_ManCiNum(p->pGia), Gia_ManCoNum(p->pGia), Gia_ManAndNum(p->pGia) );
@@ -1175,6 +1176,11 @@ void Kf_ManComputeMapping( Kf_Man_t * p )
             //Gia_CutSetPrint( Kf_ObjCuts(p, i) );
         }
     }
+    p->pPars->Cuts    = 0;
+    for ( i = 0; i < Abc_MaxInt(p->pPars->nProcNum, 1); i++ )
+        p->pPars->Cuts += p->pSett[i].CutCount[3];
+    p->pPars->CutMem  = (word)Vec_ReportMemory(&p->pMem);
+    p->pPars->CutTime = Abc_Clock() - clk;
     Kf_ManComputeRefs( p );
     if ( p->pPars->fVerbose )
     {
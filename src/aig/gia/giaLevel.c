@@ -0,0 +1,443 @@
+/**CFile****************************************************************
+
+  FileName    [giaLevel.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Incremental maintenance of direct and reverse levels.]
+
+  Author      [agent <agent@local>]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: giaLevel.c,v 1.00 2026/10/17 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The levels are kept in p->vLevels and the max level in p->nLevels, as
+// computed by Gia_ManLevelNum(). The reverse levels follow the convention
+// of Gia_ManReverseLevel(). After a local edit, only the levels in the TFO
+// (and the reverse levels in the TFI) of the changed objects are updated,
+// using the dynamic fanout and the queue of objects ordered by their old
+// levels, similar to Aig_ManUpdateLevel() in "aigTiming.c".
+
+struct Gia_LevMan_t_
+{
+    Vec_Int_t *    vLevelR;       // reverse levels
+    Vec_Int_t *    vLevelNums;    // the number of objects on each level
+    Vec_Wec_t *    vQueue;        // objects to update ordered by their old level
+    Vec_Bit_t *    vQueued;       // objects currently in the queue
+    Vec_Int_t *    vFanouts;      // temporary fanouts
+    int            fFanoutOwn;    // the fanout was started by this manager
+};
+
+static inline int  Gia_ObjLevelIncDelay( Gia_Man_t * p, Gia_Obj_t * pObj ) { return Gia_ObjIsCo(pObj) ? 0 : (Gia_ObjIsXor(pObj) ? 2 : 1);  }
+static inline int  Gia_ObjLevelR( Gia_Man_t * p, int iObj )                { return Vec_IntGetEntry( p->pLevInc->vLevelR, iObj );                  }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the level of the object using its fanins.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_ObjLevelIncNew( Gia_Man_t * p, Gia_Obj_t * pObj )
+{
+    if ( Gia_ObjIsCo(pObj) )
+        return Gia_ObjLevel( p, Gia_ObjFanin0(pObj) );
+    if ( !Gia_ObjIsAnd(pObj) )
+        return Gia_ObjLevel( p, pObj );
+    return Gia_ObjLevelIncDelay(p, pObj) + Abc_MaxInt( Gia_ObjLevel(p, Gia_ObjFanin0(pObj)), Gia_ObjLevel(p, Gia_ObjFanin1(pObj)) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the reverse level of the object using its fanouts.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_ObjLevelIncRNew( Gia_Man_t * p, Gia_Obj_t * pObj )
+{
+    Gia_Obj_t * pFanout;
+    int i, LevelR = 0;
+    if ( Gia_ObjIsCo(pObj) )
+        return 0;
+    Gia_ObjCollectFanouts( p, pObj, p->pLevInc->vFanouts );
+    Gia_ManForEachObjVec( p->pLevInc->vFanouts, p, pFanout, i )
+        LevelR = Abc_MaxInt( LevelR, Gia_ObjLevelR(p, Gia_ObjId(p, pFanout)) + Gia_ObjLevelIncDelay(p, pFanout) );
+    return LevelR;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Changes the level of the object and updates the max level.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_ObjLevelIncSet( Gia_Man_t * p, int iObj, int Level )
+{
+    Vec_Int_t * vLevelNums = p->pLevInc->vLevelNums;
+    if ( iObj < Vec_IntSize(p->vLevels) )
+        Vec_IntAddToEntry( vLevelNums, Gia_ObjLevelId(p, iObj), -1 );
+    Gia_ObjSetLevelId( p, iObj, Level );
+    Vec_IntFillExtra( vLevelNums, Level + 1, 0 );
+    Vec_IntAddToEntry( vLevelNums, Level, 1 );
+    p->nLevels = Abc_MaxInt( p->nLevels, Level );
+    while ( p->nLevels > 0 && Vec_IntEntry(vLevelNums, p->nLevels) == 0 )
+        p->nLevels--;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts incremental levelization.]
+
+  Description [Computes the levels and the reverse levels of all objects.
+  Starts the dynamic fanout, unless it is already present. MUX nodes
+  and buffers are not supported.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManLevelIncStart( Gia_Man_t * p )
+{
+    Gia_LevMan_t * pLev;
+    Gia_Obj_t * pObj;
+    int i;
+    assert( p->pMuxes == NULL && p->nBufs == 0 );
+    if ( p->pLevInc )
+        Gia_ManLevelIncStop( p );
+    pLev = ABC_CALLOC( Gia_LevMan_t, 1 );
+    pLev->vQueue   = Vec_WecAlloc( 100 );
+    pLev->vQueued  = Vec_BitStart( Gia_ManObjNum(p) );
+    pLev->vFanouts = Vec_IntAlloc( 100 );
+    if ( p->pFanData == NULL )
+    {
+        Gia_ManFanoutStart( p );
+        pLev->fFanoutOwn = 1;
+    }
+    p->pLevInc = pLev;
+    Gia_ManLevelNum( p );
+    pLev->vLevelNums = Vec_IntStart( p->nLevels + 1 );
+    Gia_ManForEachObj( p, pObj, i )
+        Vec_IntAddToEntry( pLev->vLevelNums, Gia_ObjLevelId(p, i), 1 );
+    pLev->vLevelR = Gia_ManReverseLevel( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops incremental levelization.]
+
+  Description [The levels remain in the manager.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManLevelIncStop( Gia_Man_t * p )
+{
+    Gia_LevMan_t * pLev = p->pLevInc;
+    if ( pLev == NULL )
+        return;
+    if ( pLev->fFanoutOwn && p->pFanData )
+        Gia_ManFanoutStop( p );
+    Vec_IntFreeP( &pLev->vLevelR );
+    Vec_IntFreeP( &pLev->vLevelNums );
+    Vec_WecFree( pLev->vQueue );
+    Vec_BitFree( pLev->vQueued );
+    Vec_IntFree( pLev->vFanouts );
+    ABC_FREE( p->pLevInc );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the current timing information.]
+
+  Description [The required level is counted from the max level, so that
+  the slack of the objects on the critical path is zero.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManLevelIncMax( Gia_Man_t * p )
+{
+    assert( p->pLevInc );
+    return p->nLevels;
+}
+int Gia_ManLevelIncReverse( Gia_Man_t * p, int iObj )
+{
+    assert( p->pLevInc );
+    return Gia_ObjLevelR( p, iObj );
+}
+int Gia_ManLevelIncRequired( Gia_Man_t * p, int iObj )
+{
+    assert( p->pLevInc );
+    return p->nLevels - Gia_ObjLevelR( p, iObj );
+}
+int Gia_ManLevelIncSlack( Gia_Man_t * p, int iObj )
+{
+    assert( p->pLevInc );
+    return p->nLevels - Gia_ObjLevelId( p, iObj ) - Gia_ObjLevelR( p, iObj );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Updates the levels in the TFO of the object.]
+
+  Description [Should be called after the fanins of the object changed.
+  Only the objects whose level changes are visited.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManLevelIncUpdate( Gia_Man_t * p, int iObj )
+{
+    Gia_LevMan_t * pLev = p->pLevInc;
+    Gia_Obj_t * pObj = Gia_ManObj( p, iObj ), * pFanout;
+    int LevelOld, Lev, k, m;
+    assert( pLev != NULL );
+    LevelOld = Gia_ObjLevelId( p, iObj );
+    if ( LevelOld == Gia_ObjLevelIncNew(p, pObj) )
+        return;
+    // the objects are stored by their old levels, which are assumed to be
+    // correct, so the fanouts are always scheduled after their fanins
+    Vec_WecClear( pLev->vQueue );
+    Vec_WecPush( pLev->vQueue, LevelOld, iObj );
+    Vec_BitFillExtra( pLev->vQueued, Gia_ManObjNum(p), 0 );
+    Vec_BitWriteEntry( pLev->vQueued, iObj, 1 );
+    for ( Lev = LevelOld; Lev < Vec_WecSize(pLev->vQueue); Lev++ )
+    for ( k = 0; k < Vec_IntSize(Vec_WecEntry(pLev->vQueue, Lev)); k++ )
+    {
+        int iTemp = Vec_IntEntry( Vec_WecEntry(pLev->vQueue, Lev), k );
+        Gia_Obj_t * pTemp = Gia_ManObj( p, iTemp );
+        Vec_BitWriteEntry( pLev->vQueued, iTemp, 0 );
+        assert( Gia_ObjLevelId(p, iTemp) == Lev );
+        Gia_ObjLevelIncSet( p, iTemp, Gia_ObjLevelIncNew(p, pTemp) );
+        if ( Gia_ObjLevelId(p, iTemp) == Lev )
+            continue;
+        Gia_ObjCollectFanouts( p, pTemp, pLev->vFanouts );
+        Gia_ManForEachObjVec( pLev->vFanouts, p, pFanout, m )
+        {
+            int iFanout = Gia_ObjId( p, pFanout );
+            if ( Vec_BitEntry(pLev->vQueued, iFanout) )
+                continue;
+            assert( Gia_ObjLevelId(p, iFanout) >= Lev );
+            Vec_WecPush( pLev->vQueue, Gia_ObjLevelId(p, iFanout), iFanout );
+            Vec_BitWriteEntry( pLev->vQueued, iFanout, 1 );
+        }
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Updates the reverse levels in the TFI of the object.]
+
+  Description [Should be called after the fanouts of the object changed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManLevelIncUpdateR( Gia_Man_t * p, int iObj )
+{
+    Gia_LevMan_t * pLev = p->pLevInc;
+    int LevelOld, Lev, k, f;
+    assert( pLev != NULL );
+    LevelOld = Gia_ObjLevelR( p, iObj );
+    if ( LevelOld == Gia_ObjLevelIncRNew(p, Gia_ManObj(p, iObj)) )
+        return;
+    Vec_WecClear( pLev->vQueue );
+    Vec_WecPush( pLev->vQueue, LevelOld, iObj );
+    Vec_BitFillExtra( pLev->vQueued, Gia_ManObjNum(p), 0 );
+    Vec_BitWriteEntry( pLev->vQueued, iObj, 1 );
+    for ( Lev = LevelOld; Lev < Vec_WecSize(pLev->vQueue); Lev++ )
+    for ( k = 0; k < Vec_IntSize(Vec_WecEntry(pLev->vQueue, Lev)); k++ )
+    {
+        int iTemp = Vec_IntEntry( Vec_WecEntry(pLev->vQueue, Lev), k );
+        Gia_Obj_t * pTemp = Gia_ManObj( p, iTemp );
+        Vec_BitWriteEntry( pLev->vQueued, iTemp, 0 );
+        assert( Gia_ObjLevelR(p, iTemp) == Lev );
+        Vec_IntSetEntry( pLev->vLevelR, iTemp, Gia_ObjLevelIncRNew(p, pTemp) );
+        if ( Gia_ObjLevelR(p, iTemp) == Lev || !Gia_ObjIsAnd(pTemp) )
+            continue;
+        for ( f = 0; f < 2; f++ )
+        {
+            int iFanin = f ? Gia_ObjFaninId1(pTemp, iTemp) : Gia_ObjFaninId0(pTemp, iTemp);
+            if ( Vec_BitEntry(pLev->vQueued, iFanin) )
+                continue;
+            assert( Gia_ObjLevelR(p, iFanin) >= Lev );
+            Vec_WecPush( pLev->vQueue, Gia_ObjLevelR(p, iFanin), iFanin );
+            Vec_BitWriteEntry( pLev->vQueued, iFanin, 1 );
+        }
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the object appended to the manager.]
+
+  Description [Assigns the level and the reverse level of the new object
+  and updates the reverse levels of its fanins.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManLevelIncAddObj( Gia_Man_t * p, int iObj )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p, iObj );
+    assert( p->pLevInc != NULL );
+    assert( iObj >= Vec_IntSize(p->vLevels) || Gia_ObjLevelId(p, iObj) == 0 );
+    Vec_IntFillExtra( p->vLevels, iObj + 1, 0 );
+    Vec_IntAddToEntry( p->pLevInc->vLevelNums, 0, 1 );
+    Gia_ObjLevelIncSet( p, iObj, Gia_ObjLevelIncNew(p, pObj) );
+    Vec_IntSetEntry( p->pLevInc->vLevelR, iObj, Gia_ObjLevelIncRNew(p, pObj) );
+    if ( Gia_ObjIsAnd(pObj) || Gia_ObjIsCo(pObj) )
+        Gia_ManLevelIncUpdateR( p, Gia_ObjFaninId0(pObj, iObj) );
+    if ( Gia_ObjIsAnd(pObj) )
+        Gia_ManLevelIncUpdateR( p, Gia_ObjFaninId1(pObj, iObj) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Replaces one fanin of the AND node or the CO.]
+
+  Description [The new fanin should precede the object in the manager and
+  should differ from its other fanin. The fanins of an AND node are kept
+  ordered. The levels and the reverse levels are updated.
+  The structural hashing table is not updated. The SoA view, if any,
+  becomes stale.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManLevelIncPatchFanin( Gia_Man_t * p, int iObj, int iFanin, int iLitNew )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p, iObj );
+    int iFaninOld, iLit0, iLit1;
+    assert( p->pLevInc != NULL );
+    assert( Abc_Lit2Var(iLitNew) < iObj );
+    if ( Gia_ObjIsCo(pObj) )
+    {
+        assert( iFanin == 0 );
+        iFaninOld = Gia_ObjFaninId0( pObj, iObj );
+        Gia_ObjRemoveFanout( p, Gia_ObjFanin0(pObj), pObj );
+        pObj->iDiff0  = iObj - Abc_Lit2Var(iLitNew);
+        pObj->fCompl0 = Abc_LitIsCompl(iLitNew);
+        Gia_ObjAddFanout( p, Gia_ObjFanin0(pObj), pObj );
+        Gia_ManLevelIncUpdate( p, iObj );
+        Gia_ManLevelIncUpdateR( p, iFaninOld );
+        Gia_ManLevelIncUpdateR( p, Abc_Lit2Var(iLitNew) );
+        return;
+    }
+    assert( Gia_ObjIsAnd(pObj) && !Gia_ObjIsXor(pObj) );
+    assert( iFanin == 0 || iFanin == 1 );
+    iFaninOld = iFanin ? Gia_ObjFaninId1(pObj, iObj) : Gia_ObjFaninId0(pObj, iObj);
+    iLit0 = iFanin ? Gia_ObjFaninLit0(pObj, iObj) : iLitNew;
+    iLit1 = iFanin ? iLitNew : Gia_ObjFaninLit1(pObj, iObj);
+    assert( Abc_Lit2Var(iLit0) != Abc_Lit2Var(iLit1) );
+    if ( iLit0 > iLit1 )
+        ABC_SWAP( int, iLit0, iLit1 );
+    Gia_ObjRemoveFanout( p, Gia_ObjFanin0(pObj), pObj );
+    Gia_ObjRemoveFanout( p, Gia_ObjFanin1(pObj), pObj );
+    pObj->iDiff0  = iObj - Abc_Lit2Var(iLit0);
+    pObj->fCompl0 = Abc_LitIsCompl(iLit0);
+    pObj->iDiff1  = iObj - Abc_Lit2Var(iLit1);
+    pObj->fCompl1 = Abc_LitIsCompl(iLit1);
+    Gia_ObjAddFanout( p, Gia_ObjFanin0(pObj), pObj );
+    Gia_ObjAddFanout( p, Gia_ObjFanin1(pObj), pObj );
+    Gia_ManLevelIncUpdate( p, iObj );
+    Gia_ManLevelIncUpdateR( p, iFaninOld );
+    Gia_ManLevelIncUpdateR( p, Abc_Lit2Var(iLitNew) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Compares the levels with those computed from scratch.]
+
+  Description [Returns the number of objects with incorrect levels.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManLevelIncVerify( Gia_Man_t * p, int fVerbose )
+{
+    Vec_Int_t * vLevels, * vLevelR;
+    int i, nLevels = p->nLevels, Counter = 0;
+    assert( p->pLevInc != NULL );
+    vLevels = p->vLevels;
+    p->vLevels = NULL;
+    Gia_ManLevelNum( p );
+    vLevelR = Gia_ManReverseLevel( p );
+    for ( i = 0; i < Gia_ManObjNum(p); i++ )
+    {
+        if ( Vec_IntEntry(vLevels, i) == Gia_ObjLevelId(p, i) && Vec_IntEntry(p->pLevInc->vLevelR, i) == Vec_IntEntry(vLevelR, i) )
+            continue;
+        if ( fVerbose )
+            printf( "Object %6d has level %4d (expected %4d) and reverse level %4d (expected %4d).\n",
+                i, Vec_IntEntry(vLevels, i), Gia_ObjLevelId(p, i), Vec_IntEntry(p->pLevInc->vLevelR, i), Vec_IntEntry(vLevelR, i) );
+        Counter++;
+    }
+    if ( nLevels != p->nLevels )
+    {
+        if ( fVerbose )
+            printf( "The max level is %d (expected %d).\n", nLevels, p->nLevels );
+        Counter++;
+    }
+    Vec_IntFree( p->vLevels );
+    Vec_IntFree( vLevelR );
+    p->vLevels = vLevels;
+    p->nLevels = nLevels;
+    return Counter;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
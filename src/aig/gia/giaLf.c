@@ -23,6 +23,7 @@
 #include "misc/vec/vecSet.h"
 #include "misc/vec/vecMem.h"
 #include "misc/util/utilTruth.h"
+#include "opt/dau/dau.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -87,6 +88,8 @@ struct Lf_Man_t_
     Vec_Ptr_t       vMemSets;        // memory for cutsets
     Vec_Int_t       vFreeSets;       // free cutsets
     Vec_Mem_t *     vTtMem;          // truth tables
+    Dau_TtStore_t * pTtStore;        // shared truth tables (or NULL)
+    int             nTtStart;        // shared truth tables added before this manager
     Vec_Ptr_t       vFreePages;      // free memory pages
     Lf_Mem_t        vStoreOld;       // previous cuts
     Lf_Mem_t        vStoreNew;       // current cuts
@@ -140,6 +143,31 @@ extern int Kit_TruthToGia( Gia_Man_t * pMan, unsigned * pTruth, int nVars, Vec_I
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
+/**Function*************************************************************
+
+  Synopsis    [Adds the truth table and returns its ID.]
+
+  Description [When the shared store is full, the manager continues
+  with a private copy of the shared truth tables.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Lf_ManTtInsert( Lf_Man_t * p, word * pTruth )
+{
+    int iFunc;
+    if ( p->pTtStore == NULL )
+        return Vec_MemHashInsert( p->vTtMem, pTruth );
+    iFunc = Dau_TtStoreInsert( p->pTtStore, p->pPars->nLutSize, pTruth );
+    if ( iFunc >= 0 )
+        return iFunc;
+    p->vTtMem   = Dau_TtStoreMemDup( p->pTtStore, p->pPars->nLutSize );
+    p->pTtStore = NULL;
+    return Vec_MemHashInsert( p->vTtMem, pTruth );
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -975,7 +1003,7 @@ static inline int Lf_CutComputeTruth6( Lf_Man_t * p, Lf_Cut_t * pCut0, Lf_Cut_t
     if ( (fCompl = (int)(t & 1)) ) t = ~t;
     pCutR->nLeaves = Abc_Tt6MinBase( &t, pCutR->pLeaves, pCutR->nLeaves );
     assert( (int)(t & 1) == 0 );
-    truthId        = Vec_MemHashInsert(p->vTtMem, &t);
+    truthId        = Lf_ManTtInsert(p, &t);
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
 //    p->nCutMux += Lf_ManTtIsMux( t );
     assert( (int)pCutR->nLeaves <= nOldSupp );
@@ -1004,7 +1032,7 @@ static inline int Lf_CutComputeTruth( Lf_Man_t * p, Lf_Cut_t * pCut0, Lf_Cut_t *
     pCutR->nLeaves = Abc_TtMinBase( uTruth, pCutR->pLeaves, pCutR->nLeaves, LutSize );
     assert( (uTruth[0] & 1) == 0 );
 //Kit_DsdPrintFromTruth( uTruth, pCutR->nLeaves ), printf("\n" ), printf("\n" );
-    truthId        = Vec_MemHashInsert(p->vTtMem, uTruth);
+    truthId        = Lf_ManTtInsert(p, uTruth);
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
     assert( (int)pCutR->nLeaves <= nOldSupp );
     return (int)pCutR->nLeaves < nOldSupp;
@@ -1026,7 +1054,7 @@ static inline int Lf_CutComputeTruthMux6( Lf_Man_t * p, Lf_Cut_t * pCut0, Lf_Cut
     if ( (fCompl = (int)(t & 1)) ) t = ~t;
     pCutR->nLeaves = Abc_Tt6MinBase( &t, pCutR->pLeaves, pCutR->nLeaves );
     assert( (int)(t & 1) == 0 );
-    truthId        = Vec_MemHashInsert(p->vTtMem, &t);
+    truthId        = Lf_ManTtInsert(p, &t);
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
     assert( (int)pCutR->nLeaves <= nOldSupp );
     return (int)pCutR->nLeaves < nOldSupp;
@@ -1054,7 +1082,7 @@ static inline int Lf_CutComputeTruthMux( Lf_Man_t * p, Lf_Cut_t * pCut0, Lf_Cut_
     if ( fCompl ) Abc_TtNot( uTruth, nWords );
     pCutR->nLeaves = Abc_TtMinBase( uTruth, pCutR->pLeaves, pCutR->nLeaves, LutSize );
     assert( (uTruth[0] & 1) == 0 );
-    truthId        = Vec_MemHashInsert(p->vTtMem, uTruth);
+    truthId        = Lf_ManTtInsert(p, uTruth);
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
     assert( (int)pCutR->nLeaves <= nOldSupp );
     return (int)pCutR->nLeaves < nOldSupp;
@@ -1938,6 +1966,7 @@ Gia_Man_t * Lf_ManDeriveMappingGia( Lf_Man_t * p )
 Lf_Man_t * Lf_ManAlloc( Gia_Man_t * pGia, Jf_Par_t * pPars )
 {
     Lf_Man_t * p; int i, k = 0;
+    extern void * Abc_FrameReadTtStore();
     assert( pPars->nCutNum > 1  && pPars->nCutNum <= LF_CUT_MAX );
     assert( pPars->nLutSize > 1 && pPars->nLutSize <= LF_LEAF_MAX );
     ABC_FREE( pGia->pRefs );
@@ -1954,7 +1983,14 @@ Lf_Man_t * Lf_ManAlloc( Gia_Man_t * pGia, Jf_Par_t * pPars )
     p->pPars     = pPars;
     p->nCutWords = (sizeof(Lf_Cut_t)/sizeof(int) + pPars->nLutSize + 1) >> 1;
     p->nSetWords = p->nCutWords * pPars->nCutNum;
-    p->vTtMem    = pPars->fCutMin ? Vec_MemAllocForTT( pPars->nLutSize, 0 ) : NULL;
+    // the truth tables are shared with other mappers unless MUX functions are added to them
+    if ( pPars->fCutMin && !pPars->fUseMux7 )
+        p->pTtStore = (Dau_TtStore_t *)Abc_FrameReadTtStore();
+    if ( p->pTtStore )
+        p->vTtMem = Dau_TtStoreMem( p->pTtStore, pPars->nLutSize );
+    else
+        p->vTtMem = pPars->fCutMin ? Vec_MemAllocForTT( pPars->nLutSize, 0 ) : NULL;
+    p->nTtStart  = p->pTtStore ? Vec_MemEntryNum( p->vTtMem ) : 0;
     if ( pPars->fCutMin && pPars->fUseMux7 )
         Vec_MemAddMuxTT( p->vTtMem, pPars->nLutSize );
     p->pObjBests = ABC_CALLOC( Lf_Bst_t, Gia_ManAndNotBufNum(pGia) );
@@ -1982,9 +2018,9 @@ void Lf_ManFree( Lf_Man_t * p )
 {
     ABC_FREE( p->pPars->pTimesArr );
     ABC_FREE( p->pPars->pTimesReq );
-    if ( p->pPars->fCutMin )
+    if ( p->pPars->fCutMin && p->pTtStore == NULL )
         Vec_MemHashFree( p->vTtMem );
-    if ( p->pPars->fCutMin )
+    if ( p->pPars->fCutMin && p->pTtStore == NULL )
         Vec_MemFree( p->vTtMem );
     Vec_PtrFreeData( &p->vMemSets );
     Vec_PtrFreeData( &p->vFreePages );
@@ -2088,7 +2124,7 @@ void Lf_ManPrintQuit( Lf_Man_t * p, Gia_Man_t * pNew )
     float MemMan   = 1.0 * sizeof(int) * (2 * Gia_ManObjNum(p->pGia) + 3 * Gia_ManAndNotBufNum(p->pGia)) / (1<<20); // offset, required, cutsets, maprefs, flowrefs
     float MemCutsB = 1.0 * (p->vStoreOld.MaskPage + 1) * (Vec_PtrSize(&p->vFreePages) + Vec_PtrSize(&p->vStoreOld.vPages)) / (1<<20) + 1.0 * sizeof(Lf_Bst_t) * Gia_ManAndNotBufNum(p->pGia) / (1<<20);
     float MemCutsF = 1.0 * sizeof(word) * p->nSetWords * (1<<LF_LOG_PAGE) * Vec_PtrSize(&p->vMemSets) / (1<<20);
-    float MemTt    = p->vTtMem ? Vec_MemMemory(p->vTtMem) / (1<<20) : 0;
+    float MemTt    = p->pTtStore ? Vec_MemMemoryFrom(p->vTtMem, p->nTtStart) / (1<<20) : p->vTtMem ? Vec_MemMemory(p->vTtMem) / (1<<20) : 0;
     float MemMap   = Vec_IntMemory(pNew->vMapping) / (1<<20);
     if ( p->CutCount[0] == 0 )
         p->CutCount[0] = 1;
@@ -2123,7 +2159,9 @@ void Lf_ManPrintQuit( Lf_Man_t * p, Gia_Man_t * pNew )
             printf( "%d:%d  ", i, p->nCutCounts[i] );
         printf( "Equal = %d (%.0f %%) ", p->nCutEqual, 100.0 * p->nCutEqual / p->Iter / Gia_ManAndNotBufNum(p->pGia) );
         if ( p->vTtMem )
-            printf( "TT = %d (%.2f %%)  ", Vec_MemEntryNum(p->vTtMem), 100.0 * Vec_MemEntryNum(p->vTtMem) / p->CutCount[2] );
+            printf( "TT = %d (%.2f %%)  ", Vec_MemEntryNum(p->vTtMem) - p->nTtStart, 100.0 * (Vec_MemEntryNum(p->vTtMem) - p->nTtStart) / p->CutCount[2] );
+        if ( p->pTtStore )
+            printf( "Shared TT = %d  ", Vec_MemEntryNum(p->vTtMem) );
         if ( p->pGia->pMuxes && p->nCutMux )
             printf( "MuxTT = %d (%.0f %%) ", p->nCutMux, 100.0 * p->nCutMux / p->Iter / Gia_ManMuxNum(p->pGia) );
         printf( "\n" );
@@ -2139,6 +2177,7 @@ void Lf_ManComputeMapping( Lf_Man_t * p )
 {
     Gia_Obj_t * pObj;
     int i, arrTime;
+    abctime clk = Abc_Clock();
     assert( p->vStoreNew.iCur == 0 );
     Lf_ManSetCutRefs( p );
     if ( p->pGia->pManTime != NULL )
@@ -2173,6 +2212,14 @@ void Lf_ManComputeMapping( Lf_Man_t * p )
     }
     Lf_MemRecycle( &p->vStoreOld );
     ABC_SWAP( Lf_Mem_t, p->vStoreOld, p->vStoreNew );
+    // the cuts are recomputed in each round; report the first one
+    if ( p->Iter == 0 )
+    {
+        p->pPars->Cuts    = (word)p->CutCount[3];
+        p->pPars->CutMem  = (word)(p->vStoreOld.MaskPage + 1) * (Vec_PtrSize(&p->vFreePages) + Vec_PtrSize(&p->vStoreOld.vPages)) + 
+            (word)sizeof(Lf_Bst_t) * Gia_ManAndNotBufNum(p->pGia) + (word)sizeof(word) * p->nSetWords * (1<<LF_LOG_PAGE) * Vec_PtrSize(&p->vMemSets);
+        p->pPars->CutTime = Abc_Clock() - clk;
+    }
     if ( p->fUseEla )
         Lf_ManCountMapRefs( p );
     else
@@ -2222,7 +2269,7 @@ Gia_Man_t * Lf_ManPerformMappingInt( Gia_Man_t * pGia, Jf_Par_t * pPars )
     }
 
     if ( pPars->fVeryVerbose && pPars->fCutMin )
-        Vec_MemDumpTruthTables( p->vTtMem, Gia_ManName(p->pGia), pPars->nLutSize );
+        Vec_MemDumpTruthTablesFrom( p->vTtMem, Gia_ManName(p->pGia), pPars->nLutSize, p->nTtStart );
     if ( pPars->fCutMin )
         pNew = Lf_ManDeriveMappingGia( p );
     else if ( pPars->fCoarsen )
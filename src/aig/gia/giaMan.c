@@ -84,6 +84,9 @@ void Gia_ManStop( Gia_Man_t * p )
     if ( p->vSeqModelVec )
         Vec_PtrFreeFree( p->vSeqModelVec );
     Gia_ManStaticFanoutStop( p );
+    Gia_ManSoaStop( p, 0 );
+    Gia_ManArenaStop( p );
+    Gia_ManLevelIncStop( p );
     Tim_ManStopP( (Tim_Man_t **)&p->pManTime );
     assert( p->pManTime == NULL );
     Vec_PtrFreeFree( p->vNamesIn );
@@ -95,6 +98,7 @@ void Gia_ManStop( Gia_Man_t * p )
     Vec_IntFreeP( &p->vClassNew );
     Vec_IntFreeP( &p->vClassOld );
     Vec_IntFreeP( &p->vPats );
+    Vec_WrdFreeP( &p->vPatStore );
     Vec_BitFreeP( &p->vPolars );
     Vec_WrdFreeP( &p->vSims );
     Vec_WrdFreeP( &p->vSimsT );
@@ -198,6 +202,7 @@ double Gia_ManMemory( Gia_Man_t * p )
     Memory += sizeof(int) * Gia_ManCiNum(p);
     Memory += sizeof(int) * Gia_ManCoNum(p);
     Memory += sizeof(int) * Vec_IntSize(&p->vHTable);
+    Memory += sizeof(int) * Vec_IntSize(&p->vHash);
     Memory += sizeof(int) * Gia_ManObjNum(p) * (p->pRefs != NULL);
     Memory += Vec_IntMemory( p->vLevels );
     Memory += Vec_IntMemory( p->vCellMapping );
@@ -207,6 +212,7 @@ double Gia_ManMemory( Gia_Man_t * p )
     Memory += Vec_PtrMemory( p->vNamesIn );
     Memory += Vec_PtrMemory( p->vNamesOut );
     Memory += Vec_PtrMemory( p->vNamesNode );
+    Memory += Gia_ManArenaMemory( p );
     return Memory;
 }
 
@@ -376,9 +376,15 @@ char * Gia_MmFlexEntryFetch( Gia_MmFlex_t * p, int nBytes )
         }
         if ( nBytes > p->nChunkSize )
         {
-            // resize the chunk size if more memory is requested than it can give
-            // (ideally, this should never happen)
-            p->nChunkSize = 2 * nBytes;
+            // give the entry its own chunk if more memory is requested than
+            // a chunk can give; the current chunk remains in use and all the
+            // chunks stay at least nChunkSize bytes long, as needed by restart
+            pTemp = ABC_ALLOC( char, nBytes );
+            p->nMemoryAlloc += nBytes;
+            p->pChunks[ p->nChunks++ ] = pTemp;
+            p->nEntriesUsed++;
+            p->nMemoryUsed += nBytes;
+            return pTemp;
         }
         p->pCurrent = ABC_ALLOC( char, p->nChunkSize );
         p->pEnd     = p->pCurrent + p->nChunkSize;
@@ -441,6 +447,142 @@ int Gia_MmFlexReadMemUsage( Gia_MmFlex_t * p )
     return p->nMemoryUsed;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Remembers the current state of the manager.]
+
+  Description [The entries fetched after the mark can be released in one
+  call to Gia_MmFlexRelease(), while those fetched before remain valid.
+  Marks can be nested as long as they are released in the reverse order.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_MmFlexMark( Gia_MmFlex_t * p, Gia_MmFlexMark_t * pMark )
+{
+    pMark->nChunks      = p->nChunks;
+    pMark->pCurrent     = p->pCurrent;
+    pMark->pEnd         = p->pEnd;
+    pMark->nEntriesUsed = p->nEntriesUsed;
+    pMark->nMemoryUsed  = p->nMemoryUsed;
+    pMark->nMemoryAlloc = p->nMemoryAlloc;
+}
+void Gia_MmFlexRelease( Gia_MmFlex_t * p, Gia_MmFlexMark_t * pMark )
+{
+    int i;
+    assert( pMark->nChunks <= p->nChunks );
+    for ( i = pMark->nChunks; i < p->nChunks; i++ )
+        ABC_FREE( p->pChunks[i] );
+    p->nChunks      = pMark->nChunks;
+    p->pCurrent     = pMark->pCurrent;
+    p->pEnd         = pMark->pEnd;
+    p->nEntriesUsed = pMark->nEntriesUsed;
+    p->nMemoryUsed  = pMark->nMemoryUsed;
+    p->nMemoryAlloc = pMark->nMemoryAlloc;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Scratch arena of the AIG manager.]
+
+  Description [The arena is a flexible memory manager attached to the AIG
+  manager. It is started on the first request and deleted together with
+  the manager. A pass takes a mark before allocating its scratch data
+  and releases it when done, which frees all the scratch memory at once.
+  All the entries are aligned on the 8-byte boundary. The arena is meant
+  for many small entries, such as the growing node arrays of a pass.
+  A one-shot buffer proportional to the number of objects should be
+  allocated with ABC_ALLOC() and freed after use, because it does not
+  fit into a chunk and would take a dedicated one anyway.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_MmFlex_t * Gia_ManArena( Gia_Man_t * p )
+{
+    if ( p->pArena == NULL )
+        p->pArena = Gia_MmFlexStart();
+    return p->pArena;
+}
+void Gia_ManArenaStop( Gia_Man_t * p )
+{
+    Gia_MmFlexStop( p->pArena, 0 );
+    p->pArena = NULL;
+}
+void Gia_ManArenaReset( Gia_Man_t * p )
+{
+    if ( p->pArena )
+        Gia_MmFlexRestart( p->pArena );
+}
+void Gia_ManArenaMark( Gia_Man_t * p, Gia_MmFlexMark_t * pMark )
+{
+    Gia_MmFlexMark( Gia_ManArena(p), pMark );
+}
+void Gia_ManArenaRelease( Gia_Man_t * p, Gia_MmFlexMark_t * pMark )
+{
+    assert( p->pArena != NULL );
+    Gia_MmFlexRelease( p->pArena, pMark );
+}
+void * Gia_ManArenaAlloc( Gia_Man_t * p, int nBytes )
+{
+    return Gia_MmFlexEntryFetch( Gia_ManArena(p), (nBytes + 7) & ~7 );
+}
+int Gia_ManArenaMemory( Gia_Man_t * p )
+{
+    return p->pArena ? p->pArena->nMemoryAlloc : 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Vectors allocated in the scratch arena.]
+
+  Description [Both the vector and its array are in the arena, so the
+  vector is never freed by the user. Such a vector can be used with the
+  read-only and write-entry Vec_Int/Vec_Wrd APIs, while the entries are
+  added using Gia_ManArenaVecIntPush(), which moves the array into
+  a larger arena entry when the capacity is exceeded.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * Gia_ManArenaVecIntAlloc( Gia_Man_t * p, int nCap )
+{
+    Vec_Int_t * v = (Vec_Int_t *)Gia_ManArenaAlloc( p, sizeof(Vec_Int_t) );
+    v->nCap   = Abc_MaxInt( nCap, 16 );
+    v->nSize  = 0;
+    v->pArray = (int *)Gia_ManArenaAlloc( p, sizeof(int) * v->nCap );
+    return v;
+}
+Vec_Int_t * Gia_ManArenaVecIntStart( Gia_Man_t * p, int nSize )
+{
+    Vec_Int_t * v = Gia_ManArenaVecIntAlloc( p, nSize );
+    memset( v->pArray, 0, sizeof(int) * nSize );
+    v->nSize = nSize;
+    return v;
+}
+void Gia_ManArenaVecIntGrow( Gia_Man_t * p, Vec_Int_t * v )
+{
+    int * pArray = (int *)Gia_ManArenaAlloc( p, sizeof(int) * 2 * v->nCap );
+    memcpy( pArray, v->pArray, sizeof(int) * v->nSize );
+    v->pArray = pArray;
+    v->nCap  *= 2;
+}
+Vec_Wrd_t * Gia_ManArenaVecWrdStart( Gia_Man_t * p, int nSize )
+{
+    Vec_Wrd_t * v = (Vec_Wrd_t *)Gia_ManArenaAlloc( p, sizeof(Vec_Wrd_t) );
+    v->nCap   = Abc_MaxInt( nSize, 16 );
+    v->nSize  = nSize;
+    v->pArray = (word *)Gia_ManArenaAlloc( p, sizeof(word) * v->nCap );
+    memset( v->pArray, 0, sizeof(word) * nSize );
+    return v;
+}
+
 
 
 
@@ -25,6 +25,7 @@
 #include "sat/cnf/cnf.h"
 #include "opt/dau/dau.h"
 #include "bool/kit/kit.h"
+#include "misc/util/utilPool.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -39,6 +40,8 @@ ABC_NAMESPACE_IMPL_START
 #define MF_TT_WORDS  ((MF_LEAF_MAX > 6) ? 1 << (MF_LEAF_MAX-6) : 1)
 #define MF_NO_FUNC    134217727     // (1<<27)-1
 #define MF_EPSILON 0.005
+#define MF_PROC_MAX   64
+#define MF_PAR_MIN  1000            // the smallest slice of a wavefront processed by a thread
 
 typedef struct Mf_Cut_t_ Mf_Cut_t; 
 struct Mf_Cut_t_
@@ -70,6 +73,8 @@ struct Mf_Man_t_
     Mf_Obj_t *      pLfObjs;        // best cuts
     Vec_Ptr_t       vPages;         // cut memory
     Vec_Mem_t *     vTtMem;         // truth tables
+    Dau_TtStore_t * pTtStore;       // shared truth tables (or NULL)
+    int             nTtStart;       // shared truth tables added before this manager
     Vec_Int_t       vCnfSizes;      // handles to CNF
     Vec_Int_t       vCnfMem;        // memory for CNF
     Vec_Int_t       vTemp;          // temporary array
@@ -81,6 +86,16 @@ struct Mf_Man_t_
     double          CutCount[4];    // cut counts
     int             nCutCounts[MF_LEAF_MAX+1];
 };
+typedef struct Mf_Thr_t_ Mf_Thr_t; 
+struct Mf_Thr_t_
+{
+    Mf_Man_t *      p;              // mapping manager
+    int *           pNodes;         // the slice of the wavefront
+    int             nNodes;         // the number of nodes in the slice
+    Vec_Int_t       vCuts;          // cut sets of the nodes (thread-local)
+    double          CutCount[4];    // cut counts
+    int             nCutCounts[MF_LEAF_MAX+1];
+};
 
 static inline Mf_Obj_t * Mf_ManObj( Mf_Man_t * p, int i )            { return p->pLfObjs + i;                                          }
 static inline int *      Mf_ManCutSet( Mf_Man_t * p, int i )         { return (int *)Vec_PtrEntry(&p->vPages, i >> 16) + (i & 0xFFFF); }
@@ -105,6 +120,31 @@ extern int Kit_TruthToGia( Gia_Man_t * pMan, unsigned * pTruth, int nVars, Vec_I
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
+/**Function*************************************************************
+
+  Synopsis    [Adds the truth table and returns its ID.]
+
+  Description [When the shared store is full, the manager continues
+  with a private copy of the shared truth tables.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Mf_ManTtInsert( Mf_Man_t * p, word * pTruth )
+{
+    int iFunc;
+    if ( p->pTtStore == NULL )
+        return Vec_MemHashInsert( p->vTtMem, pTruth );
+    iFunc = Dau_TtStoreInsert( p->pTtStore, p->pPars->nLutSize, pTruth );
+    if ( iFunc >= 0 )
+        return iFunc;
+    p->vTtMem   = Dau_TtStoreMemDup( p->pTtStore, p->pPars->nLutSize );
+    p->pTtStore = NULL;
+    return Vec_MemHashInsert( p->vTtMem, pTruth );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Computing truth tables of useful DSD classes of 6-functions.]
@@ -556,7 +596,7 @@ static inline int Mf_CutComputeTruth6( Mf_Man_t * p, Mf_Cut_t * pCut0, Mf_Cut_t
     if ( !p->pPars->fCnfObjIds )
     pCutR->nLeaves = Abc_Tt6MinBase( &t, pCutR->pLeaves, pCutR->nLeaves );
     assert( (int)(t & 1) == 0 );
-    truthId        = Vec_MemHashInsert(p->vTtMem, &t);
+    truthId        = Mf_ManTtInsert(p, &t);
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
     if ( (p->pPars->fGenCnf || p->pPars->fGenLit) && truthId == Vec_IntSize(&p->vCnfSizes) )
         Vec_IntPush( &p->vCnfSizes, p->pPars->fGenCnf ? Abc_Tt6CnfSize(t, pCutR->nLeaves) : Kit_TruthLitNum((unsigned *)&t, pCutR->nLeaves, &p->vCnfMem) );
@@ -587,7 +627,7 @@ static inline int Mf_CutComputeTruth( Mf_Man_t * p, Mf_Cut_t * pCut0, Mf_Cut_t *
     pCutR->nLeaves = Abc_TtMinBase( uTruth, pCutR->pLeaves, pCutR->nLeaves, LutSize );
     assert( (uTruth[0] & 1) == 0 );
 //Kit_DsdPrintFromTruth( uTruth, pCutR->nLeaves ), printf("\n" ), printf("\n" );
-    truthId        = Vec_MemHashInsert(p->vTtMem, uTruth);
+    truthId        = Mf_ManTtInsert(p, uTruth);
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
     if ( (p->pPars->fGenCnf || p->pPars->fGenLit) && truthId == Vec_IntSize(&p->vCnfSizes) && LutSize <= 8 )
         Vec_IntPush( &p->vCnfSizes, p->pPars->fGenCnf ? Abc_Tt8CnfSize(uTruth, pCutR->nLeaves) : Kit_TruthLitNum((unsigned *)uTruth, pCutR->nLeaves, &p->vCnfMem) );
@@ -611,7 +651,7 @@ static inline int Mf_CutComputeTruthMux6( Mf_Man_t * p, Mf_Cut_t * pCut0, Mf_Cut
     if ( (fCompl = (int)(t & 1)) ) t = ~t;
     pCutR->nLeaves = Abc_Tt6MinBase( &t, pCutR->pLeaves, pCutR->nLeaves );
     assert( (int)(t & 1) == 0 );
-    truthId        = Vec_MemHashInsert(p->vTtMem, &t);
+    truthId        = Mf_ManTtInsert(p, &t);
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
     if ( (p->pPars->fGenCnf || p->pPars->fGenLit) && truthId == Vec_IntSize(&p->vCnfSizes) )
         Vec_IntPush( &p->vCnfSizes, p->pPars->fGenCnf ? Abc_Tt6CnfSize(t, pCutR->nLeaves) : Kit_TruthLitNum((unsigned *)&t, pCutR->nLeaves, &p->vCnfMem) );
@@ -641,7 +681,7 @@ static inline int Mf_CutComputeTruthMux( Mf_Man_t * p, Mf_Cut_t * pCut0, Mf_Cut_
     if ( fCompl ) Abc_TtNot( uTruth, nWords );
     pCutR->nLeaves = Abc_TtMinBase( uTruth, pCutR->pLeaves, pCutR->nLeaves, LutSize );
     assert( (uTruth[0] & 1) == 0 );
-    truthId        = Vec_MemHashInsert(p->vTtMem, uTruth);
+    truthId        = Mf_ManTtInsert(p, uTruth);
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
     if ( (p->pPars->fGenCnf || p->pPars->fGenLit) && truthId == Vec_IntSize(&p->vCnfSizes) && LutSize <= 8 )
         Vec_IntPush( &p->vCnfSizes, p->pPars->fGenCnf ? Abc_Tt8CnfSize(uTruth, pCutR->nLeaves) : Kit_TruthLitNum((unsigned *)uTruth, pCutR->nLeaves, &p->vCnfMem) );
@@ -729,16 +769,22 @@ static inline int Mf_ManPrepareCuts( Mf_Cut_t * pCuts, Mf_Man_t * p, int iObj, i
     }
     return Mf_CutCreateUnit( pCuts, iObj );
 }
-static inline int Mf_ManSaveCuts( Mf_Man_t * p, Mf_Cut_t ** pCuts, int nCuts )
+static inline int Mf_ManAllocCuts( Mf_Man_t * p, int nInts )
 {
-    int i, * pPlace, iCur, nInts = 1;
-    for ( i = 0; i < nCuts; i++ )
-        nInts += pCuts[i]->nLeaves + 1;
+    int iCur;
     if ( (p->iCur & 0xFFFF) + nInts > 0xFFFF )
         p->iCur = ((p->iCur >> 16) + 1) << 16;
     if ( Vec_PtrSize(&p->vPages) == (p->iCur >> 16) )
         Vec_PtrPush( &p->vPages, ABC_ALLOC(int, (1<<16)) );
     iCur = p->iCur; p->iCur += nInts;
+    return iCur;
+}
+static inline int Mf_ManSaveCuts( Mf_Man_t * p, Mf_Cut_t ** pCuts, int nCuts )
+{
+    int i, * pPlace, iCur, nInts = 1;
+    for ( i = 0; i < nCuts; i++ )
+        nInts += pCuts[i]->nLeaves + 1;
+    iCur = Mf_ManAllocCuts( p, nInts );
     pPlace = Mf_ManCutSet( p, iCur );
     *pPlace++ = nCuts;
     for ( i = 0; i < nCuts; i++ )
@@ -749,6 +795,26 @@ static inline int Mf_ManSaveCuts( Mf_Man_t * p, Mf_Cut_t ** pCuts, int nCuts )
     }
     return iCur;
 }
+static inline void Mf_SetWriteCuts( Vec_Int_t * vCuts, Mf_Cut_t ** pCuts, int nCuts )
+{
+    int i, k;
+    Vec_IntPush( vCuts, nCuts );
+    for ( i = 0; i < nCuts; i++ )
+    {
+        Vec_IntPush( vCuts, Mf_CutSetBoth(pCuts[i]->nLeaves, pCuts[i]->iFunc) );
+        for ( k = 0; k < (int)pCuts[i]->nLeaves; k++ )
+            Vec_IntPush( vCuts, pCuts[i]->pLeaves[k] );
+    }
+}
+static inline int Mf_ManCopyCuts( Mf_Man_t * p, int * pList, int * pnInts )
+{
+    int i, * pCut, iCur;
+    Mf_SetForEachCut( pList, pCut, i );
+    *pnInts = pCut - pList;
+    iCur = Mf_ManAllocCuts( p, *pnInts );
+    memcpy( Mf_ManCutSet(p, iCur), pList, sizeof(int) * *pnInts );
+    return iCur;
+}
 static inline void Mf_ObjSetBestCut( int * pCuts, int * pCut )
 {
     assert( pCuts < pCut );
@@ -1023,9 +1089,9 @@ static inline void Mf_CutParams( Mf_Man_t * p, Mf_Cut_t * pCut, float FlowRefs )
     pCut->Delay += (int)(nLeaves > 1);
     pCut->Flow = (pCut->Flow + Mf_CutArea(p, nLeaves, pCut->iFunc)) / FlowRefs;
 }
-void Mf_ObjMergeOrder( Mf_Man_t * p, int iObj )
+int Mf_ObjMergeCuts( Mf_Man_t * p, int iObj, Mf_Cut_t * pCuts, Mf_Cut_t ** pCutsR, double * pCutCount, int * pnCutCounts )
 {
-    Mf_Cut_t pCuts0[MF_CUT_MAX], pCuts1[MF_CUT_MAX], pCuts[MF_CUT_MAX], * pCutsR[MF_CUT_MAX];
+    Mf_Cut_t pCuts0[MF_CUT_MAX], pCuts1[MF_CUT_MAX];
     Gia_Obj_t * pObj = Gia_ManObj(p->pGia, iObj);
     Mf_Obj_t * pBest = Mf_ManObj(p, iObj);
     int nLutSize = p->pPars->nLutSize;
@@ -1061,19 +1127,19 @@ void Mf_ObjMergeOrder( Mf_Man_t * p, int iObj )
         int nCuts2  = Mf_ManPrepareCuts(pCuts2, p, Gia_ObjFaninId2(p->pGia, iObj), 1);
         int fComp2  = Gia_ObjFaninC2(p->pGia, pObj);
         Mf_Cut_t * pCut2, * pCut2Lim = pCuts2 + nCuts2;
-        p->CutCount[0] += nCuts0 * nCuts1 * nCuts2;
+        pCutCount[0] += nCuts0 * nCuts1 * nCuts2;
         for ( pCut0 = pCuts0; pCut0 < pCut0Lim; pCut0++ )
         for ( pCut1 = pCuts1; pCut1 < pCut1Lim; pCut1++ )
         for ( pCut2 = pCuts2; pCut2 < pCut2Lim; pCut2++ )
         {
             if ( Mf_CutCountBits(pCut0->Sign | pCut1->Sign | pCut2->Sign) > nLutSize )
                 continue;
-            p->CutCount[1]++; 
+            pCutCount[1]++; 
             if ( !Mf_CutMergeOrderMux(pCut0, pCut1, pCut2, pCutsR[nCutsR], nLutSize) )
                 continue;
             if ( Mf_SetLastCutIsContained(pCutsR, nCutsR) )
                 continue;
-            p->CutCount[2]++;
+            pCutCount[2]++;
             if ( p->pPars->fCutMin && Mf_CutComputeTruthMux(p, pCut0, pCut1, pCut2, fComp0, fComp1, fComp2, pCutsR[nCutsR]) )
                 pCutsR[nCutsR]->Sign = Mf_CutGetSign(pCutsR[nCutsR]->pLeaves, pCutsR[nCutsR]->nLeaves);
             Mf_CutParams( p, pCutsR[nCutsR], pBest->nFlowRefs );
@@ -1083,18 +1149,18 @@ void Mf_ObjMergeOrder( Mf_Man_t * p, int iObj )
     else
     {
         int fIsXor = Gia_ObjIsXor(pObj);
-        p->CutCount[0] += nCuts0 * nCuts1;
+        pCutCount[0] += nCuts0 * nCuts1;
         for ( pCut0 = pCuts0; pCut0 < pCut0Lim; pCut0++ )
         for ( pCut1 = pCuts1; pCut1 < pCut1Lim; pCut1++ )
         {
             if ( (int)(pCut0->nLeaves + pCut1->nLeaves) > nLutSize && Mf_CutCountBits(pCut0->Sign | pCut1->Sign) > nLutSize )
                 continue;
-            p->CutCount[1]++; 
+            pCutCount[1]++; 
             if ( !Mf_CutMergeOrder(pCut0, pCut1, pCutsR[nCutsR], nLutSize) )
                 continue;
             if ( Mf_SetLastCutIsContained(pCutsR, nCutsR) )
                 continue;
-            p->CutCount[2]++;
+            pCutCount[2]++;
             if ( p->pPars->fCutMin && Mf_CutComputeTruth(p, pCut0, pCut1, fComp0, fComp1, pCutsR[nCutsR], fIsXor) )
                 pCutsR[nCutsR]->Sign = Mf_CutGetSign(pCutsR[nCutsR]->pLeaves, pCutsR[nCutsR]->nLeaves);
             Mf_CutParams( p, pCutsR[nCutsR], pBest->nFlowRefs );
@@ -1111,15 +1177,21 @@ void Mf_ObjMergeOrder( Mf_Man_t * p, int iObj )
             Mf_CutPrint( p, pCutsR[i] );
         printf( "\n" );
     } 
-    // store the cutset
+    // store the best cut parameters
     pBest->Flow = pCutsR[0]->Flow;
     pBest->Delay = pCutsR[0]->Delay;
-    pBest->iCutSet = Mf_ManSaveCuts( p, pCutsR, nCutsR );
     // verify
     assert( nCutsR > 0 && nCutsR < nCutNum );
 //    assert( Mf_SetCheckArray(pCutsR, nCutsR) );
-    p->nCutCounts[pCutsR[0]->nLeaves]++;
-    p->CutCount[3] += nCutsR;
+    pnCutCounts[pCutsR[0]->nLeaves]++;
+    pCutCount[3] += nCutsR;
+    return nCutsR;
+}
+void Mf_ObjMergeOrder( Mf_Man_t * p, int iObj )
+{
+    Mf_Cut_t pCuts[MF_CUT_MAX], * pCutsR[MF_CUT_MAX];
+    int nCutsR = Mf_ObjMergeCuts( p, iObj, pCuts, pCutsR, p->CutCount, p->nCutCounts );
+    Mf_ManObj(p, iObj)->iCutSet = Mf_ManSaveCuts( p, pCutsR, nCutsR );
 }
  
 
@@ -1383,6 +1455,7 @@ Mf_Man_t * Mf_ManAlloc( Gia_Man_t * pGia, Jf_Par_t * pPars )
     Mf_Man_t * p;
     Vec_Int_t * vFlowRefs;
     int i, Entry;
+    extern void * Abc_FrameReadTtStore();
     assert( pPars->nCutNum > 1  && pPars->nCutNum <= MF_CUT_MAX );
     assert( pPars->nLutSize > 1 && pPars->nLutSize <= MF_LEAF_MAX );
     ABC_FREE( pGia->pRefs );
@@ -1393,7 +1466,14 @@ Mf_Man_t * Mf_ManAlloc( Gia_Man_t * pGia, Jf_Par_t * pPars )
     p->clkStart  = Abc_Clock();
     p->pGia      = pGia;
     p->pPars     = pPars;
-    p->vTtMem    = pPars->fCutMin ? Vec_MemAllocForTT( pPars->nLutSize, 0 ) : NULL;
+    // the truth tables are shared with other mappers unless CNF data is attached to them
+    if ( pPars->fCutMin && !pPars->fGenCnf && !pPars->fGenLit )
+        p->pTtStore = (Dau_TtStore_t *)Abc_FrameReadTtStore();
+    if ( p->pTtStore )
+        p->vTtMem = Dau_TtStoreMem( p->pTtStore, pPars->nLutSize );
+    else
+        p->vTtMem = pPars->fCutMin ? Vec_MemAllocForTT( pPars->nLutSize, 0 ) : NULL;
+    p->nTtStart  = p->pTtStore ? Vec_MemEntryNum( p->vTtMem ) : 0;
     p->pLfObjs   = ABC_CALLOC( Mf_Obj_t, Gia_ManObjNum(pGia) );
     p->iCur      = 2;
     Vec_PtrGrow( &p->vPages, 256 );
@@ -1414,9 +1494,9 @@ Mf_Man_t * Mf_ManAlloc( Gia_Man_t * pGia, Jf_Par_t * pPars )
 void Mf_ManFree( Mf_Man_t * p )
 {
     assert( !p->pPars->fGenCnf || !p->pPars->fGenLit || Vec_IntSize(&p->vCnfSizes) == Vec_MemEntryNum(p->vTtMem) );
-    if ( p->pPars->fCutMin )
+    if ( p->pPars->fCutMin && p->pTtStore == NULL )
         Vec_MemHashFree( p->vTtMem );
-    if ( p->pPars->fCutMin )
+    if ( p->pPars->fCutMin && p->pTtStore == NULL )
         Vec_MemFree( p->vTtMem );
     Vec_PtrFreeData( &p->vPages );
     ABC_FREE( p->vCnfSizes.pArray );
@@ -1462,6 +1542,7 @@ void Mf_ManSetDefaultPars( Jf_Par_t * pPars )
     pPars->fVeryVerbose =  0;
     pPars->nLutSizeMax  =  MF_LEAF_MAX;
     pPars->nCutNumMax   =  MF_CUT_MAX;
+    pPars->nProcNumMax  =  MF_PROC_MAX;
 }
 void Mf_ManPrintStats( Mf_Man_t * p, char * pTitle )
 {
@@ -1490,6 +1571,8 @@ void Mf_ManPrintInit( Mf_Man_t * p )
     printf( "Coarse = %d  ",  p->pPars->fCoarsen );
     printf( "CNF = %d  ",     p->pPars->fGenCnf );
     printf( "FFL = %d  ",     p->pPars->fGenLit );
+    if ( p->pPars->nProcNum > 1 )
+        printf( "Procs = %d  ", p->pPars->nProcNum );
     printf( "\n" );
     printf( "Computing cuts...\r" );
     fflush( stdout );
@@ -1499,7 +1582,7 @@ void Mf_ManPrintQuit( Mf_Man_t * p, Gia_Man_t * pNew )
     float MemGia   = Gia_ManMemory(p->pGia) / (1<<20);
     float MemMan   = 1.0 * sizeof(Mf_Obj_t) * Gia_ManObjNum(p->pGia) / (1<<20);
     float MemCuts  = 1.0 * sizeof(int) * (1 << 16) * Vec_PtrSize(&p->vPages) / (1<<20);
-    float MemTt    = p->vTtMem ? Vec_MemMemory(p->vTtMem) / (1<<20) : 0;
+    float MemTt    = p->pTtStore ? Vec_MemMemoryFrom(p->vTtMem, p->nTtStart) / (1<<20) : p->vTtMem ? Vec_MemMemory(p->vTtMem) / (1<<20) : 0;
     float MemMap   = Vec_IntMemory(pNew->vMapping) / (1<<20);
     if ( p->CutCount[0] == 0 )
         p->CutCount[0] = 1;
@@ -1523,16 +1606,137 @@ void Mf_ManPrintQuit( Mf_Man_t * p, Gia_Man_t * pNew )
         for ( i = 0; i <= p->pPars->nLutSize; i++ )
             printf( "%d = %d  ", i, p->nCutCounts[i] );
         if ( p->vTtMem )
-            printf( "TT = %d (%.2f %%)  ", Vec_MemEntryNum(p->vTtMem), 100.0 * Vec_MemEntryNum(p->vTtMem) / p->CutCount[2] );
+            printf( "TT = %d (%.2f %%)  ", Vec_MemEntryNum(p->vTtMem) - p->nTtStart, 100.0 * (Vec_MemEntryNum(p->vTtMem) - p->nTtStart) / p->CutCount[2] );
+        if ( p->pTtStore )
+            printf( "Shared TT = %d  ", Vec_MemEntryNum(p->vTtMem) );
         Abc_PrintTime( 1, "Time",    Abc_Clock() - p->clkStart );
     }
     fflush( stdout );
 }
+int Mf_ManComputeCutsSlice( void * pArg )
+{
+    Mf_Thr_t * pThr = (Mf_Thr_t *)pArg;
+    Mf_Cut_t pCuts[MF_CUT_MAX], * pCutsR[MF_CUT_MAX];
+    int i, nCutsR;
+    Vec_IntClear( &pThr->vCuts );
+    for ( i = 0; i < pThr->nNodes; i++ )
+    {
+        nCutsR = Mf_ObjMergeCuts( pThr->p, pThr->pNodes[i], pCuts, pCutsR, pThr->CutCount, pThr->nCutCounts );
+        Mf_SetWriteCuts( &pThr->vCuts, pCutsR, nCutsR );
+    }
+    return 1;
+}
+Vec_Int_t * Mf_ManCollectWaves( Mf_Man_t * p, Vec_Int_t ** pvStarts )
+{
+    Gia_Man_t * pGia = p->pGia;
+    Vec_Int_t * vLevels = Vec_IntStart( Gia_ManObjNum(pGia) );
+    Vec_Int_t * vNodes  = Vec_IntStart( Gia_ManAndNum(pGia) );
+    Vec_Int_t * vStarts;
+    Gia_Obj_t * pObj;
+    int i, Level, LevelMax = 0;
+    // the wave of a node follows the waves of its fanins and its choice
+    Gia_ManForEachAnd( pGia, pObj, i )
+    {
+        Level = Abc_MaxInt( Vec_IntEntry(vLevels, Gia_ObjFaninId0(pObj, i)), Vec_IntEntry(vLevels, Gia_ObjFaninId1(pObj, i)) );
+        if ( Gia_ObjIsMuxId(pGia, i) )
+            Level = Abc_MaxInt( Level, Vec_IntEntry(vLevels, Gia_ObjFaninId2(pGia, i)) );
+        if ( Gia_ObjSibl(pGia, i) )
+            Level = Abc_MaxInt( Level, Vec_IntEntry(vLevels, Gia_ObjSibl(pGia, i)) );
+        Vec_IntWriteEntry( vLevels, i, Level + 1 );
+        LevelMax = Abc_MaxInt( LevelMax, Level + 1 );
+    }
+    // sort the nodes by wave, keeping the order of the nodes in each wave
+    vStarts = Vec_IntStart( LevelMax + 2 );
+    Gia_ManForEachAndId( pGia, i )
+        Vec_IntAddToEntry( vStarts, Vec_IntEntry(vLevels, i) + 1, 1 );
+    for ( i = 1; i <= LevelMax + 1; i++ )
+        Vec_IntAddToEntry( vStarts, i, Vec_IntEntry(vStarts, i - 1) );
+    Gia_ManForEachAndId( pGia, i )
+    {
+        Level = Vec_IntEntry( vLevels, i );
+        Vec_IntWriteEntry( vNodes, Vec_IntEntry(vStarts, Level), i );
+        Vec_IntAddToEntry( vStarts, Level, 1 );
+    }
+    // restore the beginnings of the waves
+    for ( i = LevelMax + 1; i > 0; i-- )
+        Vec_IntWriteEntry( vStarts, i, Vec_IntEntry(vStarts, i - 1) );
+    Vec_IntWriteEntry( vStarts, 0, 0 );
+    Vec_IntFree( vLevels );
+    *pvStarts = vStarts;
+    return vNodes;
+}
+void Mf_ManComputeCutsPar( Mf_Man_t * p )
+{
+    extern void * Abc_FrameReadPool();
+    Util_Pool_t * pPool = (Util_Pool_t *)Abc_FrameReadPool(), * pPoolTemp = NULL;
+    Util_PoolGroup_t * pGroup;
+    Vec_Int_t * vStarts, * vNodes = Mf_ManCollectWaves( p, &vStarts );
+    int nProcs = Abc_MinInt( p->pPars->nProcNum, MF_PROC_MAX );
+    Mf_Thr_t * pThrs = ABC_CALLOC( Mf_Thr_t, nProcs );
+    int i, k, w, nInts, nSize, nChunk, nChunks;
+    if ( pPool == NULL )
+        pPool = pPoolTemp = Util_PoolStart( nProcs - 1 );
+    for ( k = 0; k < nProcs; k++ )
+        pThrs[k].p = p;
+    for ( w = 1; w + 1 < Vec_IntSize(vStarts); w++ )
+    {
+        int * pWave = Vec_IntEntryP( vNodes, Vec_IntEntry(vStarts, w) );
+        nSize   = Vec_IntEntry(vStarts, w + 1) - Vec_IntEntry(vStarts, w);
+        nChunks = Abc_MinInt( nProcs, nSize / MF_PAR_MIN );
+        if ( nChunks < 2 )
+        {
+            for ( i = 0; i < nSize; i++ )
+                Mf_ObjMergeOrder( p, pWave[i] );
+            continue;
+        }
+        // the slices of the wave are processed concurrently
+        nChunk = (nSize + nChunks - 1) / nChunks;
+        pGroup = Util_PoolGroupStart( pPool, 0 );
+        for ( k = 0; k < nChunks; k++ )
+        {
+            pThrs[k].pNodes = pWave + k * nChunk;
+            pThrs[k].nNodes = Abc_MinInt( nChunk, nSize - k * nChunk );
+            Util_PoolSubmit( pGroup, Mf_ManComputeCutsSlice, pThrs + k );
+        }
+        Util_PoolGroupWait( pGroup );
+        Util_PoolGroupStop( pGroup );
+        // the cut sets are moved into the cut memory in the order of the nodes
+        for ( k = 0; k < nChunks; k++ )
+        {
+            int * pList = Vec_IntArray( &pThrs[k].vCuts );
+            for ( i = 0; i < pThrs[k].nNodes; i++, pList += nInts )
+                Mf_ManObj(p, pThrs[k].pNodes[i])->iCutSet = Mf_ManCopyCuts( p, pList, &nInts );
+            assert( pList == Vec_IntLimit(&pThrs[k].vCuts) );
+        }
+    }
+    for ( k = 0; k < nProcs; k++ )
+    {
+        for ( i = 0; i < 4; i++ )
+            p->CutCount[i] += pThrs[k].CutCount[i];
+        for ( i = 0; i <= MF_LEAF_MAX; i++ )
+            p->nCutCounts[i] += pThrs[k].nCutCounts[i];
+        ABC_FREE( pThrs[k].vCuts.pArray );
+    }
+    ABC_FREE( pThrs );
+    Util_PoolStop( pPoolTemp );
+    Vec_IntFree( vStarts );
+    Vec_IntFree( vNodes );
+}
 void Mf_ManComputeCuts( Mf_Man_t * p )
 {
+    abctime clk = Abc_Clock();
     int i;
-    Gia_ManForEachAndId( p->pGia, i )
-        Mf_ObjMergeOrder( p, i );
+    // the truth tables are shared by all nodes, so the cuts are computed in parallel only without them
+    if ( p->pPars->nProcNum > 1 && !p->pPars->fCutMin )
+        Mf_ManComputeCutsPar( p );
+    else
+    {
+        Gia_ManForEachAndId( p->pGia, i )
+            Mf_ObjMergeOrder( p, i );
+    }
+    p->pPars->Cuts    = (word)p->CutCount[3];
+    p->pPars->CutMem  = (word)sizeof(int) * (1 << 16) * Vec_PtrSize(&p->vPages);
+    p->pPars->CutTime = Abc_Clock() - clk;
     Mf_ManSetMapRefs( p );
     Mf_ManPrintStats( p, (char *)(p->fUseEla ? "Ela  " : (p->Iter ? "Area " : "Delay")) );
 }
@@ -1844,7 +2048,7 @@ Gia_Man_t * Mf_ManPerformMapping( Gia_Man_t * pGia, Jf_Par_t * pPars )
         Mf_ManComputeMapping( p );
     //Mf_ManOptimization( p );
     if ( pPars->fVeryVerbose && pPars->fCutMin )
-        Vec_MemDumpTruthTables( p->vTtMem, Gia_ManName(p->pGia), pPars->nLutSize );
+        Vec_MemDumpTruthTablesFrom( p->vTtMem, Gia_ManName(p->pGia), pPars->nLutSize, p->nTtStart );
     if ( pPars->fCutMin )
         pNew = Mf_ManDeriveMappingGia( p );
     else if ( pPars->fCoarsen )
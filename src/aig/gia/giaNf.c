@@ -966,6 +966,7 @@ void Nf_ManComputeCuts( Nf_Man_t * p )
 {
     Gia_Obj_t * pObj; int i, iFanin, arrTime; 
     float CutFlow = 0, CutFlowAve = 0; int fFirstCi = 0, nCutFlow = 0;
+    abctime clk = Abc_Clock();
     if ( p->pManTim )
         Tim_ManIncrementTravId( p->pManTim );    
     Gia_ManForEachObjWithBoxes( p->pGia, pObj, i )
@@ -998,6 +999,9 @@ void Nf_ManComputeCuts( Nf_Man_t * p )
             nCutFlow++;
             fFirstCi = 1;
         }
+    p->pPars->Cuts    = (word)p->CutCount[3];
+    p->pPars->CutMem  = (word)sizeof(int) * (1 << 16) * Vec_PtrSize(&p->vPages);
+    p->pPars->CutTime = Abc_Clock() - clk;
 }
 
 /**Function*************************************************************
@@ -0,0 +1,817 @@
+/**CFile****************************************************************
+
+  FileName    [giaPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Parallel reconstruction of the AIG by groups of outputs.]
+
+  Author      [agent <agent@local>]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: giaPar.c,v 1.00 2026/10/17 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The groups of COs are processed by several threads, which add their nodes
+// to one shared manager through the concurrent structural hashing of
+// Gia_ManHashAndConc().  The storage of the new manager is reserved in
+// advance, so it is not reallocated while the threads are running.  The
+// objects of the result are in a topological order, but the relative order
+// of the nodes added by different threads depends on the scheduling; the set
+// of nodes does not, because a node is identified by its fanin literals.
+
+#if defined(__GNUC__) || defined(__clang__)
+#define GIA_PAR_ATOMICS
+#endif
+
+#define GIA_PAR_THR_MAX 100
+
+typedef struct Gia_ParMan_t_ Gia_ParMan_t;
+typedef struct Gia_ParThr_t_ Gia_ParThr_t;
+typedef void (*Gia_ParWork_t)( Gia_ParThr_t * pThr, int iPart );
+
+struct Gia_ParMan_t_
+{
+    Gia_Man_t *    p;         // the original AIG
+    Gia_Man_t *    pNew;      // the resulting AIG
+    Vec_Wec_t *    vGroups;   // the COs of each part
+    Vec_Wec_t *    vPartCis;  // the CIs of each part
+    Vec_Int_t *    vPartObjs; // the number of new objects needed by each part
+    Vec_Int_t *    vCoLits;   // the literals of the COs in the resulting AIG
+    Gia_ParFunc_t  pFunc;     // user's transformation
+    void *         pUser;     // user's data
+    Gia_Man_t **   ppParts;   // the parts (replaced by the results)
+    int            nParts;    // the number of parts
+    int            iNext;     // the next part to process
+    Gia_ParWork_t  pWork;     // the processing of one part
+    int            fStrict;   // strict area control in balancing
+    unsigned       fFailed;   // the storage of the new manager is exhausted
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t Mutex;    // protects iNext
+#endif
+};
+
+struct Gia_ParThr_t_
+{
+    Gia_ParMan_t * pMan;      // the parallel manager
+    Vec_Int_t *    vMarks;    // the last part where the object was visited
+    Vec_Int_t *    vCopies;   // the literals of the objects in the part
+    Vec_Int_t *    vNodes;    // the AND nodes of the part
+    Vec_Int_t *    vCis;      // the CIs of the part
+    Vec_Int_t *    vSuper;    // the leaves of a supergate
+    Vec_Int_t *    vStore;    // the leaves of the supergates being balanced
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Atomic access to the copies of the objects.]
+
+  Description [Several threads may derive the copy of the same object at
+  the same time.  They get the same literal from the concurrent hashing,
+  so it does not matter which of them writes it.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline unsigned Gia_ManParLoad( unsigned * pVal )
+{
+#if defined(GIA_PAR_ATOMICS)
+    return __atomic_load_n( pVal, __ATOMIC_ACQUIRE );
+#else
+    return *pVal;
+#endif
+}
+static inline void Gia_ManParStore( unsigned * pVal, unsigned Val )
+{
+#if defined(GIA_PAR_ATOMICS)
+    __atomic_store_n( pVal, Val, __ATOMIC_RELEASE );
+#else
+    *pVal = Val;
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Splits the COs into groups of consecutive COs.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Wec_t * Gia_ManParGroupCos( Gia_Man_t * p, int nGroups )
+{
+    Vec_Wec_t * vGroups;
+    int i, nCos = Gia_ManCoNum(p);
+    nGroups = Abc_MaxInt( 1, Abc_MinInt(nGroups, nCos) );
+    vGroups = Vec_WecStart( nGroups );
+    for ( i = 0; i < nCos; i++ )
+        Vec_WecPush( vGroups, (int)((word)i * nGroups / Abc_MaxInt(nCos, 1)), i );
+    return vGroups;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Extracts the cones of the given COs as a combinational AIG.]
+
+  Description [The CIs of the result are the CIs in the support of the COs
+  listed in the order of their CI indexes, which are returned in vCis.
+  The objects are marked by Mark in vMarks; vCopies and vNodes are work
+  arrays, so several threads can extract parts of the same AIG.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManParCollect_rec( Gia_Man_t * p, int iObj, int Mark, Vec_Int_t * vMarks, Vec_Int_t * vCis, Vec_Int_t * vNodes )
+{
+    Gia_Obj_t * pObj;
+    if ( Vec_IntEntry(vMarks, iObj) == Mark )
+        return;
+    Vec_IntWriteEntry( vMarks, iObj, Mark );
+    pObj = Gia_ManObj( p, iObj );
+    if ( Gia_ObjIsCi(pObj) )
+    {
+        Vec_IntPush( vCis, Gia_ObjCioId(pObj) );
+        return;
+    }
+    assert( Gia_ObjIsAnd(pObj) );
+    Gia_ManParCollect_rec( p, Gia_ObjFaninId0(pObj, iObj), Mark, vMarks, vCis, vNodes );
+    Gia_ManParCollect_rec( p, Gia_ObjFaninId1(pObj, iObj), Mark, vMarks, vCis, vNodes );
+    Vec_IntPush( vNodes, iObj );
+}
+static inline int Gia_ManParCopyLit( Vec_Int_t * vCopies, int iLit )
+{
+    return Abc_LitNotCond( Vec_IntEntry(vCopies, Abc_Lit2Var(iLit)), Abc_LitIsCompl(iLit) );
+}
+Gia_Man_t * Gia_ManParExtract( Gia_Man_t * p, Vec_Int_t * vCos, int Mark, Vec_Int_t * vMarks, Vec_Int_t * vCopies, Vec_Int_t * vNodes, Vec_Int_t * vCis )
+{
+    Gia_Man_t * pNew;
+    Gia_Obj_t * pObj;
+    int i, iCo, iCi, iObj;
+    // collect the support and the nodes
+    Vec_IntClear( vCis );
+    Vec_IntClear( vNodes );
+    Vec_IntWriteEntry( vMarks, 0, Mark );
+    Vec_IntWriteEntry( vCopies, 0, 0 );
+    Vec_IntForEachEntry( vCos, iCo, i )
+        Gia_ManParCollect_rec( p, Gia_ObjFaninId0p(p, Gia_ManCo(p, iCo)), Mark, vMarks, vCis, vNodes );
+    Vec_IntSort( vCis, 0 );
+    // copy the cones
+    pNew = Gia_ManStart( 1 + Vec_IntSize(vCis) + Vec_IntSize(vNodes) + Vec_IntSize(vCos) );
+    Vec_IntForEachEntry( vCis, iCi, i )
+        Vec_IntWriteEntry( vCopies, Gia_ManCiIdToId(p, iCi), Gia_ManAppendCi(pNew) );
+    Vec_IntForEachEntry( vNodes, iObj, i )
+    {
+        pObj = Gia_ManObj( p, iObj );
+        Vec_IntWriteEntry( vCopies, iObj, Gia_ManAppendAnd(pNew, Gia_ManParCopyLit(vCopies, Gia_ObjFaninLit0(pObj, iObj)), Gia_ManParCopyLit(vCopies, Gia_ObjFaninLit1(pObj, iObj))) );
+    }
+    Vec_IntForEachEntry( vCos, iCo, i )
+        Gia_ManAppendCo( pNew, Gia_ManParCopyLit(vCopies, Gia_ObjFaninLit0p(p, Gia_ManCo(p, iCo))) );
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Processing of one part in each phase.]
+
+  Description [The first phase extracts and transforms the parts.  The second
+  one adds the transformed parts to the resulting AIG.  The CI literals of
+  the resulting AIG are in the Value fields of the CIs of the original AIG.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_ManParTransformWork( Gia_ParThr_t * pThr, int iPart )
+{
+    Gia_ParMan_t * p = pThr->pMan;
+    Gia_Man_t * pPart, * pRes;
+    Gia_Obj_t * pObj;
+    int i, nObjs = 0;
+    if ( pThr->vMarks == NULL )
+    {
+        pThr->vMarks  = Vec_IntStartFull( Gia_ManObjNum(p->p) );
+        pThr->vCopies = Vec_IntStartFull( Gia_ManObjNum(p->p) );
+        pThr->vNodes  = Vec_IntAlloc( 1000 );
+        pThr->vCis    = Vec_IntAlloc( 1000 );
+    }
+    pPart = Gia_ManParExtract( p->p, Vec_WecEntry(p->vGroups, iPart), iPart, pThr->vMarks, pThr->vCopies, pThr->vNodes, pThr->vCis );
+    Vec_IntAppend( Vec_WecEntry(p->vPartCis, iPart), pThr->vCis );
+    pRes = p->pFunc( pPart, p->pUser );
+    assert( Gia_ManCiNum(pRes) == Gia_ManCiNum(pPart) );
+    assert( Gia_ManCoNum(pRes) == Gia_ManCoNum(pPart) );
+    if ( pRes != pPart )
+        Gia_ManStop( pPart );
+    // XORs and MUXes are added as three AND nodes
+    Gia_ManForEachAnd( pRes, pObj, i )
+        nObjs += Gia_ObjIsBuf(pObj) ? 0 : (Gia_ObjIsXor(pObj) || Gia_ObjIsMuxId(pRes, i)) ? 3 : 1;
+    Vec_IntWriteEntry( p->vPartObjs, iPart, nObjs );
+    p->ppParts[iPart] = pRes;
+}
+static inline int Gia_ManParHashXor( Gia_Man_t * p, int iLit0, int iLit1 )
+{
+    int iTemp0 = Gia_ManHashAndConc( p, iLit0, Abc_LitNot(iLit1) );
+    int iTemp1 = Gia_ManHashAndConc( p, Abc_LitNot(iLit0), iLit1 );
+    return Abc_LitNot( Gia_ManHashAndConc(p, Abc_LitNot(iTemp0), Abc_LitNot(iTemp1)) );
+}
+static inline int Gia_ManParHashMux( Gia_Man_t * p, int iCtrl, int iData1, int iData0 )
+{
+    int iTemp0 = Gia_ManHashAndConc( p, Abc_LitNot(iCtrl), iData0 );
+    int iTemp1 = Gia_ManHashAndConc( p, iCtrl, iData1 );
+    return Abc_LitNot( Gia_ManHashAndConc(p, Abc_LitNot(iTemp0), Abc_LitNot(iTemp1)) );
+}
+static void Gia_ManParMergeWork( Gia_ParThr_t * pThr, int iPart )
+{
+    Gia_ParMan_t * p = pThr->pMan;
+    Gia_Man_t * pPart = p->ppParts[iPart];
+    Vec_Int_t * vCis = Vec_WecEntry( p->vPartCis, iPart );
+    Vec_Int_t * vCos = Vec_WecEntry( p->vGroups, iPart );
+    Gia_Obj_t * pObj; int i;
+    assert( Gia_ManCiNum(pPart) == Vec_IntSize(vCis) );
+    assert( Gia_ManCoNum(pPart) == Vec_IntSize(vCos) );
+    Gia_ManConst0(pPart)->Value = 0;
+    Gia_ManForEachCi( pPart, pObj, i )
+        pObj->Value = Gia_ManCi(p->p, Vec_IntEntry(vCis, i))->Value;
+    Gia_ManForEachAnd( pPart, pObj, i )
+    {
+        if ( Gia_ObjIsBuf(pObj) )
+            pObj->Value = Gia_ObjFanin0Copy(pObj);
+        else if ( Gia_ObjIsMuxId(pPart, i) )
+            pObj->Value = Gia_ManParHashMux( p->pNew, Gia_ObjFanin2Copy(pPart, pObj), Gia_ObjFanin1Copy(pObj), Gia_ObjFanin0Copy(pObj) );
+        else if ( Gia_ObjIsXor(pObj) )
+            pObj->Value = Gia_ManParHashXor( p->pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+        else
+            pObj->Value = Gia_ManHashAndConc( p->pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+    }
+    Gia_ManForEachCo( pPart, pObj, i )
+        Vec_IntWriteEntry( p->vCoLits, Vec_IntEntry(vCos, i), Gia_ObjFanin0Copy(pObj) );
+    Gia_ManStopP( &p->ppParts[iPart] );
+}
+int Gia_ManParDupDfs_rec( Gia_Man_t * pNew, Gia_Obj_t * pObj )
+{
+    unsigned Value = Gia_ManParLoad( &pObj->Value );
+    int iLit0, iLit1;
+    if ( ~Value )
+        return (int)Value;
+    assert( Gia_ObjIsAnd(pObj) );
+    iLit0 = Abc_LitNotCond( Gia_ManParDupDfs_rec(pNew, Gia_ObjFanin0(pObj)), Gia_ObjFaninC0(pObj) );
+    iLit1 = Abc_LitNotCond( Gia_ManParDupDfs_rec(pNew, Gia_ObjFanin1(pObj)), Gia_ObjFaninC1(pObj) );
+    Value = (unsigned)Gia_ManHashAndConc( pNew, iLit0, iLit1 );
+    Gia_ManParStore( &pObj->Value, Value );
+    return (int)Value;
+}
+static void Gia_ManParDupDfsWork( Gia_ParThr_t * pThr, int iPart )
+{
+    Gia_ParMan_t * p = pThr->pMan;
+    int i, iCo;
+    Vec_IntForEachEntry( Vec_WecEntry(p->vGroups, iPart), iCo, i )
+        Gia_ManParDupDfs_rec( p->pNew, Gia_ObjFanin0(Gia_ManCo(p->p, iCo)) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Processes the parts using several threads.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_ManParNextPart( Gia_ParMan_t * p )
+{
+    int iPart;
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock( &p->Mutex );
+#endif
+    iPart = p->iNext < p->nParts ? p->iNext++ : -1;
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_unlock( &p->Mutex );
+#endif
+    return iPart;
+}
+void * Gia_ManParWorkerThread( void * pArg )
+{
+    Gia_ParThr_t * pThr = (Gia_ParThr_t *)pArg;
+    int iPart;
+    while ( (iPart = Gia_ManParNextPart(pThr->pMan)) >= 0 )
+        pThr->pMan->pWork( pThr, iPart );
+    return NULL;
+}
+void Gia_ManParRun( Gia_ParMan_t * p, Gia_ParWork_t pWork, int nThreads )
+{
+    Gia_ParThr_t ThData[GIA_PAR_THR_MAX];
+    int i;
+#ifdef ABC_USE_PTHREADS
+    pthread_t WorkerThread[GIA_PAR_THR_MAX];
+    int status;
+    nThreads = Abc_MaxInt( 1, Abc_MinInt(Abc_MinInt(nThreads, p->nParts), GIA_PAR_THR_MAX) );
+#else
+    nThreads = 1;
+#endif
+    p->pWork = pWork;
+    p->iNext = 0;
+    memset( ThData, 0, sizeof(Gia_ParThr_t) * nThreads );
+    for ( i = 0; i < nThreads; i++ )
+        ThData[i].pMan = p;
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_init( &p->Mutex, NULL );
+    for ( i = 1; i < nThreads; i++ )
+    {
+        status = pthread_create( WorkerThread + i, NULL, Gia_ManParWorkerThread, (void *)(ThData + i) );
+        assert( status == 0 );
+    }
+    Gia_ManParWorkerThread( (void *)ThData );
+    for ( i = 1; i < nThreads; i++ )
+        pthread_join( WorkerThread[i], NULL );
+    pthread_mutex_destroy( &p->Mutex );
+#else
+    Gia_ManParWorkerThread( (void *)ThData );
+#endif
+    for ( i = 0; i < nThreads; i++ )
+    {
+        Vec_IntFreeP( &ThData[i].vMarks );
+        Vec_IntFreeP( &ThData[i].vCopies );
+        Vec_IntFreeP( &ThData[i].vNodes );
+        Vec_IntFreeP( &ThData[i].vCis );
+        Vec_IntFreeP( &ThData[i].vSuper );
+        Vec_IntFreeP( &ThData[i].vStore );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and finalizes the resulting AIG.]
+
+  Description [The CIs of the new AIG are added and their literals are
+  written into the Value fields of the CIs of the original AIG.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Gia_Man_t * Gia_ManParStartNew( Gia_Man_t * p, int nObjsMax )
+{
+    Gia_Man_t * pNew;
+    Gia_Obj_t * pObj;
+    int i;
+    pNew = Gia_ManStart( nObjsMax );
+    pNew->pName = Abc_UtilStrsav( p->pName );
+    pNew->pSpec = Abc_UtilStrsav( p->pSpec );
+    Gia_ManConst0(p)->Value = 0;
+    Gia_ManForEachCi( p, pObj, i )
+        pObj->Value = Gia_ManAppendCi( pNew );
+    Gia_ManHashConcStart( pNew, nObjsMax );
+    return pNew;
+}
+static void Gia_ManParStopNew( Gia_Man_t * pNew, Gia_Man_t * p, Vec_Int_t * vCoLits )
+{
+    int i, iLit;
+    Vec_IntForEachEntry( vCoLits, iLit, i )
+    {
+        assert( iLit >= 0 );
+        Gia_ManAppendCo( pNew, iLit );
+    }
+    Gia_ManHashStop( pNew );
+    Gia_ManSetRegNum( pNew, Gia_ManRegNum(p) );
+    if ( p->vNamesIn )
+        pNew->vNamesIn = Vec_PtrDupStr( p->vNamesIn );
+    if ( p->vNamesOut )
+        pNew->vNamesOut = Vec_PtrDupStr( p->vNamesOut );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Rebuilds the AIG by transforming groups of COs in parallel.]
+
+  Description [Each group of COs (given by CO indexes) is extracted into
+  a combinational AIG, which is transformed by pFunc in one of the threads.
+  The transformation should be thread-safe and preserve the number and
+  the order of CIs and COs; it may return the same manager.  The results
+  are then added to one manager by the threads using concurrent structural
+  hashing, so the logic shared by the results is shared in the manager.
+  Every CO should belong to exactly one group.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Gia_ManParTransform( Gia_Man_t * p, Vec_Wec_t * vGroups, Gia_ParFunc_t pFunc, void * pUser, int nThreads, int fVerbose )
+{
+    Gia_ParMan_t Man, * pMan = &Man;
+    int nObjsMax;
+    abctime clk = Abc_Clock();
+    assert( p->pManTime == NULL );
+    assert( p->pMuxes == NULL && Gia_ManBufNum(p) == 0 );
+    memset( pMan, 0, sizeof(Gia_ParMan_t) );
+    pMan->p         = p;
+    pMan->vGroups   = vGroups;
+    pMan->pFunc     = pFunc;
+    pMan->pUser     = pUser;
+    pMan->nParts    = Vec_WecSize(vGroups);
+    pMan->ppParts   = ABC_CALLOC( Gia_Man_t *, pMan->nParts );
+    pMan->vPartCis  = Vec_WecStart( pMan->nParts );
+    pMan->vPartObjs = Vec_IntStart( pMan->nParts );
+    pMan->vCoLits   = Vec_IntStartFull( Gia_ManCoNum(p) );
+    // extract and transform the parts
+    Gia_ManParRun( pMan, Gia_ManParTransformWork, nThreads );
+    if ( fVerbose )
+        Abc_PrintTime( 1, "Transforming parts", Abc_Clock() - clk );
+    // add them to the new manager
+    clk = Abc_Clock();
+    nObjsMax = 1 + Gia_ManCiNum(p) + Vec_IntSum(pMan->vPartObjs) + Gia_ManCoNum(p);
+    pMan->pNew = Gia_ManParStartNew( p, nObjsMax );
+    Gia_ManParRun( pMan, Gia_ManParMergeWork, Gia_ManHashConcIsSupported() ? nThreads : 1 );
+    Gia_ManParStopNew( pMan->pNew, p, pMan->vCoLits );
+    if ( fVerbose )
+        Abc_PrintTime( 1, "Merging parts     ", Abc_Clock() - clk );
+    ABC_FREE( pMan->ppParts );
+    Vec_WecFree( pMan->vPartCis );
+    Vec_IntFree( pMan->vPartObjs );
+    Vec_IntFree( pMan->vCoLits );
+    return pMan->pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Duplicates the AIG in the DFS order using several threads.]
+
+  Description [The threads traverse the cones of different groups of COs
+  and add their nodes to the new manager using concurrent hashing.  The
+  Value fields of the original AIG are shared by the threads, so a node
+  shared by several groups is usually derived once.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Gia_ManDupDfsPar( Gia_Man_t * p, int nGroups, int nThreads )
+{
+    Gia_ParMan_t Man, * pMan = &Man;
+    Gia_Obj_t * pObj;
+    int i;
+    assert( p->pMuxes == NULL && Gia_ManBufNum(p) == 0 );
+    memset( pMan, 0, sizeof(Gia_ParMan_t) );
+    pMan->p       = p;
+    pMan->vGroups = Gia_ManParGroupCos( p, nGroups );
+    pMan->nParts  = Vec_WecSize(pMan->vGroups);
+    pMan->vCoLits = Vec_IntAlloc( Gia_ManCoNum(p) );
+    Gia_ManFillValue( p );
+    pMan->pNew = Gia_ManParStartNew( p, Gia_ManObjNum(p) );
+    Gia_ManParRun( pMan, Gia_ManParDupDfsWork, Gia_ManHashConcIsSupported() ? nThreads : 1 );
+    Gia_ManForEachCo( p, pObj, i )
+        Vec_IntPush( pMan->vCoLits, Gia_ObjFanin0Copy(pObj) );
+    Gia_ManParStopNew( pMan->pNew, p, pMan->vCoLits );
+    Vec_WecFree( pMan->vGroups );
+    Vec_IntFree( pMan->vCoLits );
+    return pMan->pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Delay-oriented balancing of one cone in the shared manager.]
+
+  Description [These are the procedures of Gia_ManBalanceInt() working with
+  the concurrent hashing and the work arrays of the thread.  The references
+  and the MUX/XOR structure of the original AIG are computed in advance and
+  only read by the threads.  The levels of the new nodes are assigned when
+  they are created.  If two threads balance the same supergate at the same
+  time, they may derive different but equivalent literals; the nodes that
+  are not used are removed later.  Returns -1 if the storage is exhausted.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_ManParSuperCollectXor_rec( Gia_Man_t * p, Gia_Obj_t * pObj, int fStrict, Vec_Int_t * vSuper )
+{
+    assert( !Gia_IsComplement(pObj) );
+    if ( !Gia_ObjIsXor(pObj) ||     
+        (fStrict && Gia_ObjRefNum(p, pObj) > 1) || 
+        Gia_ObjRefNum(p, pObj) > 2 || 
+        (Gia_ObjRefNum(p, pObj) == 2 && (Gia_ObjRefNum(p, Gia_ObjFanin0(pObj)) == 1 || Gia_ObjRefNum(p, Gia_ObjFanin1(pObj)) == 1)) || 
+        Vec_IntSize(vSuper) > 50 )
+    {
+        Vec_IntPush( vSuper, Gia_ObjToLit(p, pObj) );
+        return;
+    }
+    assert( !Gia_ObjFaninC0(pObj) && !Gia_ObjFaninC1(pObj) );
+    Gia_ManParSuperCollectXor_rec( p, Gia_ObjFanin0(pObj), fStrict, vSuper );
+    Gia_ManParSuperCollectXor_rec( p, Gia_ObjFanin1(pObj), fStrict, vSuper );
+}
+static void Gia_ManParSuperCollectAnd_rec( Gia_Man_t * p, Gia_Obj_t * pObj, int fStrict, Vec_Int_t * vSuper )
+{
+    if ( Gia_IsComplement(pObj) || 
+        !Gia_ObjIsAndReal(p, pObj) || 
+        (fStrict && Gia_ObjRefNum(p, pObj) > 1) || 
+        Gia_ObjRefNum(p, pObj) > 2 || 
+        (Gia_ObjRefNum(p, pObj) == 2 && (Gia_ObjRefNum(p, Gia_ObjFanin0(pObj)) == 1 || Gia_ObjRefNum(p, Gia_ObjFanin1(pObj)) == 1)) || 
+        Vec_IntSize(vSuper) > 50 )
+    {
+        Vec_IntPush( vSuper, Gia_ObjToLit(p, pObj) );
+        return;
+    }
+    Gia_ManParSuperCollectAnd_rec( p, Gia_ObjChild0(pObj), fStrict, vSuper );
+    Gia_ManParSuperCollectAnd_rec( p, Gia_ObjChild1(pObj), fStrict, vSuper );
+}
+static void Gia_ManParSuperCollect( Gia_Man_t * p, Gia_Obj_t * pObj, int fStrict, Vec_Int_t * vSuper )
+{
+    extern void Gia_ManSimplifyXor( Vec_Int_t * vSuper );
+    extern void Gia_ManSimplifyAnd( Vec_Int_t * vSuper );
+    Vec_IntClear( vSuper );
+    if ( Gia_ObjIsXor(pObj) )
+    {
+        assert( !Gia_ObjFaninC0(pObj) && !Gia_ObjFaninC1(pObj) );
+        Gia_ManParSuperCollectXor_rec( p, Gia_ObjFanin0(pObj), fStrict, vSuper );
+        Gia_ManParSuperCollectXor_rec( p, Gia_ObjFanin1(pObj), fStrict, vSuper );
+        Vec_IntSort( vSuper, 0 );
+        Gia_ManSimplifyXor( vSuper );
+    }
+    else if ( Gia_ObjIsAndReal(p, pObj) )
+    {
+        Gia_ManParSuperCollectAnd_rec( p, Gia_ObjChild0(pObj), fStrict, vSuper );
+        Gia_ManParSuperCollectAnd_rec( p, Gia_ObjChild1(pObj), fStrict, vSuper );
+        Vec_IntSort( vSuper, 0 );
+        Gia_ManSimplifyAnd( vSuper );
+    }
+    else assert( 0 );
+    assert( Vec_IntSize(vSuper) > 0 );
+}
+static void Gia_ManParPrepareLastTwo( Gia_Man_t * pNew, Vec_Int_t * vSuper )
+{
+    int i, k, Stop, Lit1, Lit2, Level1, Level2, * pArray;
+    int nSize = Vec_IntSize(vSuper);
+    if ( nSize == 2 )
+        return;
+    assert( nSize > 2 );
+    Level1 = Gia_ObjLevelId( pNew, Abc_Lit2Var(Vec_IntEntry(vSuper, nSize-2)) );
+    // find the first one with Level1
+    for ( Stop = nSize-3; Stop >= 0; Stop-- )
+    {
+        Level2 = Gia_ObjLevelId( pNew, Abc_Lit2Var(Vec_IntEntry(vSuper, Stop)) );
+        if ( Level1 != Level2 )
+            break;
+    }
+    if ( Stop == nSize-3 )
+        return;
+    // avoid worst-case quadratic behavior by looking at the last 8 nodes
+    Stop = Abc_MaxInt( Stop, nSize - 9 );
+    for ( i = nSize - 1; i > Stop; i-- )
+        for ( k = i - 1; k > Stop; k-- )
+        {
+            Lit1 = Vec_IntEntry(vSuper, i);
+            Lit2 = Vec_IntEntry(vSuper, k);
+            if ( Abc_Lit2Var(Lit1) != Abc_Lit2Var(Lit2) && !Gia_ManHashLookupConc(pNew, Lit1, Lit2) ) // new node
+                continue;
+            // move Lit1 to be last and Lit2 to be the one before
+            pArray = Vec_IntArray( vSuper );
+            if ( i != nSize-1 )
+                ABC_SWAP( int, pArray[i], pArray[nSize-1] );
+            if ( k != nSize-2 )
+                ABC_SWAP( int, pArray[k], pArray[nSize-2] );
+        }
+}
+static int Gia_ManParCreateGate( Gia_Man_t * pNew, Gia_Obj_t * pObj, Vec_Int_t * vSuper )
+{
+    int iLit0 = Vec_IntPop(vSuper);
+    int iLit1 = Vec_IntPop(vSuper);
+    int iLit, i;
+    if ( !Gia_ObjIsXor(pObj) )
+        iLit = Gia_ManHashAndConc( pNew, iLit0, iLit1 );
+    else
+        iLit = Gia_ManHashXorConc( pNew, iLit0, iLit1 );
+    if ( iLit < 0 )
+        return -1;
+    Vec_IntPush( vSuper, iLit );
+    // shift to the corrent location
+    for ( i = Vec_IntSize(vSuper)-1; i > 0; i-- )
+    {
+        int iLit1 = Vec_IntEntry(vSuper, i);
+        int iLit2 = Vec_IntEntry(vSuper, i-1);
+        if ( Gia_ObjLevelId(pNew, Abc_Lit2Var(iLit1)) <= Gia_ObjLevelId(pNew, Abc_Lit2Var(iLit2)) )
+            break;
+        Vec_IntWriteEntry( vSuper, i,   iLit2 );
+        Vec_IntWriteEntry( vSuper, i-1, iLit1 );
+    }
+    return 0;
+}
+static int Gia_ManParBalanceGate( Gia_Man_t * pNew, Gia_Obj_t * pObj, Vec_Int_t * vSuper, int * pLits, int nLits )
+{
+    Vec_IntClear( vSuper );
+    if ( nLits == 1 )
+        Vec_IntPush( vSuper, pLits[0] );
+    else if ( nLits == 2 )
+    {
+        Vec_IntPush( vSuper, pLits[0] );
+        Vec_IntPush( vSuper, pLits[1] );
+        if ( Gia_ManParCreateGate( pNew, pObj, vSuper ) )
+            return -1;
+    }
+    else if ( nLits > 2 )
+    {
+        // collect levels
+        int i, * pArray, * pPerm;
+        for ( i = 0; i < nLits; i++ )
+            Vec_IntPush( vSuper, Gia_ObjLevelId(pNew, Abc_Lit2Var(pLits[i])) );
+        // sort by level
+        Vec_IntGrow( vSuper, 4 * nLits );        
+        pArray = Vec_IntArray( vSuper );
+        pPerm = pArray + nLits;
+        Abc_QuickSortCostData( pArray, nLits, 1, (word *)(pArray + 2 * nLits), pPerm );
+        // collect in the increasing order of level
+        for ( i = 0; i < nLits; i++ )
+            Vec_IntWriteEntry( vSuper, i, pLits[pPerm[i]] );
+        Vec_IntShrink( vSuper, nLits );
+        // perform incremental extraction
+        while ( Vec_IntSize(vSuper) > 1 )
+        {
+            if ( !Gia_ObjIsXor(pObj) )
+                Gia_ManParPrepareLastTwo( pNew, vSuper );
+            if ( Gia_ManParCreateGate( pNew, pObj, vSuper ) )
+                return -1;
+        }
+    }
+    assert( Vec_IntSize(vSuper) == 1 );
+    return Vec_IntEntry(vSuper, 0);
+}
+static int Gia_ManParBalance_rec( Gia_ParThr_t * pThr, Gia_Obj_t * pObj )
+{
+    Gia_ParMan_t * p = pThr->pMan;
+    int i, iLit, iBeg, iEnd, Value = (int)Gia_ManParLoad( &pObj->Value );
+    if ( Value != -1 )
+        return Value;
+    if ( Gia_ManParLoad( &p->fFailed ) )
+        return -1;
+    assert( Gia_ObjIsAnd(pObj) );
+    assert( !Gia_ObjIsBuf(pObj) );
+    if ( Gia_ObjIsMux(p->p, pObj) )
+    {
+        int iLit0 = Gia_ManParBalance_rec( pThr, Gia_ObjFanin0(pObj) );
+        int iLit1 = Gia_ManParBalance_rec( pThr, Gia_ObjFanin1(pObj) );
+        int iLitC = Gia_ManParBalance_rec( pThr, Gia_ObjFanin2(p->p, pObj) );
+        if ( iLit0 < 0 || iLit1 < 0 || iLitC < 0 )
+            return -1;
+        Value = Gia_ManHashMuxConc( p->pNew, Abc_LitNotCond(iLitC, Gia_ObjFaninC2(p->p, pObj)), Abc_LitNotCond(iLit1, Gia_ObjFaninC1(pObj)), Abc_LitNotCond(iLit0, Gia_ObjFaninC0(pObj)) );
+    }
+    else
+    {
+        // find supergate
+        Gia_ManParSuperCollect( p->p, pObj, p->fStrict, pThr->vSuper );
+        // save entries
+        iBeg = Vec_IntSize( pThr->vStore );
+        Vec_IntAppend( pThr->vStore, pThr->vSuper );
+        iEnd = Vec_IntSize( pThr->vStore );
+        // call recursively
+        Vec_IntForEachEntryStartStop( pThr->vStore, iLit, i, iBeg, iEnd )
+        {
+            Value = Gia_ManParBalance_rec( pThr, Gia_ManObj(p->p, Abc_Lit2Var(iLit)) );
+            if ( Value < 0 )
+                return -1;
+            Vec_IntWriteEntry( pThr->vStore, i, Abc_LitNotCond(Value, Abc_LitIsCompl(iLit)) );
+        }
+        assert( Vec_IntSize(pThr->vStore) == iEnd );
+        Value = Gia_ManParBalanceGate( p->pNew, pObj, pThr->vSuper, Vec_IntEntryP(pThr->vStore, iBeg), iEnd-iBeg );
+        Vec_IntShrink( pThr->vStore, iBeg );
+    }
+    if ( Value < 0 )
+    {
+        Gia_ManParStore( &p->fFailed, 1 );
+        return -1;
+    }
+    Gia_ManParStore( &pObj->Value, (unsigned)Value );
+    return Value;
+}
+static void Gia_ManParBalanceWork( Gia_ParThr_t * pThr, int iPart )
+{
+    Gia_ParMan_t * p = pThr->pMan;
+    int i, iCo;
+    if ( pThr->vSuper == NULL )
+    {
+        pThr->vSuper = Vec_IntAlloc( 1000 );
+        pThr->vStore = Vec_IntAlloc( 1000 );
+    }
+    Vec_IntForEachEntry( Vec_WecEntry(p->vGroups, iPart), iCo, i )
+        if ( Gia_ManParBalance_rec( pThr, Gia_ObjFanin0(Gia_ManCo(p->p, iCo)) ) < 0 )
+            break;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Delay-oriented balancing using several threads.]
+
+  Description [Performs the same balancing as Gia_ManBalance(), while the
+  threads balance the cones of different groups of COs in one manager.
+  The supergates are computed from the references of the whole AIG, and
+  the logic shared by the groups is balanced once, so the result has
+  the same quality as the one-thread balancing.  If the reserved storage
+  is exhausted, the AIG is balanced by one thread.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Gia_ManBalancePar( Gia_Man_t * p, int fSimpleAnd, int fStrict, int nGroups, int nThreads, int fVerbose )
+{
+    Gia_ParMan_t Man, * pMan = &Man;
+    Gia_Man_t * pNew, * pTemp, * pInt;
+    Gia_Obj_t * pObj;
+    int i, nObjsMax;
+    abctime clk = Abc_Clock();
+    assert( p->pManTime == NULL && p->vCiArrs == NULL && p->vInArrs == NULL );
+    pInt = fSimpleAnd ? Gia_ManDup( p ) : Gia_ManDupMuxes( p, 2 );
+    Gia_ManFillValue( pInt );
+    Gia_ManCreateRefs( pInt );
+    // the balanced AIG rarely exceeds the original one; the rest is a margin
+    nObjsMax = 2 * Gia_ManObjNum(pInt) + 1000;
+    memset( pMan, 0, sizeof(Gia_ParMan_t) );
+    pMan->p       = pInt;
+    pMan->fStrict = fStrict;
+    pMan->vGroups = Gia_ManParGroupCos( pInt, nGroups );
+    pMan->nParts  = Vec_WecSize(pMan->vGroups);
+    pMan->pNew = pNew = Gia_ManStart( nObjsMax );
+    pNew->pName = Abc_UtilStrsav( p->pName );
+    pNew->pSpec = Abc_UtilStrsav( p->pSpec );
+    pNew->pMuxes = ABC_CALLOC( unsigned, pNew->nObjsAlloc );
+    pNew->vLevels = Vec_IntStart( pNew->nObjsAlloc );
+    Gia_ManConst0(pInt)->Value = 0;
+    Gia_ManForEachCi( pInt, pObj, i )
+        pObj->Value = Gia_ManAppendCi( pNew );
+    Gia_ManHashConcStart( pNew, nObjsMax );
+    Gia_ManParRun( pMan, Gia_ManParBalanceWork, Gia_ManHashConcIsSupported() ? nThreads : 1 );
+    Vec_WecFree( pMan->vGroups );
+    if ( pMan->fFailed )
+    {
+        Gia_ManStop( pNew );
+        Gia_ManStop( pInt );
+        if ( fVerbose )
+            printf( "The storage for %d objects is exhausted; balancing with one thread.\n", nObjsMax );
+        return Gia_ManBalance( p, fSimpleAnd, fStrict, 0 );
+    }
+    Gia_ManForEachCo( pInt, pObj, i )
+        Gia_ManAppendCo( pNew, Gia_ObjFanin0Copy(pObj) );
+    Gia_ManHashStop( pNew );
+    Gia_ManSetRegNum( pNew, Gia_ManRegNum(pInt) );
+    Gia_ManStop( pInt );
+    if ( fVerbose )
+        Abc_PrintTime( 1, "Balancing ", Abc_Clock() - clk );
+    // remove the unused nodes and the MUXes
+    pNew = Gia_ManCleanup( pTemp = pNew );
+    Gia_ManStop( pTemp );
+    pNew = Gia_ManDupNoMuxes( pTemp = pNew, 0 );
+    Gia_ManStop( pTemp );
+    if ( p->vNamesIn )
+        pNew->vNamesIn = Vec_PtrDupStr( p->vNamesIn );
+    if ( p->vNamesOut )
+        pNew->vNamesOut = Vec_PtrDupStr( p->vNamesOut );
+    return pNew;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -0,0 +1,227 @@
+/**CFile****************************************************************
+
+  FileName    [giaPatStore.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Persistent store of distinguishing simulation patterns.]
+
+  Author      [agent <agent@local>]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: giaPatStore.c,v 1.00 2026/10/17 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+#include "misc/util/utilTruth.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The store keeps the CI values of the patterns, which distinguished
+// candidate equivalences in the past (counter-examples produced by the
+// SAT solver during sweeping). The patterns are bit-packed, CI-major,
+// with nPatStoreWords words per CI. When the store is full, the oldest
+// patterns are overwritten. The store survives the replacement of the
+// current AIG by a transformed one with the same CIs, so that the next
+// sweeping pass can refine its candidate classes right away. Before the
+// store is moved, the CI order of the new AIG is checked against the old
+// one, using the CI names or, if they are not available, by comparing the
+// responses of the two AIGs to the same input patterns.
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the pattern store.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManPatStoreStart( Gia_Man_t * p, int nPatsMax )
+{
+    Gia_ManPatStoreStop( p );
+    p->nPatStoreWords = Abc_MaxInt( 1, (nPatsMax + 63) / 64 );
+    p->vPatStore      = Vec_WrdStart( Gia_ManCiNum(p) * p->nPatStoreWords );
+    p->nPatStore      = 0;
+    p->iPatStore      = 0;
+}
+void Gia_ManPatStoreStop( Gia_Man_t * p )
+{
+    Vec_WrdFreeP( &p->vPatStore );
+    p->nPatStoreWords = 0;
+    p->nPatStore      = 0;
+    p->iPatStore      = 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds one pattern to the store.]
+
+  Description [The pattern is given as literals of the CI object IDs.
+  The CIs not listed in the pattern are set to 0. The literals of other
+  objects are skipped. Starts the store with
+  the default capacity if it was not started. Returns the index of the
+  pattern in the store.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManPatStoreAdd( Gia_Man_t * p, Vec_Int_t * vLits )
+{
+    int i, iLit, iPat;
+    if ( p->vPatStore == NULL )
+        Gia_ManPatStoreStart( p, GIA_PAT_STORE_DEFAULT );
+    assert( Vec_WrdSize(p->vPatStore) == Gia_ManCiNum(p) * p->nPatStoreWords );
+    iPat = p->iPatStore;
+    if ( p->nPatStore == 64 * p->nPatStoreWords ) // overwriting the oldest pattern
+        for ( i = 0; i < Gia_ManCiNum(p); i++ )
+            if ( Abc_TtGetBit(Gia_ManPatStoreCi(p, i), iPat) )
+                Abc_TtXorBit( Gia_ManPatStoreCi(p, i), iPat );
+    Vec_IntForEachEntry( vLits, iLit, i )
+    {
+        Gia_Obj_t * pObj = Gia_ManObj( p, Abc_Lit2Var(iLit) );
+        if ( Gia_ObjIsCi(pObj) && Abc_LitIsCompl(iLit) )
+            Abc_TtSetBit( Gia_ManPatStoreCi(p, Gia_ObjCioId(pObj)), iPat );
+    }
+    p->iPatStore = (iPat + 1) % (64 * p->nPatStoreWords);
+    p->nPatStore = Abc_MinInt( p->nPatStore + 1, 64 * p->nPatStoreWords );
+    return iPat;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Checks that two managers have the same CIs in the same order.]
+
+  Description [If both managers have CI names, they are compared. Otherwise,
+  the two AIGs are simulated with the same input patterns (the first word
+  of the stored patterns and one word of random patterns); the CO responses
+  match only if the new AIG is a transformed copy of the old one with the
+  same CI order, which is the case for the sweeping and synthesis commands.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManPatStoreSameCis( Gia_Man_t * pNew, Gia_Man_t * pOld )
+{
+    Vec_Wrd_t * vSimsPi, * vSimsNew, * vSimsOld;
+    int i, RetValue;
+    if ( Gia_ManCiNum(pNew) != Gia_ManCiNum(pOld) || Gia_ManRegNum(pNew) != Gia_ManRegNum(pOld) )
+        return 0;
+    if ( pNew->vNamesIn && pOld->vNamesIn )
+    {
+        if ( Vec_PtrSize(pNew->vNamesIn) != Gia_ManCiNum(pNew) || Vec_PtrSize(pOld->vNamesIn) != Gia_ManCiNum(pOld) )
+            return 0;
+        for ( i = 0; i < Gia_ManCiNum(pNew); i++ )
+            if ( strcmp( (char *)Vec_PtrEntry(pNew->vNamesIn, i), (char *)Vec_PtrEntry(pOld->vNamesIn, i) ) )
+                return 0;
+        return 1;
+    }
+    if ( Gia_ManCoNum(pNew) != Gia_ManCoNum(pOld) || Gia_ManCiNum(pNew) == 0 )
+        return 0;
+    vSimsPi = Vec_WrdAlloc( 2 * Gia_ManCiNum(pOld) );
+    for ( i = 0; i < Gia_ManCiNum(pOld); i++ )
+    {
+        Vec_WrdPush( vSimsPi, Gia_ManPatStoreCi(pOld, i)[0] );
+        Vec_WrdPush( vSimsPi, Gia_ManRandomW(0) );
+    }
+    vSimsNew = Gia_ManSimPatSimOut( pNew, vSimsPi, 1 );
+    vSimsOld = Gia_ManSimPatSimOut( pOld, vSimsPi, 1 );
+    RetValue = Vec_WrdEqual( vSimsNew, vSimsOld );
+    Vec_WrdFree( vSimsNew );
+    Vec_WrdFree( vSimsOld );
+    Vec_WrdFree( vSimsPi );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Moves the store from one manager to another.]
+
+  Description [The store is moved only if the target does not have its
+  own store and the managers have the same CIs in the same order. This is
+  either guaranteed by the caller (fSameCis is set when the target was
+  derived from the source by a construction preserving the CI order, such
+  as a miter) or checked using Gia_ManPatStoreSameCis(). Otherwise, the
+  store is deleted.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManPatStoreTransfer( Gia_Man_t * pNew, Gia_Man_t * pOld, int fSameCis )
+{
+    if ( pOld == NULL || pNew == pOld || pOld->vPatStore == NULL || pNew->vPatStore != NULL )
+        return;
+    if ( fSameCis ? Gia_ManCiNum(pNew) != Gia_ManCiNum(pOld) : !Gia_ManPatStoreSameCis(pNew, pOld) )
+    {
+        Gia_ManPatStoreStop( pOld );
+        return;
+    }
+    pNew->vPatStore      = pOld->vPatStore;
+    pNew->nPatStoreWords = pOld->nPatStoreWords;
+    pNew->nPatStore      = pOld->nPatStore;
+    pNew->iPatStore      = pOld->iPatStore;
+    pOld->vPatStore      = NULL;
+    Gia_ManPatStoreStop( pOld );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Loads a range of stored patterns into the CI simulation info.]
+
+  Description [Writes nPats patterns starting from iPatStart into bits
+  iBitStart, iBitStart+1, ... of the simulation words of each CI. The
+  simulation info is object-major: the info of object Id starts at
+  pSims + Id * nWords. The other bits are not changed. Returns the number
+  of patterns loaded.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManPatStoreLoad( Gia_Man_t * p, int iPatStart, int nPats, word * pSims, int nWords, int iBitStart )
+{
+    int i, k;
+    nPats = Abc_MinInt( nPats, p->nPatStore - iPatStart );
+    nPats = Abc_MinInt( nPats, 64 * nWords - iBitStart );
+    for ( i = 0; i < Gia_ManCiNum(p); i++ )
+    {
+        word * pStore = Gia_ManPatStoreCi( p, i );
+        word * pSim   = pSims + Gia_ManCiIdToId(p, i) * nWords;
+        for ( k = 0; k < nPats; k++ )
+            if ( Abc_TtGetBit(pStore, iPatStart + k) != Abc_TtGetBit(pSim, iBitStart + k) )
+                Abc_TtXorBit( pSim, iBitStart + k );
+    }
+    return Abc_MaxInt( nPats, 0 );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
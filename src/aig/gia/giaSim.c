@@ -20,6 +20,7 @@
 
 #include "gia.h"
 #include "misc/util/utilTruth.h"
+#include "misc/util/utilSimd.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -390,12 +391,18 @@ static inline void Gia_ManSimulateCo( Gia_ManSim_t * p, int iCo, Gia_Obj_t * pOb
   SeeAlso     []
 
 ***********************************************************************/
-static inline void Gia_ManSimulateNode( Gia_ManSim_t * p, Gia_Obj_t * pObj )
+static inline void Gia_ManSimulateNode( Gia_ManSim_t * p, Gia_Obj_t * pObj, const Abc_SimdKernels_t * pKer )
 {
     unsigned * pInfo  = Gia_SimData( p, Gia_ObjValue(pObj) );
     unsigned * pInfo0 = Gia_SimData( p, Gia_ObjDiff0(pObj) );
     unsigned * pInfo1 = Gia_SimData( p, Gia_ObjDiff1(pObj) );
     int w;
+    if ( p->nWords >= 2 * ABC_SIMD_MIN_WORDS )
+    {
+        unsigned pComps[2] = { 0, ~(unsigned)0 };
+        Abc_SimdAnd32( pKer, pInfo, pInfo0, pInfo1, pComps[Gia_ObjFaninC0(pObj)], pComps[Gia_ObjFaninC1(pObj)], p->nWords );
+        return;
+    }
     if ( Gia_ObjFaninC0(pObj) )
     {
         if (  Gia_ObjFaninC1(pObj) )
@@ -475,6 +482,7 @@ void Gia_ManSimInfoTransfer( Gia_ManSim_t * p )
 ***********************************************************************/
 void Gia_ManSimulateRound( Gia_ManSim_t * p )
 {
+    const Abc_SimdKernels_t * pKer = Abc_SimdKernels();
     Gia_Obj_t * pObj;
     int i, iCis = 0, iCos = 0;
     assert( p->pAig->nFront > 0 );
@@ -485,7 +493,7 @@ void Gia_ManSimulateRound( Gia_ManSim_t * p )
         if ( Gia_ObjIsAndOrConst0(pObj) )
         {
             assert( Gia_ObjValue(pObj) < p->pAig->nFront );
-            Gia_ManSimulateNode( p, pObj );
+            Gia_ManSimulateNode( p, pObj, pKer );
         }
         else if ( Gia_ObjIsCo(pObj) )
         {
@@ -21,9 +21,19 @@
 #include "gia.h"
 #include "misc/util/utilTruth.h"
 #include "misc/extra/extra.h"
-//#include <immintrin.h>
+#include "misc/util/utilSimd.h"
 #include "aig/miniaig/miniaig.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -90,7 +100,7 @@ void Gia_ManSimPatAssignInputs( Gia_Man_t * p, int nWords, Vec_Wrd_t * vSims, Ve
     Gia_ManForEachCiId( p, Id, i )
         memcpy( Vec_WrdEntryP(vSims, Id*nWords), Vec_WrdEntryP(vSimsIn, i*nWords), sizeof(word)*nWords );
 }
-static inline void Gia_ManSimPatSimAnd( Gia_Man_t * p, int i, Gia_Obj_t * pObj, int nWords, Vec_Wrd_t * vSims )
+static inline void Gia_ManSimPatSimAnd( Gia_Man_t * p, int i, Gia_Obj_t * pObj, int nWords, Vec_Wrd_t * vSims, const Abc_SimdKernels_t * pKer )
 {
     word pComps[2] = { 0, ~(word)0 };
     word Diff0 = pComps[Gia_ObjFaninC0(pObj)];
@@ -98,13 +108,11 @@ static inline void Gia_ManSimPatSimAnd( Gia_Man_t * p, int i, Gia_Obj_t * pObj,
     word * pSims  = Vec_WrdArray(vSims);
     word * pSims0 = pSims + nWords*Gia_ObjFaninId0(pObj, i);
     word * pSims1 = pSims + nWords*Gia_ObjFaninId1(pObj, i);
-    word * pSims2 = pSims + nWords*i; int w;
+    word * pSims2 = pSims + nWords*i;
     if ( Gia_ObjIsXor(pObj) )
-        for ( w = 0; w < nWords; w++ )
-            pSims2[w] = (pSims0[w] ^ Diff0) ^ (pSims1[w] ^ Diff1);
+        Abc_SimdXor( pKer, pSims2, pSims0, pSims1, Diff0, Diff1, nWords );
     else
-        for ( w = 0; w < nWords; w++ )
-            pSims2[w] = (pSims0[w] ^ Diff0) & (pSims1[w] ^ Diff1);
+        Abc_SimdAnd( pKer, pSims2, pSims0, pSims1, Diff0, Diff1, nWords );
 }
 static inline void Gia_ManSimPatSimPo( Gia_Man_t * p, int i, Gia_Obj_t * pObj, int nWords, Vec_Wrd_t * vSims )
 {
@@ -122,17 +130,177 @@ static inline void Gia_ManSimPatSimNot( Gia_Man_t * p, int i, Gia_Obj_t * pObj,
     for ( w = 0; w < nWords; w++ )
         pSims[w]   = ~pSims[w];
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates the internal nodes and COs for a slice of words.]
+
+  Description [Since every word of simulation info is computed independently,
+  the range [wStart; wStop) can be simulated by a separate thread without 
+  synchronization, and the result is identical to the serial one.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Gia_ManSimPatSimAndRange( Gia_Man_t * p, int i, Gia_Obj_t * pObj, int nWords, Vec_Wrd_t * vSims, int wStart, int wStop, const Abc_SimdKernels_t * pKer )
+{
+    word pComps[2] = { 0, ~(word)0 };
+    word Diff0 = pComps[Gia_ObjFaninC0(pObj)];
+    word Diff1 = pComps[Gia_ObjFaninC1(pObj)];
+    word * pSims  = Vec_WrdArray(vSims);
+    word * pSims0 = pSims + nWords*Gia_ObjFaninId0(pObj, i);
+    word * pSims1 = pSims + nWords*Gia_ObjFaninId1(pObj, i);
+    word * pSims2 = pSims + nWords*i;
+    if ( Gia_ObjIsXor(pObj) )
+        Abc_SimdXor( pKer, pSims2 + wStart, pSims0 + wStart, pSims1 + wStart, Diff0, Diff1, wStop - wStart );
+    else
+        Abc_SimdAnd( pKer, pSims2 + wStart, pSims0 + wStart, pSims1 + wStart, Diff0, Diff1, wStop - wStart );
+}
+static inline void Gia_ManSimPatSimPoRange( Gia_Man_t * p, int i, Gia_Obj_t * pObj, int nWords, Vec_Wrd_t * vSims, int wStart, int wStop )
+{
+    word pComps[2] = { 0, ~(word)0 };
+    word Diff0     = pComps[Gia_ObjFaninC0(pObj)];
+    word * pSims   = Vec_WrdArray(vSims);
+    word * pSims0  = pSims + nWords*Gia_ObjFaninId0(pObj, i);
+    word * pSims2  = pSims + nWords*i; int w;
+    for ( w = wStart; w < wStop; w++ )
+        pSims2[w]  = (pSims0[w] ^ Diff0);
+}
+static inline void Gia_ManSimPatSimAndSoaRange( Gia_Man_t * p, int i, int nWords, Vec_Wrd_t * vSims, int wStart, int wStop, const Abc_SimdKernels_t * pKer )
+{
+    word pComps[2] = { 0, ~(word)0 };
+    word Diff0 = pComps[Gia_ObjSoaFaninC0(p, i)];
+    word Diff1 = pComps[Gia_ObjSoaFaninC1(p, i)];
+    word * pSims  = Vec_WrdArray(vSims);
+    word * pSims0 = pSims + nWords*Gia_ObjSoaFaninId0(p, i) + wStart;
+    word * pSims1 = pSims + nWords*Gia_ObjSoaFaninId1(p, i) + wStart;
+    word * pSims2 = pSims + nWords*i + wStart;
+    if ( Gia_ObjSoaIsXor(p, i) )
+        Abc_SimdXor( pKer, pSims2, pSims0, pSims1, Diff0, Diff1, wStop - wStart );
+    else
+        Abc_SimdAnd( pKer, pSims2, pSims0, pSims1, Diff0, Diff1, wStop - wStart );
+}
+static inline void Gia_ManSimPatSimPoSoaRange( Gia_Man_t * p, int i, int nWords, Vec_Wrd_t * vSims, int wStart, int wStop )
+{
+    word Diff0     = Gia_ObjSoaFaninC0(p, i) ? ~(word)0 : 0;
+    word * pSims   = Vec_WrdArray(vSims);
+    word * pSims0  = pSims + nWords*Gia_ObjSoaFaninId0(p, i);
+    word * pSims2  = pSims + nWords*i; int w;
+    for ( w = wStart; w < wStop; w++ )
+        pSims2[w]  = (pSims0[w] ^ Diff0);
+}
+void Gia_ManSimPatSimRange( Gia_Man_t * p, int nWords, Vec_Wrd_t * vSims, int wStart, int wStop )
+{
+    const Abc_SimdKernels_t * pKer = Abc_SimdKernels();
+    Gia_Obj_t * pObj; int i;
+    assert( 0 <= wStart && wStart <= wStop && wStop <= nWords );
+    if ( Gia_ManHasSoa(p) )
+    {
+        // traverse the dense fanin arrays instead of the object array
+        Gia_ManForEachAndSoa( p, i )
+            Gia_ManSimPatSimAndSoaRange( p, i, nWords, vSims, wStart, wStop, pKer );
+        Gia_ManForEachCoSoa( p, i )
+            Gia_ManSimPatSimPoSoaRange( p, i, nWords, vSims, wStart, wStop );
+        return;
+    }
+    Gia_ManForEachAnd( p, pObj, i ) 
+        Gia_ManSimPatSimAndRange( p, i, pObj, nWords, vSims, wStart, wStop, pKer );
+    Gia_ManForEachCo( p, pObj, i )
+        Gia_ManSimPatSimPoRange( p, Gia_ObjId(p, pObj), pObj, nWords, vSims, wStart, wStop );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates the internal nodes and COs using several threads.]
+
+  Description [The simulation words are split into nThreads contiguous slices.
+  Each thread traverses the AIG in topological order and computes its own slice, 
+  so no synchronization is needed between the levels.  The threads read
+  the fanins from the structure-of-arrays view, which is created for this
+  call unless the caller has created it.  When the number of threads is one,
+  the number of words is too small, or pthreads are not used, the serial 
+  simulator is called.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#define GIA_SIM_THR_MAX 100
+typedef struct Gia_SimPatThData_t_
+{
+    Gia_Man_t *    p;
+    Vec_Wrd_t *    vSims;
+    int            nWords;
+    int            wStart;
+    int            wStop;
+} Gia_SimPatThData_t;
+void * Gia_ManSimPatWorkerThread( void * pArg )
+{
+    Gia_SimPatThData_t * pThData = (Gia_SimPatThData_t *)pArg;
+    Gia_ManSimPatSimRange( pThData->p, pThData->nWords, pThData->vSims, pThData->wStart, pThData->wStop );
+    return NULL;
+}
+void Gia_ManSimPatSimMt( Gia_Man_t * p, int nWords, Vec_Wrd_t * vSims, int nThreads )
+{
+    assert( Vec_WrdSize(vSims) == nWords * Gia_ManObjNum(p) );
+    nThreads = Abc_MinInt( Abc_MinInt(nThreads, nWords), GIA_SIM_THR_MAX );
+#ifdef ABC_USE_PTHREADS
+    if ( nThreads > 1 )
+    {
+        pthread_t WorkerThread[GIA_SIM_THR_MAX];
+        Gia_SimPatThData_t ThData[GIA_SIM_THR_MAX];
+        int i, status, fSoa = !Gia_ManHasSoa(p);
+        if ( fSoa )
+            Gia_ManSoaStart( p );
+        for ( i = 0; i < nThreads; i++ )
+        {
+            ThData[i].p      = p;
+            ThData[i].vSims  = vSims;
+            ThData[i].nWords = nWords;
+            ThData[i].wStart = (int)((word)nWords * i / nThreads);
+            ThData[i].wStop  = (int)((word)nWords * (i+1) / nThreads);
+        }
+        // the last slice is simulated by the calling thread
+        for ( i = 0; i < nThreads - 1; i++ )
+        {
+            status = pthread_create( WorkerThread + i, NULL, Gia_ManSimPatWorkerThread, (void *)(ThData + i) );  
+            assert( status == 0 );
+        }
+        Gia_ManSimPatWorkerThread( (void *)(ThData + nThreads - 1) );
+        for ( i = 0; i < nThreads - 1; i++ )
+            pthread_join( WorkerThread[i], NULL );
+        if ( fSoa )
+            Gia_ManSoaStop( p, 0 );
+        return;
+    }
+#endif
+    Gia_ManSimPatSimRange( p, nWords, vSims, 0, nWords );
+}
+static inline void Gia_ManSimPatSimInt( Gia_Man_t * p, int nWords, Vec_Wrd_t * vSims )
+{
+    const Abc_SimdKernels_t * pKer = Abc_SimdKernels();
+    Gia_Obj_t * pObj; int i;
+    if ( p->nSimThreads > 1 || Gia_ManHasSoa(p) )
+    {
+        Gia_ManSimPatSimMt( p, nWords, vSims, p->nSimThreads );
+        return;
+    }
+    Gia_ManForEachAnd( p, pObj, i ) 
+        Gia_ManSimPatSimAnd( p, i, pObj, nWords, vSims, pKer );
+    Gia_ManForEachCo( p, pObj, i )
+        Gia_ManSimPatSimPo( p, Gia_ObjId(p, pObj), pObj, nWords, vSims );
+}
+
 Vec_Wrd_t * Gia_ManSimPatSim( Gia_Man_t * pGia )
 {
-    Gia_Obj_t * pObj;
-    int i, nWords = Vec_WrdSize(pGia->vSimsPi) / Gia_ManCiNum(pGia);
+    int nWords = Vec_WrdSize(pGia->vSimsPi) / Gia_ManCiNum(pGia);
     Vec_Wrd_t * vSims = Vec_WrdStart( Gia_ManObjNum(pGia) * nWords );
     assert( Vec_WrdSize(pGia->vSimsPi) % Gia_ManCiNum(pGia) == 0 );
     Gia_ManSimPatAssignInputs( pGia, nWords, vSims, pGia->vSimsPi );
-    Gia_ManForEachAnd( pGia, pObj, i ) 
-        Gia_ManSimPatSimAnd( pGia, i, pObj, nWords, vSims );
-    Gia_ManForEachCo( pGia, pObj, i )
-        Gia_ManSimPatSimPo( pGia, Gia_ObjId(pGia, pObj), pObj, nWords, vSims );
+    Gia_ManSimPatSimInt( pGia, nWords, vSims );
     return vSims;
 }
 Vec_Wrd_t * Gia_ManSimPatSimOut( Gia_Man_t * pGia, Vec_Wrd_t * vSimsPi, int fOuts )
@@ -143,10 +311,7 @@ Vec_Wrd_t * Gia_ManSimPatSimOut( Gia_Man_t * pGia, Vec_Wrd_t * vSimsPi, int fOut
     Vec_Wrd_t * vSims = Vec_WrdStart( Gia_ManObjNum(pGia) * nWords );
     assert( Vec_WrdSize(vSimsPi) % Gia_ManCiNum(pGia) == 0 );
     Gia_ManSimPatAssignInputs( pGia, nWords, vSims, vSimsPi );
-    Gia_ManForEachAnd( pGia, pObj, i ) 
-        Gia_ManSimPatSimAnd( pGia, i, pObj, nWords, vSims );
-    Gia_ManForEachCo( pGia, pObj, i )
-        Gia_ManSimPatSimPo( pGia, Gia_ObjId(pGia, pObj), pObj, nWords, vSims );
+    Gia_ManSimPatSimInt( pGia, nWords, vSims );
     if ( !fOuts )
         return vSims;
     Gia_ManForEachCo( pGia, pObj, i )
@@ -154,7 +319,7 @@ Vec_Wrd_t * Gia_ManSimPatSimOut( Gia_Man_t * pGia, Vec_Wrd_t * vSimsPi, int fOut
     Vec_WrdFree( vSims );
     return vSimsCo;
 }
-static inline void Gia_ManSimPatSimAnd3( Gia_Man_t * p, int i, Gia_Obj_t * pObj, int nWords, Vec_Wrd_t * vSims, Vec_Wrd_t * vSimsC )
+static inline void Gia_ManSimPatSimAnd3( Gia_Man_t * p, int i, Gia_Obj_t * pObj, int nWords, Vec_Wrd_t * vSims, Vec_Wrd_t * vSimsC, word * pTemp, const Abc_SimdKernels_t * pKer )
 {
     word pComps[2] = { ~(word)0, 0 };
     word Diff0 = pComps[Gia_ObjFaninC0(pObj)];
@@ -164,19 +329,22 @@ static inline void Gia_ManSimPatSimAnd3( Gia_Man_t * p, int i, Gia_Obj_t * pObj,
     word * pSims2 = Vec_WrdArray(vSims) + nWords*i; 
     word * pSimsC0 = Vec_WrdArray(vSimsC) + nWords*Gia_ObjFaninId0(pObj, i);
     word * pSimsC1 = Vec_WrdArray(vSimsC) + nWords*Gia_ObjFaninId1(pObj, i);
-    word * pSimsC2 = Vec_WrdArray(vSimsC) + nWords*i; int w;
+    word * pSimsC2 = Vec_WrdArray(vSimsC) + nWords*i;
     if ( Gia_ObjIsXor(pObj) )
-        for ( w = 0; w < nWords; w++ )
-        {
-            pSimsC0[w] |= pSimsC2[w];
-            pSimsC1[w] |= pSimsC2[w];
-        }
-    else
-        for ( w = 0; w < nWords; w++ )
-        {
-            pSimsC0[w] |= (pSims2[w] | (pSims0[w] ^ Diff0)) & pSimsC2[w];
-            pSimsC1[w] |= (pSims2[w] | (pSims1[w] ^ Diff1)) & pSimsC2[w];
-        }
+    {
+        // pSimsC0 |= pSimsC2 written as pSimsC0 ? pSimsC0 : pSimsC2
+        Abc_SimdMux( pKer, pSimsC0, pSimsC0, pSimsC0, pSimsC2, 0, 0, nWords );
+        Abc_SimdMux( pKer, pSimsC1, pSimsC1, pSimsC1, pSimsC2, 0, 0, nWords );
+        return;
+    }
+    // pSimsC0 |= (pSims2 | (pSims0 ^ Diff0)) & pSimsC2, where the OR is ~(~pSims2 & ~(pSims0 ^ Diff0))
+    Abc_SimdAnd( pKer, pTemp, pSims2, pSims0, ~(word)0, ~Diff0, nWords );
+    Abc_SimdAnd( pKer, pTemp, pSimsC2, pTemp, 0, ~(word)0, nWords );
+    Abc_SimdMux( pKer, pSimsC0, pSimsC0, pSimsC0, pTemp, 0, 0, nWords );
+    // pSimsC1 |= (pSims2 | (pSims1 ^ Diff1)) & pSimsC2
+    Abc_SimdAnd( pKer, pTemp, pSims2, pSims1, ~(word)0, ~Diff1, nWords );
+    Abc_SimdAnd( pKer, pTemp, pSimsC2, pTemp, 0, ~(word)0, nWords );
+    Abc_SimdMux( pKer, pSimsC1, pSimsC1, pSimsC1, pTemp, 0, 0, nWords );
 }
 Vec_Wrd_t * Gia_ManSimPatSimIn( Gia_Man_t * pGia, Vec_Wrd_t * vSims, int fIns, Vec_Int_t * vAnds )
 {
@@ -184,6 +352,8 @@ Vec_Wrd_t * Gia_ManSimPatSimIn( Gia_Man_t * pGia, Vec_Wrd_t * vSims, int fIns, V
     int i, Id, nWords = Vec_WrdSize(vSims) / Gia_ManObjNum(pGia);
     Vec_Wrd_t * vSimsCi = fIns ? Vec_WrdStart( Gia_ManCiNum(pGia) * nWords ) : NULL;
     Vec_Wrd_t * vSimsC  = Vec_WrdStart( Vec_WrdSize(vSims) );
+    word * pTemp = ABC_ALLOC( word, nWords );
+    const Abc_SimdKernels_t * pKer = Abc_SimdKernels();
     assert( Vec_WrdSize(vSims) % Gia_ManObjNum(pGia) == 0 );
     if ( vAnds )
         Vec_IntForEachEntry( vAnds, Id, i )
@@ -192,7 +362,8 @@ Vec_Wrd_t * Gia_ManSimPatSimIn( Gia_Man_t * pGia, Vec_Wrd_t * vSims, int fIns, V
         Gia_ManForEachCoDriverId( pGia, Id, i )
             memset( Vec_WrdEntryP(vSimsC, Id*nWords), 0xFF, sizeof(word)*nWords );
     Gia_ManForEachAndReverse( pGia, pObj, i ) 
-        Gia_ManSimPatSimAnd3( pGia, i, pObj, nWords, vSims, vSimsC );
+        Gia_ManSimPatSimAnd3( pGia, i, pObj, nWords, vSims, vSimsC, pTemp, pKer );
+    ABC_FREE( pTemp );
     if ( !fIns )
         return vSimsC;
     Gia_ManForEachCi( pGia, pObj, i )
@@ -213,7 +384,7 @@ void Gia_ManSimPatSimInTest( Gia_Man_t * pGia )
     Vec_WrdFree( vSims2 );
     Vec_WrdFree( vSimsCi );
 }
-static inline void Gia_ManSimPatSimAnd4( Gia_Man_t * p, int i, Gia_Obj_t * pObj, int nWords, Vec_Wrd_t * vSims, Vec_Wrd_t * vSimsC )
+static inline void Gia_ManSimPatSimAnd4( Gia_Man_t * p, int i, Gia_Obj_t * pObj, int nWords, Vec_Wrd_t * vSims, Vec_Wrd_t * vSimsC, word * pTemp, const Abc_SimdKernels_t * pKer )
 {
     word pComps[2] = { ~(word)0, 0 };
     word Diff0 = pComps[Gia_ObjFaninC0(pObj)];
@@ -222,25 +393,32 @@ static inline void Gia_ManSimPatSimAnd4( Gia_Man_t * p, int i, Gia_Obj_t * pObj,
     word * pSims1 = Vec_WrdArray(vSims) + nWords*Gia_ObjFaninId1(pObj, i);
     word * pSimsC0 = Vec_WrdArray(vSimsC) + nWords*Gia_ObjFaninId0(pObj, i);
     word * pSimsC1 = Vec_WrdArray(vSimsC) + nWords*Gia_ObjFaninId1(pObj, i);
-    word * pSimsC2 = Vec_WrdArray(vSimsC) + nWords*i; int w;
+    word * pSimsC2 = Vec_WrdArray(vSimsC) + nWords*i;
     if ( Gia_ObjIsXor(pObj) )
-        for ( w = 0; w < nWords; w++ )
-            pSimsC2[w] = pSimsC0[w] & pSimsC1[w];
-    else
-        for ( w = 0; w < nWords; w++ )
-            pSimsC2[w] = (pSimsC0[w] & pSimsC1[w]) | ((pSims0[w] ^ Diff0) & pSimsC0[w]) | ((pSims1[w] ^ Diff1) & pSimsC1[w]);
+    {
+        Abc_SimdAnd( pKer, pSimsC2, pSimsC0, pSimsC1, 0, 0, nWords );
+        return;
+    }
+    // (pSimsC0 & pSimsC1) | ((pSims0 ^ Diff0) & pSimsC0) | ((pSims1 ^ Diff1) & pSimsC1) is equal to
+    // pSimsC0 ? (pSimsC1 | (pSims0 ^ Diff0)) : ((pSims1 ^ Diff1) & pSimsC1), where the OR is ~(~pSimsC1 & ~(pSims0 ^ Diff0))
+    Abc_SimdAnd( pKer, pTemp, pSimsC1, pSims0, ~(word)0, ~Diff0, nWords );
+    Abc_SimdAnd( pKer, pSimsC2, pSims1, pSimsC1, Diff1, 0, nWords );
+    Abc_SimdMux( pKer, pSimsC2, pSimsC0, pTemp, pSimsC2, ~(word)0, 0, nWords );
 }
 Vec_Wrd_t * Gia_ManSimPatSimC( Gia_Man_t * pGia, Vec_Wrd_t * vSims, Vec_Wrd_t * vSimsCiC )
 {
     Gia_Obj_t * pObj;
     int i, Id, nWords = Vec_WrdSize(vSims) / Gia_ManObjNum(pGia);
     Vec_Wrd_t * vSimsC = Vec_WrdStart( Vec_WrdSize(vSims) );
+    word * pTemp = ABC_ALLOC( word, nWords );
+    const Abc_SimdKernels_t * pKer = Abc_SimdKernels();
     assert( Vec_WrdSize(vSims) % Gia_ManObjNum(pGia) == 0 );
     memset( Vec_WrdEntryP(vSimsC, 0), 0xFF, sizeof(word)*nWords );
     Gia_ManForEachCiId( pGia, Id, i )
         memmove( Vec_WrdEntryP(vSimsC, Id*nWords), Vec_WrdEntryP(vSimsCiC, i*nWords), sizeof(word)*nWords );
     Gia_ManForEachAnd( pGia, pObj, i ) 
-        Gia_ManSimPatSimAnd4( pGia, i, pObj, nWords, vSims, vSimsC );
+        Gia_ManSimPatSimAnd4( pGia, i, pObj, nWords, vSims, vSimsC, pTemp, pKer );
+    ABC_FREE( pTemp );
     return vSimsC;
 }
 void Gia_ManSimPatSimCTest( Gia_Man_t * pGia )
@@ -263,12 +441,13 @@ void Gia_ManSimPatSimCTest( Gia_Man_t * pGia )
 }
 void Gia_ManSimPatResim( Gia_Man_t * pGia, Vec_Int_t * vObjs, int nWords, Vec_Wrd_t * vSims )
 {
+    const Abc_SimdKernels_t * pKer = Abc_SimdKernels();
     Gia_Obj_t * pObj; int i;
     Gia_ManForEachObjVec( vObjs, pGia, pObj, i )
         if ( i == 0 )
             Gia_ManSimPatSimNot( pGia, Gia_ObjId(pGia, pObj), pObj, nWords, vSims );
         else if ( Gia_ObjIsAnd(pObj) )
-            Gia_ManSimPatSimAnd( pGia, Gia_ObjId(pGia, pObj), pObj, nWords, vSims );
+            Gia_ManSimPatSimAnd( pGia, Gia_ObjId(pGia, pObj), pObj, nWords, vSims, pKer );
         else if ( !Gia_ObjIsCo(pObj) ) assert(0);
 }
 void Gia_ManSimPatWrite( char * pFileName, Vec_Wrd_t * vSimsIn, int nWords )
@@ -290,6 +469,7 @@ void Gia_ManSimPatWrite( char * pFileName, Vec_Wrd_t * vSimsIn, int nWords )
 ***********************************************************************/
 word * Gia_ManDeriveFuncs( Gia_Man_t * p )
 {
+    const Abc_SimdKernels_t * pKer = Abc_SimdKernels();
     int nVars2 = (Gia_ManCiNum(p) + 6)/2;
     int nVars3 = Gia_ManCiNum(p) - nVars2;
     int nWords = Abc_Truth6WordNum( Gia_ManCiNum(p) );
@@ -308,7 +488,7 @@ word * Gia_ManDeriveFuncs( Gia_Man_t * p )
         for ( v = 0; v < nVars3; v++ )
             Abc_TtConst( Vec_WrdEntryP(vSims, nWords2*(nVars2+v+1)), nWords2, (m >> v) & 1 );
         Gia_ManForEachAnd( p, pObj, i ) 
-            Gia_ManSimPatSimAnd( p, i, pObj, nWords2, vSims );
+            Gia_ManSimPatSimAnd( p, i, pObj, nWords2, vSims, pKer );
         Gia_ManForEachCo( p, pObj, i )
             Gia_ManSimPatSimPo( p, Gia_ObjId(p, pObj), pObj, nWords2, vSims );
         Gia_ManForEachCo( p, pObj, i )
@@ -436,6 +616,7 @@ int Gia_ManComparePair( Gia_Man_t * p, Vec_Wrd_t * vSims, int iOut, int nWords2
 }
 int Gia_ManCheckSimEquiv( Gia_Man_t * p, int fVerbose )
 {
+    const Abc_SimdKernels_t * pKer = Abc_SimdKernels();
     abctime clk = Abc_Clock(); int fWarning = 0;
     //int nVars2  = (Gia_ManCiNum(p) + 6)/2;
     int nVars2  = Gia_ManFindDividerVar( p, fVerbose );
@@ -449,7 +630,7 @@ int Gia_ManCheckSimEquiv( Gia_Man_t * p, int fVerbose )
         Abc_TtCopy( Vec_WrdEntryP(vSims, nWords2*Vec_IntEntry(vNode,0)), (word *)Vec_PtrEntry(vTruths, i), nWords2, 0 );
     Vec_PtrFree( vTruths );
     Gia_ManForEachAnd( p, pObj, i )
-        Gia_ManSimPatSimAnd( p, i, pObj, nWords2, vSims );
+        Gia_ManSimPatSimAnd( p, i, pObj, nWords2, vSims, pKer );
     for ( i = 0; i < Gia_ManCoNum(p)/2; i++ )
     {
         if ( !Gia_ManComparePair( p, vSims, i, nWords2 ) )
@@ -471,7 +652,7 @@ int Gia_ManCheckSimEquiv( Gia_Man_t * p, int fVerbose )
             {
                 pObj = Gia_ManObj( p, iObj );
                 assert( Gia_ObjIsAnd(pObj) );
-                Gia_ManSimPatSimAnd( p, iObj, pObj, nWords2, vSims );
+                Gia_ManSimPatSimAnd( p, iObj, pObj, nWords2, vSims, pKer );
             }
             else if ( !Gia_ManComparePair( p, vSims, iObj - Gia_ManObjNum(p), nWords2 ) )
             {
@@ -1138,6 +1319,7 @@ int Gia_ManSimRelCollectOutputs( Gia_Man_t * p, int nWords, Vec_Wrd_t * vSims, i
 }
 Vec_Wrd_t * Gia_ManSimRel( Gia_Man_t * p, Vec_Int_t * vObjs, Vec_Wrd_t * vVals )
 {
+    const Abc_SimdKernels_t * pKer = Abc_SimdKernels();
     int nWords = Vec_WrdSize(p->vSimsPi) / Gia_ManCiNum(p);
     int nMints = 1 << Vec_IntSize(vObjs), i, m, iObj;
     Gia_Obj_t * pObj;
@@ -1155,7 +1337,7 @@ Vec_Wrd_t * Gia_ManSimRel( Gia_Man_t * p, Vec_Int_t * vObjs, Vec_Wrd_t * vVals )
         pObj->fPhase = 1;
     Gia_ManForEachAnd( p, pObj, i ) 
         if ( !pObj->fPhase )
-            Gia_ManSimPatSimAnd( p, i, pObj, nWords * nMints, vSims );
+            Gia_ManSimPatSimAnd( p, i, pObj, nWords * nMints, vSims, pKer );
     Gia_ManForEachCo( p, pObj, i )
         if ( !pObj->fPhase )
             Gia_ManSimPatSimPo( p, Gia_ObjId(p, pObj), pObj, nWords * nMints, vSims );
@@ -2899,6 +3081,7 @@ Vec_Wec_t * Gia_ManRelTfos( Gia_Man_t * p, Vec_Int_t * vObjs )
 }
 Vec_Wrd_t * Gia_ManRelDerive( Gia_Man_t * p, Vec_Int_t * vObjs, Vec_Wrd_t * vSims )
 {
+    const Abc_SimdKernels_t * pKer = Abc_SimdKernels();
     int nWords = Vec_WrdSize(p->vSimsPi) / Gia_ManCiNum(p); Gia_Obj_t * pObj;
     int i, m, iVar, iMint = 0, nMints = 1 << Vec_IntSize(vObjs); 
     Vec_Wrd_t * vCopy  = Vec_WrdDup(vSims);  Vec_Int_t * vLevel;
@@ -2914,7 +3097,7 @@ Vec_Wrd_t * Gia_ManRelDerive( Gia_Man_t * p, Vec_Int_t * vObjs, Vec_Wrd_t * vSim
         if ( pObj->fPhase )
             Abc_TtClear( Vec_WrdEntryP(vCopy, Gia_ObjId(p, pObj)*nWords), nWords );
         else
-            Gia_ManSimPatSimAnd( p, Gia_ObjId(p, pObj), pObj, nWords, vCopy );
+            Gia_ManSimPatSimAnd( p, Gia_ObjId(p, pObj), pObj, nWords, vCopy, pKer );
     for ( m = 0; m < nMints; m++ )
     {
         Gia_ManForEachCo( p, pObj, i )
@@ -2932,7 +3115,7 @@ Vec_Wrd_t * Gia_ManRelDerive( Gia_Man_t * p, Vec_Int_t * vObjs, Vec_Wrd_t * vSim
         Abc_TtNot( Vec_WrdEntryP(vCopy, Vec_IntEntry(vObjs, iVar)*nWords), nWords );
         Gia_ManForEachObjVec( vLevel, p, pObj, i )
             if ( !pObj->fPhase )
-                Gia_ManSimPatSimAnd( p, Gia_ObjId(p, pObj), pObj, nWords, vCopy );
+                Gia_ManSimPatSimAnd( p, Gia_ObjId(p, pObj), pObj, nWords, vCopy, pKer );
         iMint ^= 1 << iVar;
     }
     Gia_ManForEachObjVec( vObjs, p, pObj, i )
@@ -3316,11 +3499,12 @@ Vec_Int_t * Gia_ManRelOutsTfo( Gia_Man_t * p, Vec_Int_t * vOuts )
 }
 void Gia_ManSimPatSimTfo( Gia_Man_t * p, Vec_Wrd_t * vSims, Vec_Int_t * vTfo )
 {
+    const Abc_SimdKernels_t * pKer = Abc_SimdKernels();
     Gia_Obj_t * pObj;
     int i, nWords = Vec_WrdSize(p->vSimsPi) / Gia_ManCiNum(p);
     Gia_ManForEachObjVec( vTfo, p, pObj, i ) 
         if ( Gia_ObjIsAnd(pObj) )
-            Gia_ManSimPatSimAnd( p, Gia_ObjId(p, pObj), pObj, nWords, vSims );
+            Gia_ManSimPatSimAnd( p, Gia_ObjId(p, pObj), pObj, nWords, vSims, pKer );
         else
             Gia_ManSimPatSimPo( p, Gia_ObjId(p, pObj), pObj, nWords, vSims );
 }
@@ -0,0 +1,503 @@
+/**CFile****************************************************************
+
+  FileName    [giaSnap.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Binary snapshot of the AIG manager.]
+
+  Author      [agent <agent@local>]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: giaSnap.c,v 1.00 2026/10/17 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+#include "misc/tim/tim.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The snapshot stores the arrays of the manager as they are in memory,
+// so that loading it does not strash, levelize or rebuild anything.
+// The file starts with a header of GIA_SNAP_HEADER integers, followed
+// by sections; each section has an 8-byte tag/padding word, an 8-byte
+// size, and the data padded to 8 bytes.  Unknown sections are skipped.
+// The snapshot is not portable across platforms with different
+// endianness or object layout; this is checked when it is loaded.
+
+#define GIA_SNAP_MAGIC    "GIASNAP"
+#define GIA_SNAP_VERSION  1
+#define GIA_SNAP_HEADER   16
+
+enum {
+    GIA_SNAP_END = 0,       // the last section
+    GIA_SNAP_NAME,          // pName
+    GIA_SNAP_SPEC,          // pSpec
+    GIA_SNAP_OBJS,          // pObjs
+    GIA_SNAP_MUXES,         // pMuxes
+    GIA_SNAP_CIS,           // vCis
+    GIA_SNAP_COS,           // vCos
+    GIA_SNAP_LEVELS,        // vLevels
+    GIA_SNAP_MAPPING,       // vMapping
+    GIA_SNAP_CELLMAP,       // vCellMapping
+    GIA_SNAP_PACKING,       // vPacking
+    GIA_SNAP_SIBLS,         // pSibls
+    GIA_SNAP_REPRS,         // pReprs
+    GIA_SNAP_NEXTS,         // pNexts
+    GIA_SNAP_FLOPCLASSES,   // vFlopClasses
+    GIA_SNAP_REGCLASSES,    // vRegClasses
+    GIA_SNAP_REGINITS,      // vRegInits
+    GIA_SNAP_CONFIGS,       // vConfigs
+    GIA_SNAP_CELLSTR,       // pCellStr
+    GIA_SNAP_NAMESIN,       // vNamesIn
+    GIA_SNAP_NAMESOUT,      // vNamesOut
+    GIA_SNAP_INARRS,        // vInArrs
+    GIA_SNAP_OUTREQS,       // vOutReqs
+    GIA_SNAP_TIMING,        // pManTime
+    GIA_SNAP_AIGEXTRA       // pAigExtra
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Writes one section.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_ManSnapWriteSection( FILE * pFile, int Tag, void * pData, word nBytes )
+{
+    char Zeros[8] = {0};
+    int Header[2] = { Tag, 0 };
+    fwrite( Header, 4, 2, pFile );
+    fwrite( &nBytes, 8, 1, pFile );
+    if ( nBytes )
+        fwrite( pData, 1, (size_t)nBytes, pFile );
+    if ( nBytes % 8 )
+        fwrite( Zeros, 1, (size_t)(8 - nBytes % 8), pFile );
+}
+static void Gia_ManSnapWriteVecInt( FILE * pFile, int Tag, Vec_Int_t * vVec )
+{
+    if ( vVec )
+        Gia_ManSnapWriteSection( pFile, Tag, Vec_IntArray(vVec), (word)4 * Vec_IntSize(vVec) );
+}
+static void Gia_ManSnapWriteVecFlt( FILE * pFile, int Tag, Vec_Flt_t * vVec )
+{
+    if ( vVec )
+        Gia_ManSnapWriteSection( pFile, Tag, Vec_FltArray(vVec), (word)4 * Vec_FltSize(vVec) );
+}
+static void Gia_ManSnapWriteStr( FILE * pFile, int Tag, char * pStr )
+{
+    if ( pStr )
+        Gia_ManSnapWriteSection( pFile, Tag, pStr, (word)strlen(pStr) + 1 );
+}
+static void Gia_ManSnapWriteNames( FILE * pFile, int Tag, Vec_Ptr_t * vNames )
+{
+    Vec_Str_t * vStr;
+    char * pName; int i;
+    if ( vNames == NULL )
+        return;
+    vStr = Vec_StrAlloc( 16 * Vec_PtrSize(vNames) + 1 );
+    Vec_PtrForEachEntry( char *, vNames, pName, i )
+    {
+        Vec_StrPrintStr( vStr, pName ? pName : "" );
+        Vec_StrPush( vStr, '\0' );
+    }
+    Gia_ManSnapWriteSection( pFile, Tag, Vec_StrArray(vStr), (word)Vec_StrSize(vStr) );
+    Vec_StrFree( vStr );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the snapshot of the manager.]
+
+  Description [Returns 1 if successful.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManSnapWrite( Gia_Man_t * p, char * pFileName )
+{
+    Vec_Str_t * vStr;
+    int Header[GIA_SNAP_HEADER] = {0};
+    FILE * pFile = fopen( pFileName, "wb" );
+    if ( pFile == NULL )
+    {
+        printf( "Gia_ManSnapWrite(): Cannot open the output file \"%s\".\n", pFileName );
+        return 0;
+    }
+    memcpy( Header, GIA_SNAP_MAGIC, 8 );
+    Header[2]  = GIA_SNAP_VERSION;
+    Header[3]  = 0x01020304; // endianness
+    Header[4]  = (int)sizeof(Gia_Obj_t);
+    Header[5]  = (int)sizeof(Gia_Rpr_t);
+    Header[6]  = Gia_ManObjNum(p);
+    Header[7]  = Gia_ManRegNum(p);
+    Header[8]  = p->nXors;
+    Header[9]  = p->nMuxes;
+    Header[10] = p->nBufs;
+    Header[11] = p->nConstrs;
+    Header[12] = p->fGiaSimple;
+    Header[13] = p->nAnd2Delay;
+    Header[14] = p->And2Delay;
+    Header[15] = p->nLevels;
+    fwrite( Header, 4, GIA_SNAP_HEADER, pFile );
+    // the structure
+    Gia_ManSnapWriteStr( pFile, GIA_SNAP_NAME, p->pName );
+    Gia_ManSnapWriteStr( pFile, GIA_SNAP_SPEC, p->pSpec );
+    Gia_ManSnapWriteSection( pFile, GIA_SNAP_OBJS, p->pObjs, (word)sizeof(Gia_Obj_t) * Gia_ManObjNum(p) );
+    if ( p->pMuxes )
+        Gia_ManSnapWriteSection( pFile, GIA_SNAP_MUXES, p->pMuxes, (word)4 * Gia_ManObjNum(p) );
+    Gia_ManSnapWriteVecInt( pFile, GIA_SNAP_CIS, p->vCis );
+    Gia_ManSnapWriteVecInt( pFile, GIA_SNAP_COS, p->vCos );
+    if ( p->vLevels && Vec_IntSize(p->vLevels) == Gia_ManObjNum(p) )
+        Gia_ManSnapWriteVecInt( pFile, GIA_SNAP_LEVELS, p->vLevels );
+    // the mapping
+    Gia_ManSnapWriteVecInt( pFile, GIA_SNAP_MAPPING, p->vMapping );
+    Gia_ManSnapWriteVecInt( pFile, GIA_SNAP_CELLMAP, p->vCellMapping );
+    Gia_ManSnapWriteVecInt( pFile, GIA_SNAP_PACKING, p->vPacking );
+    Gia_ManSnapWriteVecInt( pFile, GIA_SNAP_CONFIGS, p->vConfigs );
+    Gia_ManSnapWriteStr( pFile, GIA_SNAP_CELLSTR, p->pCellStr );
+    // the choices and the equivalences
+    if ( p->pSibls )
+        Gia_ManSnapWriteSection( pFile, GIA_SNAP_SIBLS, p->pSibls, (word)4 * Gia_ManObjNum(p) );
+    if ( p->pReprs )
+        Gia_ManSnapWriteSection( pFile, GIA_SNAP_REPRS, p->pReprs, (word)sizeof(Gia_Rpr_t) * Gia_ManObjNum(p) );
+    if ( p->pNexts )
+        Gia_ManSnapWriteSection( pFile, GIA_SNAP_NEXTS, p->pNexts, (word)4 * Gia_ManObjNum(p) );
+    // the registers
+    Gia_ManSnapWriteVecInt( pFile, GIA_SNAP_FLOPCLASSES, p->vFlopClasses );
+    Gia_ManSnapWriteVecInt( pFile, GIA_SNAP_REGCLASSES, p->vRegClasses );
+    Gia_ManSnapWriteVecInt( pFile, GIA_SNAP_REGINITS, p->vRegInits );
+    // the names
+    Gia_ManSnapWriteNames( pFile, GIA_SNAP_NAMESIN, p->vNamesIn );
+    Gia_ManSnapWriteNames( pFile, GIA_SNAP_NAMESOUT, p->vNamesOut );
+    // the timing
+    Gia_ManSnapWriteVecFlt( pFile, GIA_SNAP_INARRS, p->vInArrs );
+    Gia_ManSnapWriteVecFlt( pFile, GIA_SNAP_OUTREQS, p->vOutReqs );
+    if ( p->pManTime )
+    {
+        vStr = Tim_ManSave( (Tim_Man_t *)p->pManTime, 1 );
+        Gia_ManSnapWriteSection( pFile, GIA_SNAP_TIMING, Vec_StrArray(vStr), (word)Vec_StrSize(vStr) );
+        Vec_StrFree( vStr );
+    }
+    if ( p->pAigExtra )
+    {
+        vStr = Gia_AigerWriteIntoMemoryStr( p->pAigExtra );
+        Gia_ManSnapWriteSection( pFile, GIA_SNAP_AIGEXTRA, Vec_StrArray(vStr), (word)Vec_StrSize(vStr) );
+        Vec_StrFree( vStr );
+    }
+    Gia_ManSnapWriteSection( pFile, GIA_SNAP_END, NULL, 0 );
+    fclose( pFile );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the file starts like a snapshot.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManSnapIsFile( char * pFileName )
+{
+    char Buffer[8] = {0};
+    FILE * pFile = fopen( pFileName, "rb" );
+    int RetValue;
+    if ( pFile == NULL )
+        return 0;
+    RetValue = fread( Buffer, 1, 8, pFile ) == 8 && !memcmp( Buffer, GIA_SNAP_MAGIC, 8 );
+    fclose( pFile );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the snapshot from memory.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Vec_Ptr_t * Gia_ManSnapReadNames( char * pData, word nBytes )
+{
+    Vec_Ptr_t * vNames = Vec_PtrAlloc( 100 );
+    char * pCur = pData, * pStop = pData + nBytes;
+    for ( ; pCur < pStop; pCur += strlen(pCur) + 1 )
+        Vec_PtrPush( vNames, Abc_UtilStrsav(pCur) );
+    return vNames;
+}
+static inline int Gia_ManSnapIsStr( char * pData, word nBytes )
+{
+    return nBytes > 0 && pData[nBytes-1] == '\0';
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Checks the manager read from the snapshot.]
+
+  Description [Makes sure that the fanins, the CI/CO arrays, and the
+  mapping refer to the existing objects, so that a corrupted file does
+  not lead to out-of-bounds accesses later. Returns 1 if the manager
+  is consistent. The arrays of levels of a wrong size are dropped.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_ManSnapCheck( Gia_Man_t * p, int nRegs )
+{
+    Gia_Obj_t * pObj;
+    int i, k, Entry, nObjs = Gia_ManObjNum(p);
+    if ( nObjs < 1 || !Gia_ObjIsConst0(Gia_ManConst0(p)) )
+        return 0;
+    if ( nRegs < 0 || nRegs > Gia_ManCiNum(p) || nRegs > Gia_ManCoNum(p) )
+        return 0;
+    Vec_IntForEachEntry( p->vCis, Entry, i )
+        if ( Entry <= 0 || Entry >= nObjs || !Gia_ObjIsCi(Gia_ManObj(p, Entry)) || Gia_ObjCioId(Gia_ManObj(p, Entry)) != i )
+            return 0;
+    Vec_IntForEachEntry( p->vCos, Entry, i )
+        if ( Entry <= 0 || Entry >= nObjs || !Gia_ObjIsCo(Gia_ManObj(p, Entry)) || Gia_ObjCioId(Gia_ManObj(p, Entry)) != i )
+            return 0;
+    Gia_ManForEachObj1( p, pObj, i )
+    {
+        if ( Gia_ObjIsCi(pObj) )
+        {
+            if ( Gia_ObjCioId(pObj) >= Gia_ManCiNum(p) || Gia_ManCiIdToId(p, Gia_ObjCioId(pObj)) != i )
+                return 0;
+            continue;
+        }
+        if ( Gia_ObjIsCo(pObj) && (Gia_ObjCioId(pObj) >= Gia_ManCoNum(p) || Gia_ManCoIdToId(p, Gia_ObjCioId(pObj)) != i) )
+            return 0;
+        if ( !Gia_ObjIsCo(pObj) && !Gia_ObjIsAnd(pObj) )
+            return 0;
+        if ( pObj->iDiff0 == 0 || (int)pObj->iDiff0 > i || (Gia_ObjIsAnd(pObj) && (pObj->iDiff1 == 0 || (int)pObj->iDiff1 > i)) )
+            return 0;
+        if ( p->pMuxes && p->pMuxes[i] && Abc_Lit2Var(p->pMuxes[i]) >= i )
+            return 0;
+    }
+    for ( i = 0; i < nObjs; i++ )
+        if ( (p->pSibls && (p->pSibls[i] < 0 || p->pSibls[i] >= nObjs)) ||
+             (p->pNexts && (p->pNexts[i] < 0 || p->pNexts[i] >= nObjs)) ||
+             (p->pReprs && p->pReprs[i].iRepr != GIA_VOID && (int)p->pReprs[i].iRepr >= nObjs) )
+            return 0;
+    if ( p->vMapping )
+    {
+        if ( Vec_IntSize(p->vMapping) < nObjs )
+            return 0;
+        for ( i = 0; i < nObjs; i++ )
+        {
+            int iOffset = Vec_IntEntry( p->vMapping, i ), nFanins;
+            if ( iOffset == 0 )
+                continue;
+            if ( iOffset < nObjs || iOffset >= Vec_IntSize(p->vMapping) )
+                return 0;
+            nFanins = Vec_IntEntry( p->vMapping, iOffset );
+            if ( nFanins < 0 || iOffset + nFanins + 1 >= Vec_IntSize(p->vMapping) )
+                return 0;
+            for ( k = 1; k <= nFanins; k++ )
+                if ( Vec_IntEntry(p->vMapping, iOffset + k) < 0 || Vec_IntEntry(p->vMapping, iOffset + k) >= nObjs )
+                    return 0;
+        }
+    }
+    if ( p->vLevels && Vec_IntSize(p->vLevels) != nObjs )
+        Vec_IntFreeP( &p->vLevels );
+    return 1;
+}
+
+Gia_Man_t * Gia_ManSnapReadFromMemory( char * pContents, size_t nFileSize )
+{
+    Gia_Man_t * p;
+    Vec_Str_t * vStr;
+    int * pHeader = (int *)pContents;
+    char * pCur = pContents + 4 * GIA_SNAP_HEADER, * pStop = pContents + nFileSize;
+    char * pData;
+    word nBytes;
+    int Tag = -1, nObjs, fObjs = 0;
+    if ( nFileSize < 4 * GIA_SNAP_HEADER || memcmp( pContents, GIA_SNAP_MAGIC, 8 ) )
+    {
+        printf( "Gia_ManSnapRead(): The file is not a snapshot.\n" );
+        return NULL;
+    }
+    if ( pHeader[2] != GIA_SNAP_VERSION )
+    {
+        printf( "Gia_ManSnapRead(): The snapshot version (%d) is not supported.\n", pHeader[2] );
+        return NULL;
+    }
+    if ( pHeader[3] != 0x01020304 || pHeader[4] != (int)sizeof(Gia_Obj_t) || pHeader[5] != (int)sizeof(Gia_Rpr_t) )
+    {
+        printf( "Gia_ManSnapRead(): The snapshot was written on an incompatible platform.\n" );
+        return NULL;
+    }
+    nObjs = pHeader[6];
+    p = Gia_ManStart( Abc_MaxInt(nObjs, 1) );
+    p->nObjs      = nObjs;
+    p->nXors      = pHeader[8];
+    p->nMuxes     = pHeader[9];
+    p->nBufs      = pHeader[10];
+    p->nConstrs   = pHeader[11];
+    p->fGiaSimple = pHeader[12];
+    p->nAnd2Delay = pHeader[13];
+    p->And2Delay  = pHeader[14];
+    p->nLevels    = pHeader[15];
+    while ( pCur + 16 <= pStop )
+    {
+        Tag    = *(int *)pCur;
+        nBytes = *(word *)(pCur + 8);
+        pData  = pCur + 16;
+        if ( Tag == GIA_SNAP_END )
+            break;
+        if ( pData + nBytes > pStop )
+            break;
+        pCur = pData + ((nBytes + 7) & ~(word)7);
+        if ( (Tag == GIA_SNAP_NAME || Tag == GIA_SNAP_SPEC || Tag == GIA_SNAP_CELLSTR || Tag == GIA_SNAP_NAMESIN || Tag == GIA_SNAP_NAMESOUT) && !Gia_ManSnapIsStr(pData, nBytes) )
+            continue;
+        if ( Tag == GIA_SNAP_NAME )
+            p->pName = Abc_UtilStrsav( pData );
+        else if ( Tag == GIA_SNAP_SPEC )
+            p->pSpec = Abc_UtilStrsav( pData );
+        else if ( Tag == GIA_SNAP_OBJS && nBytes == (word)sizeof(Gia_Obj_t) * nObjs )
+            memcpy( p->pObjs, pData, (size_t)nBytes ), fObjs = 1;
+        else if ( Tag == GIA_SNAP_MUXES && nBytes == (word)4 * nObjs )
+        {
+            p->pMuxes = ABC_CALLOC( unsigned, p->nObjsAlloc );
+            memcpy( p->pMuxes, pData, (size_t)nBytes );
+        }
+        else if ( Tag == GIA_SNAP_CIS )
+            Vec_IntFree( p->vCis ), p->vCis = Vec_IntAllocArrayCopy( (int *)pData, (int)(nBytes / 4) );
+        else if ( Tag == GIA_SNAP_COS )
+            Vec_IntFree( p->vCos ), p->vCos = Vec_IntAllocArrayCopy( (int *)pData, (int)(nBytes / 4) );
+        else if ( Tag == GIA_SNAP_LEVELS )
+            p->vLevels = Vec_IntAllocArrayCopy( (int *)pData, (int)(nBytes / 4) );
+        else if ( Tag == GIA_SNAP_MAPPING )
+            p->vMapping = Vec_IntAllocArrayCopy( (int *)pData, (int)(nBytes / 4) );
+        else if ( Tag == GIA_SNAP_CELLMAP )
+            p->vCellMapping = Vec_IntAllocArrayCopy( (int *)pData, (int)(nBytes / 4) );
+        else if ( Tag == GIA_SNAP_PACKING )
+            p->vPacking = Vec_IntAllocArrayCopy( (int *)pData, (int)(nBytes / 4) );
+        else if ( Tag == GIA_SNAP_CONFIGS )
+            p->vConfigs = Vec_IntAllocArrayCopy( (int *)pData, (int)(nBytes / 4) );
+        else if ( Tag == GIA_SNAP_CELLSTR )
+            p->pCellStr = Abc_UtilStrsav( pData );
+        else if ( Tag == GIA_SNAP_SIBLS && nBytes == (word)4 * nObjs )
+        {
+            p->pSibls = ABC_ALLOC( int, nObjs );
+            memcpy( p->pSibls, pData, (size_t)nBytes );
+        }
+        else if ( Tag == GIA_SNAP_REPRS && nBytes == (word)sizeof(Gia_Rpr_t) * nObjs )
+        {
+            p->pReprs = ABC_ALLOC( Gia_Rpr_t, nObjs );
+            memcpy( p->pReprs, pData, (size_t)nBytes );
+        }
+        else if ( Tag == GIA_SNAP_NEXTS && nBytes == (word)4 * nObjs )
+        {
+            p->pNexts = ABC_ALLOC( int, nObjs );
+            memcpy( p->pNexts, pData, (size_t)nBytes );
+        }
+        else if ( Tag == GIA_SNAP_FLOPCLASSES )
+            p->vFlopClasses = Vec_IntAllocArrayCopy( (int *)pData, (int)(nBytes / 4) );
+        else if ( Tag == GIA_SNAP_REGCLASSES )
+            p->vRegClasses = Vec_IntAllocArrayCopy( (int *)pData, (int)(nBytes / 4) );
+        else if ( Tag == GIA_SNAP_REGINITS )
+            p->vRegInits = Vec_IntAllocArrayCopy( (int *)pData, (int)(nBytes / 4) );
+        else if ( Tag == GIA_SNAP_NAMESIN )
+            p->vNamesIn = Gia_ManSnapReadNames( pData, nBytes );
+        else if ( Tag == GIA_SNAP_NAMESOUT )
+            p->vNamesOut = Gia_ManSnapReadNames( pData, nBytes );
+        else if ( Tag == GIA_SNAP_INARRS )
+            p->vInArrs = Vec_FltAllocArrayCopy( (float *)pData, (int)(nBytes / 4) );
+        else if ( Tag == GIA_SNAP_OUTREQS )
+            p->vOutReqs = Vec_FltAllocArrayCopy( (float *)pData, (int)(nBytes / 4) );
+        else if ( Tag == GIA_SNAP_TIMING )
+        {
+            vStr = Vec_StrAllocArrayCopy( pData, (int)nBytes );
+            p->pManTime = Tim_ManLoad( vStr, 1 );
+            Vec_StrFree( vStr );
+        }
+        else if ( Tag == GIA_SNAP_AIGEXTRA )
+            p->pAigExtra = Gia_AigerReadFromMemory( pData, (int)nBytes, 0, 0, 0 );
+    }
+    if ( Tag != GIA_SNAP_END || !fObjs || !Gia_ManSnapCheck(p, pHeader[7]) )
+    {
+        printf( "Gia_ManSnapRead(): The snapshot is truncated or corrupted.\n" );
+        Gia_ManStop( p );
+        return NULL;
+    }
+    Gia_ManSetRegNum( p, pHeader[7] );
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the snapshot of the manager.]
+
+  Description [The file is mapped into memory, if possible.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Gia_ManSnapRead( char * pFileName )
+{
+    Gia_Man_t * p;
+    FILE * pFile;
+    char * pContents;
+    size_t nFileSize = 0;
+    int RetValue;
+    if ( (pContents = Gia_FileMap( pFileName, &nFileSize )) )
+    {
+        p = Gia_ManSnapReadFromMemory( pContents, nFileSize );
+        Gia_FileUnmap( pContents, nFileSize );
+        return p;
+    }
+    pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+    {
+        printf( "Gia_ManSnapRead(): Cannot open input file \"%s\".\n", pFileName );
+        return NULL;
+    }
+    nFileSize = (size_t)Gia_FileSize( pFileName );
+    pContents = ABC_ALLOC( char, nFileSize + 1 );
+    RetValue = fread( pContents, 1, nFileSize, pFile );
+    fclose( pFile );
+    p = Gia_ManSnapReadFromMemory( pContents, nFileSize );
+    ABC_FREE( pContents );
+    return p;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
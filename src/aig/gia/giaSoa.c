@@ -0,0 +1,140 @@
+/**CFile****************************************************************
+
+  FileName    [giaSoa.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Structure-of-arrays view of the AIG objects.]
+
+  Author      [agent <agent@local>]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: giaSoa.c,v 1.00 2026/10/17 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The view keeps the fanin literals, the values and the marks of the objects
+// in separate dense arrays, so that a traversal touching only the fanins
+// (or only the values) reads 4 bytes per object instead of 12 bytes.
+// The view is a snapshot, which is not updated when the fanins are edited in
+// place, so it is created by the procedure using it and deleted before the
+// AIG is changed.  Currently, it is used by the multi-threaded simulation,
+// where several threads traverse the fanins of the same AIG.
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Creates the structure-of-arrays view.]
+
+  Description [Fanin literals are derived from the object array.
+  Values and marks are copied from the objects. The view is valid until
+  objects are added or the fanins are edited in place.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManSoaStart( Gia_Man_t * p )
+{
+    Gia_Obj_t * pObj; int i;
+    if ( p->pSoaFan0 )
+        Gia_ManSoaStop( p, 0 );
+    p->nSoaObjs   = Gia_ManObjNum(p);
+    p->pSoaFan0   = ABC_ALLOC( int, p->nSoaObjs );
+    p->pSoaFan1   = ABC_ALLOC( int, p->nSoaObjs );
+    p->pSoaValues = ABC_ALLOC( unsigned, p->nSoaObjs );
+    p->pSoaMarks  = ABC_CALLOC( unsigned char, p->nSoaObjs );
+    Gia_ManForEachObj( p, pObj, i )
+    {
+        p->pSoaFan0[i] = (Gia_ObjIsAnd(pObj) || Gia_ObjIsCo(pObj)) ? Gia_ObjFaninLit0(pObj, i) : -1;
+        p->pSoaFan1[i] = Gia_ObjIsAnd(pObj) ? Gia_ObjFaninLit1(pObj, i) : -1;
+        p->pSoaValues[i] = pObj->Value;
+        p->pSoaMarks[i] = (unsigned char)(pObj->fMark0 | (pObj->fMark1 << 1));
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Deletes the structure-of-arrays view.]
+
+  Description [If fUpdate is set, values and marks are written back
+  into the objects before the view is deleted.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManSoaStop( Gia_Man_t * p, int fUpdate )
+{
+    if ( p->pSoaFan0 == NULL )
+        return;
+    if ( fUpdate )
+    {
+        Gia_Obj_t * pObj; int i;
+        assert( p->nSoaObjs == Gia_ManObjNum(p) );
+        Gia_ManForEachObj( p, pObj, i )
+        {
+            pObj->Value  = p->pSoaValues[i];
+            pObj->fMark0 = p->pSoaMarks[i] & 1;
+            pObj->fMark1 = (p->pSoaMarks[i] >> 1) & 1;
+        }
+    }
+    ABC_FREE( p->pSoaFan0 );
+    ABC_FREE( p->pSoaFan1 );
+    ABC_FREE( p->pSoaValues );
+    ABC_FREE( p->pSoaMarks );
+    p->nSoaObjs = 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Transfers the values between the objects and the view.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManSoaLoadValues( Gia_Man_t * p )
+{
+    Gia_Obj_t * pObj; int i;
+    assert( Gia_ManHasSoa(p) );
+    Gia_ManForEachObj( p, pObj, i )
+        p->pSoaValues[i] = pObj->Value;
+}
+void Gia_ManSoaStoreValues( Gia_Man_t * p )
+{
+    Gia_Obj_t * pObj; int i;
+    assert( Gia_ManHasSoa(p) );
+    Gia_ManForEachObj( p, pObj, i )
+        pObj->Value = p->pSoaValues[i];
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -555,7 +555,7 @@ int Gia_ManSpeedupObj_rec( Gia_Man_t * p, Gia_Obj_t * pObj, Vec_Int_t * vNodes )
         return 0;
     if ( !Gia_ManSpeedupObj_rec( p, Gia_ObjFanin1(pObj), vNodes ) )
         return 0;
-    Vec_IntPush( vNodes, Gia_ObjId(p, pObj) );
+    Gia_ManArenaVecIntPush( p, vNodes, Gia_ObjId(p, pObj) );
     return 1;
 }
 
@@ -572,6 +572,7 @@ int Gia_ManSpeedupObj_rec( Gia_Man_t * p, Gia_Obj_t * pObj, Vec_Int_t * vNodes )
 ***********************************************************************/
 void Gia_ManSpeedupObj( Gia_Man_t * pNew, Gia_Man_t * p, Gia_Obj_t * pObj, Vec_Int_t * vLeaves, Vec_Int_t * vTimes )
 {
+    Gia_MmFlexMark_t Mark;
     Vec_Int_t * vNodes;
     Gia_Obj_t * pTemp = NULL;
     int pCofs[32], nCofs, nSkip, i, k, iResult, iObj;
@@ -580,12 +581,13 @@ void Gia_ManSpeedupObj( Gia_Man_t * pNew, Gia_Man_t * p, Gia_Obj_t * pObj, Vec_I
     Gia_ObjSetTravIdCurrent( p, Gia_ManConst0(p) );
     Gia_ManForEachObjVec( vLeaves, p, pTemp, i )
         Gia_ObjSetTravIdCurrent( p, pTemp );
-    // collect the AIG nodes
-    vNodes = Vec_IntAlloc( 100 );
+    // collect the AIG nodes (the array is scratch memory released below)
+    Gia_ManArenaMark( p, &Mark );
+    vNodes = Gia_ManArenaVecIntAlloc( p, 100 );
     if ( !Gia_ManSpeedupObj_rec( p, pObj, vNodes ) )
     {
         printf( "Bad node!!!\n" );
-        Vec_IntFree( vNodes );
+        Gia_ManArenaRelease( p, &Mark );
         return;
     }
     // derive cofactors
@@ -600,7 +602,7 @@ void Gia_ManSpeedupObj( Gia_Man_t * pNew, Gia_Man_t * p, Gia_Obj_t * pObj, Vec_I
             pTemp->Value = Gia_ManHashAnd( pNew, Gia_ObjFanin0Copy(pTemp), Gia_ObjFanin1Copy(pTemp) );
         pCofs[i] = pTemp->Value;
     }
-    Vec_IntFree( vNodes );
+    Gia_ManArenaRelease( p, &Mark );
     // collect the resulting tree
     Gia_ManForEachObjVec( vTimes, p, pTemp, k )
         for ( nSkip = (1<<k), i = 0; i < nCofs; i += 2*nSkip )
@@ -610,6 +610,8 @@ extern ABC_DLL void *             Abc_NodeGetCuts( void * p, Abc_Obj_t * pObj, i
 extern ABC_DLL void               Abc_NodeGetCutsSeq( void * p, Abc_Obj_t * pObj, int fFirst );
 extern ABC_DLL void *             Abc_NodeReadCuts( void * p, Abc_Obj_t * pObj );
 extern ABC_DLL void               Abc_NodeFreeCuts( void * p, Abc_Obj_t * pObj );
+/*=== abcCutBench.c =======================================================*/
+extern ABC_DLL int                Abc_GiaCutBench( Gia_Man_t * pGia, char * pName, char * pEngines, int nLutSize, int nCutNum, FILE * pFile, int fHeader, int fVerbose );
 /*=== abcDar.c ============================================================*/
 extern ABC_DLL int                Abc_NtkPhaseFrameNum( Abc_Ntk_t * pNtk );
 extern ABC_DLL int                Abc_NtkDarPrintCone( Abc_Ntk_t * pNtk );
@@ -0,0 +1,342 @@
+/**CFile****************************************************************
+
+  FileName    [abcCutBench.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Network and node package.]
+
+  Synopsis    [Benchmarking cut enumeration of the mappers.]
+
+  Author      [agent <agent@local>]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: abcCutBench.c,v 1.00 2026/10/17 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "base/abc/abc.h"
+#include "base/main/main.h"
+#include "aig/gia/gia.h"
+#include "aig/gia/giaAig.h"
+#include "map/if/if.h"
+#include "opt/cut/cut.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the cut enumerators that can be benchmarked
+typedef enum {
+    ABC_CB_MF = 0,          // &mf
+    ABC_CB_NF,              // &nf (needs a genlib library)
+    ABC_CB_LF,              // &lf
+    ABC_CB_JF,              // &jf
+    ABC_CB_KF,              // &kf (needs pthreads)
+    ABC_CB_IF,              // &if
+    ABC_CB_CUT,             // cut
+    ABC_CB_NUM
+} Abc_CutBenchEngine_t;
+
+static char * s_CutBenchNames[ABC_CB_NUM] = { "mf", "nf", "lf", "jf", "kf", "if", "cut" };
+
+extern void                Nf_ManSetDefaultPars( Jf_Par_t * pPars );
+extern Gia_Man_t *         Nf_ManPerformMapping( Gia_Man_t * pGia, Jf_Par_t * pPars );
+extern void                Kf_ManSetDefaultPars( Jf_Par_t * pPars );
+extern Gia_Man_t *         Kf_ManPerformMapping( Gia_Man_t * pGia, Jf_Par_t * pPars );
+extern If_Man_t *          Gia_ManToIf( Gia_Man_t * p, If_Par_t * pPars );
+extern Abc_Ntk_t *         Abc_NtkFromAigPhase( Aig_Man_t * pMan );
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Runs cut enumeration of one of the GIA-based mappers.]
+
+  Description [Returns 1 on success, 0 if the engine is not available
+  for these parameters, and -1 if the engine failed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_CutBenchGia( Gia_Man_t * p, int Engine, int nLutSize, int nCutNum, int fTruth, word * pnCuts, word * pnMem, abctime * pTime )
+{
+    Jf_Par_t Pars, * pPars = &Pars;
+    Gia_Man_t * pCopy, * pNew = NULL;
+    memset( pPars, 0, sizeof(Jf_Par_t) );
+    if ( Engine == ABC_CB_MF )
+        Mf_ManSetDefaultPars( pPars );
+    else if ( Engine == ABC_CB_NF )
+        Nf_ManSetDefaultPars( pPars );
+    else if ( Engine == ABC_CB_LF )
+        Lf_ManSetDefaultPars( pPars );
+    else if ( Engine == ABC_CB_JF )
+        Jf_ManSetDefaultPars( pPars );
+    else if ( Engine == ABC_CB_KF )
+        Kf_ManSetDefaultPars( pPars );
+    else assert( 0 );
+    // the engine is compiled out or cannot handle these parameters
+    if ( nLutSize > pPars->nLutSizeMax || nCutNum < 2 || nCutNum > pPars->nCutNumMax )
+        return 0;
+    if ( Engine == ABC_CB_NF && Abc_FrameReadLibGen() == NULL )
+        return 0;
+    // perform only one round of cut enumeration followed by the mapping
+    // (&nf cannot derive the mapping without an exact area round)
+    pPars->nLutSize   = nLutSize;
+    pPars->nCutNum    = nCutNum;
+    pPars->nRounds    = Engine == ABC_CB_JF ? 0 : 1;
+    pPars->nRoundsEla = Engine == ABC_CB_NF ? 1 : 0;
+    pPars->fCoarsen   = 0;
+    pPars->fCutMin    = Engine == ABC_CB_NF ? 1 : fTruth;
+    pCopy = Gia_ManDup( p );
+    if ( Engine == ABC_CB_MF )
+        pNew = Mf_ManPerformMapping( pCopy, pPars );
+    else if ( Engine == ABC_CB_NF )
+        pNew = Nf_ManPerformMapping( pCopy, pPars );
+    else if ( Engine == ABC_CB_LF )
+        pNew = Lf_ManPerformMapping( pCopy, pPars );
+    else if ( Engine == ABC_CB_JF )
+        pNew = Jf_ManPerformMapping( pCopy, pPars );
+    else if ( Engine == ABC_CB_KF )
+        pNew = Kf_ManPerformMapping( pCopy, pPars );
+    if ( pNew && pNew != pCopy )
+        Gia_ManStop( pNew );
+    Gia_ManStop( pCopy );
+    if ( pNew == NULL )
+        return -1;
+    *pnCuts = pPars->Cuts;
+    *pnMem  = pPars->CutMem;
+    *pTime  = pPars->CutTime;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs cut enumeration of the If mapper.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_CutBenchIf( Gia_Man_t * p, int nLutSize, int nCutNum, int fTruth, word * pnCuts, word * pnMem, abctime * pTime )
+{
+    If_Par_t Pars, * pPars = &Pars;
+    If_Man_t * pIfMan;
+    int nCrossCut, nSetsMore;
+    abctime clk;
+    if ( nLutSize < 2 || nLutSize > IF_MAX_LUTSIZE || nCutNum < 1 || nCutNum >= (1<<12) )
+        return 0;
+    // perform only the delay-oriented round
+    Gia_ManSetIfParsDefault( pPars );
+    pPars->nLutSize    = nLutSize;
+    pPars->nCutsMax    = nCutNum;
+    pPars->fPreprocess = 0;
+    pPars->fExpRed     = 0;
+    pPars->nFlowIters  = 0;
+    pPars->nAreaIters  = 0;
+    pPars->fTruth      = fTruth;
+    pIfMan = Gia_ManToIf( p, pPars );
+    if ( pIfMan == NULL )
+        return -1;
+    // prepare the cutsets as If_ManPerformMapping() does
+    pIfMan->pPars->fAreaOnly = pIfMan->pPars->fArea;
+    If_ManSetupCiCutSets( pIfMan );
+    nCrossCut = If_ManCrossCut( pIfMan );
+    If_ManSetupSetAll( pIfMan, nCrossCut );
+    pIfMan->vObjsRev = If_ManReverseOrder( pIfMan );
+    clk = Abc_Clock();
+    If_ManPerformMappingComb( pIfMan );
+    *pTime  = Abc_Clock() - clk;
+    *pnCuts = (word)pIfMan->nCutsSaved;
+    nSetsMore = pIfMan->vMemSets ? 1024 * Vec_PtrSize(pIfMan->vMemSets) : 0;
+    *pnMem  = (word)pIfMan->nSetBytes * (128 + nCrossCut + nSetsMore) +
+              (word)If_ManCiNum(pIfMan) * (sizeof(If_Set_t) + sizeof(void *));
+    If_ManStop( pIfMan );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs cut enumeration of the stand-alone cut manager.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_CutBenchCut( Gia_Man_t * p, int nLutSize, int nCutNum, int fTruth, word * pnCuts, word * pnMem, abctime * pTime )
+{
+    Cut_Params_t Params, * pParams = &Params;
+    Cut_Man_t * pCutMan;
+    Aig_Man_t * pAig;
+    Abc_Ntk_t * pNtk;
+    Abc_Obj_t * pObj;
+    Vec_Ptr_t * vNodes;
+    abctime clk;
+    int i;
+    if ( nLutSize < CUT_SIZE_MIN || nLutSize > CUT_SIZE_MAX || nCutNum < 1 )
+        return 0;
+    pAig = Gia_ManToAig( p, 0 );
+    pNtk = Abc_NtkFromAigPhase( pAig );
+    Aig_ManStop( pAig );
+    if ( pNtk == NULL )
+        return -1;
+    memset( pParams, 0, sizeof(Cut_Params_t) );
+    pParams->nVarsMax = nLutSize;
+    pParams->nKeepMax = nCutNum;
+    pParams->fTruth   = fTruth;
+    pParams->fFilter  = 1;
+    pParams->fDag     = 1;
+    pParams->nIdsMax  = Abc_NtkObjNumMax( pNtk );
+    // same as Abc_NtkCuts() without the statistics printout
+    vNodes = Abc_AigDfs( pNtk, 0, 0 );
+    clk = Abc_Clock();
+    pCutMan = Cut_ManStart( pParams );
+    Abc_NtkForEachCi( pNtk, pObj, i )
+        if ( Abc_ObjFanoutNum(pObj) > 0 )
+            Cut_NodeSetTriv( pCutMan, pObj->Id );
+    Vec_PtrForEachEntry( Abc_Obj_t *, vNodes, pObj, i )
+        Abc_NodeGetCuts( pCutMan, pObj, pParams->fDag, pParams->fTree );
+    *pTime  = Abc_Clock() - clk;
+    Vec_PtrFree( vNodes );
+    *pnCuts = (word)Cut_ManReadCutsNum( pCutMan );
+    *pnMem  = (word)Cut_ManReadMemPeak( pCutMan );
+    Cut_ManStop( pCutMan );
+    Abc_NtkDelete( pNtk );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs cut enumeration of one engine.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_CutBenchEngine( Gia_Man_t * p, int Engine, int nLutSize, int nCutNum, int fTruth, word * pnCuts, word * pnMem, abctime * pTime )
+{
+    if ( Engine == ABC_CB_IF )
+        return Abc_CutBenchIf( p, nLutSize, nCutNum, fTruth, pnCuts, pnMem, pTime );
+    if ( Engine == ABC_CB_CUT )
+        return Abc_CutBenchCut( p, nLutSize, nCutNum, fTruth, pnCuts, pnMem, pTime );
+    return Abc_CutBenchGia( p, Engine, nLutSize, nCutNum, fTruth, pnCuts, pnMem, pTime );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Benchmarks cut enumeration of the mappers.]
+
+  Description [Runs each engine in the comma-separated list pEngines
+  (all engines if NULL) on the AIG with the given cut size and cut limit
+  and writes one CSV line per engine into pFile. Cut time is the time
+  of cut enumeration without truth tables. Truth-table time is the
+  difference to the run that also computes the truth tables, and is
+  "NA" for the engines that cannot switch them off. Memory is the cut
+  storage of the engine. Returns 0 if an engine is unknown or failed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_GiaCutBench( Gia_Man_t * pGia, char * pName, char * pEngines, int nLutSize, int nCutNum, FILE * pFile, int fHeader, int fVerbose )
+{
+    char * pList, * pToken;
+    int pEngineList[ABC_CB_NUM], nEngines = 0;
+    int i, k, Status, RetValue = 1;
+    Gia_Man_t * p;
+    // parse the list of engines
+    if ( pEngines == NULL )
+        for ( i = 0; i < ABC_CB_NUM; i++ )
+            pEngineList[nEngines++] = i;
+    else
+    {
+        pList = Abc_UtilStrsav( pEngines );
+        for ( pToken = strtok(pList, ","); pToken; pToken = strtok(NULL, ",") )
+        {
+            for ( k = 0; k < ABC_CB_NUM; k++ )
+                if ( !strcmp(pToken, s_CutBenchNames[k]) )
+                    break;
+            if ( k == ABC_CB_NUM )
+            {
+                Abc_Print( -1, "Abc_GiaCutBench(): Unknown engine \"%s\".\n", pToken );
+                ABC_FREE( pList );
+                return 0;
+            }
+            for ( i = 0; i < nEngines; i++ )
+                if ( pEngineList[i] == k )
+                    break;
+            if ( i == nEngines )
+                pEngineList[nEngines++] = k;
+        }
+        ABC_FREE( pList );
+    }
+    if ( pName == NULL )
+        pName = Gia_ManName(pGia) ? Gia_ManName(pGia) : (char *)"design";
+    // the mappers expect an AIG without dangling nodes
+    p = Gia_ManCleanup( pGia );
+    if ( fHeader )
+        fprintf( pFile, "design,engine,lut_size,cut_limit,nodes,cuts,cuts_per_node,cut_time,cuts_per_sec,tt_time,mem_mb,status\n" );
+    for ( i = 0; i < nEngines; i++ )
+    {
+        word nCuts = 0, nMem = 0, nCutsTt = 0, nMemTt = 0;
+        abctime Time = 0, TimeTt = 0;
+        int Engine = pEngineList[i], fTtAvail = (Engine != ABC_CB_NF && Engine != ABC_CB_KF);
+        double CutTime, CutsPerSec;
+        if ( fVerbose )
+            printf( "Running %s with K = %d and C = %d...\n", s_CutBenchNames[Engine], nLutSize, nCutNum );
+        Status = Abc_CutBenchEngine( p, Engine, nLutSize, nCutNum, 0, &nCuts, &nMem, &Time );
+        if ( Status == 1 && fTtAvail )
+            Status = Abc_CutBenchEngine( p, Engine, nLutSize, nCutNum, 1, &nCutsTt, &nMemTt, &TimeTt );
+        fprintf( pFile, "%s,%s,%d,%d,%d,", pName, s_CutBenchNames[Engine], nLutSize, nCutNum, Gia_ManAndNum(p) );
+        if ( Status != 1 )
+        {
+            fprintf( pFile, "NA,NA,NA,NA,NA,NA,%s\n", Status == 0 ? "skipped" : "failed" );
+            if ( Status == -1 )
+                RetValue = 0;
+            continue;
+        }
+        CutTime = 1.0 * Time / CLOCKS_PER_SEC;
+        CutsPerSec = CutTime > 0 ? (double)nCuts / CutTime : 0;
+        fprintf( pFile, "%.0f,%.2f,%.6f,", (double)nCuts, (double)nCuts / Abc_MaxInt(Gia_ManAndNum(p), 1), CutTime );
+        if ( CutTime > 0 )
+            fprintf( pFile, "%.0f,", CutsPerSec );
+        else
+            fprintf( pFile, "NA," );
+        if ( fTtAvail )
+            fprintf( pFile, "%.6f,", 1.0 * (TimeTt > Time ? TimeTt - Time : 0) / CLOCKS_PER_SEC );
+        else
+            fprintf( pFile, "NA," );
+        fprintf( pFile, "%.3f,ok\n", 1.0 * nMem / (1<<20) );
+    }
+    fflush( pFile );
+    Gia_ManStop( p );
+    return RetValue;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
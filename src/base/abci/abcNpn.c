@@ -182,6 +182,8 @@ void Abc_TruthNpnPerform( Abc_TtStore_t * p, int NpnType, int fVerbose )
     unsigned uCanonPhase=0;
     abctime clk = Abc_Clock();
     int i;
+    extern void * Abc_FrameReadNpnCache();
+    Dau_NpnCache_t * pCache = (Dau_NpnCache_t *)Abc_FrameReadNpnCache();
 
     char * pAlgoName = NULL;
     if ( NpnType == 0 )
@@ -262,7 +264,10 @@ void Abc_TruthNpnPerform( Abc_TtStore_t * p, int NpnType, int fVerbose )
             if ( fVerbose )
                 printf( "%7d : ", i );
             resetPCanonPermArray(pCanonPerm, p->nVars);
-            uCanonPhase = luckyCanonicizer_final_fast( p->pFuncs[i], p->nVars, pCanonPerm );
+            if ( pCache )
+                uCanonPhase = Dau_NpnCacheCanonicize( pCache, DAU_NPN_LUCKY, p->pFuncs[i], p->nVars, pCanonPerm );
+            else
+                uCanonPhase = luckyCanonicizer_final_fast( p->pFuncs[i], p->nVars, pCanonPerm );
             if ( fVerbose )
                 Extra_PrintHex( stdout, (unsigned *)p->pFuncs[i], p->nVars ), Abc_TruthNpnPrint(pCanonPerm, uCanonPhase, p->nVars), printf( "\n" );
         }
@@ -274,7 +279,10 @@ void Abc_TruthNpnPerform( Abc_TtStore_t * p, int NpnType, int fVerbose )
             if ( fVerbose )
                 printf( "%7d : ", i );
             resetPCanonPermArray(pCanonPerm, p->nVars);
-            uCanonPhase = luckyCanonicizer_final_fast1( p->pFuncs[i], p->nVars, pCanonPerm );
+            if ( pCache )
+                uCanonPhase = Dau_NpnCacheCanonicize( pCache, DAU_NPN_LUCKY1, p->pFuncs[i], p->nVars, pCanonPerm );
+            else
+                uCanonPhase = luckyCanonicizer_final_fast1( p->pFuncs[i], p->nVars, pCanonPerm );
             if ( fVerbose )
                 Extra_PrintHex( stdout, (unsigned *)p->pFuncs[i], p->nVars ), Abc_TruthNpnPrint(pCanonPerm, uCanonPhase, p->nVars), printf( "\n" );
         }
@@ -285,7 +293,10 @@ void Abc_TruthNpnPerform( Abc_TtStore_t * p, int NpnType, int fVerbose )
         {
             if ( fVerbose )
                 printf( "%7d : ", i );
-            uCanonPhase = Abc_TtCanonicize( p->pFuncs[i], p->nVars, pCanonPerm );
+            if ( pCache )
+                uCanonPhase = Dau_NpnCacheCanonicize( pCache, DAU_NPN_ABC, p->pFuncs[i], p->nVars, pCanonPerm );
+            else
+                uCanonPhase = Abc_TtCanonicize( p->pFuncs[i], p->nVars, pCanonPerm );
             if ( fVerbose )
                 Extra_PrintHex( stdout, (unsigned *)p->pFuncs[i], p->nVars ), Abc_TruthNpnPrint(pCanonPerm, uCanonPhase, p->nVars), printf( "\n" );
         }
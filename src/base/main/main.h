@@ -107,6 +107,11 @@ extern ABC_DLL void *          Abc_FrameReadManDsd();
 extern ABC_DLL void *          Abc_FrameReadManDsd2();           
 extern ABC_DLL Vec_Ptr_t *     Abc_FrameReadSignalNames();
 extern ABC_DLL char *          Abc_FrameReadSpecName();
+extern ABC_DLL void *          Abc_FrameReadPool();
+extern ABC_DLL void *          Abc_FrameReadTtStore();
+extern ABC_DLL void            Abc_FrameClearTtStore();
+extern ABC_DLL void *          Abc_FrameReadNpnCache();
+extern ABC_DLL void            Abc_FrameClearNpnCache();
          
 extern ABC_DLL char *          Abc_FrameReadFlag( char * pFlag ); 
 extern ABC_DLL int             Abc_FrameIsFlagEnabled( char * pFlag );
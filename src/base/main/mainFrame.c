@@ -23,11 +23,23 @@
 #include "bool/dec/dec.h"
 #include "map/if/if.h"
 #include "aig/miniaig/ndr.h"
+#include "misc/util/utilPool.h"
+#include "opt/dau/dau.h"
 
 #ifdef ABC_USE_CUDD
 #include "bdd/extrab/extraBdd.h"
 #endif
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -36,6 +48,9 @@ ABC_NAMESPACE_IMPL_START
 ////////////////////////////////////////////////////////////////////////
 
 static Abc_Frame_t * s_GlobalFrame = NULL;
+#ifdef ABC_USE_PTHREADS
+static pthread_mutex_t s_PoolMutex = PTHREAD_MUTEX_INITIALIZER;
+#endif
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -124,6 +139,121 @@ void        Abc_FrameSetArrayMapping( int * p )              { ABC_FREE( s_Globa
 int *       Abc_FrameReadBoxes( Abc_Frame_t * pAbc )         { return pAbc->pBoxes;                                            }
 void        Abc_FrameSetBoxes( int * p )                     { ABC_FREE( s_GlobalFrame->pBoxes ); s_GlobalFrame->pBoxes = p;   }      
 
+/**Function*************************************************************
+
+  Synopsis    [Returns the shared pool of worker threads.]
+
+  Description [The pool is started on the first call. The number of
+  threads is taken from the flag "threads" (set threads <num>), which
+  includes the calling thread, or else from the number of processors.
+  When the flag changes, the pool is restarted on the next call, but only
+  if none of its task groups is live; otherwise the old pool is returned.
+  Can be called from several threads. Returns NULL if there is no frame.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Abc_FrameReadPool()
+{
+    Util_Pool_t * pPool;
+    char * pFlag;
+    int nThreads;
+    if ( s_GlobalFrame == NULL )
+        return NULL;
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock( &s_PoolMutex );
+#endif
+    pFlag = Abc_FrameReadFlag( "threads" );
+    nThreads = pFlag ? atoi(pFlag) : Util_PoolCpuNum();
+    nThreads = Abc_MinInt( Abc_MaxInt(nThreads - 1, 1), UTIL_POOL_THR_MAX );
+    pPool = (Util_Pool_t *)s_GlobalFrame->pPool;
+    if ( pPool && Util_PoolThreadNum(pPool) != nThreads && Util_PoolGroupNum(pPool) == 0 )
+    {
+        Util_PoolStop( pPool );
+        pPool = NULL;
+    }
+    if ( pPool == NULL )
+        pPool = Util_PoolStart( nThreads );
+    s_GlobalFrame->pPool = pPool;
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_unlock( &s_PoolMutex );
+#endif
+    return pPool;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the shared store of truth tables.]
+
+  Description [The store is used by the mappers when the flag "ttstore"
+  is enabled (set ttstore), so that the truth tables and their NPN classes
+  computed by one command are reused by the following ones. Returns NULL
+  if the flag is not enabled or if there is no frame.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Abc_FrameReadTtStore()
+{
+    if ( s_GlobalFrame == NULL || !Abc_FrameIsFlagEnabled("ttstore") )
+        return NULL;
+    if ( s_GlobalFrame->pTtStore == NULL )
+        s_GlobalFrame->pTtStore = Dau_TtStoreStart();
+    Dau_TtStoreSetCache( (Dau_TtStore_t *)s_GlobalFrame->pTtStore, (Dau_NpnCache_t *)Abc_FrameReadNpnCache() );
+    return s_GlobalFrame->pTtStore;
+}
+void Abc_FrameClearTtStore()
+{
+    if ( s_GlobalFrame == NULL || s_GlobalFrame->pTtStore == NULL )
+        return;
+    Dau_TtStoreStop( (Dau_TtStore_t *)s_GlobalFrame->pTtStore );
+    s_GlobalFrame->pTtStore = NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the persistent cache of NPN canonical forms.]
+
+  Description [The cache is used when the flag "npncache" is set to the
+  name of the cache file (set npncache <file>). The file is loaded when
+  the cache is started; the canonical forms computed afterwards are added
+  to the file when the cache is cleared, when the flag changes, and when
+  the frame is deallocated. Returns NULL if the flag is not set.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Abc_FrameReadNpnCache()
+{
+    char * pFileName;
+    if ( s_GlobalFrame == NULL )
+        return NULL;
+    pFileName = Abc_FrameReadFlag( "npncache" );
+    if ( pFileName && pFileName[0] == 0 )
+        pFileName = NULL;
+    if ( s_GlobalFrame->pNpnCache && (pFileName == NULL || strcmp(pFileName, Dau_NpnCacheFileName((Dau_NpnCache_t *)s_GlobalFrame->pNpnCache))) )
+        Abc_FrameClearNpnCache();
+    if ( s_GlobalFrame->pNpnCache == NULL && pFileName )
+        s_GlobalFrame->pNpnCache = Dau_NpnCacheStart( pFileName );
+    return s_GlobalFrame->pNpnCache;
+}
+void Abc_FrameClearNpnCache()
+{
+    if ( s_GlobalFrame == NULL || s_GlobalFrame->pNpnCache == NULL )
+        return;
+    if ( s_GlobalFrame->pTtStore )
+        Dau_TtStoreSetCache( (Dau_TtStore_t *)s_GlobalFrame->pTtStore, NULL );
+    Dau_NpnCacheWrite( (Dau_NpnCache_t *)s_GlobalFrame->pNpnCache );
+    Dau_NpnCacheStop( (Dau_NpnCache_t *)s_GlobalFrame->pNpnCache );
+    s_GlobalFrame->pNpnCache = NULL;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Returns 1 if the flag is enabled without value or with value 1.]
@@ -210,6 +340,9 @@ void Abc_FrameDeallocate( Abc_Frame_t * p )
 //    undefine_cube_size();
     Rwt_ManGlobalStop();
 //    Ivy_TruthManStop();
+    if ( p->pPool     )  Util_PoolStop( (Util_Pool_t *)p->pPool );
+    if ( p->pTtStore  )  Dau_TtStoreStop( (Dau_TtStore_t *)p->pTtStore );
+    if ( p->pNpnCache )  Dau_NpnCacheWrite( (Dau_NpnCache_t *)p->pNpnCache ), Dau_NpnCacheStop( (Dau_NpnCache_t *)p->pNpnCache );
     if ( p->vAbcObjIds)  Vec_IntFree( p->vAbcObjIds );
     if ( p->vCexVec   )  Vec_PtrFreeFree( p->vCexVec );
     if ( p->vPoEquivs )  Vec_VecFree( (Vec_Vec_t *)p->vPoEquivs );
@@ -104,6 +104,9 @@ struct Abc_Frame_t_
     void *          pLibSuper;     // the current supergate library
     void *          pLibScl;       // the current Liberty library
     void *          pAbcCon;       // constraint manager
+    void *          pPool;         // the shared pool of worker threads
+    void *          pTtStore;      // the shared store of truth tables
+    void *          pNpnCache;     // the persistent cache of NPN canonical forms
     // timing constraints
     char *          pDrivingCell;  // name of the driving cell
     float           MaxLoad;       // maximum output load
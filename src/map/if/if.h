@@ -114,6 +114,7 @@ struct If_Par_t_
     int                nAndDelay;     // delay of AND-gate in LUT library units
     int                nAndArea;      // area of AND-gate in LUT library units
     int                nLutDecSize;   // the LUT size for decomposition
+    int                nProcs;        // the number of threads for cut computation
     int                fPreprocess;   // preprossing
     int                fArea;         // area-oriented mapping
     int                fFancy;        // a fancy feature
@@ -217,8 +218,11 @@ struct If_Man_t_
     float              dPower;        // the sum total of switching activities of all LUTs in the mapping
     int                nCutsUsed;     // the number of cuts currently used
     int                nCutsMerged;   // the total number of cuts merged
+    int                nCutsSaved;    // the total number of cuts stored at the nodes
     unsigned *         puTemp[4];     // used for the truth table computation
     word *             puTempW;       // used for the truth table computation
+    word *             puTempPend;    // the truth tables of the new cuts of the node (one per cut of the set)
+    int *              pTempPendC;    // the complemented attributes of these truth tables
     int                SortMode;      // one of the three sorting modes
     int                fNextRound;    // set to 1 after the first round
     int                nChoices;      // the number of choice nodes
@@ -250,6 +254,7 @@ struct If_Man_t_
     If_Set_t *         pMemCi;        // memory for CI cutsets
     If_Set_t *         pMemAnd;       // memory for AND cutsets
     If_Set_t *         pFreeList;     // the list of free cutsets
+    Vec_Ptr_t *        vMemSets;      // additional memory for AND cutsets
     int                nSmallSupp;    // the small support
     int                nCutsTotal;
     int                nCutsUseless[32];
@@ -259,6 +264,10 @@ struct If_Man_t_
     int                nCuts5, nCuts5a;
     If_DsdMan_t *      pIfDsdMan;     // DSD manager
     Vec_Mem_t *        vTtMem[IF_MAX_FUNC_LUTSIZE+1];   // truth table memory and hash table
+    Dau_TtStore_t *    pTtStore;      // shared truth tables (or NULL)
+    int                fTtStoreMem;   // the truth table memory belongs to the store
+    int                nTtStart[IF_MAX_FUNC_LUTSIZE+1]; // shared truth tables added before this manager
+    Dau_NpnCache_t *   pNpnCache;     // persistent cache of canonical forms (or NULL)
     Vec_Wec_t *        vTtIsops[IF_MAX_FUNC_LUTSIZE+1]; // mapping of truth table into DSD
     Vec_Int_t *        vTtDsds[IF_MAX_FUNC_LUTSIZE+1];  // mapping of truth table into DSD
     Vec_Str_t *        vTtPerms[IF_MAX_FUNC_LUTSIZE+1]; // mapping of truth table into permutations
@@ -284,6 +293,9 @@ struct If_Man_t_
     int                pDumpIns[16];
     Vec_Str_t *        vMarks;
     Vec_Int_t *        vVisited2;
+    // parallel mapping
+    int                fParallel;     // the manager is a thread-local copy
+    void *             pFuncLock;     // the locks protecting the shared function data
 
     // timing manager
     Tim_Man_t *        pManTim;
@@ -651,6 +663,8 @@ extern void            If_ManDerefNodeCutSet( If_Man_t * p, If_Obj_t * pObj );
 extern void            If_ManDerefChoiceCutSet( If_Man_t * p, If_Obj_t * pObj );
 extern void            If_ManSetupSetAll( If_Man_t * p, int nCrossCut );
 /*=== ifMap.c =============================================================*/
+extern void            If_ManLockTt( If_Man_t * p, int nVars );
+extern void            If_ManUnlockTt( If_Man_t * p, int nVars );
 extern int *           If_CutArrTimeProfile( If_Man_t * p, If_Cut_t * pCut );
 extern void            If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess, int fFirst );
 extern void            If_ObjPerformMappingChoice( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess );
@@ -672,7 +686,10 @@ extern float           If_ManDelayMax( If_Man_t * p, int fSeq );
 extern void            If_ManComputeRequired( If_Man_t * p );
 /*=== ifTruth.c ===========================================================*/
 extern void            If_CutRotatePins( If_Man_t * p, If_Cut_t * pCut );
+extern int             If_ManTruthBatchCheck( If_Par_t * pPars );
+extern int             If_CutComputeTruthLocal( If_Man_t * p, If_Cut_t * pCut, If_Cut_t * pCut0, If_Cut_t * pCut1, int fCompl0, int fCompl1, word * pTruth, int * pfCompl );
 extern int             If_CutComputeTruth( If_Man_t * p, If_Cut_t * pCut, If_Cut_t * pCut0, If_Cut_t * pCut1, int fCompl0, int fCompl1 );
+extern void            If_CutInsertTruthBatch( If_Man_t * p, If_Cut_t ** ppCuts, word ** ppTruths, int * pCompls, int nCuts );
 extern int             If_CutComputeTruthPerm( If_Man_t * p, If_Cut_t * pCut, If_Cut_t * pCut0, If_Cut_t * pCut1, int fCompl0, int fCompl1 );
 extern Vec_Mem_t *     If_DeriveHashTable6( int nVars, word Truth );
 extern int             If_CutCheckTruth6( If_Man_t * p, If_Cut_t * pCut );
@@ -28,9 +28,10 @@ ABC_NAMESPACE_IMPL_START
 ////////////////////////////////////////////////////////////////////////
 
 static If_Obj_t * If_ManSetupObj( If_Man_t * p );
+static void       If_ManSetupSetMore( If_Man_t * p, int nCutSets );
 
 static void       If_ManCutSetRecycle( If_Man_t * p, If_Set_t * pSet ) { pSet->pNext = p->pFreeList; p->pFreeList = pSet;                            }
-static If_Set_t * If_ManCutSetFetch( If_Man_t * p )                    { If_Set_t * pTemp = p->pFreeList; p->pFreeList = p->pFreeList->pNext; return pTemp; }
+static If_Set_t * If_ManCutSetFetch( If_Man_t * p )                    { If_Set_t * pTemp; if ( p->pFreeList == NULL ) If_ManSetupSetMore( p, 1024 ); pTemp = p->pFreeList; p->pFreeList = p->pFreeList->pNext; return pTemp; }
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -50,6 +51,8 @@ static If_Set_t * If_ManCutSetFetch( If_Man_t * p )                    { If_Set_
 If_Man_t * If_ManStart( If_Par_t * pPars )
 {
     If_Man_t * p; int v;
+    extern void * Abc_FrameReadTtStore();
+    extern void * Abc_FrameReadNpnCache();
     assert( !pPars->fUseDsd || !pPars->fUseTtPerm );
     // start the manager
     p = ABC_ALLOC( If_Man_t, 1 );
@@ -67,8 +70,14 @@ If_Man_t * If_ManStart( If_Par_t * pPars )
     {
         for ( v = 0; v <= p->pPars->nLutSize; v++ )
             p->nTruth6Words[v] = Abc_Truth6WordNum( v );
+        // the truth tables are shared with other mappers unless data is attached to them
+        p->pTtStore    = (Dau_TtStore_t *)Abc_FrameReadTtStore();
+        p->fTtStoreMem = p->pTtStore && pPars->nProcs <= 1 && !pPars->fUseTtPerm && !pPars->fUseDsd && !pPars->fUseCofVars && 
+            !pPars->fUseAndVars && !pPars->fDelayOpt && pPars->nGateSize == 0 && p->pPars->nLutSize <= DAU_STORE_VAR_MAX;
         for ( v = 6; v <= Abc_MaxInt(6,p->pPars->nLutSize); v++ )
-            p->vTtMem[v] = Vec_MemAllocForTT( v, pPars->fUseTtPerm );
+            p->vTtMem[v] = p->fTtStoreMem ? Dau_TtStoreMem( p->pTtStore, v ) : Vec_MemAllocForTT( v, pPars->fUseTtPerm );
+        for ( v = 6; v <= Abc_MaxInt(6,p->pPars->nLutSize); v++ )
+            p->nTtStart[v] = p->fTtStoreMem ? Vec_MemEntryNum( p->vTtMem[v] ) : 0;
         for ( v = 0; v < 6; v++ )
             p->vTtMem[v] = p->vTtMem[6];
         if ( p->pPars->fDelayOpt || pPars->nGateSize > 0 )
@@ -101,6 +110,11 @@ If_Man_t * If_ManStart( If_Par_t * pPars )
     p->puTemp[2] = p->pPars->fTruth? p->puTemp[1] + p->nTruth6Words[p->pPars->nLutSize]*2 : NULL;
     p->puTemp[3] = p->pPars->fTruth? p->puTemp[2] + p->nTruth6Words[p->pPars->nLutSize]*2 : NULL;
     p->puTempW   = p->pPars->fTruth? ABC_ALLOC( word, p->nTruth6Words[p->pPars->nLutSize] ) : NULL;
+    if ( If_ManTruthBatchCheck(p->pPars) )
+    {
+        p->puTempPend = ABC_ALLOC( word, p->nTruth6Words[p->pPars->nLutSize] * (p->pPars->nCutsMax + 1) );
+        p->pTempPendC = ABC_ALLOC( int, p->pPars->nCutsMax + 1 );
+    }
     if ( pPars->fUseDsd )
     {
         for ( v = 6; v <= Abc_MaxInt(6,p->pPars->nLutSize); v++ )
@@ -120,6 +134,7 @@ If_Man_t * If_ManStart( If_Par_t * pPars )
     }
     if ( pPars->fUseTtPerm )
     {
+        p->pNpnCache = (Dau_NpnCache_t *)Abc_FrameReadNpnCache();
         p->vPairHash = Hash_IntManStart( 10000 );
         p->vPairPerms = Vec_StrAlloc( 10000 );
         Vec_StrFill( p->vPairPerms, p->pPars->nLutSize, 0 );
@@ -217,12 +232,17 @@ void If_ManStop( If_Man_t * p )
         If_ManCacheAnalize( p );
     if ( p->pPars->fVerbose && p->pPars->fTruth )
     {
-        int nUnique = 0, nMemTotal = 0;
+        int nUnique = 0, nShared = 0, nMemTotal = 0;
+        for ( i = 6; i <= Abc_MaxInt(6,p->pPars->nLutSize); i++ )
+            nUnique += Vec_MemEntryNum(p->vTtMem[i]) - p->nTtStart[i];
         for ( i = 6; i <= Abc_MaxInt(6,p->pPars->nLutSize); i++ )
-            nUnique += Vec_MemEntryNum(p->vTtMem[i]);
+            nShared += p->fTtStoreMem ? Vec_MemEntryNum(p->vTtMem[i]) : 0;
         for ( i = 6; i <= Abc_MaxInt(6,p->pPars->nLutSize); i++ )
-            nMemTotal += (int)Vec_MemMemory(p->vTtMem[i]);
-        printf( "Unique truth tables = %d   Memory = %.2f MB   ", nUnique, 1.0 * nMemTotal / (1<<20) ); 
+            nMemTotal += (int)(p->fTtStoreMem ? Vec_MemMemoryFrom(p->vTtMem[i], p->nTtStart[i]) : Vec_MemMemory(p->vTtMem[i]));
+        if ( p->fTtStoreMem )
+            printf( "Unique truth tables = %d (%d shared)   Memory = %.2f MB   ", nUnique, nShared, 1.0 * nMemTotal / (1<<20) ); 
+        else
+            printf( "Unique truth tables = %d   Memory = %.2f MB   ", nUnique, 1.0 * nMemTotal / (1<<20) ); 
         Abc_PrintTime( 1, "Time", p->timeCache[4] );
         if ( p->nCacheMisses )
         {
@@ -277,9 +297,9 @@ void If_ManStop( If_Man_t * p )
     Vec_IntFreeP( &p->vVisited2 );
     if ( p->vPairHash )
         Hash_IntManStop( p->vPairHash );
-    for ( i = 6; i <= Abc_MaxInt(6,p->pPars->nLutSize); i++ )
+    for ( i = 6; i <= Abc_MaxInt(6,p->pPars->nLutSize) && !p->fTtStoreMem; i++ )
         Vec_MemHashFree( p->vTtMem[i] );
-    for ( i = 6; i <= Abc_MaxInt(6,p->pPars->nLutSize); i++ )
+    for ( i = 6; i <= Abc_MaxInt(6,p->pPars->nLutSize) && !p->fTtStoreMem; i++ )
         Vec_MemFreeP( &p->vTtMem[i] );
     for ( i = 6; i <= Abc_MaxInt(6,p->pPars->nLutSize); i++ )
         Vec_WecFreeP( &p->vTtIsops[i] );
@@ -293,8 +313,12 @@ void If_ManStop( If_Man_t * p )
     }
     ABC_FREE( p->pMemCi );
     ABC_FREE( p->pMemAnd );
+    if ( p->vMemSets )
+        Vec_PtrFreeFree( p->vMemSets );
     ABC_FREE( p->puTemp[0] );
     ABC_FREE( p->puTempW );
+    ABC_FREE( p->puTempPend );
+    ABC_FREE( p->pTempPendC );
     // free pars memory
     ABC_FREE( p->pPars->pTimesArr );
     ABC_FREE( p->pPars->pTimesReq );
@@ -718,6 +742,35 @@ void If_ManSetupSetAll( If_Man_t * p, int nCrossCut )
 
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Adds cutsets to the free list.]
+
+  Description [Used when more cutsets are alive at the same time than
+  predicted by the cross cut, for example, when the nodes are processed
+  by level in the parallel mapping.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void If_ManSetupSetMore( If_Man_t * p, int nCutSets )
+{
+    If_Set_t * pCutSet;
+    int i;
+    if ( p->vMemSets == NULL )
+        p->vMemSets = Vec_PtrAlloc( 16 );
+    pCutSet = (If_Set_t *)ABC_ALLOC( char, nCutSets * p->nSetBytes );
+    Vec_PtrPush( p->vMemSets, pCutSet );
+    for ( i = 0; i < nCutSets; i++ )
+    {
+        If_ManSetupSet( p, pCutSet );
+        If_ManCutSetRecycle( p, pCutSet );
+        pCutSet = (If_Set_t *)( (char *)pCutSet + p->nSetBytes );
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
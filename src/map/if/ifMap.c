@@ -20,6 +20,17 @@
 
 #include "if.h"
 #include "misc/extra/extra.h"
+#include "misc/util/utilPool.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
 
 ABC_NAMESPACE_IMPL_START
 
@@ -31,10 +42,93 @@ extern char * Dau_DsdMerge( char * pDsd0i, int * pPerm0, char * pDsd1i, int * pP
 extern int    If_CutDelayRecCost3( If_Man_t* p, If_Cut_t* pCut, If_Obj_t * pObj );
 extern int    Abc_ExactDelayCost( word * pTruth, int nVars, int * pArrTimeProfile, char * pPerm, int * Cost, int AigLevel );
 
+#define IF_PROC_MAX   64
+#define IF_PAR_MIN   500            // the smallest slice of a wavefront processed by a thread
+
+typedef struct If_Thr_t_ If_Thr_t;
+struct If_Thr_t_
+{
+    If_Man_t       Man;             // the thread-local copy of the manager
+    If_Obj_t **    pNodes;          // the slice of the wavefront
+    int            nNodes;          // the number of nodes in the slice
+    int            Mode;            // the mapping mode
+    int            fPreprocess;     // the preprocessing flag
+    int            fFirst;          // the first round flag
+};
+
+// the locks of the data shared by the threads: each table of truth tables
+// (by the number of variables) is locked together with the data attached 
+// to its functions, while the DSD manager and the user checks are locked together
+typedef struct If_Locks_t_ If_Locks_t;
+struct If_Locks_t_
+{
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t Func;                          // the DSD manager and the cell checks
+    pthread_mutex_t Tt[IF_MAX_FUNC_LUTSIZE+1];     // the truth tables by the number of variables
+#else
+    int             Dummy;
+#endif
+};
+
+static inline void If_ManLockFunc( If_Man_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    if ( p->pFuncLock )
+        pthread_mutex_lock( &((If_Locks_t *)p->pFuncLock)->Func );
+#endif
+}
+static inline void If_ManUnlockFunc( If_Man_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    if ( p->pFuncLock )
+        pthread_mutex_unlock( &((If_Locks_t *)p->pFuncLock)->Func );
+#endif
+}
+// the delay evaluators read the data of the function of the cut
+static inline void If_ManLockCut( If_Man_t * p, If_Cut_t * pCut )
+{
+    If_ManLockTt( p, pCut->nLeaves );
+    if ( p->pPars->fUseDsd )
+        If_ManLockFunc( p );
+}
+static inline void If_ManUnlockCut( If_Man_t * p, If_Cut_t * pCut )
+{
+    if ( p->pPars->fUseDsd )
+        If_ManUnlockFunc( p );
+    If_ManUnlockTt( p, pCut->nLeaves );
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
+/**Function*************************************************************
+
+  Synopsis    [Locks the table of truth tables with the given support size.]
+
+  Description [Does nothing unless the nodes are mapped in parallel.
+  The tables with less than 6 variables share the 6-variable table.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void If_ManLockTt( If_Man_t * p, int nVars )
+{
+#ifdef ABC_USE_PTHREADS
+    if ( p->pFuncLock )
+        pthread_mutex_lock( &((If_Locks_t *)p->pFuncLock)->Tt[Abc_MaxInt(6, nVars)] );
+#endif
+}
+void If_ManUnlockTt( If_Man_t * p, int nVars )
+{
+#ifdef ABC_USE_PTHREADS
+    if ( p->pFuncLock )
+        pthread_mutex_unlock( &((If_Locks_t *)p->pFuncLock)->Tt[Abc_MaxInt(6, nVars)] );
+#endif
+}
+
 /**Function*************************************************************
 
   Synopsis    [Compute delay of the cut's output in terms of logic levels.]
@@ -148,6 +242,250 @@ int * If_CutArrTimeProfile( If_Man_t * p, If_Cut_t * pCut )
     return p->pArrTimeProfile;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Returns the place of the cut in the memory of the cutset.]
+
+  Description [The cuts are moved around the cutset by reordering the 
+  pointers, so the place identifies the cut until the node is processed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int If_CutSetPlace( If_Man_t * p, If_Set_t * pCutSet, If_Cut_t * pCut )
+{
+    char * pArray = (char *)(pCutSet->ppCuts + pCutSet->nCutsMax + 1);
+    int Place = (int)(((char *)pCut - pArray) / p->nCutBytes);
+    assert( Place >= 0 && Place <= pCutSet->nCutsMax );
+    return Place;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the functions of the new cuts of the node to the table.]
+
+  Description [The new cuts have function ID -1, while their truth tables
+  are kept in the place of the cut in the temporary storage.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void If_ObjInsertTruths( If_Man_t * p, If_Set_t * pCutSet )
+{
+    If_Cut_t * ppCuts[16];
+    word * ppTruths[16];
+    int pCompls[16];
+    int i, Place, nCuts = 0;
+    int nWords = p->nTruth6Words[p->pPars->nLutSize];
+    abctime clk = 0;
+    if ( p->pPars->fVerbose )
+        clk = Abc_Clock();
+    for ( i = 0; i < pCutSet->nCuts; i++ )
+    {
+        if ( pCutSet->ppCuts[i]->iCutFunc >= 0 )
+            continue;
+        Place = If_CutSetPlace( p, pCutSet, pCutSet->ppCuts[i] );
+        ppCuts[nCuts]   = pCutSet->ppCuts[i];
+        ppTruths[nCuts] = p->puTempPend + nWords * Place;
+        pCompls[nCuts]  = p->pTempPendC[Place];
+        if ( ++nCuts < 16 )
+            continue;
+        If_CutInsertTruthBatch( p, ppCuts, ppTruths, pCompls, nCuts );
+        nCuts = 0;
+    }
+    if ( nCuts )
+        If_CutInsertTruthBatch( p, ppCuts, ppTruths, pCompls, nCuts );
+    if ( p->pPars->fVerbose )
+        p->timeCache[4] += Abc_Clock() - clk;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Checks the function of the cut.]
+
+  Description [Computes the DSD of the function and runs the user checks.
+  Returns 0 if the cut should be skipped. In the parallel mapping, the 
+  caller locks the table of the function and, if the DSD manager or the
+  cell checks are used, the function lock.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int If_ObjPerformMappingCheck( If_Man_t * p, If_Cut_t * pCut )
+{
+    int v, iCutDsd;
+    if ( p->pPars->fUseDsd )
+    {
+        extern void If_ManCacheRecord( If_Man_t * p, int iDsd0, int iDsd1, int nShared, int iDsd );
+        int truthId = Abc_Lit2Var(pCut->iCutFunc);
+        if ( truthId >= Vec_IntSize(p->vTtDsds[pCut->nLeaves]) || Vec_IntEntry(p->vTtDsds[pCut->nLeaves], truthId) == -1 )
+        {
+            while ( truthId >= Vec_IntSize(p->vTtDsds[pCut->nLeaves]) )
+            {
+                Vec_IntPush( p->vTtDsds[pCut->nLeaves], -1 );
+                for ( v = 0; v < Abc_MaxInt(6, pCut->nLeaves); v++ )
+                    Vec_StrPush( p->vTtPerms[pCut->nLeaves], IF_BIG_CHAR );
+            }
+            iCutDsd = If_DsdManCompute( p->pIfDsdMan, If_CutTruthWR(p, pCut), pCut->nLeaves, (unsigned char *)If_CutDsdPerm(p, pCut), p->pPars->pLutStruct );
+            Vec_IntWriteEntry( p->vTtDsds[pCut->nLeaves], truthId, iCutDsd );
+        }
+        assert( If_DsdManSuppSize(p->pIfDsdMan, If_CutDsdLit(p, pCut)) == (int)pCut->nLeaves );
+        //If_ManCacheRecord( p, If_CutDsdLit(p, pCut0), If_CutDsdLit(p, pCut1), nShared, If_CutDsdLit(p, pCut) );
+    }
+    // run user functions
+    pCut->fUseless = 0;
+    if ( p->pPars->pFuncCell || p->pPars->pFuncCell2 )
+    {
+        assert( p->pPars->fUseTtPerm == 0 );
+        assert( pCut->nLimit >= 4 && pCut->nLimit <= 16 );
+        if ( p->pPars->fUseDsd )
+            pCut->fUseless = If_DsdManCheckDec( p->pIfDsdMan, If_CutDsdLit(p, pCut) );
+        else if ( p->pPars->pFuncCell2 )
+            pCut->fUseless = !p->pPars->pFuncCell2( p, (word *)If_CutTruthW(p, pCut), pCut->nLeaves, NULL, NULL );
+        else
+            pCut->fUseless = !p->pPars->pFuncCell( p, If_CutTruth(p, pCut), Abc_MaxInt(6, pCut->nLeaves), pCut->nLeaves, p->pPars->pLutStruct );
+        p->nCutsUselessAll += pCut->fUseless;
+        p->nCutsUseless[pCut->nLeaves] += pCut->fUseless;
+        p->nCutsCountAll++;
+        p->nCutsCount[pCut->nLeaves]++;
+        // skip 5-input cuts, which cannot be decomposed
+        if ( (p->pPars->fEnableCheck75 || p->pPars->fEnableCheck75u) && pCut->nLeaves == 5 && pCut->nLimit == 5 )
+        {
+            extern int If_CluCheckDecInAny( word t, int nVars );
+            extern int If_CluCheckDecOut( word t, int nVars );
+            unsigned TruthU = *If_CutTruth(p, pCut);
+            word Truth = (((word)TruthU << 32) | (word)TruthU);
+            p->nCuts5++;
+            if ( If_CluCheckDecInAny( Truth, 5 ) )
+                p->nCuts5a++;
+            else
+                return 0;
+        }
+        else if ( p->pPars->fVerbose && pCut->nLeaves == 5 )
+        {
+            extern int If_CluCheckDecInAny( word t, int nVars );
+            extern int If_CluCheckDecOut( word t, int nVars );
+            unsigned TruthU = *If_CutTruth(p, pCut);
+            word Truth = (((word)TruthU << 32) | (word)TruthU);
+            p->nCuts5++;
+            if ( If_CluCheckDecInAny( Truth, 5 ) || If_CluCheckDecOut( Truth, 5 ) )
+                p->nCuts5a++;
+        }
+    }
+    else if ( p->pPars->fUseDsdTune )
+    {
+        pCut->fUseless = If_DsdManReadMark( p->pIfDsdMan, If_CutDsdLit(p, pCut) );
+        p->nCutsUselessAll += pCut->fUseless;
+        p->nCutsUseless[pCut->nLeaves] += pCut->fUseless;
+        p->nCutsCountAll++;
+        p->nCutsCount[pCut->nLeaves]++;
+    }
+    else if ( p->pPars->fUse34Spec )
+    {
+        assert( pCut->nLeaves <= 4 );
+        if ( pCut->nLeaves == 4 && !Abc_Tt4Check( (int)(0xFFFF & *If_CutTruth(p, pCut)) ) )
+            pCut->fUseless = 1;
+    }
+    else 
+    {
+        if ( p->pPars->fUseAndVars )
+        {
+            int iDecMask = -1, truthId = Abc_Lit2Var(pCut->iCutFunc);
+            assert( p->pPars->nLutSize <= 13 );
+            if ( truthId >= Vec_IntSize(p->vTtDecs[pCut->nLeaves]) || Vec_IntEntry(p->vTtDecs[pCut->nLeaves], truthId) == -1 )
+            {
+                while ( truthId >= Vec_IntSize(p->vTtDecs[pCut->nLeaves]) )
+                    Vec_IntPush( p->vTtDecs[pCut->nLeaves], -1 );
+                if ( (int)pCut->nLeaves > p->pPars->nLutSize / 2 && (int)pCut->nLeaves <= 2 * (p->pPars->nLutSize / 2) )
+                    iDecMask = Abc_TtProcessBiDec( If_CutTruthWR(p, pCut), (int)pCut->nLeaves, p->pPars->nLutSize / 2 );
+                else
+                    iDecMask = 0;
+                Vec_IntWriteEntry( p->vTtDecs[pCut->nLeaves], truthId, iDecMask );
+            }
+            iDecMask = Vec_IntEntry(p->vTtDecs[pCut->nLeaves], truthId);
+            assert( iDecMask >= 0 );
+            pCut->fUseless = (int)(iDecMask == 0 && (int)pCut->nLeaves > p->pPars->nLutSize / 2);
+            p->nCutsUselessAll += pCut->fUseless;
+            p->nCutsUseless[pCut->nLeaves] += pCut->fUseless;
+            p->nCutsCountAll++;
+            p->nCutsCount[pCut->nLeaves]++;
+        }
+        if ( p->pPars->fUseCofVars && (!p->pPars->fUseAndVars || pCut->fUseless) )
+        {
+            int iCofVar = -1, truthId = Abc_Lit2Var(pCut->iCutFunc);
+            if ( truthId >= Vec_StrSize(p->vTtVars[pCut->nLeaves]) || Vec_StrEntry(p->vTtVars[pCut->nLeaves], truthId) == (char)-1 )
+            {
+                while ( truthId >= Vec_StrSize(p->vTtVars[pCut->nLeaves]) )
+                    Vec_StrPush( p->vTtVars[pCut->nLeaves], (char)-1 );
+                iCofVar = Abc_TtCheckCondDep( If_CutTruthWR(p, pCut), pCut->nLeaves, p->pPars->nLutSize / 2 );
+                Vec_StrWriteEntry( p->vTtVars[pCut->nLeaves], truthId, (char)iCofVar );
+            }
+            iCofVar = Vec_StrEntry(p->vTtVars[pCut->nLeaves], truthId);
+            assert( iCofVar >= 0 && iCofVar <= (int)pCut->nLeaves );
+            pCut->fUseless = (int)(iCofVar == (int)pCut->nLeaves && pCut->nLeaves > 0);
+            p->nCutsUselessAll += pCut->fUseless;
+            p->nCutsUseless[pCut->nLeaves] += pCut->fUseless;
+            p->nCutsCountAll++;
+            p->nCutsCount[pCut->nLeaves]++;
+        }
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the truth table of the cut and checks its function.]
+
+  Description [Returns 0 if the cut should be skipped.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int If_ObjPerformMappingTruth( If_Man_t * p, If_Obj_t * pObj, If_Set_t * pCutSet, If_Cut_t * pCut, If_Cut_t * pCut0, If_Cut_t * pCut1, If_Cut_t * pCut0R, If_Cut_t * pCut1R, int fFunc0R, int fFunc1R, int fSave0, int fBatch )
+{
+    int fLockFunc = p->pPars->fUseDsd || p->pPars->fUseDsdTune || p->pPars->pFuncCell || p->pPars->pFuncCell2;
+    int fChange, RetValue;
+//    int nShared = pCut0->nLeaves + pCut1->nLeaves - pCut->nLeaves;
+    abctime clk = 0;
+    if ( p->pPars->fVerbose )
+        clk = Abc_Clock();
+    if ( p->pPars->fUseTtPerm )
+        fChange = If_CutComputeTruthPerm( p, pCut, pCut0R, pCut1R, fFunc0R, fFunc1R );
+    else if ( fBatch ) // the function is added to the table after the node is processed
+    {
+        int Place = If_CutSetPlace( p, pCutSet, pCut );
+        fChange = If_CutComputeTruthLocal( p, pCut, pCut0, pCut1, pObj->fCompl0, pObj->fCompl1, 
+            p->puTempPend + p->nTruth6Words[p->pPars->nLutSize] * Place, p->pTempPendC + Place );
+    }
+    else
+        fChange = If_CutComputeTruth( p, pCut, pCut0, pCut1, pObj->fCompl0, pObj->fCompl1 );
+    if ( p->pPars->fVerbose )
+        p->timeCache[4] += Abc_Clock() - clk;
+    if ( !p->pPars->fSkipCutFilter && fChange && If_CutFilter( pCutSet, pCut, fSave0 ) )
+        return 0;
+    if ( p->pPars->fLut6Filter && pCut->nLeaves == 6 && !If_CutCheckTruth6(p, pCut) )
+        return 0;
+    if ( fBatch ) // the function is not in the table yet and is not checked
+        return If_ObjPerformMappingCheck( p, pCut );
+    // the data attached to the function are locked with its table
+    If_ManLockTt( p, pCut->nLeaves );
+    if ( fLockFunc )
+        If_ManLockFunc( p );
+    RetValue = If_ObjPerformMappingCheck( p, pCut );
+    if ( fLockFunc )
+        If_ManUnlockFunc( p );
+    If_ManUnlockTt( p, pCut->nLeaves );
+    return RetValue;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Finds the best cut for the given node.]
@@ -165,10 +503,12 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
     If_Cut_t * pCut0, * pCut1, * pCut;
     If_Cut_t * pCut0R, * pCut1R;
     int fFunc0R, fFunc1R;
-    int i, k, v, iCutDsd, fChange;
+    int i, k, v, fChange;
     int fSave0 = p->pPars->fDelayOpt || p->pPars->fDelayOptLut || p->pPars->fDsdBalance || p->pPars->fUserRecLib || p->pPars->fUserSesLib || p->pPars->fUserLutDec || p->pPars->fUserLut2D ||
         p->pPars->fUseDsdTune || p->pPars->fUseCofVars || p->pPars->fUseAndVars || p->pPars->fUse34Spec || p->pPars->pLutStruct || p->pPars->pFuncCell2 || p->pPars->fUseCheck1 || p->pPars->fUseCheck2;
     int fUseAndCut = (p->pPars->nAndDelay > 0) || (p->pPars->nAndArea > 0);
+    int fLockDelay = p->pPars->fDelayOpt || p->pPars->fDsdBalance || p->pPars->fDelayOptLut || p->pPars->nGateSize > 0;
+    int fTruthBatch = p->puTempPend != NULL && If_ManTruthBatchCheck( p->pPars );
     assert( !If_ObjIsAnd(pObj->pFanin0) || pObj->pFanin0->pCutSet->nCuts > 0 );
     assert( !If_ObjIsAnd(pObj->pFanin1) || pObj->pFanin1->pCutSet->nCuts > 0 );
 
@@ -177,18 +517,20 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
         pObj->EstRefs = (float)pObj->nRefs;
     else if ( Mode == 1 )
         pObj->EstRefs = (float)((2.0 * pObj->EstRefs + pObj->nRefs) / 3.0);
-    // deref the selected cut
-    if ( Mode && pObj->nRefs > 0 )
+    // deref the selected cut (in the parallel mapping, the caller does it)
+    if ( Mode && pObj->nRefs > 0 && !p->fParallel )
         If_CutAreaDeref( p, If_ObjCutBest(pObj) );
 
-    // prepare the cutset
-    pCutSet = If_ManSetupNodeCutSet( p, pObj );
+    // prepare the cutset (in the parallel mapping, it is already assigned)
+    pCutSet = p->fParallel ? pObj->pCutSet : If_ManSetupNodeCutSet( p, pObj );
 
     // get the current assigned best cut
     pCut = If_ObjCutBest(pObj);
     if ( !fFirst )
     {
         // recompute the parameters of the best cut
+        if ( fLockDelay )
+            If_ManLockCut( p, pCut );
         if ( p->pPars->fDelayOpt )
             pCut->Delay = If_CutSopBalanceEval( p, pCut, NULL );
         else if ( p->pPars->fDsdBalance )
@@ -218,6 +560,8 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
             pCut->Delay = If_CutDelaySop( p, pCut );
         else
             pCut->Delay = If_CutDelay( p, pObj, pCut );
+        if ( fLockDelay )
+            If_ManUnlockCut( p, pCut );
         assert( pCut->Delay != -1 );
 //        assert( pCut->Delay <= pObj->Required + p->fEpsilon );
         if ( pCut->Delay > pObj->Required + 2*p->fEpsilon )
@@ -286,135 +630,9 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
         pCut->fCompl = 0;
         if ( p->pPars->fTruth )
         {
-//            int nShared = pCut0->nLeaves + pCut1->nLeaves - pCut->nLeaves;
-            abctime clk = 0;
-            if ( p->pPars->fVerbose )
-                clk = Abc_Clock();
-            if ( p->pPars->fUseTtPerm )
-                fChange = If_CutComputeTruthPerm( p, pCut, pCut0R, pCut1R, fFunc0R, fFunc1R );
-            else
-                fChange = If_CutComputeTruth( p, pCut, pCut0, pCut1, pObj->fCompl0, pObj->fCompl1 );
-            if ( p->pPars->fVerbose )
-                p->timeCache[4] += Abc_Clock() - clk;
-            if ( !p->pPars->fSkipCutFilter && fChange && If_CutFilter( pCutSet, pCut, fSave0 ) )
+            fChange = If_ObjPerformMappingTruth( p, pObj, pCutSet, pCut, pCut0, pCut1, pCut0R, pCut1R, fFunc0R, fFunc1R, fSave0, fTruthBatch );
+            if ( !fChange )
                 continue;
-            if ( p->pPars->fLut6Filter && pCut->nLeaves == 6 && !If_CutCheckTruth6(p, pCut) )
-                continue;
-            if ( p->pPars->fUseDsd )
-            {
-                extern void If_ManCacheRecord( If_Man_t * p, int iDsd0, int iDsd1, int nShared, int iDsd );
-                int truthId = Abc_Lit2Var(pCut->iCutFunc);
-                if ( truthId >= Vec_IntSize(p->vTtDsds[pCut->nLeaves]) || Vec_IntEntry(p->vTtDsds[pCut->nLeaves], truthId) == -1 )
-                {
-                    while ( truthId >= Vec_IntSize(p->vTtDsds[pCut->nLeaves]) )
-                    {
-                        Vec_IntPush( p->vTtDsds[pCut->nLeaves], -1 );
-                        for ( v = 0; v < Abc_MaxInt(6, pCut->nLeaves); v++ )
-                            Vec_StrPush( p->vTtPerms[pCut->nLeaves], IF_BIG_CHAR );
-                    }
-                    iCutDsd = If_DsdManCompute( p->pIfDsdMan, If_CutTruthWR(p, pCut), pCut->nLeaves, (unsigned char *)If_CutDsdPerm(p, pCut), p->pPars->pLutStruct );
-                    Vec_IntWriteEntry( p->vTtDsds[pCut->nLeaves], truthId, iCutDsd );
-                }
-                assert( If_DsdManSuppSize(p->pIfDsdMan, If_CutDsdLit(p, pCut)) == (int)pCut->nLeaves );
-                //If_ManCacheRecord( p, If_CutDsdLit(p, pCut0), If_CutDsdLit(p, pCut1), nShared, If_CutDsdLit(p, pCut) );
-            }
-            // run user functions
-            pCut->fUseless = 0;
-            if ( p->pPars->pFuncCell || p->pPars->pFuncCell2 )
-            {
-                assert( p->pPars->fUseTtPerm == 0 );
-                assert( pCut->nLimit >= 4 && pCut->nLimit <= 16 );
-                if ( p->pPars->fUseDsd )
-                    pCut->fUseless = If_DsdManCheckDec( p->pIfDsdMan, If_CutDsdLit(p, pCut) );
-                else if ( p->pPars->pFuncCell2 )
-                    pCut->fUseless = !p->pPars->pFuncCell2( p, (word *)If_CutTruthW(p, pCut), pCut->nLeaves, NULL, NULL );
-                else
-                    pCut->fUseless = !p->pPars->pFuncCell( p, If_CutTruth(p, pCut), Abc_MaxInt(6, pCut->nLeaves), pCut->nLeaves, p->pPars->pLutStruct );
-                p->nCutsUselessAll += pCut->fUseless;
-                p->nCutsUseless[pCut->nLeaves] += pCut->fUseless;
-                p->nCutsCountAll++;
-                p->nCutsCount[pCut->nLeaves]++;
-                // skip 5-input cuts, which cannot be decomposed
-                if ( (p->pPars->fEnableCheck75 || p->pPars->fEnableCheck75u) && pCut->nLeaves == 5 && pCut->nLimit == 5 )
-                {
-                    extern int If_CluCheckDecInAny( word t, int nVars );
-                    extern int If_CluCheckDecOut( word t, int nVars );
-                    unsigned TruthU = *If_CutTruth(p, pCut);
-                    word Truth = (((word)TruthU << 32) | (word)TruthU);
-                    p->nCuts5++;
-                    if ( If_CluCheckDecInAny( Truth, 5 ) )
-                        p->nCuts5a++;
-                    else
-                        continue;
-                }
-                else if ( p->pPars->fVerbose && pCut->nLeaves == 5 )
-                {
-                    extern int If_CluCheckDecInAny( word t, int nVars );
-                    extern int If_CluCheckDecOut( word t, int nVars );
-                    unsigned TruthU = *If_CutTruth(p, pCut);
-                    word Truth = (((word)TruthU << 32) | (word)TruthU);
-                    p->nCuts5++;
-                    if ( If_CluCheckDecInAny( Truth, 5 ) || If_CluCheckDecOut( Truth, 5 ) )
-                        p->nCuts5a++;
-                }
-            }
-            else if ( p->pPars->fUseDsdTune )
-            {
-                pCut->fUseless = If_DsdManReadMark( p->pIfDsdMan, If_CutDsdLit(p, pCut) );
-                p->nCutsUselessAll += pCut->fUseless;
-                p->nCutsUseless[pCut->nLeaves] += pCut->fUseless;
-                p->nCutsCountAll++;
-                p->nCutsCount[pCut->nLeaves]++;
-            }
-            else if ( p->pPars->fUse34Spec )
-            {
-                assert( pCut->nLeaves <= 4 );
-                if ( pCut->nLeaves == 4 && !Abc_Tt4Check( (int)(0xFFFF & *If_CutTruth(p, pCut)) ) )
-                    pCut->fUseless = 1;
-            }
-            else 
-            {
-                if ( p->pPars->fUseAndVars )
-                {
-                    int iDecMask = -1, truthId = Abc_Lit2Var(pCut->iCutFunc);
-                    assert( p->pPars->nLutSize <= 13 );
-                    if ( truthId >= Vec_IntSize(p->vTtDecs[pCut->nLeaves]) || Vec_IntEntry(p->vTtDecs[pCut->nLeaves], truthId) == -1 )
-                    {
-                        while ( truthId >= Vec_IntSize(p->vTtDecs[pCut->nLeaves]) )
-                            Vec_IntPush( p->vTtDecs[pCut->nLeaves], -1 );
-                        if ( (int)pCut->nLeaves > p->pPars->nLutSize / 2 && (int)pCut->nLeaves <= 2 * (p->pPars->nLutSize / 2) )
-                            iDecMask = Abc_TtProcessBiDec( If_CutTruthWR(p, pCut), (int)pCut->nLeaves, p->pPars->nLutSize / 2 );
-                        else
-                            iDecMask = 0;
-                        Vec_IntWriteEntry( p->vTtDecs[pCut->nLeaves], truthId, iDecMask );
-                    }
-                    iDecMask = Vec_IntEntry(p->vTtDecs[pCut->nLeaves], truthId);
-                    assert( iDecMask >= 0 );
-                    pCut->fUseless = (int)(iDecMask == 0 && (int)pCut->nLeaves > p->pPars->nLutSize / 2);
-                    p->nCutsUselessAll += pCut->fUseless;
-                    p->nCutsUseless[pCut->nLeaves] += pCut->fUseless;
-                    p->nCutsCountAll++;
-                    p->nCutsCount[pCut->nLeaves]++;
-                }
-                if ( p->pPars->fUseCofVars && (!p->pPars->fUseAndVars || pCut->fUseless) )
-                {
-                    int iCofVar = -1, truthId = Abc_Lit2Var(pCut->iCutFunc);
-                    if ( truthId >= Vec_StrSize(p->vTtVars[pCut->nLeaves]) || Vec_StrEntry(p->vTtVars[pCut->nLeaves], truthId) == (char)-1 )
-                    {
-                        while ( truthId >= Vec_StrSize(p->vTtVars[pCut->nLeaves]) )
-                            Vec_StrPush( p->vTtVars[pCut->nLeaves], (char)-1 );
-                        iCofVar = Abc_TtCheckCondDep( If_CutTruthWR(p, pCut), pCut->nLeaves, p->pPars->nLutSize / 2 );
-                        Vec_StrWriteEntry( p->vTtVars[pCut->nLeaves], truthId, (char)iCofVar );
-                    }
-                    iCofVar = Vec_StrEntry(p->vTtVars[pCut->nLeaves], truthId);
-                    assert( iCofVar >= 0 && iCofVar <= (int)pCut->nLeaves );
-                    pCut->fUseless = (int)(iCofVar == (int)pCut->nLeaves && pCut->nLeaves > 0);
-                    p->nCutsUselessAll += pCut->fUseless;
-                    p->nCutsUseless[pCut->nLeaves] += pCut->fUseless;
-                    p->nCutsCountAll++;
-                    p->nCutsCount[pCut->nLeaves]++;
-                }
-            }
         }
         
         // compute the application-specific cost and depth
@@ -423,6 +641,8 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
         if ( pCut->Cost == IF_COST_MAX )
             continue;
         // check if the cut satisfies the required times
+        if ( fLockDelay )
+            If_ManLockCut( p, pCut );
         if ( p->pPars->fDelayOpt )
             pCut->Delay = If_CutSopBalanceEval( p, pCut, NULL );
         else if ( p->pPars->fDsdBalance )
@@ -458,6 +678,8 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
             pCut->Delay = If_CutDelaySop( p, pCut );
         else 
             pCut->Delay = If_CutDelay( p, pObj, pCut );
+        if ( fLockDelay )
+            If_ManUnlockCut( p, pCut );
         if ( pCut->Delay == -1 )
             continue;
         if ( Mode && pCut->Delay > pObj->Required + p->fEpsilon && pCutSet->nCuts > 0 )
@@ -474,6 +696,9 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
 //        If_CutTraverse( p, pObj, pCut );
     } 
     assert( pCutSet->nCuts > 0 );
+    p->nCutsSaved += pCutSet->nCuts;
+    if ( fTruthBatch )
+        If_ObjInsertTruths( p, pCutSet );
 //    If_CutVerifyCuts( pCutSet, !p->pPars->fUseTtPerm );
 
     // update the best cut
@@ -495,7 +720,7 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
 //        p->nBestCutSmall[1]++;
 
     // ref the selected cut
-    if ( Mode && pObj->nRefs > 0 )
+    if ( Mode && pObj->nRefs > 0 && !p->fParallel )
         If_CutAreaRef( p, If_ObjCutBest(pObj) );
     if ( If_ObjCutBest(pObj)->fUseless )
         Abc_Print( 1, "The best cut is useless.\n" );
@@ -504,7 +729,8 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
         If_ObjForEachCut( pObj, pCut, i )
             p->pPars->pFuncUser( p, pObj, pCut );
     // free the cuts
-    If_ManDerefNodeCutSet( p, pObj );
+    if ( !p->fParallel )
+        If_ManDerefNodeCutSet( p, pObj );
 }
 
 /**Function*************************************************************
@@ -592,6 +818,234 @@ void If_ObjPerformMappingChoice( If_Man_t * p, If_Obj_t * pObj, int Mode, int fP
     If_ManDerefChoiceCutSet( p, pObj );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the mapping round can be performed in parallel.]
+
+  Description [The nodes are processed in parallel when the cut computation
+  depends only on the fanin cones of the nodes, that is, without choices,
+  the timing manager, sequential mapping, exact area recovery, and user
+  callbacks that are not known to be thread-safe.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int If_ManPerformMappingParCheck( If_Man_t * p, int Mode )
+{
+    If_Par_t * pPars = p->pPars;
+    return pPars->nProcs > 1 && Mode < 2 && p->pManTim == NULL && p->nChoices == 0 && !pPars->fLiftLeaves && !pPars->fUseTtPerm && 
+        !pPars->fUserRecLib && !pPars->fUserSesLib && !pPars->fUserLutDec && !pPars->fUserLut2D && pPars->pFuncCost == NULL && pPars->pFuncUser == NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the internal nodes by level.]
+
+  Description [Returns the nodes sorted by level and, for each level, 
+  the beginning of its wave in the array.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Ptr_t * If_ManCollectWaves( If_Man_t * p, Vec_Int_t ** pvStarts )
+{
+    Vec_Ptr_t * vNodes = Vec_PtrStart( If_ManAndNum(p) );
+    Vec_Int_t * vStarts;
+    If_Obj_t * pObj;
+    int i, LevelMax = 0;
+    If_ManForEachNode( p, pObj, i )
+        LevelMax = Abc_MaxInt( LevelMax, (int)pObj->Level );
+    vStarts = Vec_IntStart( LevelMax + 2 );
+    If_ManForEachNode( p, pObj, i )
+        Vec_IntAddToEntry( vStarts, pObj->Level + 1, 1 );
+    for ( i = 1; i < Vec_IntSize(vStarts); i++ )
+        Vec_IntAddToEntry( vStarts, i, Vec_IntEntry(vStarts, i - 1) );
+    assert( Vec_IntEntryLast(vStarts) == If_ManAndNum(p) );
+    // the nodes of each level are listed in the topological order
+    If_ManForEachNode( p, pObj, i )
+    {
+        Vec_PtrWriteEntry( vNodes, Vec_IntEntry(vStarts, pObj->Level), pObj );
+        Vec_IntAddToEntry( vStarts, pObj->Level, 1 );
+    }
+    for ( i = LevelMax + 1; i > 0; i-- )
+        Vec_IntWriteEntry( vStarts, i, Vec_IntEntry(vStarts, i - 1) );
+    Vec_IntWriteEntry( vStarts, 0, 0 );
+    *pvStarts = vStarts;
+    return vNodes;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prepares the thread-local copy of the manager.]
+
+  Description [The copy shares the nodes and the functional data with
+  the manager, while the statistics, the temporary truth tables, and the
+  cover used to derive the ISOPs are local to the thread.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void If_ManStartThread( If_Man_t * p, If_Man_t * pMan, void * pLock )
+{
+    int nWords = p->nTruth6Words[p->pPars->nLutSize];
+    *pMan = *p;
+    pMan->fParallel       = 1;
+    pMan->pFuncLock       = pLock;
+    pMan->nCutsMerged     = 0;
+    pMan->nCutsSaved      = 0;
+    pMan->nCutsTotal      = 0;
+    pMan->nCutsCountAll   = 0;
+    pMan->nCutsUselessAll = 0;
+    pMan->nCuts5          = 0;
+    pMan->nCuts5a         = 0;
+    memset( pMan->nCutsUseless, 0, sizeof(int) * 32 );
+    memset( pMan->nCutsCount, 0, sizeof(int) * 32 );
+    memset( pMan->timeCache, 0, sizeof(abctime) * 6 );
+    pMan->puTemp[0] = p->pPars->fTruth? ABC_ALLOC( unsigned, 8 * nWords ) : NULL;
+    pMan->puTemp[1] = p->pPars->fTruth? pMan->puTemp[0] + nWords*2 : NULL;
+    pMan->puTemp[2] = p->pPars->fTruth? pMan->puTemp[1] + nWords*2 : NULL;
+    pMan->puTemp[3] = p->pPars->fTruth? pMan->puTemp[2] + nWords*2 : NULL;
+    pMan->puTempW   = p->pPars->fTruth? ABC_ALLOC( word, nWords ) : NULL;
+    pMan->puTempPend = p->puTempPend? ABC_ALLOC( word, nWords * (p->pPars->nCutsMax + 1) ) : NULL;
+    pMan->pTempPendC = p->pTempPendC? ABC_ALLOC( int, p->pPars->nCutsMax + 1 ) : NULL;
+    pMan->vCover     = p->vCover? Vec_IntAlloc( 0 ) : NULL;
+}
+void If_ManStopThread( If_Man_t * p, If_Man_t * pMan )
+{
+    int i;
+    p->nCutsMerged     += pMan->nCutsMerged;
+    p->nCutsSaved      += pMan->nCutsSaved;
+    p->nCutsTotal      += pMan->nCutsTotal;
+    p->nCutsCountAll   += pMan->nCutsCountAll;
+    p->nCutsUselessAll += pMan->nCutsUselessAll;
+    p->nCuts5          += pMan->nCuts5;
+    p->nCuts5a         += pMan->nCuts5a;
+    for ( i = 0; i < 32; i++ )
+    {
+        p->nCutsUseless[i] += pMan->nCutsUseless[i];
+        p->nCutsCount[i]   += pMan->nCutsCount[i];
+    }
+    for ( i = 0; i < 6; i++ )
+        p->timeCache[i] += pMan->timeCache[i];
+    ABC_FREE( pMan->puTemp[0] );
+    ABC_FREE( pMan->puTempW );
+    ABC_FREE( pMan->puTempPend );
+    ABC_FREE( pMan->pTempPendC );
+    Vec_IntFreeP( &pMan->vCover );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs one mapping pass over the nodes in parallel.]
+
+  Description [The nodes are processed by levels. Large levels are split
+  into slices mapped concurrently by the threads. Before a level is 
+  processed, the cutsets of its nodes are allocated and their best cuts
+  dereferenced; after it is processed, the new best cuts are referenced 
+  and the cutsets are released, both in the topological order. Therefore,
+  the result does not depend on the number of threads.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int If_ManPerformMappingSlice( void * pArg )
+{
+    If_Thr_t * pThr = (If_Thr_t *)pArg;
+    int i;
+    for ( i = 0; i < pThr->nNodes; i++ )
+        If_ObjPerformMappingAnd( &pThr->Man, pThr->pNodes[i], pThr->Mode, pThr->fPreprocess, pThr->fFirst );
+    return 1;
+}
+void If_ManPerformMappingPar( If_Man_t * p, int Mode, int fPreprocess, int fFirst )
+{
+    extern void * Abc_FrameReadPool();
+    Util_Pool_t * pPool = (Util_Pool_t *)Abc_FrameReadPool(), * pPoolTemp = NULL;
+    Util_PoolGroup_t * pGroup;
+    Vec_Int_t * vStarts;
+    Vec_Ptr_t * vNodes = If_ManCollectWaves( p, &vStarts );
+    int nProcs = Abc_MinInt( p->pPars->nProcs, IF_PROC_MAX );
+    If_Thr_t * pThrs = ABC_CALLOC( If_Thr_t, nProcs );
+    If_Locks_t * pLocks = ABC_CALLOC( If_Locks_t, 1 );
+    int i, k, v, w, nSize, nChunk, nChunks;
+    int nTtNode = (p->pPars->nCutsMax + 1) * (p->pPars->nCutsMax + 1) + 2; // truth tables added by one node
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_init( &pLocks->Func, NULL );
+    for ( i = 0; i <= IF_MAX_FUNC_LUTSIZE; i++ )
+        pthread_mutex_init( &pLocks->Tt[i], NULL );
+#endif
+    if ( pPool == NULL )
+        pPool = pPoolTemp = Util_PoolStart( nProcs - 1 );
+    for ( k = 0; k < nProcs; k++ )
+    {
+        If_ManStartThread( p, &pThrs[k].Man, (void *)pLocks );
+        pThrs[k].Mode        = Mode;
+        pThrs[k].fPreprocess = fPreprocess;
+        pThrs[k].fFirst      = fFirst;
+    }
+    for ( w = 0; w + 1 < Vec_IntSize(vStarts); w++ )
+    {
+        If_Obj_t ** pWave = (If_Obj_t **)Vec_PtrArray(vNodes) + Vec_IntEntry(vStarts, w);
+        nSize   = Vec_IntEntry(vStarts, w + 1) - Vec_IntEntry(vStarts, w);
+        nChunks = Abc_MinInt( nProcs, nSize / IF_PAR_MIN );
+        if ( nChunks < 2 )
+        {
+            for ( i = 0; i < nSize; i++ )
+                If_ObjPerformMappingAnd( p, pWave[i], Mode, fPreprocess, fFirst );
+            continue;
+        }
+        for ( i = 0; i < nSize; i++ )
+        {
+            if ( Mode && pWave[i]->nRefs > 0 )
+                If_CutAreaDeref( p, If_ObjCutBest(pWave[i]) );
+            If_ManSetupNodeCutSet( p, pWave[i] );
+        }
+        // the truth tables are read without locking, so the wave should fit into the reserved pages
+        if ( p->pPars->fTruth )
+            for ( v = 6; v <= Abc_MaxInt(6,p->pPars->nLutSize); v++ )
+                Vec_MemReserveEntries( p->vTtMem[v], nSize * nTtNode );
+        // the slices of the wave are processed concurrently
+        nChunk = (nSize + nChunks - 1) / nChunks;
+        pGroup = Util_PoolGroupStart( pPool, 0 );
+        for ( k = 0; k < nChunks; k++ )
+        {
+            pThrs[k].pNodes = pWave + k * nChunk;
+            pThrs[k].nNodes = Abc_MinInt( nChunk, nSize - k * nChunk );
+            Util_PoolSubmit( pGroup, If_ManPerformMappingSlice, pThrs + k );
+        }
+        Util_PoolGroupWait( pGroup );
+        Util_PoolGroupStop( pGroup );
+        if ( p->pPars->fTruth )
+            for ( v = 6; v <= Abc_MaxInt(6,p->pPars->nLutSize); v++ )
+                Vec_MemUnfixPages( p->vTtMem[v] );
+        for ( i = 0; i < nSize; i++ )
+        {
+            if ( Mode && pWave[i]->nRefs > 0 )
+                If_CutAreaRef( p, If_ObjCutBest(pWave[i]) );
+            If_ManDerefNodeCutSet( p, pWave[i] );
+        }
+    }
+    for ( k = 0; k < nProcs; k++ )
+        If_ManStopThread( p, &pThrs[k].Man );
+    ABC_FREE( pThrs );
+    Util_PoolStop( pPoolTemp );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_destroy( &pLocks->Func );
+    for ( i = 0; i <= IF_MAX_FUNC_LUTSIZE; i++ )
+        pthread_mutex_destroy( &pLocks->Tt[i] );
+#endif
+    ABC_FREE( pLocks );
+    Vec_IntFree( vStarts );
+    Vec_PtrFree( vNodes );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Performs one mapping pass over all nodes.]
@@ -622,6 +1076,7 @@ int If_ManPerformMappingRound( If_Man_t * p, int nCutsUsed, int Mode, int fPrepr
     // set the cut number
     p->nCutsUsed   = nCutsUsed;
     p->nCutsMerged = 0;
+    p->nCutsSaved  = 0;
     // make sure the visit counters are all zero
     If_ManForEachNode( p, pObj, i )
         assert( pObj->nVisits == pObj->nVisitsCopy );
@@ -658,6 +1113,8 @@ int If_ManPerformMappingRound( If_Man_t * p, int nCutsUsed, int Mode, int fPrepr
         }
 //        Tim_ManPrint( p->pManTim );
     }
+    else if ( If_ManPerformMappingParCheck( p, Mode ) )
+        If_ManPerformMappingPar( p, Mode, fPreprocess, fFirst );
     else
     {
         pProgress = Extra_ProgressBarStart( stdout, If_ManObjNum(p) );
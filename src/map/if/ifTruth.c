@@ -31,6 +31,46 @@ ABC_NAMESPACE_IMPL_START
 
 //#define IF_TRY_NEW
 
+// when the shared store is full, the mapper continues with private copies of its tables
+static inline void If_ManTtStoreLeave( If_Man_t * p )
+{
+    int v;
+    assert( p->fTtStoreMem );
+    for ( v = 6; v <= Abc_MaxInt(6,p->pPars->nLutSize); v++ )
+        p->vTtMem[v] = Dau_TtStoreMemDup( p->pTtStore, v );
+    for ( v = 0; v < 6; v++ )
+        p->vTtMem[v] = p->vTtMem[6];
+    p->fTtStoreMem = 0;
+}
+static inline int If_ManTtInsert( If_Man_t * p, int nLeaves, word * pTruth )
+{
+    if ( p->fTtStoreMem ) // tables with less than 6 variables are stored in the 6-variable table
+    {
+        int iFunc = Dau_TtStoreInsert( p->pTtStore, Abc_MaxInt(6, nLeaves), pTruth );
+        if ( iFunc >= 0 )
+            return iFunc;
+        If_ManTtStoreLeave( p );
+    }
+    return Vec_MemHashInsert( p->vTtMem[nLeaves], pTruth );
+}
+static inline void If_ManTtInsertBatch( If_Man_t * p, int nVars, word ** ppTruths, int nTruths, int * pIds )
+{
+    int i;
+    if ( !p->fTtStoreMem )
+    {
+        Vec_MemHashInsertBatch( p->vTtMem[nVars], ppTruths, nTruths, pIds );
+        return;
+    }
+    Dau_TtStoreInsertBatch( p->pTtStore, nVars, ppTruths, nTruths, pIds );
+    for ( i = 0; i < nTruths; i++ )
+        if ( pIds[i] == -1 )
+        {
+            if ( p->fTtStoreMem )
+                If_ManTtStoreLeave( p );
+            pIds[i] = Vec_MemHashInsert( p->vTtMem[nVars], ppTruths[i] );
+        }
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -80,38 +120,62 @@ void If_CutRotatePins( If_Man_t * p, If_Cut_t * pCut )
     }
     Abc_TtCopy( p->puTempW, If_CutTruthWR(p, pCut), p->nTruth6Words[pCut->nLeaves], 0 );
     If_CutTruthPermute( p->puTempW, If_CutLeaveNum(pCut), pCut->nLeaves, p->nTruth6Words[pCut->nLeaves], PinDelays, If_CutLeaves(pCut) );
-    truthId        = Vec_MemHashInsert( p->vTtMem[pCut->nLeaves], p->puTempW );
+    truthId        = If_ManTtInsert( p, pCut->nLeaves, p->puTempW );
     pCut->iCutFunc = Abc_Var2Lit( truthId, If_CutTruthIsCompl(pCut) );
     assert( (p->puTempW[0] & 1) == 0 );
 }
 
 /**Function*************************************************************
 
-  Synopsis    [Truth table computation.]
+  Synopsis    [Returns 1 if the functions of the cuts can be added in batches.]
 
-  Description []
+  Description [This is the case when the function IDs of the new cuts of
+  the node are not used before all of its cuts are computed, that is,
+  when neither the cut evaluation nor the user callbacks look at the 
+  functions. Then only the functions of the cuts remaining in the cutset
+  are added to the table, after the node is processed.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-int If_CutComputeTruth( If_Man_t * p, If_Cut_t * pCut, If_Cut_t * pCut0, If_Cut_t * pCut1, int fCompl0, int fCompl1 )
+int If_ManTruthBatchCheck( If_Par_t * pPars )
 {
-    int fCompl, truthId, nLeavesNew, PrevSize, RetValue = 0;
+    return pPars->fTruth && !pPars->fUseTtPerm && !pPars->fUseDsd && !pPars->fUseDsdTune && !pPars->fUse34Spec && 
+        !pPars->fUseAndVars && !pPars->fUseCofVars && !pPars->fLut6Filter && !pPars->fDelayOpt && !pPars->fDsdBalance && 
+        !pPars->fDelayOptLut && !pPars->fUserRecLib && !pPars->fUserSesLib && !pPars->fUserLutDec && !pPars->fUserLut2D && 
+        pPars->nGateSize == 0 && pPars->pFuncCell == NULL && pPars->pFuncCell2 == NULL && pPars->pFuncCost == NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the function of the cut without adding it to the table.]
+
+  Description [Writes the truth table with the constant-0 minterm equal 
+  to 0 into pTruth and its complemented attribute into pfCompl. Returns 1
+  if the cut minimization has reduced the leaves.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int If_CutComputeTruthLocal( If_Man_t * p, If_Cut_t * pCut, If_Cut_t * pCut0, If_Cut_t * pCut1, int fCompl0, int fCompl1, word * pTruth, int * pfCompl )
+{
+    int nLeavesNew, RetValue = 0;
     word * pTruth0s = Vec_MemReadEntry( p->vTtMem[pCut0->nLeaves], Abc_Lit2Var(pCut0->iCutFunc) );
     word * pTruth1s = Vec_MemReadEntry( p->vTtMem[pCut1->nLeaves], Abc_Lit2Var(pCut1->iCutFunc) );
     word * pTruth0  = (word *)p->puTemp[0];
     word * pTruth1  = (word *)p->puTemp[1];
-    word * pTruth   = (word *)p->puTemp[2];
     Abc_TtCopy( pTruth0, pTruth0s, p->nTruth6Words[pCut0->nLeaves], fCompl0 ^ pCut0->fCompl ^ Abc_LitIsCompl(pCut0->iCutFunc) );
     Abc_TtCopy( pTruth1, pTruth1s, p->nTruth6Words[pCut1->nLeaves], fCompl1 ^ pCut1->fCompl ^ Abc_LitIsCompl(pCut1->iCutFunc) );
     Abc_TtStretch6( pTruth0, pCut0->nLeaves, pCut->nLeaves );
     Abc_TtStretch6( pTruth1, pCut1->nLeaves, pCut->nLeaves );
     Abc_TtExpand( pTruth0, pCut->nLeaves, pCut0->pLeaves, pCut0->nLeaves, pCut->pLeaves, pCut->nLeaves );
     Abc_TtExpand( pTruth1, pCut->nLeaves, pCut1->pLeaves, pCut1->nLeaves, pCut->pLeaves, pCut->nLeaves );
-    fCompl         = (pTruth0[0] & pTruth1[0] & 1);
-    Abc_TtAnd( pTruth, pTruth0, pTruth1, p->nTruth6Words[pCut->nLeaves], fCompl );
+    *pfCompl       = (pTruth0[0] & pTruth1[0] & 1);
+    Abc_TtAnd( pTruth, pTruth0, pTruth1, p->nTruth6Words[pCut->nLeaves], *pfCompl );
     if ( p->pPars->fCutMin && (pCut0->nLeaves + pCut1->nLeaves > pCut->nLeaves || pCut0->nLeaves == 0 || pCut1->nLeaves == 0) )
     {
         nLeavesNew = Abc_TtMinBase( pTruth, pCut->pLeaves, pCut->nLeaves, pCut->nLeaves );
@@ -122,8 +186,29 @@ int If_CutComputeTruth( If_Man_t * p, If_Cut_t * pCut, If_Cut_t * pCut0, If_Cut_
             RetValue      = 1;
         }
     }
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Truth table computation.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int If_CutComputeTruth( If_Man_t * p, If_Cut_t * pCut, If_Cut_t * pCut0, If_Cut_t * pCut1, int fCompl0, int fCompl1 )
+{
+    word * pTruth   = (word *)p->puTemp[2];
+    int fCompl, truthId, PrevSize;
+    int RetValue    = If_CutComputeTruthLocal( p, pCut, pCut0, pCut1, fCompl0, fCompl1, pTruth, &fCompl );
+    // in the parallel mapping, the table and the ISOPs of its functions are locked
+    If_ManLockTt( p, pCut->nLeaves );
     PrevSize       = Vec_MemEntryNum( p->vTtMem[pCut->nLeaves] );   
-    truthId        = Vec_MemHashInsert( p->vTtMem[pCut->nLeaves], pTruth );
+    truthId        = If_ManTtInsert( p, pCut->nLeaves, pTruth );
     pCut->iCutFunc = Abc_Var2Lit( truthId, fCompl );
     assert( (pTruth[0] & 1) == 0 );
 #ifdef IF_TRY_NEW
@@ -147,9 +232,58 @@ int If_CutComputeTruth( If_Man_t * p, If_Cut_t * pCut, If_Cut_t * pCut0, If_Cut_
         }
         assert( Vec_WecSize(p->vTtIsops[pCut->nLeaves]) == Vec_MemEntryNum(p->vTtMem[pCut->nLeaves]) );
     }
+    If_ManUnlockTt( p, pCut->nLeaves );
     return RetValue;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Adds the functions of several cuts to the table.]
+
+  Description [The functions computed by If_CutComputeTruthLocal() are 
+  given by their truth tables and complemented attributes. The cuts are 
+  grouped by the table they belong to, and each group is added in one 
+  batch, which overlaps the hash table lookups and takes the lock of 
+  the table once. Sets the function IDs of the cuts.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void If_CutInsertTruthBatch( If_Man_t * p, If_Cut_t ** ppCuts, word ** ppTruths, int * pCompls, int nCuts )
+{
+    word * pBatch[16];
+    int pIds[16], pIndex[16];
+    int v, i, k, n;
+    assert( p->vTtIsops[6] == NULL );
+    for ( v = 6; v <= Abc_MaxInt(6, p->pPars->nLutSize); v++ )
+    {
+        for ( n = i = 0; i < nCuts; i++ )
+        {
+            if ( Abc_MaxInt(6, (int)ppCuts[i]->nLeaves) != v )
+                continue;
+            pIndex[n]   = i;
+            pBatch[n++] = ppTruths[i];
+            if ( n < 16 )
+                continue;
+            If_ManLockTt( p, v );
+            If_ManTtInsertBatch( p, v, pBatch, n, pIds );
+            If_ManUnlockTt( p, v );
+            for ( k = 0; k < n; k++ )
+                ppCuts[pIndex[k]]->iCutFunc = Abc_Var2Lit( pIds[k], pCompls[pIndex[k]] );
+            n = 0;
+        }
+        if ( n == 0 )
+            continue;
+        If_ManLockTt( p, v );
+        If_ManTtInsertBatch( p, v, pBatch, n, pIds );
+        If_ManUnlockTt( p, v );
+        for ( k = 0; k < n; k++ )
+            ppCuts[pIndex[k]]->iCutFunc = Abc_Var2Lit( pIds[k], pCompls[pIndex[k]] );
+    }
+}
+
 /**Function*************************************************************
 
   Synopsis    [Truth table computation.]
@@ -227,7 +361,12 @@ if ( fVerbose )
     // compute canonical form
 if ( p->pPars->fVerbose )
 clk = Abc_Clock();
-    p->uCanonPhase = Abc_TtCanonicize( pTruth, pCut->nLeaves, p->pCanonPerm );
+    if ( p->pTtStore )
+        p->uCanonPhase = Dau_TtStoreCanonicize( p->pTtStore, pTruth, pCut->nLeaves, p->pCanonPerm );
+    else if ( p->pNpnCache )
+        p->uCanonPhase = Dau_NpnCacheCanonicize( p->pNpnCache, DAU_NPN_ABC, pTruth, pCut->nLeaves, p->pCanonPerm );
+    else
+        p->uCanonPhase = Abc_TtCanonicize( pTruth, pCut->nLeaves, p->pCanonPerm );
 if ( p->pPars->fVerbose )
 p->timeCache[3] += Abc_Clock() - clk;
     for ( v = 0; v < (int)pCut->nLeaves; v++ )
@@ -0,0 +1,542 @@
+/**CFile****************************************************************
+
+  FileName    [utilPool.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Generic interface to pthreads.]
+
+  Synopsis    [Work-stealing pool of worker threads.]
+
+  Author      [agent <agent@local>]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: utilPool.c,v 1.00 2026/10/17 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <time.h>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+#ifdef ABC_USE_PTHREADS
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+#endif
+
+#include "misc/util/abc_global.h"
+#include "utilPool.h"
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+struct Util_PoolGroup_t_
+{
+    Util_Pool_t *     pPool;      // the pool executing the tasks
+    int               nPending;   // the tasks submitted and not finished
+    int               nDone;      // the tasks executed
+    int               nSkipped;   // the tasks skipped after cancellation
+    volatile int      fCancel;    // the group is canceled
+    abctime           Deadline;   // the time when the group is canceled
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t   Mutex;      // protects the counters
+    pthread_cond_t    Cond;       // signals that no tasks are pending
+#endif
+};
+
+#ifdef ABC_USE_PTHREADS
+
+typedef struct Util_PoolTask_t_ Util_PoolTask_t;
+struct Util_PoolTask_t_
+{
+    Util_PoolFunc_t   pFunc;
+    void *            pArg;
+    Util_PoolGroup_t* pGroup;
+};
+
+typedef struct Util_PoolDeque_t_ Util_PoolDeque_t;
+struct Util_PoolDeque_t_
+{
+    pthread_mutex_t   Mutex;
+    Util_PoolTask_t * pTasks;     // circular buffer
+    int               nCap;       // the buffer size
+    int               iFirst;     // the first task
+    int               nSize;      // the number of tasks
+};
+
+struct Util_Pool_t_
+{
+    int               nThreads;   // the number of workers
+    pthread_t *       pThreads;   // the workers
+    Util_PoolDeque_t *pDeques;    // one deque per worker and the shared one
+    pthread_key_t     Key;        // the worker number (plus one) of this thread
+    pthread_mutex_t   Mutex;      // protects nQueued, nGroups and fStop
+    pthread_cond_t    Cond;       // signals new tasks
+    int               nQueued;    // the tasks in the deques
+    int               nGroups;    // the groups started and not stopped
+    int               fStop;      // the workers should exit
+};
+
+#else
+
+struct Util_Pool_t_
+{
+    int               nThreads;
+    int               nGroups;
+};
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the number of online processors.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Util_PoolCpuNum()
+{
+    int nCpus = 1;
+#if defined(_WIN32)
+    char * pNum = getenv( "NUMBER_OF_PROCESSORS" );
+    if ( pNum )
+        nCpus = atoi( pNum );
+#elif defined(_SC_NPROCESSORS_ONLN)
+    nCpus = (int)sysconf( _SC_NPROCESSORS_ONLN );
+#endif
+    return Abc_MaxInt( 1, nCpus );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Task groups.]
+
+  Description [TimeOut is in seconds (0 means no timeout).]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Util_PoolGroup_t * Util_PoolGroupStart( Util_Pool_t * p, int TimeOut )
+{
+    Util_PoolGroup_t * g = ABC_CALLOC( Util_PoolGroup_t, 1 );
+    g->pPool    = p;
+    g->Deadline = TimeOut > 0 ? Abc_Clock() + (abctime)TimeOut * CLOCKS_PER_SEC : 0;
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_init( &g->Mutex, NULL );
+    pthread_cond_init( &g->Cond, NULL );
+    pthread_mutex_lock( &p->Mutex );
+    p->nGroups++;
+    pthread_mutex_unlock( &p->Mutex );
+#else
+    p->nGroups++;
+#endif
+    return g;
+}
+void Util_PoolGroupStop( Util_PoolGroup_t * g )
+{
+    Util_Pool_t * p = g->pPool;
+    assert( g->nPending == 0 );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_destroy( &g->Mutex );
+    pthread_cond_destroy( &g->Cond );
+    pthread_mutex_lock( &p->Mutex );
+    p->nGroups--;
+    pthread_mutex_unlock( &p->Mutex );
+#else
+    p->nGroups--;
+#endif
+    ABC_FREE( g );
+}
+void Util_PoolGroupCancel( Util_PoolGroup_t * g )
+{
+    g->fCancel = 1;
+}
+int Util_PoolGroupIsCanceled( Util_PoolGroup_t * g )
+{
+    if ( !g->fCancel && g->Deadline && Abc_Clock() > g->Deadline )
+        g->fCancel = 1;
+    return g->fCancel;
+}
+int Util_PoolGroupDoneNum( Util_PoolGroup_t * g )
+{
+    return g->nDone;
+}
+int Util_PoolGroupSkippedNum( Util_PoolGroup_t * g )
+{
+    return g->nSkipped;
+}
+int Util_PoolThreadNum( Util_Pool_t * p )
+{
+    return p ? p->nThreads : 0;
+}
+int Util_PoolGroupNum( Util_Pool_t * p )
+{
+    int nGroups;
+    if ( p == NULL )
+        return 0;
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock( &p->Mutex );
+    nGroups = p->nGroups;
+    pthread_mutex_unlock( &p->Mutex );
+#else
+    nGroups = p->nGroups;
+#endif
+    return nGroups;
+}
+
+#ifndef ABC_USE_PTHREADS
+
+/**Function*************************************************************
+
+  Synopsis    [Serial version: the tasks are executed when submitted.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Util_Pool_t * Util_PoolStart( int nThreads )
+{
+    return ABC_CALLOC( Util_Pool_t, 1 );
+}
+void Util_PoolStop( Util_Pool_t * p )
+{
+    ABC_FREE( p );
+}
+void Util_PoolSubmit( Util_PoolGroup_t * g, Util_PoolFunc_t pFunc, void * pArg )
+{
+    if ( Util_PoolGroupIsCanceled(g) )
+        g->nSkipped++;
+    else
+        pFunc( pArg ), g->nDone++;
+}
+int Util_PoolGroupWait( Util_PoolGroup_t * g )
+{
+    return g->nSkipped == 0;
+}
+
+#else // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    [Deque operations.]
+
+  Description [The owner pushes and pops at the back, thieves take
+  tasks from the front.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Util_PoolDequePush( Util_PoolDeque_t * q, Util_PoolTask_t * pTask )
+{
+    pthread_mutex_lock( &q->Mutex );
+    if ( q->nSize == q->nCap )
+    {
+        int i, nCapNew = Abc_MaxInt( 64, 2 * q->nCap );
+        Util_PoolTask_t * pTasks = ABC_ALLOC( Util_PoolTask_t, nCapNew );
+        for ( i = 0; i < q->nSize; i++ )
+            pTasks[i] = q->pTasks[(q->iFirst + i) % q->nCap];
+        ABC_FREE( q->pTasks );
+        q->pTasks = pTasks;
+        q->nCap   = nCapNew;
+        q->iFirst = 0;
+    }
+    q->pTasks[(q->iFirst + q->nSize++) % q->nCap] = *pTask;
+    pthread_mutex_unlock( &q->Mutex );
+}
+static int Util_PoolDequePop( Util_PoolDeque_t * q, Util_PoolTask_t * pTask, int fFront )
+{
+    int RetValue = 0;
+    if ( q->nSize == 0 ) // quick check without locking
+        return 0;
+    pthread_mutex_lock( &q->Mutex );
+    if ( q->nSize > 0 )
+    {
+        if ( fFront )
+        {
+            *pTask = q->pTasks[q->iFirst];
+            q->iFirst = (q->iFirst + 1) % q->nCap;
+        }
+        else
+            *pTask = q->pTasks[(q->iFirst + q->nSize - 1) % q->nCap];
+        q->nSize--;
+        RetValue = 1;
+    }
+    pthread_mutex_unlock( &q->Mutex );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Finds the next task for the given worker.]
+
+  Description [The worker is -1 for the threads not owned by the pool.
+  Looks at the own deque, then at the shared one, then steals.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Util_PoolSelf( Util_Pool_t * p )
+{
+    return (int)(ABC_PTRINT_T)pthread_getspecific( p->Key ) - 1;
+}
+static int Util_PoolFetch( Util_Pool_t * p, int iSelf, Util_PoolTask_t * pTask )
+{
+    int i, k, fFound = 0;
+    if ( iSelf >= 0 && Util_PoolDequePop(p->pDeques + iSelf, pTask, 0) )
+        fFound = 1;
+    else if ( Util_PoolDequePop(p->pDeques + p->nThreads, pTask, 1) )
+        fFound = 1;
+    else for ( k = 1; k <= p->nThreads && !fFound; k++ )
+    {
+        i = (iSelf + k + p->nThreads) % p->nThreads;
+        if ( i != iSelf && Util_PoolDequePop(p->pDeques + i, pTask, 1) )
+            fFound = 1;
+    }
+    if ( fFound )
+    {
+        pthread_mutex_lock( &p->Mutex );
+        p->nQueued--;
+        pthread_mutex_unlock( &p->Mutex );
+    }
+    return fFound;
+}
+static void Util_PoolRun( Util_PoolTask_t * pTask )
+{
+    Util_PoolGroup_t * g = pTask->pGroup;
+    int fSkip = Util_PoolGroupIsCanceled( g );
+    if ( !fSkip )
+        pTask->pFunc( pTask->pArg );
+    pthread_mutex_lock( &g->Mutex );
+    if ( fSkip )
+        g->nSkipped++;
+    else
+        g->nDone++;
+    if ( --g->nPending == 0 )
+        pthread_cond_broadcast( &g->Cond );
+    pthread_mutex_unlock( &g->Mutex );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [The worker thread.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Util_PoolThData_t_
+{
+    Util_Pool_t * pPool;
+    int           iThread;
+} Util_PoolThData_t;
+
+static void * Util_PoolWorker( void * pArg )
+{
+    Util_PoolThData_t * pThData = (Util_PoolThData_t *)pArg;
+    Util_Pool_t * p = pThData->pPool;
+    int iSelf = pThData->iThread;
+    Util_PoolTask_t Task;
+    ABC_FREE( pThData );
+    pthread_setspecific( p->Key, (void *)(ABC_PTRINT_T)(iSelf + 1) );
+    while ( 1 )
+    {
+        if ( Util_PoolFetch(p, iSelf, &Task) )
+        {
+            Util_PoolRun( &Task );
+            continue;
+        }
+        pthread_mutex_lock( &p->Mutex );
+        while ( p->nQueued == 0 && !p->fStop )
+            pthread_cond_wait( &p->Cond, &p->Mutex );
+        if ( p->fStop )
+        {
+            pthread_mutex_unlock( &p->Mutex );
+            break;
+        }
+        pthread_mutex_unlock( &p->Mutex );
+    }
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the pool.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Util_Pool_t * Util_PoolStart( int nThreads )
+{
+    Util_Pool_t * p = ABC_CALLOC( Util_Pool_t, 1 );
+    int i, status;
+    p->nThreads = Abc_MinInt( Abc_MaxInt(nThreads, 1), UTIL_POOL_THR_MAX );
+    p->pThreads = ABC_CALLOC( pthread_t, p->nThreads );
+    p->pDeques  = ABC_CALLOC( Util_PoolDeque_t, p->nThreads + 1 );
+    for ( i = 0; i <= p->nThreads; i++ )
+        pthread_mutex_init( &p->pDeques[i].Mutex, NULL );
+    pthread_key_create( &p->Key, NULL );
+    pthread_mutex_init( &p->Mutex, NULL );
+    pthread_cond_init( &p->Cond, NULL );
+    for ( i = 0; i < p->nThreads; i++ )
+    {
+        Util_PoolThData_t * pThData = ABC_ALLOC( Util_PoolThData_t, 1 );
+        pThData->pPool   = p;
+        pThData->iThread = i;
+        status = pthread_create( p->pThreads + i, NULL, Util_PoolWorker, (void *)pThData );  assert( status == 0 );
+    }
+    return p;
+}
+void Util_PoolStop( Util_Pool_t * p )
+{
+    int i;
+    if ( p == NULL )
+        return;
+    pthread_mutex_lock( &p->Mutex );
+    assert( p->nGroups == 0 );
+    p->fStop = 1;
+    pthread_cond_broadcast( &p->Cond );
+    pthread_mutex_unlock( &p->Mutex );
+    for ( i = 0; i < p->nThreads; i++ )
+        pthread_join( p->pThreads[i], NULL );
+    for ( i = 0; i <= p->nThreads; i++ )
+    {
+        assert( p->pDeques[i].nSize == 0 );
+        pthread_mutex_destroy( &p->pDeques[i].Mutex );
+        ABC_FREE( p->pDeques[i].pTasks );
+    }
+    pthread_key_delete( p->Key );
+    pthread_mutex_destroy( &p->Mutex );
+    pthread_cond_destroy( &p->Cond );
+    ABC_FREE( p->pDeques );
+    ABC_FREE( p->pThreads );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Submits one task to the group.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Util_PoolSubmit( Util_PoolGroup_t * g, Util_PoolFunc_t pFunc, void * pArg )
+{
+    Util_Pool_t * p = g->pPool;
+    Util_PoolTask_t Task;
+    int iSelf = Util_PoolSelf( p );
+    Task.pFunc  = pFunc;
+    Task.pArg   = pArg;
+    Task.pGroup = g;
+    pthread_mutex_lock( &g->Mutex );
+    g->nPending++;
+    pthread_mutex_unlock( &g->Mutex );
+    Util_PoolDequePush( p->pDeques + (iSelf >= 0 ? iSelf : p->nThreads), &Task );
+    pthread_mutex_lock( &p->Mutex );
+    p->nQueued++;
+    pthread_cond_signal( &p->Cond );
+    pthread_mutex_unlock( &p->Mutex );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Waits for the tasks of the group to finish.]
+
+  Description [The calling thread executes the queued tasks (of any
+  group) while waiting. Returns 1 if all tasks were executed and 0 if
+  some were skipped because the group was canceled.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Util_PoolGroupWait( Util_PoolGroup_t * g )
+{
+    Util_Pool_t * p = g->pPool;
+    Util_PoolTask_t Task;
+    int iSelf = Util_PoolSelf( p );
+    while ( 1 )
+    {
+        pthread_mutex_lock( &g->Mutex );
+        if ( g->nPending == 0 )
+        {
+            pthread_mutex_unlock( &g->Mutex );
+            break;
+        }
+        pthread_mutex_unlock( &g->Mutex );
+        if ( Util_PoolFetch(p, iSelf, &Task) )
+        {
+            Util_PoolRun( &Task );
+            continue;
+        }
+        // nothing to help with: sleep until the group is done or for 1 msec
+        pthread_mutex_lock( &g->Mutex );
+        if ( g->nPending > 0 )
+        {
+            struct timespec Time;
+#ifdef _WIN32
+            timespec_get( &Time, TIME_UTC );
+#else
+            clock_gettime( CLOCK_REALTIME, &Time );
+#endif
+            Time.tv_nsec += 1000000;
+            if ( Time.tv_nsec >= 1000000000 )
+                Time.tv_sec++, Time.tv_nsec -= 1000000000;
+            pthread_cond_timedwait( &g->Cond, &g->Mutex, &Time );
+        }
+        pthread_mutex_unlock( &g->Mutex );
+    }
+    return g->nSkipped == 0;
+}
+
+#endif // pthreads are used
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
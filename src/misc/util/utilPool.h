@@ -0,0 +1,87 @@
+/**CFile****************************************************************
+
+  FileName    [utilPool.h]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Generic interface to pthreads.]
+
+  Synopsis    [Work-stealing pool of worker threads.]
+
+  Author      [agent <agent@local>]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: utilPool.h,v 1.00 2026/10/17 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#ifndef ABC__misc__util__utilPool_h
+#define ABC__misc__util__utilPool_h
+
+////////////////////////////////////////////////////////////////////////
+///                          INCLUDES                                ///
+////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////
+///                         PARAMETERS                               ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_HEADER_START
+
+// the max number of worker threads in one pool
+#define UTIL_POOL_THR_MAX  64
+
+////////////////////////////////////////////////////////////////////////
+///                         BASIC TYPES                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The pool owns a fixed set of worker threads, each with its own deque of
+// tasks. A task submitted by a worker goes to the back of its deque and is
+// taken from the back (LIFO), while idle workers steal from the front of the
+// other deques. Tasks submitted by other threads go to a shared deque.
+// Tasks are submitted in groups; the thread waiting for a group executes
+// pending tasks instead of blocking, so nested parallel sections reuse the
+// same workers rather than starting new threads. A group can be canceled
+// explicitly or by its timeout, in which case the tasks not yet started are
+// skipped; running tasks may poll Util_PoolGroupIsCanceled() to stop early.
+// The pool is meant for short tasks; engines that keep long-lived solver
+// threads with their own protocols (cecSplit, absPth, wlcPth, bmcBmcS, giaKf)
+// start dedicated threads instead.
+
+typedef struct Util_Pool_t_      Util_Pool_t;
+typedef struct Util_PoolGroup_t_ Util_PoolGroup_t;
+typedef int (*Util_PoolFunc_t)( void * pArg );
+
+////////////////////////////////////////////////////////////////////////
+///                      MACRO DEFINITIONS                           ///
+////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////
+///                    FUNCTION DECLARATIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/*=== utilPool.c ==========================================================*/
+extern int                Util_PoolCpuNum();
+extern Util_Pool_t *      Util_PoolStart( int nThreads );
+extern void               Util_PoolStop( Util_Pool_t * p );
+extern int                Util_PoolThreadNum( Util_Pool_t * p );
+extern int                Util_PoolGroupNum( Util_Pool_t * p );
+extern Util_PoolGroup_t * Util_PoolGroupStart( Util_Pool_t * p, int TimeOut );
+extern void               Util_PoolGroupStop( Util_PoolGroup_t * g );
+extern void               Util_PoolSubmit( Util_PoolGroup_t * g, Util_PoolFunc_t pFunc, void * pArg );
+extern int                Util_PoolGroupWait( Util_PoolGroup_t * g );
+extern void               Util_PoolGroupCancel( Util_PoolGroup_t * g );
+extern int                Util_PoolGroupIsCanceled( Util_PoolGroup_t * g );
+extern int                Util_PoolGroupDoneNum( Util_PoolGroup_t * g );
+extern int                Util_PoolGroupSkippedNum( Util_PoolGroup_t * g );
+
+ABC_NAMESPACE_HEADER_END
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
@@ -31,17 +31,10 @@
 #include <pthread.h>
 #endif
 
-#ifdef __cplusplus
-#include <atomic>
-using namespace std;
-#else
-#include <stdatomic.h>
-#include <stdbool.h>
-#endif
-
 #endif
 
 #include "misc/vec/vec.h"
+#include "utilPool.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -55,9 +48,10 @@ ABC_NAMESPACE_IMPL_START
 
 /**Function*************************************************************
 
-  Synopsis    []
+  Synopsis    [Applies the user function to each data item concurrently.]
 
-  Description []
+  Description [The items are processed by the shared pool of worker
+  threads owned by the ABC frame, using at most nProcs-1 of them.]
                
   SideEffects []
 
@@ -76,106 +70,60 @@ void Util_ProcessThreads( int (*pUserFunc)(void *), void * vData, int nProcs, in
 
 #else // pthreads are used
 
-#define PAR_THR_MAX 100
 typedef struct Util_ThData_t_
 {
-    void *       pUserData;
-    int        (*pUserFunc)(void *);
-    int          iThread;
-    int          nTimeOut;
-    atomic_bool  fWorking;
+    Vec_Ptr_t *        vData;
+    int              (*pUserFunc)(void *);
+    Util_PoolGroup_t * pGroup;
+    pthread_mutex_t    Mutex;
+    int                iNext;
 } Util_ThData_t;
 
-void * Util_Thread( void * pArg )
+int Util_ThreadRunner( void * pArg )
 {
-    struct timespec pause_duration;
-    pause_duration.tv_sec = 0;
-    pause_duration.tv_nsec = 10000000L; // 10 milliseconds
-
     Util_ThData_t * pThData = (Util_ThData_t *)pArg;
+    int iItem;
     while ( 1 )
     {
-        while ( !atomic_load_explicit((atomic_bool *)&pThData->fWorking, memory_order_acquire) )
-            nanosleep(&pause_duration, NULL);
-        if ( pThData->pUserData == NULL )
-        {
-            pthread_exit( NULL );
-            assert( 0 );
-            return NULL;
-        }
-        pThData->pUserFunc( pThData->pUserData );
-        atomic_store_explicit(&pThData->fWorking, false, memory_order_release);
+        pthread_mutex_lock( &pThData->Mutex );
+        iItem = pThData->iNext++;
+        pthread_mutex_unlock( &pThData->Mutex );
+        if ( iItem >= Vec_PtrSize(pThData->vData) )
+            break;
+        pThData->pUserFunc( Vec_PtrEntry(pThData->vData, iItem) );
     }
-    assert( 0 );
-    return NULL;
+    return 1;
 }
-
 void Util_ProcessThreads( int (*pUserFunc)(void *), void * vData, int nProcs, int TimeOut, int fVerbose )
 {
     //abctime clkStart = Abc_Clock();
-    Util_ThData_t ThData[PAR_THR_MAX];
-    pthread_t WorkerThread[PAR_THR_MAX];
-    Vec_Ptr_t * vStack = NULL;
-    int i, status;
+    extern void * Abc_FrameReadPool();
+    Util_Pool_t * pPool = (Util_Pool_t *)Abc_FrameReadPool(), * pPoolTemp = NULL;
+    Util_ThData_t ThData;
+    int i, nRunners;
     fflush( stdout );
-    if ( nProcs <= 2 ) {
+    // the manager thread used to be idle, so nProcs-1 items are processed at a time
+    nRunners = Abc_MinInt( nProcs - 1, Vec_PtrSize((Vec_Ptr_t *)vData) );
+    if ( nRunners <= 1 ) {
         void * pData; int i;
         Vec_PtrForEachEntry( void *, (Vec_Ptr_t *)vData, pData, i )
             pUserFunc( pData );
         return;
     }
-    // subtract manager thread
-    nProcs--;
-    assert( nProcs >= 1 && nProcs <= PAR_THR_MAX );
-    // start threads
-    for ( i = 0; i < nProcs; i++ )
-    {
-        ThData[i].pUserData = NULL;
-        ThData[i].pUserFunc = pUserFunc;
-        ThData[i].iThread   = i;
-        ThData[i].nTimeOut  = TimeOut;
-        atomic_store_explicit(&ThData[i].fWorking, false, memory_order_release);
-        status = pthread_create( WorkerThread + i, NULL, Util_Thread, (void *)(ThData + i) );  assert( status == 0 );
-    }
-
-    struct timespec pause_duration;
-    pause_duration.tv_sec = 0;
-    pause_duration.tv_nsec = 10000000L; // 10 milliseconds
-
-    // look at the threads
-    vStack = Vec_PtrDup( (Vec_Ptr_t *)vData );
-    while ( Vec_PtrSize(vStack) > 0 )
-    {
-        for ( i = 0; i < nProcs; i++ )
-        {
-            if ( atomic_load_explicit(&ThData[i].fWorking, memory_order_acquire) )
-                continue;
-            ThData[i].pUserData = Vec_PtrPop( vStack );
-            atomic_store_explicit(&ThData[i].fWorking, true, memory_order_release);
-            break;
-        }
-    }
-    Vec_PtrFree( vStack );    
-    
-    // wait till threads finish
-    for ( i = 0; i < nProcs; i++ )
-    {
-        if ( atomic_load_explicit(&ThData[i].fWorking, memory_order_acquire) )
-            i = -1; // Start from the beginning again
-        nanosleep(&pause_duration, NULL);
-    }
-
-    // stop threads
-    for ( i = 0; i < nProcs; i++ )
-    {
-        ThData[i].pUserData = NULL;
-        atomic_store_explicit(&ThData[i].fWorking, true, memory_order_release);
-    }
-
-    // Join threads
-    for ( i = 0; i < nProcs; i++ )
-        pthread_join( WorkerThread[i], NULL );
-
+    if ( pPool == NULL )
+        pPool = pPoolTemp = Util_PoolStart( nRunners - 1 );
+    ThData.vData     = (Vec_Ptr_t *)vData;
+    ThData.pUserFunc = pUserFunc;
+    // TimeOut is per item and is enforced by the user function; a group deadline would drop the remaining items
+    ThData.pGroup    = Util_PoolGroupStart( pPool, 0 );
+    ThData.iNext     = 0;
+    pthread_mutex_init( &ThData.Mutex, NULL );
+    for ( i = 0; i < nRunners; i++ )
+        Util_PoolSubmit( ThData.pGroup, Util_ThreadRunner, (void *)&ThData );
+    Util_PoolGroupWait( ThData.pGroup );
+    Util_PoolGroupStop( ThData.pGroup );
+    pthread_mutex_destroy( &ThData.Mutex );
+    Util_PoolStop( pPoolTemp );
     //if ( fVerbose )
     //    Abc_PrintTime( 1, "Time", Abc_Clock() - clkStart );    
 }
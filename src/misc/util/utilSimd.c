@@ -0,0 +1,431 @@
+/**CFile****************************************************************
+
+  FileName    [utilSimd.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Word-level SIMD kernels for bit-parallel simulation.]
+
+  Synopsis    [Word-level SIMD kernels for bit-parallel simulation.]
+
+  Author      [agent <agent@local>]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: utilSimd.c,v 1.00 2026/10/17 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#include "misc/util/abc_global.h"
+#include "misc/util/utilTruth.h"
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define ABC_SIMD_X86
+#include <immintrin.h>
+#endif
+
+#include "utilSimd.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+static Abc_SimdLevel_t           s_SimdLevelMax = ABC_SIMD_NONE;
+static const Abc_SimdKernels_t * s_pSimdKernels = NULL;
+#ifdef ABC_USE_PTHREADS
+static pthread_once_t            s_SimdOnce     = PTHREAD_ONCE_INIT;
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Portable kernels.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_SimdAndScalar( word * pOut, word * pIn0, word * pIn1, word Diff0, word Diff1, int nWords )
+{
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        pOut[w] = (pIn0[w] ^ Diff0) & (pIn1[w] ^ Diff1);
+}
+static void Abc_SimdXorScalar( word * pOut, word * pIn0, word * pIn1, word Diff0, word Diff1, int nWords )
+{
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        pOut[w] = (pIn0[w] ^ Diff0) ^ (pIn1[w] ^ Diff1);
+}
+static void Abc_SimdMuxScalar( word * pOut, word * pCtrl, word * pIn1, word * pIn0, word Diff1, word Diff0, int nWords )
+{
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        pOut[w] = (pCtrl[w] & (pIn1[w] ^ Diff1)) | (~pCtrl[w] & (pIn0[w] ^ Diff0));
+}
+static void Abc_SimdAnd32Scalar( unsigned * pOut, unsigned * pIn0, unsigned * pIn1, unsigned Diff0, unsigned Diff1, int nWords )
+{
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        pOut[w] = (pIn0[w] ^ Diff0) & (pIn1[w] ^ Diff1);
+}
+static const Abc_SimdKernels_t s_SimdScalar = { ABC_SIMD_NONE, Abc_SimdAndScalar, Abc_SimdAnd32Scalar, Abc_SimdXorScalar, Abc_SimdMuxScalar, NULL, NULL };
+
+#ifdef ABC_SIMD_X86
+
+/**Function*************************************************************
+
+  Synopsis    [AVX2 kernels.]
+
+  Description [Compiled for the AVX2 target independently of the global
+  compiler flags and only called after the CPU support has been checked.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+__attribute__((target("avx2"))) static void Abc_SimdAndAvx2( word * pOut, word * pIn0, word * pIn1, word Diff0, word Diff1, int nWords )
+{
+    __m256i d0 = _mm256_set1_epi64x( (long long)Diff0 );
+    __m256i d1 = _mm256_set1_epi64x( (long long)Diff1 );
+    int w = 0;
+    for ( ; w + 4 <= nWords; w += 4 )
+    {
+        __m256i a = _mm256_xor_si256( _mm256_loadu_si256((const __m256i *)(pIn0 + w)), d0 );
+        __m256i b = _mm256_xor_si256( _mm256_loadu_si256((const __m256i *)(pIn1 + w)), d1 );
+        _mm256_storeu_si256( (__m256i *)(pOut + w), _mm256_and_si256(a, b) );
+    }
+    for ( ; w < nWords; w++ )
+        pOut[w] = (pIn0[w] ^ Diff0) & (pIn1[w] ^ Diff1);
+}
+__attribute__((target("avx2"))) static void Abc_SimdXorAvx2( word * pOut, word * pIn0, word * pIn1, word Diff0, word Diff1, int nWords )
+{
+    __m256i d = _mm256_set1_epi64x( (long long)(Diff0 ^ Diff1) );
+    int w = 0;
+    for ( ; w + 4 <= nWords; w += 4 )
+    {
+        __m256i a = _mm256_loadu_si256( (const __m256i *)(pIn0 + w) );
+        __m256i b = _mm256_loadu_si256( (const __m256i *)(pIn1 + w) );
+        _mm256_storeu_si256( (__m256i *)(pOut + w), _mm256_xor_si256(_mm256_xor_si256(a, b), d) );
+    }
+    for ( ; w < nWords; w++ )
+        pOut[w] = (pIn0[w] ^ Diff0) ^ (pIn1[w] ^ Diff1);
+}
+__attribute__((target("avx2"))) static void Abc_SimdMuxAvx2( word * pOut, word * pCtrl, word * pIn1, word * pIn0, word Diff1, word Diff0, int nWords )
+{
+    __m256i d0 = _mm256_set1_epi64x( (long long)Diff0 );
+    __m256i d1 = _mm256_set1_epi64x( (long long)Diff1 );
+    int w = 0;
+    for ( ; w + 4 <= nWords; w += 4 )
+    {
+        __m256i c = _mm256_loadu_si256( (const __m256i *)(pCtrl + w) );
+        __m256i a = _mm256_xor_si256( _mm256_loadu_si256((const __m256i *)(pIn1 + w)), d1 );
+        __m256i b = _mm256_xor_si256( _mm256_loadu_si256((const __m256i *)(pIn0 + w)), d0 );
+        _mm256_storeu_si256( (__m256i *)(pOut + w), _mm256_or_si256(_mm256_and_si256(c, a), _mm256_andnot_si256(c, b)) );
+    }
+    for ( ; w < nWords; w++ )
+        pOut[w] = (pCtrl[w] & (pIn1[w] ^ Diff1)) | (~pCtrl[w] & (pIn0[w] ^ Diff0));
+}
+__attribute__((target("avx2"))) static void Abc_SimdAnd32Avx2( unsigned * pOut, unsigned * pIn0, unsigned * pIn1, unsigned Diff0, unsigned Diff1, int nWords )
+{
+    __m256i d0 = _mm256_set1_epi32( (int)Diff0 );
+    __m256i d1 = _mm256_set1_epi32( (int)Diff1 );
+    int w = 0;
+    for ( ; w + 8 <= nWords; w += 8 )
+    {
+        __m256i a = _mm256_xor_si256( _mm256_loadu_si256((const __m256i *)(pIn0 + w)), d0 );
+        __m256i b = _mm256_xor_si256( _mm256_loadu_si256((const __m256i *)(pIn1 + w)), d1 );
+        _mm256_storeu_si256( (__m256i *)(pOut + w), _mm256_and_si256(a, b) );
+    }
+    for ( ; w < nWords; w++ )
+        pOut[w] = (pIn0[w] ^ Diff0) & (pIn1[w] ^ Diff1);
+}
+// the NPN kernels are not provided for AVX2, where the lack of unsigned 64-bit
+// minimum and of masked moves makes them slower than the scalar code
+static const Abc_SimdKernels_t s_SimdAvx2 = { ABC_SIMD_AVX2, Abc_SimdAndAvx2, Abc_SimdAnd32Avx2, Abc_SimdXorAvx2, Abc_SimdMuxAvx2, NULL, NULL };
+
+/**Function*************************************************************
+
+  Synopsis    [AVX-512 kernels.]
+
+  Description [The MUX uses one ternary-logic instruction (0xCA = A ? B : C).]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+__attribute__((target("avx512f"))) static void Abc_SimdAndAvx512( word * pOut, word * pIn0, word * pIn1, word Diff0, word Diff1, int nWords )
+{
+    __m512i d0 = _mm512_set1_epi64( (long long)Diff0 );
+    __m512i d1 = _mm512_set1_epi64( (long long)Diff1 );
+    int w = 0;
+    for ( ; w + 8 <= nWords; w += 8 )
+    {
+        __m512i a = _mm512_xor_si512( _mm512_loadu_si512((const void *)(pIn0 + w)), d0 );
+        __m512i b = _mm512_xor_si512( _mm512_loadu_si512((const void *)(pIn1 + w)), d1 );
+        _mm512_storeu_si512( (void *)(pOut + w), _mm512_and_si512(a, b) );
+    }
+    for ( ; w < nWords; w++ )
+        pOut[w] = (pIn0[w] ^ Diff0) & (pIn1[w] ^ Diff1);
+}
+__attribute__((target("avx512f"))) static void Abc_SimdAnd32Avx512( unsigned * pOut, unsigned * pIn0, unsigned * pIn1, unsigned Diff0, unsigned Diff1, int nWords )
+{
+    __m512i d0 = _mm512_set1_epi32( (int)Diff0 );
+    __m512i d1 = _mm512_set1_epi32( (int)Diff1 );
+    int w = 0;
+    for ( ; w + 16 <= nWords; w += 16 )
+    {
+        __m512i a = _mm512_xor_si512( _mm512_loadu_si512((const void *)(pIn0 + w)), d0 );
+        __m512i b = _mm512_xor_si512( _mm512_loadu_si512((const void *)(pIn1 + w)), d1 );
+        _mm512_storeu_si512( (void *)(pOut + w), _mm512_and_si512(a, b) );
+    }
+    for ( ; w < nWords; w++ )
+        pOut[w] = (pIn0[w] ^ Diff0) & (pIn1[w] ^ Diff1);
+}
+__attribute__((target("avx512f"))) static void Abc_SimdXorAvx512( word * pOut, word * pIn0, word * pIn1, word Diff0, word Diff1, int nWords )
+{
+    __m512i d = _mm512_set1_epi64( (long long)(Diff0 ^ Diff1) );
+    int w = 0;
+    for ( ; w + 8 <= nWords; w += 8 )
+    {
+        __m512i a = _mm512_loadu_si512( (const void *)(pIn0 + w) );
+        __m512i b = _mm512_loadu_si512( (const void *)(pIn1 + w) );
+        _mm512_storeu_si512( (void *)(pOut + w), _mm512_ternarylogic_epi64(a, b, d, 0x96) );
+    }
+    for ( ; w < nWords; w++ )
+        pOut[w] = (pIn0[w] ^ Diff0) ^ (pIn1[w] ^ Diff1);
+}
+__attribute__((target("avx512f"))) static void Abc_SimdMuxAvx512( word * pOut, word * pCtrl, word * pIn1, word * pIn0, word Diff1, word Diff0, int nWords )
+{
+    __m512i d0 = _mm512_set1_epi64( (long long)Diff0 );
+    __m512i d1 = _mm512_set1_epi64( (long long)Diff1 );
+    int w = 0;
+    for ( ; w + 8 <= nWords; w += 8 )
+    {
+        __m512i c = _mm512_loadu_si512( (const void *)(pCtrl + w) );
+        __m512i a = _mm512_xor_si512( _mm512_loadu_si512((const void *)(pIn1 + w)), d1 );
+        __m512i b = _mm512_xor_si512( _mm512_loadu_si512((const void *)(pIn0 + w)), d0 );
+        _mm512_storeu_si512( (void *)(pOut + w), _mm512_ternarylogic_epi64(c, a, b, 0xCA) );
+    }
+    for ( ; w < nWords; w++ )
+        pOut[w] = (pCtrl[w] & (pIn1[w] ^ Diff1)) | (~pCtrl[w] & (pIn0[w] ^ Diff0));
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Finds the best phase/swap configuration of two adjacent variables.]
+
+  Description [Vectorized version of Abc_Tt6CofactorPermNaive(): the eight
+  configurations of variables iVar and iVar+1 of the 6-input function are
+  evaluated in one register and the smallest truth table is selected.
+  Lane k holds configuration k ^ (k >> 1), which is the order in which the
+  scalar code visits them, so the first minimal lane breaks the ties the
+  same way. Configuration bits are 1 (flip iVar), 2 (flip iVar+1) and 4
+  (swap iVar and iVar+1 after the flips). Replaces the truth table by the
+  best one and returns its configuration.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+__attribute__((target("avx512f"))) static int Abc_SimdTt6PermAvx512( word * pTruth, int iVar )
+{
+    __m128i s0 = _mm_cvtsi32_si128( 1 << iVar );
+    __m128i s1 = _mm_cvtsi32_si128( 2 << iVar );
+    __m512i m0 = _mm512_set1_epi64( (long long)s_Truths6[iVar] );
+    __m512i m1 = _mm512_set1_epi64( (long long)s_Truths6[iVar+1] );
+    __m512i t  = _mm512_set1_epi64( (long long)pTruth[0] );
+    __m512i f;
+    word Best;
+    int Lane;
+    // flip iVar in lanes 1, 2, 5, 6 (configurations 1, 3, 7, 5)
+    f = _mm512_ternarylogic_epi64( _mm512_sll_epi64(t, s0), m0, _mm512_srl_epi64(_mm512_and_si512(t, m0), s0), 0xEA );
+    t = _mm512_mask_mov_epi64( t, 0x66, f );
+    // flip iVar+1 in lanes 2, 3, 4, 5 (configurations 3, 2, 6, 7)
+    f = _mm512_ternarylogic_epi64( _mm512_sll_epi64(t, s1), m1, _mm512_srl_epi64(_mm512_and_si512(t, m1), s1), 0xEA );
+    t = _mm512_mask_mov_epi64( t, 0x3C, f );
+    // swap the variables in lanes 4, 5, 6, 7 (configurations 6, 7, 5, 4)
+    f = _mm512_or_si512( _mm512_and_si512(t, _mm512_set1_epi64((long long)s_PMasks[iVar][0])),
+        _mm512_or_si512( _mm512_sll_epi64(_mm512_and_si512(t, _mm512_set1_epi64((long long)s_PMasks[iVar][1])), s0),
+                         _mm512_srl_epi64(_mm512_and_si512(t, _mm512_set1_epi64((long long)s_PMasks[iVar][2])), s0) ) );
+    t = _mm512_mask_mov_epi64( t, 0xF0, f );
+    // select the first smallest lane
+    Best = (word)_mm512_reduce_min_epu64( t );
+    Lane = __builtin_ctz( (unsigned)_mm512_cmpeq_epu64_mask(t, _mm512_set1_epi64((long long)Best)) );
+    pTruth[0] = Best;
+    return Lane ^ (Lane >> 1);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Counts ones in the 6-input function and its negative cofactors.]
+
+  Description [Vectorized version of Abc_TtCountOnesInCofs() for one word:
+  lane i < 6 holds the negative cofactor of variable i and lane 6 holds the
+  function, and the ones are counted in all lanes at once. Writes the
+  counts of the cofactors into pStore[0..5] and returns the count of the
+  function.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+__attribute__((target("avx512f"))) static int Abc_SimdTt6CountAvx512( word Truth, int * pStore )
+{
+    __m512i m = _mm512_set_epi64( 0, ~(long long)0, (long long)s_Truths6Neg[5], (long long)s_Truths6Neg[4],
+        (long long)s_Truths6Neg[3], (long long)s_Truths6Neg[2], (long long)s_Truths6Neg[1], (long long)s_Truths6Neg[0] );
+    __m512i x = _mm512_and_si512( _mm512_set1_epi64((long long)Truth), m );
+    int Counts[8];
+    x = _mm512_sub_epi64( x, _mm512_and_si512(_mm512_srli_epi64(x, 1), _mm512_set1_epi64(ABC_CONST(0x5555555555555555))) );
+    x = _mm512_add_epi64( _mm512_and_si512(x, _mm512_set1_epi64(ABC_CONST(0x3333333333333333))),
+                          _mm512_and_si512(_mm512_srli_epi64(x, 2), _mm512_set1_epi64(ABC_CONST(0x3333333333333333))) );
+    x = _mm512_and_si512( _mm512_add_epi64(x, _mm512_srli_epi64(x, 4)), _mm512_set1_epi64(ABC_CONST(0x0F0F0F0F0F0F0F0F)) );
+    x = _mm512_add_epi64( x, _mm512_srli_epi64(x, 8) );
+    x = _mm512_add_epi64( x, _mm512_srli_epi64(x, 16) );
+    x = _mm512_add_epi64( x, _mm512_srli_epi64(x, 32) );
+    x = _mm512_and_si512( x, _mm512_set1_epi64(0xFF) );
+    _mm256_storeu_si256( (__m256i *)Counts, _mm512_cvtepi64_epi32(x) );
+    memcpy( pStore, Counts, sizeof(int) * 6 );
+    return Counts[6];
+}
+static const Abc_SimdKernels_t s_SimdAvx512 = { ABC_SIMD_AVX512, Abc_SimdAndAvx512, Abc_SimdAnd32Avx512, Abc_SimdXorAvx512, Abc_SimdMuxAvx512, Abc_SimdTt6PermAvx512, Abc_SimdTt6CountAvx512 };
+
+#endif // ABC_SIMD_X86
+
+/**Function*************************************************************
+
+  Synopsis    [Detects the CPU and selects the best kernels.]
+
+  Description [Runs once per process, even if several threads ask for
+  the kernels at the same time.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_SimdInit()
+{
+    s_SimdLevelMax = ABC_SIMD_NONE;
+    s_pSimdKernels = &s_SimdScalar;
+#ifdef ABC_SIMD_X86
+    __builtin_cpu_init();
+    if ( __builtin_cpu_supports("avx512f") )
+        s_SimdLevelMax = ABC_SIMD_AVX512, s_pSimdKernels = &s_SimdAvx512;
+    else if ( __builtin_cpu_supports("avx2") )
+        s_SimdLevelMax = ABC_SIMD_AVX2, s_pSimdKernels = &s_SimdAvx2;
+#endif
+}
+static inline void Abc_SimdInitOnce()
+{
+#ifdef ABC_USE_PTHREADS
+    pthread_once( &s_SimdOnce, Abc_SimdInit );
+#else
+    if ( s_pSimdKernels == NULL )
+        Abc_SimdInit();
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the best instruction set supported by this CPU.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_SimdLevel_t Abc_SimdDetect()
+{
+    Abc_SimdInitOnce();
+    return s_SimdLevelMax;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Selects the kernels.]
+
+  Description [The requested level is reduced to what the CPU supports.
+  Returns the level actually selected. Should not be called while other
+  threads are using the kernels.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_SimdLevel_t Abc_SimdSetLevel( Abc_SimdLevel_t Level )
+{
+    if ( Level > Abc_SimdDetect() )
+        Level = Abc_SimdDetect();
+#ifdef ABC_SIMD_X86
+    if ( Level == ABC_SIMD_AVX512 )
+        s_pSimdKernels = &s_SimdAvx512;
+    else if ( Level == ABC_SIMD_AVX2 )
+        s_pSimdKernels = &s_SimdAvx2;
+    else
+#endif
+        s_pSimdKernels = &s_SimdScalar;
+    return s_pSimdKernels->Level;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the selected kernels.]
+
+  Description [Passes should look up the kernels once, outside of their
+  inner loops.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+const Abc_SimdKernels_t * Abc_SimdKernels()
+{
+    Abc_SimdInitOnce();
+    return s_pSimdKernels;
+}
+Abc_SimdLevel_t Abc_SimdLevel()
+{
+    return Abc_SimdKernels()->Level;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -0,0 +1,148 @@
+/**CFile****************************************************************
+
+  FileName    [utilSimd.h]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Word-level SIMD kernels for bit-parallel simulation.]
+
+  Synopsis    [Word-level SIMD kernels for bit-parallel simulation.]
+
+  Author      [agent <agent@local>]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: utilSimd.h,v 1.00 2026/10/17 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#ifndef ABC__misc__util__utilSimd_h
+#define ABC__misc__util__utilSimd_h
+
+////////////////////////////////////////////////////////////////////////
+///                          INCLUDES                                ///
+////////////////////////////////////////////////////////////////////////
+
+#include "misc/util/abc_global.h"
+
+////////////////////////////////////////////////////////////////////////
+///                         PARAMETERS                               ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_HEADER_START
+
+// the instruction set used by the kernels
+typedef enum {
+    ABC_SIMD_NONE = 0,  // portable scalar code
+    ABC_SIMD_AVX2,      // 256-bit AVX2
+    ABC_SIMD_AVX512     // 512-bit AVX-512F
+} Abc_SimdLevel_t;
+
+// arrays shorter than this are processed by the inlined scalar code
+#define ABC_SIMD_MIN_WORDS  4
+
+////////////////////////////////////////////////////////////////////////
+///                         BASIC TYPES                              ///
+////////////////////////////////////////////////////////////////////////
+
+typedef void (*Abc_SimdBinary_t)( word * pOut, word * pIn0, word * pIn1, word Diff0, word Diff1, int nWords );
+typedef void (*Abc_SimdBinary32_t)( unsigned * pOut, unsigned * pIn0, unsigned * pIn1, unsigned Diff0, unsigned Diff1, int nWords );
+typedef void (*Abc_SimdTernary_t)( word * pOut, word * pCtrl, word * pIn1, word * pIn0, word Diff1, word Diff0, int nWords );
+typedef int  (*Abc_SimdTt6Perm_t)( word * pTruth, int iVar );
+typedef int  (*Abc_SimdTt6Count_t)( word Truth, int * pStore );
+
+typedef struct Abc_SimdKernels_t_ Abc_SimdKernels_t;
+struct Abc_SimdKernels_t_
+{
+    Abc_SimdLevel_t      Level;   // the instruction set of these kernels
+    Abc_SimdBinary_t     pAnd;    // pOut = (pIn0 ^ Diff0) & (pIn1 ^ Diff1)
+    Abc_SimdBinary32_t   pAnd32;  // the same over arrays of 32-bit words
+    Abc_SimdBinary_t     pXor;    // pOut = (pIn0 ^ Diff0) ^ (pIn1 ^ Diff1)
+    Abc_SimdTernary_t    pMux;    // pOut = pCtrl ? (pIn1 ^ Diff1) : (pIn0 ^ Diff0)
+    Abc_SimdTt6Perm_t    pTt6Perm;// the best phase/swap of variables iVar and iVar+1 (NULL if not faster than scalar code)
+    Abc_SimdTt6Count_t   pTt6Count;// the number of ones in the function and in its negative cofactors (NULL, as above)
+};
+
+////////////////////////////////////////////////////////////////////////
+///                      MACRO DEFINITIONS                           ///
+////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////
+///                    FUNCTION DECLARATIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/*=== utilSimd.c ==========================================================*/
+extern Abc_SimdLevel_t           Abc_SimdDetect();
+extern Abc_SimdLevel_t           Abc_SimdLevel();
+extern Abc_SimdLevel_t           Abc_SimdSetLevel( Abc_SimdLevel_t Level );
+extern const Abc_SimdKernels_t * Abc_SimdKernels();
+
+/**Function*************************************************************
+
+  Synopsis    [Complemented-AND, XOR and MUX over arrays of words.]
+
+  Description [Short arrays are handled inline, to avoid the indirect call;
+  longer ones are passed to the kernel selected at runtime by CPUID.
+  The caller looks up the kernels with Abc_SimdKernels() once per pass.
+  Diff0/Diff1 are either 0 or ~0 and complement the corresponding input.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Abc_SimdAnd( const Abc_SimdKernels_t * pKer, word * pOut, word * pIn0, word * pIn1, word Diff0, word Diff1, int nWords )
+{
+    int w;
+    if ( nWords >= ABC_SIMD_MIN_WORDS )
+    {
+        pKer->pAnd( pOut, pIn0, pIn1, Diff0, Diff1, nWords );
+        return;
+    }
+    for ( w = 0; w < nWords; w++ )
+        pOut[w] = (pIn0[w] ^ Diff0) & (pIn1[w] ^ Diff1);
+}
+static inline void Abc_SimdXor( const Abc_SimdKernels_t * pKer, word * pOut, word * pIn0, word * pIn1, word Diff0, word Diff1, int nWords )
+{
+    int w;
+    if ( nWords >= ABC_SIMD_MIN_WORDS )
+    {
+        pKer->pXor( pOut, pIn0, pIn1, Diff0, Diff1, nWords );
+        return;
+    }
+    for ( w = 0; w < nWords; w++ )
+        pOut[w] = (pIn0[w] ^ Diff0) ^ (pIn1[w] ^ Diff1);
+}
+static inline void Abc_SimdMux( const Abc_SimdKernels_t * pKer, word * pOut, word * pCtrl, word * pIn1, word * pIn0, word Diff1, word Diff0, int nWords )
+{
+    int w;
+    if ( nWords >= ABC_SIMD_MIN_WORDS )
+    {
+        pKer->pMux( pOut, pCtrl, pIn1, pIn0, Diff1, Diff0, nWords );
+        return;
+    }
+    for ( w = 0; w < nWords; w++ )
+        pOut[w] = (pCtrl[w] & (pIn1[w] ^ Diff1)) | (~pCtrl[w] & (pIn0[w] ^ Diff0));
+}
+static inline void Abc_SimdAnd32( const Abc_SimdKernels_t * pKer, unsigned * pOut, unsigned * pIn0, unsigned * pIn1, unsigned Diff0, unsigned Diff1, int nWords )
+{
+    int w;
+    if ( nWords >= 2 * ABC_SIMD_MIN_WORDS )
+    {
+        pKer->pAnd32( pOut, pIn0, pIn1, Diff0, Diff1, nWords );
+        return;
+    }
+    for ( w = 0; w < nWords; w++ )
+        pOut[w] = (pIn0[w] ^ Diff0) & (pIn1[w] ^ Diff1);
+}
+
+ABC_NAMESPACE_HEADER_END
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
@@ -43,6 +43,12 @@ ABC_NAMESPACE_HEADER_START
 ///                         PARAMETERS                               ///
 ////////////////////////////////////////////////////////////////////////
 
+#if defined(__GNUC__) || defined(__clang__)
+#define VEC_MEM_PREFETCH(p)  __builtin_prefetch(p)
+#else
+#define VEC_MEM_PREFETCH(p)
+#endif
+
 ////////////////////////////////////////////////////////////////////////
 ///                         BASIC TYPES                              ///
 ////////////////////////////////////////////////////////////////////////
@@ -56,6 +62,7 @@ struct Vec_Mem_t_
     int              PageMask;    // page mask
     int              nPageAlloc;  // number of pages currently allocated
     int              iPage;       // the number of a page currently used   
+    int              fPagesFixed; // page pointers are reserved and never reallocated
     word **          ppPages;     // memory pages
     Vec_Int_t *      vTable;      // hash table
     Vec_Int_t *      vNexts;      // next pointers
@@ -67,6 +74,8 @@ struct Vec_Mem_t_
 
 #define Vec_MemForEachEntry( p, pEntry, i )                                              \
     for ( i = 0; (i < Vec_MemEntryNum(p)) && ((pEntry) = Vec_MemReadEntry(p, i)); i++ )
+#define Vec_MemForEachEntryStart( p, pEntry, i, Start )                                  \
+    for ( i = Start; (i < Vec_MemEntryNum(p)) && ((pEntry) = Vec_MemReadEntry(p, i)); i++ )
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -102,6 +111,30 @@ static inline Vec_Mem_t * Vec_MemAlloc( int nEntrySize, int LogPageSze )
     p->iPage      = -1;
     return p;
 }
+static inline void Vec_MemReservePages( Vec_Mem_t * p, int nPageAlloc )
+{
+    // page pointers are not reallocated while the page count stays below nPageAlloc,
+    // so that entries can be read while new ones are added under a lock
+    p->fPagesFixed = 1;
+    if ( p->nPageAlloc >= nPageAlloc )
+        return;
+    p->ppPages = ABC_REALLOC( word *, p->ppPages, nPageAlloc );
+    memset( p->ppPages + p->nPageAlloc, 0, sizeof(word *) * (size_t)(nPageAlloc - p->nPageAlloc) );
+    p->nPageAlloc = nPageAlloc;
+}
+static inline void Vec_MemReserveEntries( Vec_Mem_t * p, int nEntries )
+{
+    // may move the page pointers, so it is called when nobody reads the table
+    Vec_MemReservePages( p, ((p->nEntries + nEntries) >> p->LogPageSze) + 1 );
+}
+static inline void Vec_MemUnfixPages( Vec_Mem_t * p )
+{
+    p->fPagesFixed = 0;
+}
+static inline int Vec_MemIsFull( Vec_Mem_t * p )
+{
+    return p->fPagesFixed && (p->nEntries >> p->LogPageSze) >= p->nPageAlloc;
+}
 static inline void Vec_MemFree( Vec_Mem_t * p )
 {
     int i;
@@ -184,6 +217,11 @@ static inline double Vec_MemMemory( Vec_Mem_t * p )
 {
     return (double)sizeof(word) * p->nEntrySize * (1 << p->LogPageSze) * (p->iPage + 1) + (double)sizeof(word *) * p->nPageAlloc + (double)sizeof(Vec_Mem_t);
 }
+static inline double Vec_MemMemoryFrom( Vec_Mem_t * p, int iStart )
+{
+    assert( iStart >= 0 && iStart <= p->nEntries );
+    return (double)sizeof(word) * p->nEntrySize * (p->nEntries - iStart);
+}
 
 /**Function*************************************************************
 
@@ -219,6 +257,9 @@ static inline word * Vec_MemGetEntry( Vec_Mem_t * p, int i )
         int k, iPageNew = (i >> p->LogPageSze);
         if ( p->iPage < iPageNew )
         {
+            // the readers do not lock the table, so the reserved page pointers cannot move
+            if ( iPageNew >= p->nPageAlloc && p->fPagesFixed )
+                return NULL;
             // realloc page pointers if needed
             if ( iPageNew >= p->nPageAlloc )
                 p->ppPages = ABC_REALLOC( word *, p->ppPages, (p->nPageAlloc = p->nPageAlloc ? 2 * p->nPageAlloc : iPageNew + 32) );
@@ -236,11 +277,13 @@ static inline word * Vec_MemGetEntry( Vec_Mem_t * p, int i )
 static inline void Vec_MemSetEntry( Vec_Mem_t * p, int i, word * pEntry )
 {
     word * pPlace = Vec_MemGetEntry( p, i );
+    assert( pPlace != NULL );
     memmove( pPlace, pEntry, sizeof(word) * (size_t)p->nEntrySize );
 }
 static inline void Vec_MemPush( Vec_Mem_t * p, word * pEntry )
 {
     word * pPlace = Vec_MemGetEntry( p, p->nEntries );
+    assert( pPlace != NULL );
     memmove( pPlace, pEntry, sizeof(word) * (size_t)p->nEntrySize );
 }
 
@@ -284,13 +327,13 @@ static inline void Vec_MemDumpDigit( FILE * pFile, int HexDigit )
     else
         fprintf( pFile, "%c", 'A' + HexDigit-10 );
 }
-static inline void Vec_MemDump( FILE * pFile, Vec_Mem_t * pVec )
+static inline void Vec_MemDumpFrom( FILE * pFile, Vec_Mem_t * pVec, int iStart )
 {
     word * pEntry;
     int i, w, d;
     if ( pFile == stdout )
-        printf( "Memory vector has %d entries: \n", Vec_MemEntryNum(pVec) );
-    Vec_MemForEachEntry( pVec, pEntry, i )
+        printf( "Memory vector has %d entries: \n", Vec_MemEntryNum(pVec) - iStart );
+    Vec_MemForEachEntryStart( pVec, pEntry, i, iStart )
     {
         for ( w = pVec->nEntrySize - 1; w >= 0; w-- )
             for ( d = 15; d >= 0; d-- )
@@ -298,6 +341,10 @@ static inline void Vec_MemDump( FILE * pFile, Vec_Mem_t * pVec )
         fprintf( pFile, "\n" );
     }
 }
+static inline void Vec_MemDump( FILE * pFile, Vec_Mem_t * pVec )
+{
+    Vec_MemDumpFrom( pFile, pVec, 0 );
+}
 
 /**Function*************************************************************
 
@@ -333,14 +380,18 @@ static inline unsigned Vec_MemHashKey( Vec_Mem_t * p, word * pEntry )
         uHash += pData[i] * s_Primes[i & 0x7];
     return uHash % Vec_IntSize(p->vTable);
 }
-static int * Vec_MemHashLookup( Vec_Mem_t * p, word * pEntry )
+static int * Vec_MemHashLookupKey( Vec_Mem_t * p, word * pEntry, unsigned Key )
 {
-    int * pSpot = Vec_IntEntryP( p->vTable, Vec_MemHashKey(p, pEntry) );
+    int * pSpot = Vec_IntEntryP( p->vTable, Key );
     for ( ; *pSpot != -1; pSpot = Vec_IntEntryP(p->vNexts, *pSpot) )
         if ( !memcmp( Vec_MemReadEntry(p, *pSpot), pEntry, sizeof(word) * p->nEntrySize ) ) // equal
             return pSpot;
     return pSpot;
 }
+static int * Vec_MemHashLookup( Vec_Mem_t * p, word * pEntry )
+{
+    return Vec_MemHashLookupKey( p, pEntry, Vec_MemHashKey(p, pEntry) );
+}
 static void Vec_MemHashProfile( Vec_Mem_t * p )
 {
     int e;
@@ -378,6 +429,9 @@ static int Vec_MemHashInsert( Vec_Mem_t * p, word * pEntry )
     pSpot = Vec_MemHashLookup( p, pEntry );
     if ( *pSpot != -1 )
         return *pSpot;
+    // a new entry is not added when the reserved pages are used up
+    if ( Vec_MemIsFull(p) )
+        return -1;
     *pSpot = Vec_IntSize(p->vNexts);
     Vec_IntPush( p->vNexts, -1 );
     Vec_MemPush( p, pEntry );
@@ -385,6 +439,60 @@ static int Vec_MemHashInsert( Vec_Mem_t * p, word * pEntry )
     return Vec_IntSize(p->vNexts) - 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Adds several entries to the hash table.]
+
+  Description [Same as calling Vec_MemHashInsert() for each entry in turn,
+  but the hash keys of a group of entries are computed first and their 
+  bins are prefetched, so that the cache misses of the lookups overlap.
+  Writes the entry IDs into pIds, or -1 for the new entries that did not
+  fit into the reserved pages.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Vec_MemHashInsertBatch( Vec_Mem_t * p, word ** ppEntries, int nEntries, int * pIds )
+{
+    unsigned pKeys[16];
+    int i, k, n, * pSpot;
+    for ( i = 0; i < nEntries; i += n )
+    {
+        n = Abc_MinInt( 16, nEntries - i );
+        // resize in advance so that the keys remain valid for the whole group
+        while ( p->nEntries + n > Vec_IntSize(p->vTable) )
+            Vec_MemHashResize( p );
+        for ( k = 0; k < n; k++ )
+        {
+            pKeys[k] = Vec_MemHashKey( p, ppEntries[i+k] );
+            VEC_MEM_PREFETCH( Vec_IntEntryP(p->vTable, pKeys[k]) );
+        }
+        for ( k = 0; k < n; k++ )
+            if ( Vec_IntEntry(p->vTable, pKeys[k]) >= 0 )
+                VEC_MEM_PREFETCH( Vec_MemReadEntry(p, Vec_IntEntry(p->vTable, pKeys[k])) );
+        for ( k = 0; k < n; k++ )
+        {
+            pSpot = Vec_MemHashLookupKey( p, ppEntries[i+k], pKeys[k] );
+            if ( *pSpot != -1 )
+            {
+                pIds[i+k] = *pSpot;
+                continue;
+            }
+            if ( Vec_MemIsFull(p) )
+            {
+                pIds[i+k] = -1;
+                continue;
+            }
+            pIds[i+k] = *pSpot = Vec_IntSize(p->vNexts);
+            Vec_IntPush( p->vNexts, -1 );
+            Vec_MemPush( p, ppEntries[i+k] );
+        }
+    }
+    assert( p->nEntries == Vec_IntSize(p->vNexts) );
+}
+
 
 /**Function*************************************************************
 
@@ -428,18 +536,22 @@ static inline void Vec_MemAddMuxTT( Vec_Mem_t * p, int nVars )
     Value = Vec_MemHashInsert( p, uTruth ); assert( Value == 2 );
     ABC_FREE( uTruth );
 }
-static inline void Vec_MemDumpTruthTables( Vec_Mem_t * p, char * pName, int nLutSize )
+static inline void Vec_MemDumpTruthTablesFrom( Vec_Mem_t * p, char * pName, int nLutSize, int iStart )
 {
     FILE * pFile;
     char pFileName[1000];
     sprintf( pFileName, "tt_%s_%02d.txt", pName ? pName : NULL, nLutSize );
     pFile = pName ? fopen( pFileName, "wb" ) : stdout;
-    Vec_MemDump( pFile, p );
+    Vec_MemDumpFrom( pFile, p, iStart );
     if ( pFile != stdout )
         fclose( pFile );
     printf( "Dumped %d %d-var truth tables into file \"%s\" (%.2f MB).\n", 
-        Vec_MemEntryNum(p), nLutSize, pName ? pFileName : "stdout",
-        8.0 * Vec_MemEntryNum(p) * Vec_MemEntrySize(p) / (1 << 20) );
+        Vec_MemEntryNum(p) - iStart, nLutSize, pName ? pFileName : "stdout",
+        8.0 * (Vec_MemEntryNum(p) - iStart) * Vec_MemEntrySize(p) / (1 << 20) );
+}
+static inline void Vec_MemDumpTruthTables( Vec_Mem_t * p, char * pName, int nLutSize )
+{
+    Vec_MemDumpTruthTablesFrom( p, pName, nLutSize, 0 );
 }
 
 ABC_NAMESPACE_HEADER_END
@@ -130,6 +130,8 @@ extern void             Cut_ManSetNodeAttrs( Cut_Man_t * p, Vec_Int_t * vFanCoun
 extern int              Cut_ManReadVarsMax( Cut_Man_t * p );
 extern Cut_Params_t *   Cut_ManReadParams( Cut_Man_t * p );
 extern Vec_Int_t *      Cut_ManReadNodeAttrs( Cut_Man_t * p );
+extern int              Cut_ManReadCutsNum( Cut_Man_t * p );
+extern double           Cut_ManReadMemPeak( Cut_Man_t * p );
 extern void             Cut_ManIncrementDagNodes( Cut_Man_t * p );
 /*=== cutNode.c ==========================================================*/
 extern Cut_Cut_t *      Cut_NodeComputeCuts( Cut_Man_t * p, int Node, int Node0, int Node1, int fCompl0, int fCompl1, int fTriv, int TreeCode ); 
@@ -295,6 +295,38 @@ Vec_Int_t * Cut_ManReadNodeAttrs( Cut_Man_t * p )
     return p->vNodeAttrs;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Returns the number of non-trivial cuts currently stored.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cut_ManReadCutsNum( Cut_Man_t * p )
+{
+    return p->nCutsCur - p->nCutsTriv;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the peak memory used by the cuts in bytes.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+double Cut_ManReadMemPeak( Cut_Man_t * p )
+{
+    return (double)p->nCutsPeak * p->EntrySize;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -42,6 +42,7 @@ ABC_NAMESPACE_HEADER_START
 #define DAU_MAX_VAR    12 // should be 6 or more
 #define DAU_MAX_STR  2000
 #define DAU_MAX_WORD  (1<<(DAU_MAX_VAR-6))
+#define DAU_STORE_VAR_MAX 16 // the max number of variables in the truth-table store
 
 ////////////////////////////////////////////////////////////////////////
 ///                         BASIC TYPES                              ///
@@ -60,6 +61,16 @@ typedef enum {
 
 typedef struct Dss_Man_t_ Dss_Man_t;
 typedef struct Abc_TtHieMan_t_ Abc_TtHieMan_t;
+typedef struct Dau_TtStore_t_ Dau_TtStore_t;
+typedef struct Dau_NpnCache_t_ Dau_NpnCache_t;
+
+// canonicizers whose results are kept in the persistent NPN cache
+typedef enum { 
+    DAU_NPN_ABC = 0,       // 0:  Abc_TtCanonicize()
+    DAU_NPN_LUCKY,         // 1:  luckyCanonicizer_final_fast()
+    DAU_NPN_LUCKY1,        // 2:  luckyCanonicizer_final_fast1()
+    DAU_NPN_TYPES          // 3:  the number of canonicizers
+} Dau_NpnType_t;
 typedef unsigned(*TtCanonicizeFunc)(Abc_TtHieMan_t * p, word * pTruth, int nVars, char * pCanonPerm, int flag);
 
 ////////////////////////////////////////////////////////////////////////
@@ -117,6 +128,28 @@ extern void          Dau_DecSortSet( unsigned set, int nVars, int * pnUnique, in
 extern void          Dau_DecPrintSets( Vec_Int_t * vSets, int nVars );
 extern void          Dau_DecPrintSet( unsigned set, int nVars, int fNewLine );
 
+/*=== dauCache.c  ==========================================================*/
+extern Dau_NpnCache_t * Dau_NpnCacheStart( char * pFileName );
+extern void          Dau_NpnCacheStop( Dau_NpnCache_t * p );
+extern char *        Dau_NpnCacheFileName( Dau_NpnCache_t * p );
+extern int           Dau_NpnCacheEntryNum( Dau_NpnCache_t * p, int fNew );
+extern unsigned      Dau_NpnCacheCanonicize( Dau_NpnCache_t * p, int Type, word * pTruth, int nVars, char * pCanonPerm );
+extern int           Dau_NpnCacheWrite( Dau_NpnCache_t * p );
+extern void          Dau_NpnCachePrintStats( Dau_NpnCache_t * p );
+/*=== dauStore.c  ==========================================================*/
+extern Dau_TtStore_t * Dau_TtStoreStart();
+extern void          Dau_TtStoreStop( Dau_TtStore_t * p );
+extern void          Dau_TtStoreSetCache( Dau_TtStore_t * p, Dau_NpnCache_t * pCache );
+extern Vec_Mem_t *   Dau_TtStoreMem( Dau_TtStore_t * p, int nVars );
+extern Vec_Mem_t *   Dau_TtStoreMemDup( Dau_TtStore_t * p, int nVars );
+extern int           Dau_TtStoreInsert( Dau_TtStore_t * p, int nVars, word * pTruth );
+extern void          Dau_TtStoreInsertBatch( Dau_TtStore_t * p, int nVars, word ** ppTruths, int nTruths, int * pIds );
+extern int           Dau_TtStoreNpnClass( Dau_TtStore_t * p, int nVars, int iFunc, unsigned * puPhase, char * pPerm );
+extern int           Dau_TtStoreNpnClassNum( Dau_TtStore_t * p, int nVars );
+extern void          Dau_TtStoreNpnTruth( Dau_TtStore_t * p, int nVars, int iClass, word * pTruth );
+extern unsigned      Dau_TtStoreCanonicize( Dau_TtStore_t * p, word * pTruth, int nVars, char * pCanonPerm );
+extern void          Dau_TtStorePrintStats( Dau_TtStore_t * p );
+
 /*=== dauTree.c  ==========================================================*/
 extern Dss_Man_t *   Dss_ManAlloc( int nVars, int nNonDecLimit );
 extern void          Dss_ManFree( Dss_Man_t * p );
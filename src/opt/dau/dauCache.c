@@ -0,0 +1,560 @@
+/**CFile****************************************************************
+
+  FileName    [dauCache.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [DAG-aware unmapping.]
+
+  Synopsis    [Persistent cache of NPN canonical forms.]
+
+  Author      [agent <agent@local>]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: dauCache.c,v 1.00 2026/10/17 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#ifdef ABC_USE_PTHREADS
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+#endif
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include "dauInt.h"
+#include "misc/util/utilTruth.h"
+#include "bool/lucky/lucky.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The cache file contains the header, the table of sections and the records
+// of each section.  A section holds the records computed by one canonicizer
+// for the functions of one support size, sorted by the original truth table,
+// so that the records can be looked up in the mapped file without parsing.
+// A record is the original truth table, the canonical truth table, the phase
+// and the permutation (16 characters) returned by the canonicizer.
+
+#define DAU_NPN_MAGIC     "ABCNPN\n"   // the file signature (8 bytes with the terminating zero)
+#define DAU_NPN_VERSION   1            // the file format version
+
+typedef struct Dau_NpnHead_t_ Dau_NpnHead_t;
+struct Dau_NpnHead_t_
+{
+    char             Magic[8];    // file signature
+    int              Version;     // format version
+    int              nSections;   // the number of sections
+};
+
+typedef struct Dau_NpnSec_t_ Dau_NpnSec_t;
+struct Dau_NpnSec_t_
+{
+    int              Type;        // canonicizer (Dau_NpnType_t)
+    int              nVars;       // the number of variables
+    int              nEntries;    // the number of records
+    int              nRecWords;   // the record size in words
+    word             Offset;      // the offset of the first record in the file
+};
+
+struct Dau_NpnCache_t_
+{
+    char *           pFileName;   // the cache file
+    word *           pData;       // the contents of the file
+    size_t           nDataSize;   // the size of the contents in bytes
+    int              fMapped;     // the contents are mapped rather than read
+    word *           pRecs[DAU_NPN_TYPES][DAU_STORE_VAR_MAX+1]; // records from the file
+    int              nRecs[DAU_NPN_TYPES][DAU_STORE_VAR_MAX+1]; // the number of records from the file
+    Vec_Mem_t *      vKeys[DAU_NPN_TYPES][DAU_STORE_VAR_MAX+1]; // functions canonicized in this run
+    Vec_Wrd_t *      vData[DAU_NPN_TYPES][DAU_STORE_VAR_MAX+1]; // their records without the key
+    word             nLookups;    // the number of requests
+    word             nHitsFile;   // the number of requests answered from the file
+    word             nHitsNew;    // the number of requests answered from this run
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t  Mutex;       // protects the records of this run
+#endif
+};
+
+static inline int  Dau_NpnRecWords( int nVars )  { return 2 * Abc_TtWordNum(nVars) + 3; }
+
+static inline void Dau_NpnCacheLock( Dau_NpnCache_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock( &p->Mutex );
+#endif
+}
+static inline void Dau_NpnCacheUnlock( Dau_NpnCache_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_unlock( &p->Mutex );
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Compares two truth tables in the order of the records.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Dau_NpnCacheCompare( word * pTruth0, word * pTruth1, int nWords )
+{
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        if ( pTruth0[w] != pTruth1[w] )
+            return pTruth0[w] < pTruth1[w] ? -1 : 1;
+    return 0;
+}
+static Vec_Mem_t * s_vSortKeys = NULL;
+static int Dau_NpnCacheCompareIds( int * pId0, int * pId1 )
+{
+    return Dau_NpnCacheCompare( Vec_MemReadEntry(s_vSortKeys, *pId0), Vec_MemReadEntry(s_vSortKeys, *pId1), s_vSortKeys->nEntrySize );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Loads the cache file.]
+
+  Description [Maps the file into memory when possible and reads it
+  otherwise. The file is ignored with a warning if it is not a valid
+  cache file. Returns 1 if the records of the file can be used.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Dau_NpnCacheLoadData( Dau_NpnCache_t * p )
+{
+    FILE * pFile;
+    size_t nFileSize;
+#ifndef _WIN32
+    struct stat Stat;
+    int fd = open( p->pFileName, O_RDONLY );
+    if ( fd < 0 )
+        return 0;
+    if ( fstat( fd, &Stat ) == 0 && Stat.st_size > 0 )
+    {
+        void * pContents = mmap( NULL, (size_t)Stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+        if ( pContents != MAP_FAILED )
+        {
+            close( fd );
+            p->pData     = (word *)pContents;
+            p->nDataSize = (size_t)Stat.st_size;
+            p->fMapped   = 1;
+            return 1;
+        }
+    }
+    close( fd );
+#endif
+    // read the file if it cannot be mapped
+    pFile = fopen( p->pFileName, "rb" );
+    if ( pFile == NULL )
+        return 0;
+    fseek( pFile, 0, SEEK_END );
+    nFileSize = (size_t)ftell( pFile );
+    rewind( pFile );
+    p->pData = ABC_ALLOC( word, nFileSize / sizeof(word) + 1 );
+    if ( fread( p->pData, 1, nFileSize, pFile ) != nFileSize )
+    {
+        ABC_FREE( p->pData );
+        fclose( pFile );
+        return 0;
+    }
+    fclose( pFile );
+    p->nDataSize = nFileSize;
+    return 1;
+}
+static void Dau_NpnCacheFreeData( Dau_NpnCache_t * p )
+{
+    if ( p->pData == NULL )
+        return;
+#ifndef _WIN32
+    if ( p->fMapped )
+        munmap( (void *)p->pData, p->nDataSize );
+    else
+#endif
+        ABC_FREE( p->pData );
+    p->pData = NULL;
+    p->nDataSize = 0;
+    p->fMapped = 0;
+    memset( p->pRecs, 0, sizeof(p->pRecs) );
+    memset( p->nRecs, 0, sizeof(p->nRecs) );
+}
+static int Dau_NpnCacheLoad( Dau_NpnCache_t * p )
+{
+    Dau_NpnHead_t * pHead;
+    Dau_NpnSec_t * pSecs;
+    int i;
+    if ( !Dau_NpnCacheLoadData( p ) )
+        return 0;
+    pHead = (Dau_NpnHead_t *)p->pData;
+    if ( p->nDataSize < sizeof(Dau_NpnHead_t) || memcmp(pHead->Magic, DAU_NPN_MAGIC, 8) || pHead->Version != DAU_NPN_VERSION ||
+         pHead->nSections < 0 || p->nDataSize < sizeof(Dau_NpnHead_t) + sizeof(Dau_NpnSec_t) * (size_t)pHead->nSections )
+    {
+        printf( "Warning: File \"%s\" is not a valid NPN cache and will be overwritten.\n", p->pFileName );
+        Dau_NpnCacheFreeData( p );
+        return 0;
+    }
+    pSecs = (Dau_NpnSec_t *)(pHead + 1);
+    for ( i = 0; i < pHead->nSections; i++ )
+    {
+        Dau_NpnSec_t * pSec = pSecs + i;
+        if ( pSec->Type < 0 || pSec->Type >= DAU_NPN_TYPES || pSec->nVars < 0 || pSec->nVars > DAU_STORE_VAR_MAX ||
+             pSec->nRecWords != Dau_NpnRecWords(pSec->nVars) || pSec->nEntries < 0 || pSec->Offset % sizeof(word) != 0 ||
+             pSec->Offset > p->nDataSize || (p->nDataSize - pSec->Offset) / sizeof(word) / pSec->nRecWords < (size_t)pSec->nEntries )
+        {
+            printf( "Warning: File \"%s\" is not a valid NPN cache and will be overwritten.\n", p->pFileName );
+            Dau_NpnCacheFreeData( p );
+            return 0;
+        }
+        p->pRecs[pSec->Type][pSec->nVars] = p->pData + pSec->Offset / sizeof(word);
+        p->nRecs[pSec->Type][pSec->nVars] = pSec->nEntries;
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the cache.]
+
+  Description [The records of the file are loaded on start (the file may
+  not exist yet). The records computed in this run are written to the file
+  by Dau_NpnCacheWrite(), which is not called by Dau_NpnCacheStop().]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Dau_NpnCache_t * Dau_NpnCacheStart( char * pFileName )
+{
+    Dau_NpnCache_t * p = ABC_CALLOC( Dau_NpnCache_t, 1 );
+    p->pFileName = Abc_UtilStrsav( pFileName );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_init( &p->Mutex, NULL );
+#endif
+    Dau_NpnCacheLoad( p );
+    return p;
+}
+void Dau_NpnCacheStop( Dau_NpnCache_t * p )
+{
+    int t, v;
+    for ( t = 0; t < DAU_NPN_TYPES; t++ )
+    for ( v = 0; v <= DAU_STORE_VAR_MAX; v++ )
+    {
+        if ( p->vKeys[t][v] == NULL )
+            continue;
+        Vec_MemHashFree( p->vKeys[t][v] );
+        Vec_MemFree( p->vKeys[t][v] );
+        Vec_WrdFree( p->vData[t][v] );
+    }
+    Dau_NpnCacheFreeData( p );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_destroy( &p->Mutex );
+#endif
+    ABC_FREE( p->pFileName );
+    ABC_FREE( p );
+}
+char * Dau_NpnCacheFileName( Dau_NpnCache_t * p )
+{
+    return p->pFileName;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the number of records from the file or from this run.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Dau_NpnCacheEntryNum( Dau_NpnCache_t * p, int fNew )
+{
+    int t, v, Counter = 0;
+    Dau_NpnCacheLock( p );
+    for ( t = 0; t < DAU_NPN_TYPES; t++ )
+    for ( v = 0; v <= DAU_STORE_VAR_MAX; v++ )
+        Counter += fNew ? (p->vKeys[t][v] ? Vec_MemEntryNum(p->vKeys[t][v]) : 0) : p->nRecs[t][v];
+    Dau_NpnCacheUnlock( p );
+    return Counter;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Canonicizes the truth table using the cache.]
+
+  Description [Works as the canonicizer of the given type: replaces the
+  truth table by its canonical form, writes the permutation into pCanonPerm
+  and returns the phase. The canonicizer is called only for the functions
+  not found in the file or among the functions canonicized in this run.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static unsigned Dau_NpnCacheCompute( int Type, word * pTruth, int nVars, char * pCanonPerm )
+{
+    if ( Type == DAU_NPN_ABC )
+        return Abc_TtCanonicize( pTruth, nVars, pCanonPerm );
+    resetPCanonPermArray( pCanonPerm, nVars );
+    if ( Type == DAU_NPN_LUCKY )
+        return luckyCanonicizer_final_fast( pTruth, nVars, pCanonPerm );
+    assert( Type == DAU_NPN_LUCKY1 );
+    return luckyCanonicizer_final_fast1( pTruth, nVars, pCanonPerm );
+}
+static word * Dau_NpnCacheFind( Dau_NpnCache_t * p, int Type, word * pTruth, int nVars )
+{
+    int nWords = Abc_TtWordNum(nVars), nRecWords = Dau_NpnRecWords(nVars);
+    int iBeg = 0, iEnd = p->nRecs[Type][nVars];
+    // binary search among the records of the file
+    while ( iBeg < iEnd )
+    {
+        int iMid = iBeg + (iEnd - iBeg) / 2;
+        word * pRec = p->pRecs[Type][nVars] + (size_t)nRecWords * iMid;
+        int Value = Dau_NpnCacheCompare( pRec, pTruth, nWords );
+        if ( Value == 0 )
+            return pRec + nWords;
+        if ( Value < 0 )
+            iBeg = iMid + 1;
+        else
+            iEnd = iMid;
+    }
+    return NULL;
+}
+unsigned Dau_NpnCacheCanonicize( Dau_NpnCache_t * p, int Type, word * pTruth, int nVars, char * pCanonPerm )
+{
+    word pKey[1 << (DAU_STORE_VAR_MAX-6)], pPerm[2] = {0};
+    int nWords = Abc_TtWordNum(nVars), nRecWords = Dau_NpnRecWords(nVars);
+    word * pData;
+    unsigned uPhase;
+    int iFunc, * pSpot;
+    assert( Type >= 0 && Type < DAU_NPN_TYPES );
+    assert( nVars >= 0 && nVars <= DAU_STORE_VAR_MAX );
+    // look up the records of the file, which do not change
+    if ( (pData = Dau_NpnCacheFind(p, Type, pTruth, nVars)) )
+    {
+        Dau_NpnCacheLock( p );
+        p->nLookups++;
+        p->nHitsFile++;
+        Dau_NpnCacheUnlock( p );
+        Abc_TtCopy( pTruth, pData, nWords, 0 );
+        memcpy( pCanonPerm, pData + nWords + 1, (size_t)nVars );
+        return (unsigned)pData[nWords];
+    }
+    // look up the records of this run
+    Dau_NpnCacheLock( p );
+    p->nLookups++;
+    if ( p->vKeys[Type][nVars] && *(pSpot = Vec_MemHashLookup(p->vKeys[Type][nVars], pTruth)) != -1 )
+    {
+        pData = Vec_WrdEntryP( p->vData[Type][nVars], (nRecWords - nWords) * *pSpot );
+        Abc_TtCopy( pTruth, pData, nWords, 0 );
+        memcpy( pCanonPerm, pData + nWords + 1, (size_t)nVars );
+        uPhase = (unsigned)pData[nWords];
+        p->nHitsNew++;
+        Dau_NpnCacheUnlock( p );
+        return uPhase;
+    }
+    Dau_NpnCacheUnlock( p );
+    // compute the canonical form without holding the lock
+    Abc_TtCopy( pKey, pTruth, nWords, 0 );
+    uPhase = Dau_NpnCacheCompute( Type, pTruth, nVars, pCanonPerm );
+    memcpy( pPerm, pCanonPerm, (size_t)nVars );
+    // add the record unless another thread has added it meanwhile
+    Dau_NpnCacheLock( p );
+    if ( p->vKeys[Type][nVars] == NULL )
+    {
+        p->vKeys[Type][nVars] = Vec_MemAlloc( nWords, 12 );
+        Vec_MemHashAlloc( p->vKeys[Type][nVars], 1000 );
+        p->vData[Type][nVars] = Vec_WrdAlloc( 1000 );
+    }
+    iFunc = Vec_MemHashInsert( p->vKeys[Type][nVars], pKey );
+    if ( iFunc == Vec_MemEntryNum(p->vKeys[Type][nVars]) - 1 )
+    {
+        int w;
+        for ( w = 0; w < nWords; w++ )
+            Vec_WrdPush( p->vData[Type][nVars], pTruth[w] );
+        Vec_WrdPush( p->vData[Type][nVars], (word)uPhase );
+        Vec_WrdPush( p->vData[Type][nVars], pPerm[0] );
+        Vec_WrdPush( p->vData[Type][nVars], pPerm[1] );
+    }
+    Dau_NpnCacheUnlock( p );
+    return uPhase;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the records of the file and of this run into the file.]
+
+  Description [The records are merged in the sorted order and written into
+  a temporary file, which then replaces the cache file, so that the mapped
+  contents remain valid. Does nothing if no records were added in this run.
+  Returns 0 if the file cannot be written.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Dau_NpnCacheWrite( Dau_NpnCache_t * p )
+{
+    Dau_NpnHead_t Head;
+    Dau_NpnSec_t Secs[DAU_NPN_TYPES * (DAU_STORE_VAR_MAX+1)];
+    char * pFileTemp;
+    FILE * pFile;
+    word Offset;
+    int t, v, i, k, j, nSecs = 0, RetValue = 1;
+    if ( Dau_NpnCacheEntryNum(p, 1) == 0 )
+        return 1;
+    Dau_NpnCacheLock( p );
+    // collect the sections
+    memset( Secs, 0, sizeof(Secs) );
+    for ( t = 0; t < DAU_NPN_TYPES; t++ )
+    for ( v = 0; v <= DAU_STORE_VAR_MAX; v++ )
+    {
+        int nEntries = p->nRecs[t][v] + (p->vKeys[t][v] ? Vec_MemEntryNum(p->vKeys[t][v]) : 0);
+        if ( nEntries == 0 )
+            continue;
+        Secs[nSecs].Type      = t;
+        Secs[nSecs].nVars     = v;
+        Secs[nSecs].nEntries  = nEntries;
+        Secs[nSecs].nRecWords = Dau_NpnRecWords(v);
+        nSecs++;
+    }
+    Offset = sizeof(Dau_NpnHead_t) + sizeof(Dau_NpnSec_t) * nSecs;
+    for ( i = 0; i < nSecs; i++ )
+    {
+        Secs[i].Offset = Offset;
+        Offset += sizeof(word) * Secs[i].nRecWords * Secs[i].nEntries;
+    }
+    // write the file
+    pFileTemp = ABC_ALLOC( char, strlen(p->pFileName) + 10 );
+    sprintf( pFileTemp, "%s.tmp", p->pFileName );
+    pFile = fopen( pFileTemp, "wb" );
+    if ( pFile == NULL )
+    {
+        printf( "Cannot open file \"%s\" for writing.\n", pFileTemp );
+        ABC_FREE( pFileTemp );
+        Dau_NpnCacheUnlock( p );
+        return 0;
+    }
+    memset( &Head, 0, sizeof(Dau_NpnHead_t) );
+    memcpy( Head.Magic, DAU_NPN_MAGIC, 8 );
+    Head.Version   = DAU_NPN_VERSION;
+    Head.nSections = nSecs;
+    fwrite( &Head, sizeof(Dau_NpnHead_t), 1, pFile );
+    fwrite( Secs, sizeof(Dau_NpnSec_t), (size_t)nSecs, pFile );
+    for ( i = 0; i < nSecs; i++ )
+    {
+        int nVars = Secs[i].nVars, Type = Secs[i].Type;
+        int nWords = Abc_TtWordNum(nVars), nRecWords = Secs[i].nRecWords;
+        Vec_Mem_t * vKeys = p->vKeys[Type][nVars];
+        Vec_Int_t * vOrder = Vec_IntStartNatural( vKeys ? Vec_MemEntryNum(vKeys) : 0 );
+        word * pRecs = p->pRecs[Type][nVars];
+        // sort the records of this run
+        s_vSortKeys = vKeys;
+        if ( Vec_IntSize(vOrder) > 1 )
+            qsort( Vec_IntArray(vOrder), (size_t)Vec_IntSize(vOrder), sizeof(int), (int (*)(const void *, const void *))Dau_NpnCacheCompareIds );
+        s_vSortKeys = NULL;
+        // merge them with the records of the file
+        for ( k = j = 0; k < p->nRecs[Type][nVars] || j < Vec_IntSize(vOrder); )
+        {
+            word * pRec = k < p->nRecs[Type][nVars] ? pRecs + (size_t)nRecWords * k : NULL;
+            word * pKey = j < Vec_IntSize(vOrder) ? Vec_MemReadEntry(vKeys, Vec_IntEntry(vOrder, j)) : NULL;
+            if ( pRec && (pKey == NULL || Dau_NpnCacheCompare(pRec, pKey, nWords) < 0) )
+            {
+                fwrite( pRec, sizeof(word), (size_t)nRecWords, pFile );
+                k++;
+                continue;
+            }
+            fwrite( pKey, sizeof(word), (size_t)nWords, pFile );
+            fwrite( Vec_WrdEntryP(p->vData[Type][nVars], (nRecWords - nWords) * Vec_IntEntry(vOrder, j)), sizeof(word), (size_t)(nRecWords - nWords), pFile );
+            j++;
+        }
+        Vec_IntFree( vOrder );
+    }
+    if ( ferror(pFile) )
+        RetValue = 0;
+    if ( fclose(pFile) != 0 )
+        RetValue = 0;
+    if ( RetValue && rename(pFileTemp, p->pFileName) != 0 )
+    {
+#ifdef _WIN32
+        // the target has to be removed first
+        remove( p->pFileName );
+        RetValue = (rename(pFileTemp, p->pFileName) == 0);
+#else
+        RetValue = 0;
+#endif
+    }
+    if ( !RetValue )
+    {
+        printf( "Cannot write file \"%s\".\n", p->pFileName );
+        remove( pFileTemp );
+    }
+    ABC_FREE( pFileTemp );
+    Dau_NpnCacheUnlock( p );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints statistics of the cache.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Dau_NpnCachePrintStats( Dau_NpnCache_t * p )
+{
+    word nLookups, nHitsFile, nHitsNew;
+    int nFile = Dau_NpnCacheEntryNum( p, 0 );
+    int nNew  = Dau_NpnCacheEntryNum( p, 1 );
+    Dau_NpnCacheLock( p );
+    nLookups  = p->nLookups;
+    nHitsFile = p->nHitsFile;
+    nHitsNew  = p->nHitsNew;
+    Dau_NpnCacheUnlock( p );
+    printf( "NPN cache \"%s\" (%s):  Records in the file = %d.  Added = %d.\n",
+        p->pFileName, p->pData ? (p->fMapped ? "mapped" : "read") : "new", nFile, nNew );
+    printf( "Canonicization requests = %.0f.  Answered from the file = %.0f (%.2f %%).  From this run = %.0f (%.2f %%).\n",
+        (double)nLookups, (double)nHitsFile, 100.0 * (double)nHitsFile / Abc_MaxWord(nLookups, 1),
+        (double)nHitsNew, 100.0 * (double)nHitsNew / Abc_MaxWord(nLookups, 1) );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
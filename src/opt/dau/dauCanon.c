@@ -22,6 +22,7 @@
 #include "misc/util/utilTruth.h"
 #include "misc/vec/vecMem.h"
 #include "bool/lucky/lucky.h"
+#include "misc/util/utilSimd.h"
 #include <math.h>
 
 #ifdef _MSC_VER
@@ -586,6 +587,7 @@ int Abc_TtCountOnesInCofsFast( word * pTruth, int nVars, int * pStore )
 ***********************************************************************/
 static inline unsigned Abc_TtSemiCanonicize( word * pTruth, int nVars, char * pCanonPerm, int * pStoreOut, int fOnlySwap )
 {
+    Abc_SimdTt6Count_t pTt6Count = Abc_SimdKernels()->pTt6Count;
     int fUseOld = 1;
     int fOldSwap = 0;
     int pStoreIn[17];
@@ -596,7 +598,32 @@ static inline unsigned Abc_TtSemiCanonicize( word * pTruth, int nVars, char * pC
     for ( i = 0; i < nVars; i++ )
         pCanonPerm[i] = i;
 
-    if ( fUseOld )
+    if ( fUseOld && nVars <= 6 && pTt6Count )
+    {
+        // counts the ones in the function and its cofactors at once
+        Abc_TtVerifySmallTruth( pTruth, nVars );
+        nOnes = pTt6Count( pTruth[0], pStore );
+        // normalize polarity
+        if ( nOnes > 32 && !fOnlySwap )
+        {
+            for ( i = 0; i < nVars; i++ )
+                pStore[i] = 32 - pStore[i]; 
+            pTruth[0] = ~pTruth[0];
+            nOnes = 64 - nOnes;
+            uCanonPhase |= (1 << nVars);
+        }
+        // normalize phase
+        pStore[nVars] = nOnes;
+        for ( i = 0; i < nVars; i++ )
+        {
+            if ( pStore[i] >= nOnes - pStore[i] || fOnlySwap )
+                continue;
+            Abc_TtFlip( pTruth, nWords, i );
+            uCanonPhase |= (1 << i);
+            pStore[i] = nOnes - pStore[i]; 
+        }
+    }
+    else if ( fUseOld )
     {
         // normalize polarity    
         nOnes = Abc_TtCountOnesInTruth( pTruth, nVars );
@@ -737,7 +764,7 @@ void Abc_TtCofactorTest10( word * pTruth, int nVars, int N )
   SeeAlso     []
 
 ***********************************************************************/
-int Abc_Tt6CofactorPermNaive( word * pTruth, int i, int fSwapOnly )
+int Abc_Tt6CofactorPermNaive( word * pTruth, int i, int fSwapOnly, Abc_SimdTt6Perm_t pTt6Perm )
 {
     if ( fSwapOnly )
     {
@@ -749,6 +776,8 @@ int Abc_Tt6CofactorPermNaive( word * pTruth, int i, int fSwapOnly )
         }
         return 0;
     }
+    if ( pTt6Perm ) // evaluates the eight configurations at once
+        return pTt6Perm( pTruth, i );
     {
         word Copy = pTruth[0];
         word Best = pTruth[0];
@@ -877,10 +906,10 @@ int Abc_TtCofactorPermNaive( word * pTruth, int i, int nWords, int fSwapOnly )
   SeeAlso     []
 
 ***********************************************************************/
-int Abc_TtCofactorPermConfig( word * pTruth, int i, int nWords, int fSwapOnly, int fNaive )
+int Abc_TtCofactorPermConfig( word * pTruth, int i, int nWords, int fSwapOnly, int fNaive, Abc_SimdTt6Perm_t pTt6Perm )
 {
     if ( nWords == 1 )
-        return Abc_Tt6CofactorPermNaive( pTruth, i, fSwapOnly );
+        return Abc_Tt6CofactorPermNaive( pTruth, i, fSwapOnly, pTt6Perm );
     if ( fNaive )
         return Abc_TtCofactorPermNaive( pTruth, i, nWords, fSwapOnly );
     if ( fSwapOnly )
@@ -975,11 +1004,11 @@ int Abc_TtCofactorPermConfig( word * pTruth, int i, int nWords, int fSwapOnly, i
         return Config;
     }
 }
-int Abc_TtCofactorPerm( word * pTruth, int i, int nWords, int fSwapOnly, char * pCanonPerm, unsigned * puCanonPhase, int fNaive )
+int Abc_TtCofactorPerm( word * pTruth, int i, int nWords, int fSwapOnly, char * pCanonPerm, unsigned * puCanonPhase, int fNaive, Abc_SimdTt6Perm_t pTt6Perm )
 {
     if ( fSwapOnly )
     {
-        int Config = Abc_TtCofactorPermConfig( pTruth, i, nWords, 1, 0 );
+        int Config = Abc_TtCofactorPermConfig( pTruth, i, nWords, 1, 0, pTt6Perm );
         if ( Config )
         {
             if ( ((*puCanonPhase >> i) & 1) != ((*puCanonPhase >> (i+1)) & 1) )
@@ -995,7 +1024,7 @@ int Abc_TtCofactorPerm( word * pTruth, int i, int nWords, int fSwapOnly, char *
         static word pCopy1[1024];
         int Config;
         Abc_TtCopy( pCopy1, pTruth, nWords, 0 );
-        Config = Abc_TtCofactorPermConfig( pTruth, i, nWords, 0, fNaive );
+        Config = Abc_TtCofactorPermConfig( pTruth, i, nWords, 0, fNaive, pTt6Perm );
         if ( Config == 0 )
             return 0;
         if ( Abc_TtCompareRev(pTruth, pCopy1, nWords) == 1 ) // made it worse
@@ -1035,6 +1064,7 @@ int Abc_TtCofactorPerm( word * pTruth, int i, int nWords, int fSwapOnly, char *
 //#define CANON_VERIFY
 unsigned Abc_TtCanonicize( word * pTruth, int nVars, char * pCanonPerm )
 {
+    Abc_SimdTt6Perm_t pTt6Perm = Abc_SimdKernels()->pTt6Perm;
     int pStoreIn[17];
     unsigned uCanonPhase;
     int i, k, nWords = Abc_TtWordNum( nVars );
@@ -1053,13 +1083,13 @@ unsigned Abc_TtCanonicize( word * pTruth, int nVars, char * pCanonPerm )
         int fChanges = 0;
         for ( i = nVars - 2; i >= 0; i-- )
             if ( pStoreIn[i] == pStoreIn[i+1] )
-                fChanges |= Abc_TtCofactorPerm( pTruth, i, nWords, pStoreIn[i] != pStoreIn[nVars]/2, pCanonPerm, &uCanonPhase, fNaive );
+                fChanges |= Abc_TtCofactorPerm( pTruth, i, nWords, pStoreIn[i] != pStoreIn[nVars]/2, pCanonPerm, &uCanonPhase, fNaive, pTt6Perm );
         if ( !fChanges )
             break;
         fChanges = 0;
         for ( i = 1; i < nVars - 1; i++ )
             if ( pStoreIn[i] == pStoreIn[i+1] )
-                fChanges |= Abc_TtCofactorPerm( pTruth, i, nWords, pStoreIn[i] != pStoreIn[nVars]/2, pCanonPerm, &uCanonPhase, fNaive );
+                fChanges |= Abc_TtCofactorPerm( pTruth, i, nWords, pStoreIn[i] != pStoreIn[nVars]/2, pCanonPerm, &uCanonPhase, fNaive, pTt6Perm );
         if ( !fChanges )
             break;
     }
@@ -1084,6 +1114,7 @@ unsigned Abc_TtCanonicize( word * pTruth, int nVars, char * pCanonPerm )
 
 unsigned Abc_TtCanonicizePerm( word * pTruth, int nVars, char * pCanonPerm )
 {
+    Abc_SimdTt6Perm_t pTt6Perm = Abc_SimdKernels()->pTt6Perm;
     int pStoreIn[17];
     unsigned uCanonPhase;
     int i, k, nWords = Abc_TtWordNum( nVars );
@@ -1106,13 +1137,13 @@ unsigned Abc_TtCanonicizePerm( word * pTruth, int nVars, char * pCanonPerm )
         int fChanges = 0;
         for ( i = nVars - 2; i >= 0; i-- )
             if ( pStoreIn[i] == pStoreIn[i+1] )
-                fChanges |= Abc_TtCofactorPerm( pTruth, i, nWords, 1, pCanonPerm, &uCanonPhase, fNaive );
+                fChanges |= Abc_TtCofactorPerm( pTruth, i, nWords, 1, pCanonPerm, &uCanonPhase, fNaive, pTt6Perm );
         if ( !fChanges )
             break;
         fChanges = 0;
         for ( i = 1; i < nVars - 1; i++ )
             if ( pStoreIn[i] == pStoreIn[i+1] )
-                fChanges |= Abc_TtCofactorPerm( pTruth, i, nWords, 1, pCanonPerm, &uCanonPhase, fNaive );
+                fChanges |= Abc_TtCofactorPerm( pTruth, i, nWords, 1, pCanonPerm, &uCanonPhase, fNaive, pTt6Perm );
         if ( !fChanges )
             break;
     }
@@ -1317,6 +1348,7 @@ int Abc_TtHieRetrieveOrInsert(Abc_TtHieMan_t * p, int level, word * pTruth, word
 
 unsigned Abc_TtCanonicizeHie( Abc_TtHieMan_t * p, word * pTruthInit, int nVars, char * pCanonPerm, int fExact )
 {
+    Abc_SimdTt6Perm_t pTt6Perm = Abc_SimdKernels()->pTt6Perm;
     int fNaive = 1;
     int pStore[17];
     //static word pTruth[1024];
@@ -1393,13 +1425,13 @@ unsigned Abc_TtCanonicizeHie( Abc_TtHieMan_t * p, word * pTruthInit, int nVars,
         int fChanges = 0;
         for ( i = nVars - 2; i >= 0; i-- )
             if ( pStore[i] == pStore[i+1] )
-                fChanges |= Abc_TtCofactorPerm( pTruth, i, nWords, pStore[i] != pStore[nVars]/2, pCanonPerm, &uCanonPhase, fNaive );
+                fChanges |= Abc_TtCofactorPerm( pTruth, i, nWords, pStore[i] != pStore[nVars]/2, pCanonPerm, &uCanonPhase, fNaive, pTt6Perm );
         if ( !fChanges )
             break;
         fChanges = 0;
         for ( i = 1; i < nVars - 1; i++ )
             if ( pStore[i] == pStore[i+1] )
-                fChanges |= Abc_TtCofactorPerm( pTruth, i, nWords, pStore[i] != pStore[nVars]/2, pCanonPerm, &uCanonPhase, fNaive );
+                fChanges |= Abc_TtCofactorPerm( pTruth, i, nWords, pStore[i] != pStore[nVars]/2, pCanonPerm, &uCanonPhase, fNaive, pTt6Perm );
         if ( !fChanges )
             break;
     }
@@ -0,0 +1,393 @@
+/**CFile****************************************************************
+
+  FileName    [dauStore.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [DAG-aware unmapping.]
+
+  Synopsis    [Process-wide store of truth tables and their NPN classes.]
+
+  Author      [agent <agent@local>]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: dauStore.c,v 1.00 2026/10/17 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#ifdef ABC_USE_PTHREADS
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+#endif
+
+#include "dauInt.h"
+#include "misc/util/utilTruth.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define DAU_STORE_PAGE_LOG   12   // log2 of the number of truth tables on one page
+#define DAU_STORE_PAGE_MAX  (1<<14) // the max number of pages without reallocation
+
+typedef struct Dau_TtTable_t_ Dau_TtTable_t;
+struct Dau_TtTable_t_
+{
+    Vec_Mem_t *      vTtMem;      // truth tables (entry 0 is const0, entry 1 is the first variable)
+    Vec_Int_t *      vClass;      // the NPN class of each truth table (-1 if not computed)
+    Vec_Int_t *      vPhase;      // the canonical phase of each truth table
+    Vec_Str_t *      vPerm;       // the canonical permutation of each truth table
+    Vec_Mem_t *      vCanon;      // the canonical forms
+};
+
+struct Dau_TtStore_t_
+{
+    Dau_TtTable_t *  pTables[DAU_STORE_VAR_MAX+1];  // tables by the number of variables
+    word             nCanonCalls; // the number of canonicization requests
+    word             nCanonHits;  // the number of requests answered from the store
+    Dau_NpnCache_t * pCache;      // persistent cache of canonical forms (or NULL)
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t  Mutex;       // protects the tables
+#endif
+};
+
+static inline void Dau_TtStoreLock( Dau_TtStore_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock( &p->Mutex );
+#endif
+}
+static inline void Dau_TtStoreUnlock( Dau_TtStore_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_unlock( &p->Mutex );
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the store.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Dau_TtStore_t * Dau_TtStoreStart()
+{
+    Dau_TtStore_t * p = ABC_CALLOC( Dau_TtStore_t, 1 );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_init( &p->Mutex, NULL );
+#endif
+    return p;
+}
+void Dau_TtStoreStop( Dau_TtStore_t * p )
+{
+    int v;
+    for ( v = 0; v <= DAU_STORE_VAR_MAX; v++ )
+    {
+        Dau_TtTable_t * pTable = p->pTables[v];
+        if ( pTable == NULL )
+            continue;
+        Vec_MemHashFree( pTable->vTtMem );
+        Vec_MemFree( pTable->vTtMem );
+        Vec_MemHashFree( pTable->vCanon );
+        Vec_MemFree( pTable->vCanon );
+        Vec_IntFree( pTable->vClass );
+        Vec_IntFree( pTable->vPhase );
+        Vec_StrFree( pTable->vPerm );
+        ABC_FREE( pTable );
+    }
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_destroy( &p->Mutex );
+#endif
+    ABC_FREE( p );
+}
+void Dau_TtStoreSetCache( Dau_TtStore_t * p, Dau_NpnCache_t * pCache )
+{
+    Dau_TtStoreLock( p );
+    p->pCache = pCache;
+    Dau_TtStoreUnlock( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the table of the given size, creating it if needed.]
+
+  Description [Should be called with the lock held.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Dau_TtTable_t * Dau_TtStoreTable( Dau_TtStore_t * p, int nVars )
+{
+    Dau_TtTable_t * pTable;
+    assert( nVars >= 0 && nVars <= DAU_STORE_VAR_MAX );
+    if ( (pTable = p->pTables[nVars]) )
+        return pTable;
+    pTable = ABC_CALLOC( Dau_TtTable_t, 1 );
+    pTable->vTtMem = Vec_MemAllocForTT( nVars, 0 );
+    Vec_MemReservePages( pTable->vTtMem, DAU_STORE_PAGE_MAX );
+    pTable->vCanon = Vec_MemAlloc( Abc_TtWordNum(nVars), DAU_STORE_PAGE_LOG );
+    Vec_MemHashAlloc( pTable->vCanon, 1000 );
+    pTable->vClass = Vec_IntAlloc( 1000 );
+    pTable->vPhase = Vec_IntAlloc( 1000 );
+    pTable->vPerm  = Vec_StrAlloc( 1000 );
+    p->pTables[nVars] = pTable;
+    return pTable;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the shared truth tables with the given number of variables.]
+
+  Description [The table has the layout of Vec_MemAllocForTT( nVars, 0 ):
+  entry 0 is constant 0 and entry 1 is the first variable. Entries can be
+  read with Vec_MemReadEntry() at any time, but they should be added only
+  by Dau_TtStoreInsert(), which serializes the callers.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Mem_t * Dau_TtStoreMem( Dau_TtStore_t * p, int nVars )
+{
+    Vec_Mem_t * vTtMem;
+    Dau_TtStoreLock( p );
+    vTtMem = Dau_TtStoreTable( p, nVars )->vTtMem;
+    Dau_TtStoreUnlock( p );
+    return vTtMem;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Copies the shared truth tables into a private table.]
+
+  Description [The entries keep their IDs. The copy is not reserved and
+  grows as usual, so a mapper switches to it when the store is full.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Mem_t * Dau_TtStoreMemDup( Dau_TtStore_t * p, int nVars )
+{
+    Vec_Mem_t * vTtMem, * vCopy;
+    word * pEntry; int i, Value;
+    Dau_TtStoreLock( p );
+    vTtMem = Dau_TtStoreTable( p, nVars )->vTtMem;
+    vCopy  = Vec_MemAlloc( Vec_MemEntrySize(vTtMem), vTtMem->LogPageSze );
+    Vec_MemHashAlloc( vCopy, 2 * Vec_MemEntryNum(vTtMem) + 1000 );
+    Vec_MemForEachEntry( vTtMem, pEntry, i )
+    {
+        Value = Vec_MemHashInsert( vCopy, pEntry );
+        assert( Value == i );
+    }
+    Dau_TtStoreUnlock( p );
+    return vCopy;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the truth table to the store and returns its ID.]
+
+  Description [Returns -1 if the truth table is new and the reserved
+  pages of the store are used up.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Dau_TtStoreInsert( Dau_TtStore_t * p, int nVars, word * pTruth )
+{
+    int iFunc;
+    Dau_TtStoreLock( p );
+    iFunc = Vec_MemHashInsert( Dau_TtStoreTable(p, nVars)->vTtMem, pTruth );
+    Dau_TtStoreUnlock( p );
+    return iFunc;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds several truth tables to the store.]
+
+  Description [Writes their IDs into pIds, or -1 for the new truth tables
+  that did not fit. The store is locked once for the whole batch.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Dau_TtStoreInsertBatch( Dau_TtStore_t * p, int nVars, word ** ppTruths, int nTruths, int * pIds )
+{
+    Dau_TtStoreLock( p );
+    Vec_MemHashInsertBatch( Dau_TtStoreTable(p, nVars)->vTtMem, ppTruths, nTruths, pIds );
+    Dau_TtStoreUnlock( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the NPN class of the truth table with the given ID.]
+
+  Description [The class is computed with Abc_TtCanonicize() on the first
+  request and reused afterwards. If uPhase and pPerm are not NULL, they
+  receive the phase and the permutation returned by Abc_TtCanonicize().]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Dau_TtStoreNpnClassInt( Dau_TtStore_t * p, Dau_TtTable_t * pTable, int nVars, int iFunc )
+{
+    word pTruth[1 << (DAU_STORE_VAR_MAX-6)];
+    char pPerm[DAU_STORE_VAR_MAX];
+    unsigned uPhase;
+    int iClass, k;
+    p->nCanonCalls++;
+    if ( iFunc < Vec_IntSize(pTable->vClass) && Vec_IntEntry(pTable->vClass, iFunc) >= 0 )
+    {
+        p->nCanonHits++;
+        return Vec_IntEntry(pTable->vClass, iFunc);
+    }
+    Abc_TtCopy( pTruth, Vec_MemReadEntry(pTable->vTtMem, iFunc), Abc_TtWordNum(nVars), 0 );
+    if ( p->pCache )
+        uPhase = Dau_NpnCacheCanonicize( p->pCache, DAU_NPN_ABC, pTruth, nVars, pPerm );
+    else
+        uPhase = Abc_TtCanonicize( pTruth, nVars, pPerm );
+    iClass = Vec_MemHashInsert( pTable->vCanon, pTruth );
+    Vec_IntFillExtra( pTable->vClass, iFunc + 1, -1 );
+    Vec_IntFillExtra( pTable->vPhase, iFunc + 1, 0 );
+    Vec_StrFillExtra( pTable->vPerm, nVars * (iFunc + 1), 0 );
+    Vec_IntWriteEntry( pTable->vClass, iFunc, iClass );
+    Vec_IntWriteEntry( pTable->vPhase, iFunc, (int)uPhase );
+    for ( k = 0; k < nVars; k++ )
+        Vec_StrWriteEntry( pTable->vPerm, nVars * iFunc + k, pPerm[k] );
+    return iClass;
+}
+int Dau_TtStoreNpnClass( Dau_TtStore_t * p, int nVars, int iFunc, unsigned * puPhase, char * pPerm )
+{
+    Dau_TtTable_t * pTable;
+    int iClass;
+    Dau_TtStoreLock( p );
+    pTable = Dau_TtStoreTable( p, nVars );
+    iClass = Dau_TtStoreNpnClassInt( p, pTable, nVars, iFunc );
+    if ( puPhase )
+        *puPhase = (unsigned)Vec_IntEntry( pTable->vPhase, iFunc );
+    if ( pPerm )
+        memcpy( pPerm, Vec_StrArray(pTable->vPerm) + nVars * iFunc, (size_t)nVars );
+    Dau_TtStoreUnlock( p );
+    return iClass;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the number of NPN classes and their canonical forms.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Dau_TtStoreNpnClassNum( Dau_TtStore_t * p, int nVars )
+{
+    int nClasses;
+    Dau_TtStoreLock( p );
+    nClasses = Vec_MemEntryNum( Dau_TtStoreTable(p, nVars)->vCanon );
+    Dau_TtStoreUnlock( p );
+    return nClasses;
+}
+void Dau_TtStoreNpnTruth( Dau_TtStore_t * p, int nVars, int iClass, word * pTruth )
+{
+    Dau_TtStoreLock( p );
+    Abc_TtCopy( pTruth, Vec_MemReadEntry(Dau_TtStoreTable(p, nVars)->vCanon, iClass), Abc_TtWordNum(nVars), 0 );
+    Dau_TtStoreUnlock( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Canonicizes the truth table using the store.]
+
+  Description [Works as Abc_TtCanonicize() but computes the canonical form
+  of each function only once per process.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+unsigned Dau_TtStoreCanonicize( Dau_TtStore_t * p, word * pTruth, int nVars, char * pCanonPerm )
+{
+    Dau_TtTable_t * pTable;
+    unsigned uPhase;
+    int iFunc, iClass;
+    Dau_TtStoreLock( p );
+    pTable = Dau_TtStoreTable( p, nVars );
+    iFunc  = Vec_MemHashInsert( pTable->vTtMem, pTruth );
+    iClass = Dau_TtStoreNpnClassInt( p, pTable, nVars, iFunc );
+    uPhase = (unsigned)Vec_IntEntry( pTable->vPhase, iFunc );
+    memcpy( pCanonPerm, Vec_StrArray(pTable->vPerm) + nVars * iFunc, (size_t)nVars );
+    Abc_TtCopy( pTruth, Vec_MemReadEntry(pTable->vCanon, iClass), Abc_TtWordNum(nVars), 0 );
+    Dau_TtStoreUnlock( p );
+    return uPhase;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints statistics of the store.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Dau_TtStorePrintStats( Dau_TtStore_t * p )
+{
+    int v;
+    Dau_TtStoreLock( p );
+    for ( v = 0; v <= DAU_STORE_VAR_MAX; v++ )
+    {
+        Dau_TtTable_t * pTable = p->pTables[v];
+        if ( pTable == NULL )
+            continue;
+        printf( "Vars = %2d :  Functions = %9d.  NPN classes = %9d.  Memory = %8.2f MB\n", v,
+            Vec_MemEntryNum(pTable->vTtMem), Vec_MemEntryNum(pTable->vCanon),
+            (Vec_MemMemory(pTable->vTtMem) + Vec_MemMemory(pTable->vCanon)) / (1<<20) );
+    }
+    printf( "Canonicization requests = %.0f.  Answered from the store = %.0f (%.2f %%)\n",
+        (double)p->nCanonCalls, (double)p->nCanonHits, 100.0 * (double)p->nCanonHits / Abc_MaxWord(p->nCanonCalls, 1) );
+    Dau_TtStoreUnlock( p );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
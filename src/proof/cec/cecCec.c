@@ -23,6 +23,7 @@
 #include "aig/gia/giaAig.h"
 #include "misc/extra/extra.h"
 #include "sat/cnf/cnf.h"
+#include "sat/bmc/bmc.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -312,6 +313,94 @@ int Cec_ManVerifyNaive( Gia_Man_t * p, Cec_ParCec_t * pPars )
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Performs naive checking with the portfolio of SAT solvers.]
+
+  Description [The solvers run in parallel on the same CNF and share
+  short learned clauses.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec_ManVerifyNaivePort( Gia_Man_t * p, Cec_ParCec_t * pPars )
+{
+    Cnf_Dat_t * pCnf = (Cnf_Dat_t *)Mf_ManGenerateCnf( p, 8, 0, 0, 0, 0 );
+    Bmc_PortPar_t ParsPort, * pParsPort = &ParsPort;
+    Bmc_Port_t * pPort;
+    Gia_Obj_t * pObj0, * pObj1;
+    abctime clkStart = Abc_Clock();
+    int nPairs = Gia_ManPoNum(p)/2;
+    int nUnsats = 0, nSats = 0, nUndecs = 0, nTrivs = 0;
+    int i, k, iVar0, iVar1, pLits[2], status = l_Undef;
+    ProgressBar * pProgress = Extra_ProgressBarStart( stdout, nPairs );
+    assert( Gia_ManPoNum(p) % 2 == 0 );
+    Bmc_PortSetDefaultParams( pParsPort );
+    pParsPort->nSolvers   = pPars->nProcs;
+    pParsPort->nConfLimit = pPars->nBTLimit;
+    pPort = Bmc_PortStart( pParsPort );
+    Bmc_PortSetNVars( pPort, pCnf->nVars );
+    for ( i = 0; i < pCnf->nClauses; i++ )
+        Bmc_PortAddClause( pPort, pCnf->pClauses[i], pCnf->pClauses[i+1]-pCnf->pClauses[i] );
+    for ( i = 0; i < nPairs; i++ )
+    {
+        if ( (i & 0xFF) == 0 )
+            Extra_ProgressBarUpdate( pProgress, i, NULL );
+        pObj0 = Gia_ManPo(p, 2*i);
+        pObj1 = Gia_ManPo(p, 2*i+1);
+        if ( Gia_ObjChild0(pObj0) == Gia_ObjChild0(pObj1) )
+        {
+            nUnsats++;
+            nTrivs++;
+            continue;
+        }
+        if ( pPars->TimeLimit && (Abc_Clock() - clkStart)/CLOCKS_PER_SEC >= pPars->TimeLimit )
+        {
+            printf( "Timeout (%d sec) is reached.\n", pPars->TimeLimit );
+            nUndecs = nPairs - nUnsats - nSats;
+            break;
+        }
+        iVar0 = pCnf->pVarNums[ Gia_ObjId(p, pObj0) ];
+        iVar1 = pCnf->pVarNums[ Gia_ObjId(p, pObj1) ];
+        assert( iVar0 >= 0 && iVar1 >= 0 );
+        // check direct and inverse
+        for ( k = 0; k < 2; k++ )
+        {
+            pLits[0] = Abc_Var2Lit( iVar0, !k );
+            pLits[1] = Abc_Var2Lit( iVar1,  k );
+            status = Bmc_PortSolve( pPort, pLits, 2 );
+            if ( status != l_False )
+                break;
+            pLits[0] = Abc_LitNot( pLits[0] );
+            pLits[1] = Abc_LitNot( pLits[1] );
+            Bmc_PortAddClause( pPort, pLits, 2 );
+        }
+        if ( k == 2 )
+            nUnsats++;
+        else if ( status == l_True )
+        {
+            printf( "Output %d is SAT.\n", i );
+            nSats++;
+        }
+        else
+            nUndecs++;
+    }
+    Extra_ProgressBarStop( pProgress );
+    printf( "UNSAT = %6d.  SAT = %6d.   UNDEC = %6d.  Trivial = %6d.  ", nUnsats, nSats, nUndecs, nTrivs );
+    Abc_PrintTime( 1, "Time", Abc_Clock() - clkStart );
+    if ( pPars->fVerbose )
+        Bmc_PortPrintStats( pPort );
+    Cnf_DataFree( pCnf );
+    Bmc_PortStop( pPort );
+    if ( nSats )
+        return 0;
+    if ( nUndecs )
+        return -1;
+    return 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    [New CEC engine.]
@@ -345,7 +434,7 @@ int Cec_ManVerify( Gia_Man_t * pInit, Cec_ParCec_t * pPars )
     Gia_ManStop( pNew );
     if ( pPars->fNaive )
     {
-        RetValue = Cec_ManVerifyNaive( p, pPars );
+        RetValue = pPars->nProcs > 1 ? Cec_ManVerifyNaivePort( p, pPars ) : Cec_ManVerifyNaive( p, pPars );
         Gia_ManStop( p );
         return RetValue;
     }
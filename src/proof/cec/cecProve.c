@@ -26,6 +26,7 @@
 #include "proof/pdr/pdr.h"
 #include "proof/cec/cec.h"
 #include "proof/ssw/ssw.h"
+#include "misc/util/utilPool.h"
 
 
 #ifdef ABC_USE_PTHREADS
@@ -186,65 +187,61 @@ Gia_Man_t * Cec_GiaScorrNew( Gia_Man_t * p )
 #define PAR_THR_MAX 8
 typedef struct Par_ThData_t_
 {
-    Gia_Man_t * p;
-    int         iEngine;
-    int         fWorking;
-    int         nTimeOut;
-    int         Result;
-    int         fVerbose;
+    Gia_Man_t *        p;
+    int                iEngine;
+    int                nTimeOut;
+    int                Result;
+    int                fVerbose;
+    Util_Pool_t *      pPool;
+    Util_PoolGroup_t * pGroup;
 } Par_ThData_t;
-void * Cec_GiaProveWorkerThread( void * pArg )
+int Cec_GiaProveTask( void * pArg )
 {
     Par_ThData_t * pThData = (Par_ThData_t *)pArg;
-    volatile int * pPlace = &pThData->fWorking;
-    while ( 1 )
-    {
-        while ( *pPlace == 0 );
-        assert( pThData->fWorking );
-        if ( pThData->p == NULL )
-        {
-            pthread_exit( NULL );
-            assert( 0 );
-            return NULL;
-        }
-        pThData->Result = Cec_GiaProveOne( pThData->p, pThData->iEngine, pThData->nTimeOut, pThData->fVerbose );
-        pThData->fWorking = 0;
-    }
-    assert( 0 );
-    return NULL;
+    pThData->Result = Cec_GiaProveOne( pThData->p, pThData->iEngine, pThData->nTimeOut, pThData->fVerbose );
+    if ( pThData->Result != -1 )
+        Util_PoolGroupCancel( pThData->pGroup );
+    return 1;
 }
-void Cec_GiaInitThreads( Par_ThData_t * ThData, int nProcs, Gia_Man_t * p, int nTimeOut, int fVerbose, pthread_t * WorkerThread )
+Util_PoolGroup_t * Cec_GiaInitThreads( Par_ThData_t * ThData, int nProcs, Gia_Man_t * p, int nTimeOut, int fVerbose )
 {
-    int i, status;
+    // the engines race each other, so they get a pool of their own with one thread per engine
+    Util_Pool_t * pPool = Util_PoolStart( nProcs );
+    Util_PoolGroup_t * pGroup = Util_PoolGroupStart( pPool, 0 );
+    int i;
     assert( nProcs <= PAR_THR_MAX );
     for ( i = 0; i < nProcs; i++ )
     {
         ThData[i].p        = Gia_ManDup(p);
         ThData[i].iEngine  = i;
         ThData[i].nTimeOut = nTimeOut;
-        ThData[i].fWorking = 0;
         ThData[i].Result   = -1;
         ThData[i].fVerbose = fVerbose;
-        if ( !WorkerThread )
-            continue;
-        status = pthread_create( WorkerThread + i, NULL,Cec_GiaProveWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+        ThData[i].pPool    = pPool;
+        ThData[i].pGroup   = pGroup;
     }
     for ( i = 0; i < nProcs; i++ )
-        ThData[i].fWorking = 1;
+        Util_PoolSubmit( pGroup, Cec_GiaProveTask, (void *)(ThData + i) );
+    return pGroup;
 }
 int Cec_GiaWaitThreads( Par_ThData_t * ThData, int nProcs, Gia_Man_t * p, int RetValue, int * pRetEngine )
 {
+    Util_PoolGroup_t * pGroup = ThData[0].pGroup;
     int i;
+    if ( RetValue != -1 )
+        Util_PoolGroupCancel( pGroup );
+    Util_PoolGroupWait( pGroup );
+    Util_PoolGroupStop( pGroup );
+    Util_PoolStop( ThData[0].pPool );
     for ( i = 0; i < nProcs; i++ )
     {
-        if ( RetValue == -1 && !ThData[i].fWorking && ThData[i].Result != -1 ) {
+        if ( RetValue == -1 && ThData[i].Result != -1 ) {
             RetValue = ThData[i].Result;
             *pRetEngine = i;
             if ( !p->pCexSeq && ThData[i].p->pCexSeq )
                 p->pCexSeq = Abc_CexDup( ThData[i].p->pCexSeq, -1 );
         }
-        if ( ThData[i].fWorking )
-            i = -1;
+        Gia_ManStopP( &ThData[i].p );
     }
     return RetValue;
 }
@@ -253,8 +250,7 @@ int Cec_GiaProveTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nTimeOut2, in
 {
     abctime clkScorr = 0, clkTotal = Abc_Clock();
     Par_ThData_t ThData[PAR_THR_MAX];
-    pthread_t WorkerThread[PAR_THR_MAX];
-    int i, RetValue = -1, RetEngine = -2;
+    int RetValue = -1, RetEngine = -2;
     Abc_CexFreeP( &p->pCexComb );
     Abc_CexFreeP( &p->pCexSeq );        
     if ( !fSilent && fVerbose )
@@ -264,7 +260,7 @@ int Cec_GiaProveTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nTimeOut2, in
     fflush( stdout );
 
     assert( nProcs == 3 || nProcs == 5 );
-    Cec_GiaInitThreads( ThData, nProcs, p, nTimeOut, fVerbose, WorkerThread );
+    Cec_GiaInitThreads( ThData, nProcs, p, nTimeOut, fVerbose );
 
     // meanwhile, perform scorr
     Gia_Man_t * pScorr = Cec_GiaScorrNew( p );
@@ -280,7 +276,7 @@ int Cec_GiaProveTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nTimeOut2, in
             printf( "Reduced the miter from %d to %d nodes. ", Gia_ManAndNum(p), Gia_ManAndNum(pScorr) );
             Abc_PrintTime( 1, "Time", clkScorr );
         }
-        Cec_GiaInitThreads( ThData, nProcs, pScorr, nTimeOut2, fVerbose, NULL );
+        Cec_GiaInitThreads( ThData, nProcs, pScorr, nTimeOut2, fVerbose );
 
         // meanwhile, perform scorr
         if ( Gia_ManAndNum(pScorr) < 100000 )
@@ -297,22 +293,18 @@ int Cec_GiaProveTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nTimeOut2, in
                     printf( "Reduced the miter from %d to %d nodes. ", Gia_ManAndNum(pScorr), Gia_ManAndNum(pScorr2) );
                     Abc_PrintTime( 1, "Time", clkScorr2 );
                 }
-                Cec_GiaInitThreads( ThData, nProcs, pScorr2, nTimeOut3, fVerbose, NULL );
+                Cec_GiaInitThreads( ThData, nProcs, pScorr2, nTimeOut3, fVerbose );
 
                 RetValue = Cec_GiaWaitThreads( ThData, nProcs, p, RetValue, &RetEngine );
                 // do something else      
             }
             Gia_ManStop( pScorr2 );   
         }
+        else // the miter is too large for the old scorr; wait for the engines
+            RetValue = Cec_GiaWaitThreads( ThData, nProcs, p, RetValue, &RetEngine );
     }
     Gia_ManStop( pScorr );    
 
-    // stop threads
-    for ( i = 0; i < nProcs; i++ )
-    {
-        ThData[i].p = NULL;
-        ThData[i].fWorking = 1;
-    }
     if ( !fSilent )
     {
         printf( "Problem \"%s\" is ", p->pSpec );
@@ -25,6 +25,16 @@
 #include "base/abc/abc.h"
 #include "map/if/if.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
 #define USE_GLUCOSE2
 
 #ifdef USE_GLUCOSE2
@@ -146,6 +156,23 @@ static inline int    Cec4_ObjSatId( Gia_Man_t * p, Gia_Obj_t * pObj )
 static inline int    Cec4_ObjSetSatId( Gia_Man_t * p, Gia_Obj_t * pObj, int Num ) { assert(Cec4_ObjSatId(p, pObj) == -1); Gia_ObjSetCopy2Array(p, Gia_ObjId(p, pObj), Num); Vec_IntPush(&p->vSuppVars, Gia_ObjId(p, pObj)); if ( Gia_ObjIsCi(pObj) ) Vec_IntPushTwo(&p->vCopiesTwo, Gia_ObjId(p, pObj), Num); assert(Vec_IntSize(&p->vVarMap) == Num); Vec_IntPush(&p->vVarMap, Gia_ObjId(p, pObj)); return Num;  }
 static inline void   Cec4_ObjCleanSatId( Gia_Man_t * p, Gia_Obj_t * pObj )        { assert(Cec4_ObjSatId(p, pObj) != -1); Gia_ObjSetCopy2Array(p, Gia_ObjId(p, pObj), -1);               }
 
+// parallel SAT sweeping
+#define CEC4_THR_MAX     100   // the max number of threads
+#define CEC4_SHARD_PAIRS 256   // the min number of candidate pairs in one shard
+
+typedef struct Cec4_ParThData_t_ Cec4_ParThData_t;
+struct Cec4_ParThData_t_
+{
+    Cec4_Man_t *     pMan;           // manager of this worker (own solver and internal AIG)
+    Vec_Int_t *      vPairs;         // candidate pairs (iRepr, iObj)
+    Vec_Int_t *      vShards;        // the first pair of each shard followed by the number of pairs
+    Vec_Int_t *      vMap;           // the internal AIG literal of each object
+    Vec_Int_t *      vStatus;        // the result for each pair
+    Vec_Wec_t *      vCexes;         // the counter-example for each disproved pair
+    int *            piShard;        // the next shard to solve
+    void *           pMutex;         // protects the shard counter
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -222,6 +249,7 @@ void Cec4_ManSetParams( Cec_ParFra_t * pPars )
     pPars->nSatVarMax     =    1000;    // the max number of SAT variables before recycling SAT solver
     pPars->nCallsRecycle  =     500;    // calls to perform before recycling SAT solver
     pPars->nGenIters      =     100;    // pattern generation iterations
+    pPars->nProcs         =       1;    // the number of threads for SAT sweeping
     pPars->fBMiterInfo    =       0;    // printing BMiter information
 }
 
@@ -325,9 +353,12 @@ void Cec4_ManDestroy( Cec4_Man_t * p )
     //    p->pAig->nBitPats, Vec_IntSize(p->pAig->vPats) - 2*p->pAig->nBitPats, 1.0*Vec_IntSize(p->pAig->vPats)/Abc_MaxInt(1, p->pAig->nBitPats)-2 );
     //Cec4_EvalPatterns( p->pAig, p->pAig->vPats, p->pAig->nBitPats );
     //Vec_IntFreeP( &p->pAig->vPats );
-    Vec_WrdFreeP( &p->pAig->vSims );
-    Vec_WrdFreeP( &p->pAig->vSimsPi );
-    Gia_ManCleanMark01( p->pAig );
+    if ( p->pAig ) // the workers of the parallel sweeping detach from the shared AIG
+    {
+        Vec_WrdFreeP( &p->pAig->vSims );
+        Vec_WrdFreeP( &p->pAig->vSimsPi );
+        Gia_ManCleanMark01( p->pAig );
+    }
     sat_solver_stop( p->pSat );
     Gia_ManStopP( &p->pNew );
     Vec_PtrFreeP( &p->vFrontier );
@@ -1642,10 +1673,27 @@ int Cec4_ManSolveTwo( Cec4_Man_t * p, int iObj0, int iObj1, int fPhase, int * pf
     //    printf( "*  " );
     return status;
 }
+void Cec4_ManCollectCex( Cec4_Man_t * p, Vec_Int_t * vPat )
+{
+    int i, IdAig, IdSat;
+    Vec_IntClear( vPat );
+    if ( p->pPars->jType == 0 )
+    {
+        Vec_IntForEachEntryDouble( &p->pNew->vCopiesTwo, IdAig, IdSat, i )
+            Vec_IntPush( vPat, Abc_Var2Lit(IdAig, sat_solver_read_cex_varvalue(p->pSat, IdSat)) );
+    }
+    else
+    {
+        int * pCex = sat_solver_read_cex( p->pSat );
+        int * pMap = Vec_IntArray(&p->pNew->vVarMap);
+        for ( i = 0; i < pCex[0]; )
+            Vec_IntPush( vPat, Abc_Lit2LitV(pMap, Abc_LitNot(pCex[++i])) );
+    }
+}
 int Cec4_ManSweepNode( Cec4_Man_t * p, int iObj, int iRepr )
 {
     abctime clk = Abc_Clock();
-    int i, IdAig, IdSat, status, fEasy, RetValue = 1;
+    int i, status, fEasy, RetValue = 1;
     Gia_Obj_t * pObj = Gia_ManObj( p->pAig, iObj );
     Gia_Obj_t * pRepr = Gia_ManObj( p->pAig, iRepr );
     int fCompl = Abc_LitIsCompl(pObj->Value) ^ Abc_LitIsCompl(pRepr->Value) ^ pObj->fPhase ^ pRepr->fPhase;
@@ -1658,19 +1706,8 @@ int Cec4_ManSweepNode( Cec4_Man_t * p, int iObj, int iRepr )
         //printf( "Disproved: %d == %d.\n", Abc_Lit2Var(pRepr->Value), Abc_Lit2Var(pObj->Value) );
         p->nSatSat++;
         p->nPatterns++;
-        Vec_IntClear( p->vPat );
-        if ( p->pPars->jType == 0 )
-        {
-            Vec_IntForEachEntryDouble( &p->pNew->vCopiesTwo, IdAig, IdSat, i )
-                Vec_IntPush( p->vPat, Abc_Var2Lit(IdAig, sat_solver_read_cex_varvalue(p->pSat, IdSat)) );
-        }
-        else
-        {
-            int * pCex = sat_solver_read_cex( p->pSat );
-            int * pMap = Vec_IntArray(&p->pNew->vVarMap);
-            for ( i = 0; i < pCex[0]; )
-                Vec_IntPush( p->vPat, Abc_Lit2LitV(pMap, Abc_LitNot(pCex[++i])) );
-        }
+        Cec4_ManCollectCex( p, p->vPat );
+        Gia_ManPatStoreAdd( p->pAig, p->vPat );
         assert( p->pAig->iPatsPi >= 0 && p->pAig->iPatsPi < 64 * p->pAig->nSimWords - 1 );
         p->pAig->iPatsPi++;
         Vec_IntForEachEntry( p->vPat, iLit, i )
@@ -1858,11 +1895,270 @@ void Cec4_ManSimulateDumpInfo( Cec4_Man_t * pMan )
     Vec_WrdFree( vSims );
     Vec_WrdFree( vSimsPi );
 }
+/**Function*************************************************************
+
+  Synopsis    [Simulates the patterns saved in the store of the AIG.]
+
+  Description [The stored patterns fill the simulation words of the CIs,
+  except the first bit, which is reserved for the all-0 pattern. Returns 0
+  if a counter-example is detected for the miter.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec4_ManSimulateStore( Gia_Man_t * p, Cec4_Man_t * pMan )
+{
+    int iPat, nPats;
+    for ( iPat = 0; iPat < Gia_ManPatStoreNum(p); iPat += nPats )
+    {
+        Cec4_ManSimulateCis( p );
+        nPats = Gia_ManPatStoreLoad( p, iPat, Gia_ManPatStoreNum(p), Vec_WrdArray(p->vSims), p->nSimWords, 1 );
+        Cec4_ManSimulate( p, pMan );
+        if ( pMan->pPars->fCheckMiter && !Cec4_ManSimulateCos(p) )
+            return 0;
+    }
+    if ( pMan->pPars->fVerbose )
+    {
+        printf( "Simulated %d stored patterns.  ", Gia_ManPatStoreNum(p) );
+        Cec4_ManPrintStats( p, pMan->pPars, pMan, 1 );
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Parallel SAT sweeping of the candidate equivalences.]
+
+  Description [The candidate pairs (class representative, class member)
+  are split into shards composed of whole classes. Each worker owns a SAT
+  solver and a copy of the internal AIG, in which its CNF is constructed,
+  and solves one shard at a time, starting with an empty solver. Since the
+  shards do not depend on the number of threads, neither do the results.
+  The coordinator then simulates the counter-examples and returns, for each
+  object, the representative it was proved equivalent to (or -1).]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Cec4_ManDupStrash( Gia_Man_t * p )
+{
+    Gia_Obj_t * pObj; int i;
+    Gia_Man_t * pNew = Cec4_ManStartNew( p );
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        if ( Gia_ObjIsXor(pObj) )
+            pObj->Value = Gia_ManHashXorReal( pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+        else
+            pObj->Value = Gia_ManHashAnd( pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+    }
+    Gia_ManHashStop( pNew );
+    return pNew;
+}
+void Cec4_ManParSolveShard( Cec4_ParThData_t * pThData, int iShard )
+{
+    Cec4_Man_t * p = pThData->pMan;
+    int iFirst = Vec_IntEntry( pThData->vShards, 2*iShard );
+    int nPairs = Vec_IntEntry( pThData->vShards, 2*iShard+1 );
+    int k, fEasy;
+    // an empty solver keeps the results independent of the shard order
+    Cec4_ManSatSolverRecycle( p );
+    for ( k = iFirst; k < iFirst + nPairs; k++ )
+    {
+        int iRepr = Vec_IntEntry( pThData->vPairs, 2*k );
+        int iObj  = Vec_IntEntry( pThData->vPairs, 2*k+1 );
+        int iLit0 = Vec_IntEntry( pThData->vMap, iRepr );
+        int iLit1 = Vec_IntEntry( pThData->vMap, iObj );
+        int fCompl = Abc_LitIsCompl(iLit0) ^ Abc_LitIsCompl(iLit1) ^ Gia_ManObj(p->pAig, iRepr)->fPhase ^ Gia_ManObj(p->pAig, iObj)->fPhase;
+        int fEffort = p->vCoDrivers ? Vec_BitEntry(p->vCoDrivers, iObj) || Vec_BitEntry(p->vCoDrivers, iRepr) : 0;
+        int status = GLUCOSE_UNSAT;
+        if ( Abc_Lit2Var(iLit0) != Abc_Lit2Var(iLit1) )
+            status = Cec4_ManSolveTwo( p, Abc_Lit2Var(iLit0), Abc_Lit2Var(iLit1), fCompl, &fEasy, 0, fEffort );
+        Vec_IntWriteEntry( pThData->vStatus, k, status );
+        if ( status == GLUCOSE_SAT )
+            Cec4_ManCollectCex( p, Vec_WecEntry(pThData->vCexes, k) );
+    }
+}
+
+#ifdef ABC_USE_PTHREADS
+
+void * Cec4_ManParWorkerThread( void * pArg )
+{
+    Cec4_ParThData_t * pThData = (Cec4_ParThData_t *)pArg;
+    int iShard, status;
+    while ( 1 )
+    {
+        status = pthread_mutex_lock( (pthread_mutex_t *)pThData->pMutex );  assert( status == 0 );
+        iShard = (*pThData->piShard)++;
+        status = pthread_mutex_unlock( (pthread_mutex_t *)pThData->pMutex );  assert( status == 0 );
+        if ( iShard >= Vec_IntSize(pThData->vShards) / 2 )
+            break;
+        Cec4_ManParSolveShard( pThData, iShard );
+    }
+    return NULL;
+}
+Vec_Int_t * Cec4_ManPerformSweepingPar( Gia_Man_t * p, Cec4_Man_t * pMan )
+{
+    Cec_ParFra_t * pPars = pMan->pPars, ParsW = *pMan->pPars;
+    Cec4_ParThData_t ThData[CEC4_THR_MAX];
+    pthread_t WorkerThread[CEC4_THR_MAX];
+    pthread_mutex_t Mutex;
+    Vec_Int_t * vPairs, * vShards, * vMap, * vStatus, * vProved;
+    Vec_Wec_t * vCexes;
+    Gia_Obj_t * pObj;
+    abctime clk = Abc_Clock();
+    int i, k, iRepr, iObj, iLit, iStart = 0, iShard = 0, status, nThreads, nCounts[3] = {0};
+    // collect the candidate pairs and split them into shards of whole classes
+    vPairs  = Vec_IntAlloc( 1000 );
+    vShards = Vec_IntAlloc( 100 );
+    Gia_ManForEachClass0( p, iRepr )
+    {
+        Gia_ClassForEachObj1( p, iRepr, iObj )
+            if ( Gia_ObjIsAnd(Gia_ManObj(p, iObj)) && (!pPars->nLevelMax || Gia_ObjLevelId(p, iObj) <= pPars->nLevelMax) )
+                Vec_IntPushTwo( vPairs, iRepr, iObj );
+        if ( Vec_IntSize(vPairs)/2 - iStart < CEC4_SHARD_PAIRS )
+            continue;
+        Vec_IntPushTwo( vShards, iStart, Vec_IntSize(vPairs)/2 - iStart );
+        iStart = Vec_IntSize(vPairs)/2;
+    }
+    if ( Vec_IntSize(vPairs)/2 > iStart )
+        Vec_IntPushTwo( vShards, iStart, Vec_IntSize(vPairs)/2 - iStart );
+    nThreads = Abc_MinInt( Abc_MinInt(pPars->nProcs, CEC4_THR_MAX), Vec_IntSize(vShards)/2 );
+    if ( nThreads < 1 )
+    {
+        Vec_IntFree( vPairs );
+        Vec_IntFree( vShards );
+        return NULL;
+    }
+    vStatus = Vec_IntStart( Vec_IntSize(vPairs)/2 );
+    vCexes  = Vec_WecStart( Vec_IntSize(vPairs)/2 );
+    // create the workers, each with its own copy of the internal AIG
+    ParsW.fVerbose = 0;
+    for ( i = 0; i < nThreads; i++ )
+    {
+        ThData[i].pMan       = Cec4_ManCreate( p, &ParsW );
+        ThData[i].pMan->pNew = Cec4_ManDupStrash( p );
+        ThData[i].vPairs     = vPairs;
+        ThData[i].vShards    = vShards;
+        ThData[i].vStatus    = vStatus;
+        ThData[i].vCexes     = vCexes;
+        ThData[i].piShard    = &iShard;
+        ThData[i].pMutex     = (void *)&Mutex;
+    }
+    vMap = Vec_IntAlloc( Gia_ManObjNum(p) );
+    Gia_ManForEachObj( p, pObj, i )
+        Vec_IntPush( vMap, pObj->Value );
+    for ( i = 0; i < nThreads; i++ )
+        ThData[i].vMap = vMap;
+    // solve the shards
+    status = pthread_mutex_init( &Mutex, NULL );  assert( status == 0 );
+    for ( i = 1; i < nThreads; i++ )
+    {
+        status = pthread_create( WorkerThread + i, NULL, Cec4_ManParWorkerThread, (void *)(ThData + i) );  
+        assert( status == 0 );
+    }
+    Cec4_ManParWorkerThread( (void *)ThData );
+    for ( i = 1; i < nThreads; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );  
+        assert( status == 0 );
+    }
+    status = pthread_mutex_destroy( &Mutex );  assert( status == 0 );
+    // the workers share the AIG with the coordinator and own everything else
+    for ( i = 0; i < nThreads; i++ )
+    {
+        Cec4_Man_t * pW = ThData[i].pMan;
+        pMan->nRecycles += pW->nRecycles;
+        pMan->nGates[0] += pW->nGates[0];
+        pMan->nGates[1] += pW->nGates[1];
+        for ( k = 0; k < 3; k++ )
+        {
+            pMan->nConflicts[0][k] = k < 2 ? pMan->nConflicts[0][k] + pW->nConflicts[0][k] : Abc_MaxInt(pMan->nConflicts[0][k], pW->nConflicts[0][k]);
+            pMan->nConflicts[1][k] = k < 2 ? pMan->nConflicts[1][k] + pW->nConflicts[1][k] : Abc_MaxInt(pMan->nConflicts[1][k], pW->nConflicts[1][k]);
+        }
+        pMan->timeCnf += pW->timeCnf;
+        pW->pAig = NULL;
+        Cec4_ManDestroy( pW );
+    }
+    // simulate the counter-examples in the order of the pairs
+    vProved = Vec_IntStartFull( Gia_ManObjNum(p) );
+    Vec_IntForEachEntry( vStatus, status, k )
+    {
+        iRepr = Vec_IntEntry( vPairs, 2*k );
+        iObj  = Vec_IntEntry( vPairs, 2*k+1 );
+        if ( status == GLUCOSE_UNSAT )
+        {
+            Vec_IntWriteEntry( vProved, iObj, iRepr );
+            nCounts[0]++;
+            continue;
+        }
+        if ( status != GLUCOSE_SAT )
+        {
+            pMan->nSatUndec++;
+            nCounts[2]++;
+            continue;
+        }
+        pMan->nSatSat++;
+        pMan->nPatterns++;
+        nCounts[1]++;
+        assert( p->iPatsPi >= 0 && p->iPatsPi < 64 * p->nSimWords - 1 );
+        p->iPatsPi++;
+        Vec_IntForEachEntry( Vec_WecEntry(vCexes, k), iLit, i )
+            Cec4_ObjSimSetInputBit( p, Abc_Lit2Var(iLit), Abc_LitIsCompl(iLit) );
+        Gia_ManPatStoreAdd( p, Vec_WecEntry(vCexes, k) );
+        if ( p->vPats )
+        {
+            Vec_IntPush( p->vPats, Vec_IntSize(Vec_WecEntry(vCexes, k))+2 );
+            Vec_IntAppend( p->vPats, Vec_WecEntry(vCexes, k) );
+            Vec_IntPush( p->vPats, -1 );
+        }
+        if ( p->iPatsPi == 64 * p->nSimWords - 2 )
+        {
+            Cec4_ManSimulate( p, pMan );
+            Vec_IntFill( pMan->vCexStamps, Gia_ManObjNum(p), 0 );
+            p->iPatsPi = 0;
+            Vec_WrdFill( p->vSimsPi, Vec_WrdSize(p->vSimsPi), 0 );
+        }
+    }
+    if ( p->iPatsPi > 0 )
+    {
+        Cec4_ManSimulate( p, pMan );
+        Vec_IntFill( pMan->vCexStamps, Gia_ManObjNum(p), 0 );
+        p->iPatsPi = 0;
+        Vec_WrdFill( p->vSimsPi, Vec_WrdSize(p->vSimsPi), 0 );
+    }
+    if ( pPars->fVerbose )
+    {
+        printf( "Parallel sweeping with %d threads: Pairs = %d. Shards = %d.  P = %d  D = %d  F = %d  ", 
+            nThreads, Vec_IntSize(vPairs)/2, Vec_IntSize(vShards)/2, nCounts[0], nCounts[1], nCounts[2] );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    Vec_IntFree( vPairs );
+    Vec_IntFree( vShards );
+    Vec_IntFree( vMap );
+    Vec_IntFree( vStatus );
+    Vec_WecFree( vCexes );
+    return vProved;
+}
+
+#else
+
+Vec_Int_t * Cec4_ManPerformSweepingPar( Gia_Man_t * p, Cec4_Man_t * pMan )
+{
+    return NULL;
+}
+
+#endif // pthreads are used
+
 int Cec4_ManPerformSweeping( Gia_Man_t * p, Cec_ParFra_t * pPars, Gia_Man_t ** ppNew, int fSimOnly )
 {
 
     Cec4_Man_t * pMan = Cec4_ManCreate( p, pPars ); 
     Gia_Obj_t * pObj, * pRepr; 
+    Vec_Int_t * vProved = NULL;
     int i, fSimulate = 1, Id;
     if ( pPars->fVerbose )
         printf( "Solver type = %d. Simulate %d words in %d rounds. SAT with %d confs. Recycle after %d SAT calls.\n", 
@@ -1923,6 +2219,9 @@ int Cec4_ManPerformSweeping( Gia_Man_t * p, Cec_ParFra_t * pPars, Gia_Man_t ** p
         if ( i && i % (pPars->nRounds / 5) == 0 && pPars->fVerbose )
             Cec4_ManPrintStats( p, pPars, pMan, 1 );
     }
+    // simulate the patterns stored by the previous runs
+    if ( Gia_ManPatStoreNum(p) && !Cec4_ManSimulateStore(p, pMan) ) // cex detected
+        goto finalize;
     if ( fSimOnly )
         goto finalize;
 
@@ -1945,6 +2244,8 @@ int Cec4_ManPerformSweeping( Gia_Man_t * p, Cec_ParFra_t * pPars, Gia_Man_t ** p
     p->iPatsPi = 0;
     Vec_WrdFill( p->vSimsPi, Vec_WrdSize(p->vSimsPi), 0 );
     pMan->nSatSat = 0;
+    if ( pPars->nProcs > 1 && !pPars->fUseCones )
+        vProved = Cec4_ManPerformSweepingPar( p, pMan );
     pMan->pNew = Cec4_ManStartNew( p );
     Gia_ManForEachAnd( p, pObj, i )
     {
@@ -1989,20 +2290,25 @@ int Cec4_ManPerformSweeping( Gia_Man_t * p, Cec_ParFra_t * pPars, Gia_Man_t ** p
                 pMan->iLastConst = i;
             continue;
         }
-        if ( Cec4_ManSweepNode(pMan, i, Gia_ObjId(p, pRepr)) && Gia_ObjProved(p, i) )
+        if ( vProved && Vec_IntEntry(vProved, i) == id_repr )
         {
-            if (pPars->fBMiterInfo){
-
-                Bnd_ManMerge( id_repr, id_obj, pObj->fPhase ^ pRepr->fPhase );
-                // printf( "proven %d merged into %d (phase : %d)\n", Gia_ObjId(p, pObj), Gia_ObjId(p,pRepr), pObj->fPhase ^ pRepr -> fPhase );
-
-            }
-            pObj->Value = Abc_LitNotCond( pRepr->Value, pObj->fPhase ^ pRepr->fPhase );
+            pMan->nSatUnsat++;
+            Gia_ObjSetProved( p, i );
+            if ( id_repr == 0 )
+                pMan->iLastConst = i;
+        }
+        else if ( !Cec4_ManSweepNode(pMan, i, id_repr) || !Gia_ObjProved(p, i) )
+            continue;
+        if (pPars->fBMiterInfo){
 
+            Bnd_ManMerge( id_repr, id_obj, pObj->fPhase ^ pRepr->fPhase );
+            // printf( "proven %d merged into %d (phase : %d)\n", Gia_ObjId(p, pObj), Gia_ObjId(p,pRepr), pObj->fPhase ^ pRepr -> fPhase );
 
         }
+        pObj->Value = Abc_LitNotCond( pRepr->Value, pObj->fPhase ^ pRepr->fPhase );
     }
     
+    Vec_IntFreeP( &vProved );
     if ( pPars->fBMiterInfo )
     {
         // print
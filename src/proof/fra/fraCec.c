@@ -21,6 +21,7 @@
 #include "fra.h"
 #include "sat/cnf/cnf.h"
 #include "sat/bsat/satSolver2.h"
+#include "sat/bmc/bmc.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -306,6 +307,67 @@ int Aig_ManCountXors( Aig_Man_t * p )
 
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Solves the combinational miter with the portfolio of solvers.]
+
+  Description [Asserts the OR of the outputs. Returns 1 if UNSAT, 0 if SAT
+  (in which case pMan->pData holds the values of the CIs), and -1 if
+  undecided within the conflict limit.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Fra_FraigSatPort( Aig_Man_t * pMan, int nConfLimit, int nProcs, int fVerbose )
+{
+    Bmc_PortPar_t Pars, * pPars = &Pars;
+    Bmc_Port_t * pPort;
+    Cnf_Dat_t * pCnf;
+    Vec_Int_t * vCiIds, * vLits;
+    Aig_Obj_t * pObj;
+    int i, status, RetValue = 1;
+    assert( Aig_ManRegNum(pMan) == 0 );
+    pMan->pData = NULL;
+    // derive CNF
+    pCnf = Cnf_Derive( pMan, Aig_ManCoNum(pMan) );
+    Bmc_PortSetDefaultParams( pPars );
+    pPars->nSolvers   = nProcs;
+    pPars->nConfLimit = nConfLimit;
+    pPars->fVerbose   = fVerbose;
+    pPort = Bmc_PortStart( pPars );
+    Bmc_PortSetNVars( pPort, pCnf->nVars );
+    for ( i = 0; i < pCnf->nClauses; i++ )
+        if ( !Bmc_PortAddClause( pPort, pCnf->pClauses[i], pCnf->pClauses[i+1]-pCnf->pClauses[i] ) )
+            break;
+    // add the OR clause for the outputs
+    vLits = Vec_IntAlloc( Aig_ManCoNum(pMan) );
+    Aig_ManForEachCo( pMan, pObj, i )
+        Vec_IntPush( vLits, toLitCond(pCnf->pVarNums[pObj->Id], 0) );
+    Bmc_PortAddClause( pPort, Vec_IntArray(vLits), Vec_IntSize(vLits) );
+    Vec_IntFree( vLits );
+    vCiIds = Cnf_DataCollectPiSatNums( pCnf, pMan );
+    Cnf_DataFree( pCnf );
+    // solve the miter
+    status = Bmc_PortSolve( pPort, NULL, 0 );
+    if ( status == l_Undef )
+        RetValue = -1;
+    else if ( status == l_True )
+    {
+        int * pModel = ABC_CALLOC( int, Vec_IntSize(vCiIds) );
+        for ( i = 0; i < Vec_IntSize(vCiIds); i++ )
+            pModel[i] = Bmc_PortVarValue( pPort, Vec_IntEntry(vCiIds, i) );
+        pMan->pData = pModel;
+        RetValue = 0;
+    }
+    if ( fVerbose )
+        Bmc_PortPrintStats( pPort );
+    Vec_IntFree( vCiIds );
+    Bmc_PortStop( pPort );
+    return RetValue;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -74,6 +74,7 @@ void Fra_SecSetDefaultParams( Fra_Sec_t * p )
     p->fUseNewProver     =       0;  // enables new prover
     p->fUsePdr           =       1;  // enables PDR
     p->nPdrTimeout       =      60;  // enabled PDR timeout
+    p->nProcs            =       1;  // the number of solvers sharing learned clauses
     p->fSilent           =       0;  // disables all output
     p->fVerbose          =       0;  // enables verbose reporting of statistics
     p->fVeryVerbose      =       0;  // enables very verbose reporting  
@@ -306,6 +307,31 @@ ABC_PRT( "Time", Abc_Clock() - clk );
     RetValue = Fra_FraigMiterStatus( pNew );
     if ( RetValue >= 0 )
         goto finish;
+
+    // solve the remaining combinational miter with the portfolio
+    if ( pNew->nRegs == 0 && pParSec->nProcs > 1 )
+    {
+        int i;
+clk = Abc_Clock();
+        RetValue = Fra_FraigSatPort( pNew, pParSec->nBTLimitGlobal, pParSec->nProcs, pParSec->fVeryVerbose );
+        if ( pParSec->fVerbose )
+        {
+            printf( "Portfolio SAT with %d solvers.  ", pParSec->nProcs );
+ABC_PRT( "Time", Abc_Clock() - clk );
+        }
+        if ( RetValue == 0 && pNew->pData )
+        {
+            int * pModel = (int *)pNew->pData;
+            pNew->pSeqModel = Abc_CexAlloc( 0, Aig_ManCiNum(pNew), 1 );
+            for ( i = 0; i < Aig_ManCiNum(pNew); i++ )
+                if ( pModel[i] )
+                    Abc_InfoSetBit( pNew->pSeqModel->pData, i );
+            pNew->pSeqModel->iPo = Saig_ManFindFailedPoCex( pNew, pNew->pSeqModel );
+            ABC_FREE( pNew->pData );
+        }
+        if ( RetValue >= 0 )
+            goto finish;
+    }
 /*
     if ( RetValue == -1 && pParSec->TimeLimit )
     {
@@ -343,21 +343,22 @@ int Pdr_ManFreeVar( Pdr_Man_t * p, int k )
 
 /**Function*************************************************************
 
-  Synopsis    [Creates SAT solver.]
+  Synopsis    [Derives the CNF used by the SAT solvers.]
 
-  Description []
+  Description [The CNF is derived when the first solver is created.
+  Concurrent workers call this in advance because the CNF computation
+  is not reentrant.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-static inline sat_solver * Pdr_ManNewSolver1( sat_solver * pSat, Pdr_Man_t * p, int k, int fInit )
+void Pdr_ManDeriveCnf( Pdr_Man_t * p )
 {
     Aig_Obj_t * pObj;
     int i;
-    assert( pSat );
-    if ( p->pCnf1 == NULL )
+    if ( p->pPars->fMonoCnf && p->pCnf1 == NULL )
     {
         int nRegs = p->pAig->nRegs;
         p->pAig->nRegs = Aig_ManCoNum(p->pAig);
@@ -366,12 +367,39 @@ static inline sat_solver * Pdr_ManNewSolver1( sat_solver * pSat, Pdr_Man_t * p,
         assert( p->vVar2Reg == NULL );
         p->vVar2Reg = Vec_IntStartFull( p->pCnf1->nVars );
         Saig_ManForEachLi( p->pAig, pObj, i )
-            Vec_IntWriteEntry( p->vVar2Reg, Pdr_ObjSatVar(p, k, 3, pObj), i );
+            Vec_IntWriteEntry( p->vVar2Reg, Pdr_ObjSatVar(p, 0, 3, pObj), i );
+    }
+    if ( !p->pPars->fMonoCnf && p->pCnf2 == NULL )
+    {
+        p->pCnf2     = Cnf_DeriveOtherWithMan( p->pCnfMan, p->pAig, 0 );
+#ifdef USE_PG
+        p->pCnf2->pClaPols = Cnf_DataDeriveLitPolarities( p->pCnf2 );
+#endif
+        p->pvId2Vars = ABC_CALLOC( Vec_Int_t, Aig_ManObjNumMax(p->pAig) );
+        Vec_PtrGrow( &p->vVar2Ids, 256 );
     }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Creates SAT solver.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline sat_solver * Pdr_ManNewSolver1( sat_solver * pSat, Pdr_Man_t * p, int k, int fInit )
+{
+    assert( pSat );
+    Pdr_ManDeriveCnf( p );
     pSat = (sat_solver *)Cnf_DataWriteIntoSolverInt( pSat, p->pCnf1, 1, fInit );
     sat_solver_set_runtime_limit( pSat, p->timeToStop );
     sat_solver_set_runid( pSat, p->pPars->RunId );
     sat_solver_set_stop_func( pSat, p->pPars->pFuncStop );
+    sat_solver_set_stop( pSat, p->pStop );
     return pSat;
 }
 
@@ -391,15 +419,7 @@ static inline sat_solver * Pdr_ManNewSolver2( sat_solver * pSat, Pdr_Man_t * p,
     Vec_Int_t * vVar2Ids;
     int i, Entry;
     assert( pSat );
-    if ( p->pCnf2 == NULL )
-    {
-        p->pCnf2     = Cnf_DeriveOtherWithMan( p->pCnfMan, p->pAig, 0 );
-#ifdef USE_PG
-        p->pCnf2->pClaPols = Cnf_DataDeriveLitPolarities( p->pCnf2 );
-#endif
-        p->pvId2Vars = ABC_CALLOC( Vec_Int_t, Aig_ManObjNumMax(p->pAig) );
-        Vec_PtrGrow( &p->vVar2Ids, 256 );
-    }
+    Pdr_ManDeriveCnf( p );
     // update the variable mapping
     vVar2Ids = (Vec_Int_t *)Vec_PtrGetEntry( &p->vVar2Ids, k );
     if ( vVar2Ids == NULL )
@@ -422,6 +442,7 @@ static inline sat_solver * Pdr_ManNewSolver2( sat_solver * pSat, Pdr_Man_t * p,
     sat_solver_set_runtime_limit( pSat, p->timeToStop );
     sat_solver_set_runid( pSat, p->pPars->RunId );
     sat_solver_set_stop_func( pSat, p->pPars->pFuncStop );
+    sat_solver_set_stop( pSat, p->pStop );
     return pSat;
 }
 
@@ -59,6 +59,7 @@ void Pdr_ManSetDefaultParams( Pdr_Par_t * pPars )
     pPars->nConfGenLimit  =       0;  // limit on SAT solver conflicts during generalization
     pPars->nRestLimit     =       0;  // limit on the number of proof-obligations
     pPars->nRandomSeed   = 91648253;  // value to seed the SAT solver with
+    pPars->nProcs        = 1;         // the number of concurrent workers sharing clauses
     pPars->fTwoRounds     =       0;  // use two rounds for generalization
     pPars->fMonoCnf       =       0;  // monolythic CNF
     pPars->fNewXSim       =       0;  // updated X-valued simulation
@@ -207,6 +208,8 @@ int Pdr_ManPushClauses( Pdr_Man_t * p )
             }
             // add the last clause
             Vec_PtrPush( vArrayK1, pCubeK );
+            if ( p->pShare )
+                Pdr_ManPublishClause( p, k+1, pCubeK );
             Vec_PtrWriteEntry( vArrayK, j, Vec_PtrEntryLast(vArrayK) );
             Vec_PtrPop(vArrayK);
             j--;
@@ -908,6 +911,9 @@ int Pdr_ManBlockCube( Pdr_Man_t * p, Pdr_Set_t * pCube )
     while ( !Pdr_QueueIsEmpty(p) )
     {
         Counter++;
+        // add the clauses derived by other workers
+        if ( p->pShare && Pdr_ManImportClauses( p ) == -1 )
+            return -1;
         pThis = Pdr_QueueHead( p );
         if ( pThis->iFrame == 0 || (p->pPars->fUseAbs && Pdr_SetIsInit(pThis->pState, -1)) )
             return 0; // SAT
@@ -987,6 +993,8 @@ int Pdr_ManBlockCube( Pdr_Man_t * p, Pdr_Set_t * pCube )
                     p->nAbsFlops++;
                 Vec_IntAddToEntry( p->vPrio, pCubeMin->Lits[i] / 2, 1 << p->nPrioShift );
             }
+            if ( p->pShare )
+                Pdr_ManPublishClause( p, k, pCubeMin );
             Vec_VecPush( p->vClauses, k, pCubeMin );   // consume ref
             p->nCubes++;
             // add clause
@@ -1017,6 +1025,8 @@ int Pdr_ManBlockCube( Pdr_Man_t * p, Pdr_Set_t * pCube )
         // check termination
         if ( p->pPars->pFuncStop && p->pPars->pFuncStop(p->pPars->RunId) )
             return -1;
+        if ( p->pStop && *p->pStop )
+            return -1;
         if ( p->timeToStop && Abc_Clock() > p->timeToStop )
             return -1;
         if ( p->timeToStopOne && Abc_Clock() > p->timeToStopOne )
@@ -1288,7 +1298,9 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
             Pdr_ManPrintClauses( p, 0 );
         }
         // push clauses into this timeframe
-        RetValue = Pdr_ManPushClauses( p );
+        RetValue = p->pShare ? Pdr_ManImportClauses( p ) : 0;
+        if ( RetValue == 0 )
+            RetValue = Pdr_ManPushClauses( p );
         if ( RetValue == -1 )
         {
             if ( p->pPars->fVerbose )
@@ -1333,7 +1345,7 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
             Pdr_ManPrintProgress( p, 0, Abc_Clock() - clkStart );
 
         // check termination
-        if ( p->pPars->pFuncStop && p->pPars->pFuncStop(p->pPars->RunId) )
+        if ( (p->pPars->pFuncStop && p->pPars->pFuncStop(p->pPars->RunId)) || (p->pStop && *p->pStop) )
         {
             p->pPars->iFrame = iFrame;
             return -1;
@@ -1394,6 +1406,7 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
 int Pdr_ManSolve( Aig_Man_t * pAig, Pdr_Par_t * pPars )
 {
     Pdr_Man_t * p;
+    Aig_Man_t * pAigPar;
     int k, RetValue;
     abctime clk = Abc_Clock();
     if ( pPars->nTimeOutOne && !pPars->fSolveAll )
@@ -1414,8 +1427,15 @@ int Pdr_ManSolve( Aig_Man_t * pAig, Pdr_Par_t * pPars )
             pPars->fSolveAll ?    "yes" : "no" );
     }
     ABC_FREE( pAig->pSeqModel );
-    p = Pdr_ManStart( pAig, pPars, NULL );
-    RetValue = Pdr_ManSolveInt( p );
+    if ( pPars->nProcs > 1 && !pPars->fSolveAll && !pPars->fUseAbs && !pPars->pFuncStop )
+        p = Pdr_ManSolvePar( pAig, pPars, &RetValue );
+    else
+        p = NULL;
+    if ( p == NULL )
+    {
+        p = Pdr_ManStart( pAig, pPars, NULL );
+        RetValue = Pdr_ManSolveInt( p );
+    }
     if ( RetValue == 0 )
         assert( pAig->pSeqModel != NULL || p->vCexes != NULL );
     if ( p->vCexes )
@@ -1434,7 +1454,10 @@ int Pdr_ManSolve( Aig_Man_t * pAig, Pdr_Par_t * pPars )
     else if ( RetValue == 1 )
         Abc_FrameSetInv( Pdr_ManDeriveInfinityClauses( p, RetValue!=1 ) );
     p->tTotal += Abc_Clock() - clk;
+    pAigPar = p->pAig != pAig ? p->pAig : NULL;
     Pdr_ManStop( p );
+    if ( pAigPar )
+        Aig_ManStop( pAigPar );
     pPars->iFrame--;
     // convert all -2 (unknown) entries into -1 (undec)
     if ( pPars->vOutMap )
@@ -0,0 +1,383 @@
+/**CFile****************************************************************
+
+  FileName    [pdrPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Property driven reachability.]
+
+  Synopsis    [Concurrent PDR with frame clause sharing.]
+
+  Author      [agent <agent@local>]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: pdrPar.c,v 1.00 2026/10/17 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "pdrInt.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#ifndef ABC_USE_PTHREADS
+
+Pdr_Man_t * Pdr_ManSolvePar( Aig_Man_t * pAig, Pdr_Par_t * pPars, int * pRetValue ) { return NULL; }
+void        Pdr_ManPublishClause( Pdr_Man_t * p, int k, Pdr_Set_t * pCube )          {}
+int         Pdr_ManImportClauses( Pdr_Man_t * p )                                    { return 0; }
+
+#else // pthreads are used
+
+// clauses shared by the workers
+struct Pdr_Shr_t_
+{
+    pthread_mutex_t  Mutex;        // protects the fields below
+    Vec_Ptr_t *      vCubes;       // published cubes (the clauses are their negations)
+    Vec_Int_t *      vInfo;        // the frame and the worker of each cube
+    volatile int     nCubes;       // the number of published cubes
+    int              iWinner;      // the first worker to finish
+    int              fStop;        // stops the workers of this run
+};
+
+// information given to the thread
+typedef struct Pdr_ThData_t_
+{
+    Pdr_Man_t *      p;
+    int              RetValue;
+} Pdr_ThData_t;
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts/stops the shared clause storage.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Pdr_Shr_t * Pdr_ShrStart()
+{
+    Pdr_Shr_t * p;
+    int status;
+    p = ABC_CALLOC( Pdr_Shr_t, 1 );
+    status = pthread_mutex_init( &p->Mutex, NULL );  assert( status == 0 );
+    p->vCubes  = Vec_PtrAlloc( 1000 );
+    p->vInfo   = Vec_IntAlloc( 2000 );
+    p->iWinner = -1;
+    return p;
+}
+static void Pdr_ShrStop( Pdr_Shr_t * p )
+{
+    Pdr_Set_t * pCube;
+    int i, status;
+    Vec_PtrForEachEntry( Pdr_Set_t *, p->vCubes, pCube, i )
+        Pdr_SetDeref( pCube );
+    Vec_PtrFree( p->vCubes );
+    Vec_IntFree( p->vInfo );
+    status = pthread_mutex_destroy( &p->Mutex );  assert( status == 0 );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Publishes the clause derived at the given frame.]
+
+  Description [The cube is copied, so the caller keeps its reference.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManPublishClause( Pdr_Man_t * p, int k, Pdr_Set_t * pCube )
+{
+    Pdr_Shr_t * pShare = p->pShare;
+    int status;
+    status = pthread_mutex_lock( &pShare->Mutex );  assert( status == 0 );
+    Vec_PtrPush( pShare->vCubes, Pdr_SetDup(pCube) );
+    Vec_IntPushTwo( pShare->vInfo, k, p->iWorker );
+    pShare->nCubes++;
+    status = pthread_mutex_unlock( &pShare->Mutex );  assert( status == 0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Imports the clauses published by other workers.]
+
+  Description [Each clause is added at its frame (or at the last frame
+  of this worker, if it is lower) only if it is inductive relative to
+  the previous frame of this worker. The other workers use different
+  heuristics, so their frames differ from those of this worker, and
+  re-checking the clause keeps the frames of this worker sound.
+  Returns -1 if the resource limit is reached; 0, otherwise.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_ManImportClauses( Pdr_Man_t * p )
+{
+    Pdr_Shr_t * pShare = p->pShare;
+    Vec_Ptr_t * vCubes;
+    Vec_Int_t * vLevels;
+    Pdr_Set_t * pCube;
+    int i, k, status, RetValue = 0;
+    int kMax = Vec_PtrSize(p->vSolvers)-1;
+    // the unprotected read is only a hint; the cubes are copied under the lock
+    if ( p->nShared == pShare->nCubes || kMax < 1 )
+        return 0;
+    vCubes  = Vec_PtrAlloc( 100 );
+    vLevels = Vec_IntAlloc( 100 );
+    status = pthread_mutex_lock( &pShare->Mutex );  assert( status == 0 );
+    for ( i = p->nShared; i < Vec_PtrSize(pShare->vCubes); i++ )
+    {
+        if ( Vec_IntEntry(pShare->vInfo, 2*i+1) == p->iWorker )
+            continue;
+        Vec_PtrPush( vCubes, Pdr_SetDup((Pdr_Set_t *)Vec_PtrEntry(pShare->vCubes, i)) );
+        Vec_IntPush( vLevels, Vec_IntEntry(pShare->vInfo, 2*i) );
+    }
+    p->nShared = i;
+    status = pthread_mutex_unlock( &pShare->Mutex );  assert( status == 0 );
+    // add the clauses that hold in this worker
+    Vec_PtrForEachEntry( Pdr_Set_t *, vCubes, pCube, i )
+    {
+        k = Abc_MinInt( Vec_IntEntry(vLevels, i), kMax );
+        if ( RetValue == -1 || k < 1 || Pdr_ManCheckContainment( p, k, pCube ) )
+        {
+            Pdr_SetDeref( pCube );
+            continue;
+        }
+        status = Pdr_ManCheckCube( p, k-1, pCube, NULL, 0, 1, 1 );
+        if ( status != 1 )
+        {
+            if ( status == -1 )
+                RetValue = -1;
+            Pdr_SetDeref( pCube );
+            continue;
+        }
+        Vec_VecPush( p->vClauses, k, pCube );   // consume ref
+        for ( status = 1; status <= k; status++ )
+            Pdr_ManSolverAddClause( p, status, pCube );
+        p->nImports++;
+    }
+    Vec_PtrFree( vCubes );
+    Vec_IntFree( vLevels );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Diversifies the parameters of the workers.]
+
+  Description [Worker 0 uses the parameters given by the user.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Pdr_ManSetWorkerParams( Pdr_Par_t * pPars, int iWorker )
+{
+    if ( iWorker % 4 == 1 )
+        pPars->fFlopOrder ^= 1;
+    else if ( iWorker % 4 == 2 )
+        pPars->fSkipDown ^= 1;
+    else if ( iWorker % 4 == 3 )
+    {
+        pPars->fTwoRounds ^= 1;
+        pPars->fFlopPrio  ^= 1;
+    }
+    pPars->nRandomSeed += 1001 * iWorker;
+    pPars->nProcs       = 1;
+    pPars->fVerbose     = 0;
+    pPars->fVeryVerbose = 0;
+    pPars->fNotVerbose  = 1;
+    pPars->fSilent      = 1;
+    pPars->fDumpInv     = 0;
+    pPars->fUseBridge   = 0;
+    pPars->vOutMap      = NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs one worker.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void * Pdr_ManWorkerThread( void * pArg )
+{
+    Pdr_ThData_t * pThData = (Pdr_ThData_t *)pArg;
+    Pdr_Man_t * p = pThData->p;
+    int status;
+    pThData->RetValue = Pdr_ManSolveInt( p );
+    status = pthread_mutex_lock( &p->pShare->Mutex );  assert( status == 0 );
+    if ( pThData->RetValue != -1 && p->pShare->iWinner == -1 )
+    {
+        p->pShare->iWinner = p->iWorker;
+        // stop the other workers
+        p->pShare->fStop = 1;
+    }
+    status = pthread_mutex_unlock( &p->pShare->Mutex );  assert( status == 0 );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the problem using several concurrent workers.]
+
+  Description [The workers run PDR with different heuristics on copies
+  of the AIG and exchange the clauses added to their frames. The first
+  worker to prove or disprove the property stops the others. Returns the
+  manager of this worker (or of worker 0, if the resource limit is reached),
+  with the AIG copy in p->pAig, which the caller should stop after the
+  manager. The counter-example is moved into pAig->pSeqModel.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Pdr_Man_t * Pdr_ManSolvePar( Aig_Man_t * pAig, Pdr_Par_t * pPars, int * pRetValue )
+{
+    Pdr_ThData_t ThData[PDR_PAR_MAX];
+    pthread_t WorkerThread[PDR_PAR_MAX];
+    Pdr_Par_t Pars[PDR_PAR_MAX];
+    Pdr_Shr_t * pShare;
+    Pdr_Man_t * p;
+    Aig_Man_t * pTemp;
+    sat_solver * pSat;
+    abctime clk = Abc_Clock();
+    int i, status, iWinner, nImports = 0;
+    int nProcs = Abc_MinInt( pPars->nProcs, PDR_PAR_MAX );
+    assert( nProcs > 1 && !pPars->fSolveAll && !pPars->fUseAbs );
+    // start the workers (deriving CNF is not reentrant)
+    pShare = Pdr_ShrStart();
+    for ( i = 0; i < nProcs; i++ )
+    {
+        Pars[i] = *pPars;
+        Pdr_ManSetWorkerParams( Pars + i, i );
+        p = Pdr_ManStart( Aig_ManDupSimple(pAig), Pars + i, NULL );
+        Pdr_ManDeriveCnf( p );
+        p->pShare  = pShare;
+        p->pStop   = &pShare->fStop;
+        p->iWorker = i;
+        ThData[i].p = p;
+        ThData[i].RetValue = -1;
+    }
+    for ( i = 0; i < nProcs; i++ )
+    {
+        status = pthread_create( WorkerThread + i, NULL, Pdr_ManWorkerThread, (void *)(ThData + i) );
+        assert( status == 0 );
+    }
+    for ( i = 0; i < nProcs; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );
+        assert( status == 0 );
+    }
+    iWinner = pShare->iWinner;
+    *pRetValue = iWinner >= 0 ? ThData[iWinner].RetValue : -1;
+    if ( iWinner == -1 )
+        iWinner = 0;
+    // stop the other workers
+    for ( i = 0; i < nProcs; i++ )
+    {
+        nImports += ThData[i].p->nImports;
+        if ( i == iWinner )
+            continue;
+        pTemp = ThData[i].p->pAig;
+        Pdr_ManStop( ThData[i].p );
+        Aig_ManStop( pTemp );
+    }
+    Pdr_ShrStop( pShare );
+    // transfer the results
+    p = ThData[iWinner].p;
+    p->pPars = pPars;
+    p->pShare = NULL;
+    p->pStop  = NULL;
+    Vec_PtrForEachEntry( sat_solver *, p->vSolvers, pSat, i )
+        sat_solver_set_stop( pSat, NULL );
+    pPars->iFrame         = Pars[iWinner].iFrame;
+    pPars->nFailOuts      = Pars[iWinner].nFailOuts;
+    pPars->nDropOuts      = Pars[iWinner].nDropOuts;
+    pPars->nProveOuts     = Pars[iWinner].nProveOuts;
+    pPars->timeLastSolved = Pars[iWinner].timeLastSolved;
+    pPars->nImports       = nImports;
+    if ( *pRetValue == 0 )
+    {
+        assert( p->pAig->pSeqModel != NULL );
+        pAig->pSeqModel = p->pAig->pSeqModel;
+        p->pAig->pSeqModel = NULL;
+    }
+    if ( pPars->fVerbose )
+    {
+        Abc_Print( 1, "Worker %d (out of %d) finished in frame %d. Imported clauses = %d.  ",
+            iWinner, nProcs, pPars->iFrame, nImports );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    if ( *pRetValue == 1 )
+    {
+        if ( !pPars->fSilent )
+            Pdr_ManReportInvariant( p );
+        if ( !pPars->fSilent )
+            Pdr_ManVerifyInvariant( p );
+        if ( pPars->vOutMap )
+            for ( i = 0; i < Saig_ManPoNum(pAig); i++ )
+                if ( Vec_IntEntry(pPars->vOutMap, i) == -2 ) // unknown
+                    Vec_IntWriteEntry( pPars->vOutMap, i, 1 ); // unsat
+    }
+    else if ( *pRetValue == 0 )
+    {
+        if ( pPars->vOutMap )
+            Vec_IntWriteEntry( pPars->vOutMap, p->iOutCur, 0 );
+    }
+    else if ( !pPars->fSilent )
+    {
+        if ( pPars->nTimeOut && Abc_Clock() >= clk + (abctime)pPars->nTimeOut * CLOCKS_PER_SEC )
+            Abc_Print( 1, "Reached timeout (%d seconds) in frame %d.\n", pPars->nTimeOut, pPars->iFrame );
+        else if ( pPars->nFrameMax && pPars->iFrame >= pPars->nFrameMax )
+            Abc_Print( 1, "Reached limit on the number of timeframes (%d).\n", pPars->nFrameMax );
+        else
+            Abc_Print( 1, "Reached resource limit in frame %d.\n", pPars->iFrame );
+    }
+    return p;
+}
+
+#endif // pthreads are used
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
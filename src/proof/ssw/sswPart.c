@@ -32,13 +32,6 @@
 #include <unistd.h>
 #endif
 
-#ifdef __cplusplus
-#include <atomic>
-using namespace std;
-#else
-#include <stdatomic.h>
-#include <stdbool.h>
-#endif
 
 #endif
 
@@ -97,104 +90,45 @@ void Ssw_SignalCorrespondenceArray( Vec_Ptr_t * vGias, Ssw_Pars_t * pPars )
 
 #else // pthreads are used
 
-
-#define PAR_THR_MAX 100
 typedef struct Par_ScorrThData_t_
 {
     Cec_ParCor_t CorPars;
     Gia_Man_t *  p;
-    int *        pMap;
-    int          iThread;
-    int          nTimeOut;
-    atomic_bool  fWorking;
 } Par_ScorrThData_t;
 
-void * Ssw_GiaWorkerThread( void * pArg )
+int Ssw_GiaWorkerTask( void * pArg )
 {
-    struct timespec pause_duration;
-    pause_duration.tv_sec = 0;
-    pause_duration.tv_nsec = 10000000L; // 10 milliseconds
-
     Par_ScorrThData_t * pThData = (Par_ScorrThData_t *)pArg;
-    while ( 1 )
-    {
-        while ( !atomic_load_explicit((atomic_bool *)&pThData->fWorking, memory_order_acquire) )
-            nanosleep(&pause_duration, NULL);
-        if ( pThData->p == NULL )
-        {
-            pthread_exit( NULL );
-            assert( 0 );
-            return NULL;
-        }
-        Cec_ManLSCorrespondenceClasses( pThData->p, &pThData->CorPars );
-        atomic_store_explicit(&pThData->fWorking, false, memory_order_release);
-    }
-    assert( 0 );
-    return NULL;
+    Cec_ManLSCorrespondenceClasses( pThData->p, &pThData->CorPars );
+    return 1;
 }
 
 void Ssw_SignalCorrespondenceArray( Vec_Ptr_t * vGias, Ssw_Pars_t * pPars )
 {
     //abctime clkTotal = Abc_Clock();
-    Par_ScorrThData_t ThData[PAR_THR_MAX];
-    pthread_t WorkerThread[PAR_THR_MAX];
-    int i, status, nProcs = pPars->nProcs;
-    Vec_Ptr_t * vStack;
+    Par_ScorrThData_t * pThData;
+    Vec_Ptr_t * vData;
+    Gia_Man_t * pGia;
+    int i;
     Cec_ParCor_t CorPars, * pCorPars = &CorPars;
     Cec_ManCorSetDefaultParams( pCorPars );
     if ( pPars->fVerbose )
-        printf( "Running concurrent &scorr with %d processes.\n", nProcs );
+        printf( "Running concurrent &scorr with %d processes.\n", pPars->nProcs );
     fflush( stdout );
     if ( pPars->nProcs < 2 )
         return Ssw_SignalCorrespondenceArray1( vGias, pPars );
-    // subtract manager thread
-    nProcs--;
-    assert( nProcs >= 1 && nProcs <= PAR_THR_MAX );
-    // start threads
-    for ( i = 0; i < nProcs; i++ )
-    {
-        ThData[i].CorPars  = *pCorPars;
-        ThData[i].iThread  = i;
-        atomic_store_explicit(&ThData[i].fWorking, false, memory_order_release);
-        status = pthread_create( WorkerThread + i, NULL, Ssw_GiaWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
-    }
-
-    struct timespec pause_duration;
-    pause_duration.tv_sec = 0;
-    pause_duration.tv_nsec = 10000000L; // 10 milliseconds
-
-    // look at the threads
-    vStack = Vec_PtrDup( vGias );
-    while ( Vec_PtrSize(vStack) > 0 )
-    {
-        for ( i = 0; i < nProcs; i++ )
-        {
-            if ( atomic_load_explicit(&ThData[i].fWorking, memory_order_acquire) )
-                continue;
-            ThData[i].p = (Gia_Man_t*)Vec_PtrPop( vStack );
-            atomic_store_explicit(&ThData[i].fWorking, true, memory_order_release);
-            break;
-        }
-    }
-    Vec_PtrFree( vStack );    
-    // wait till threads finish
-    for ( i = 0; i < nProcs; i++ )
-    {
-        if ( atomic_load_explicit(&ThData[i].fWorking, memory_order_acquire) )
-            i = -1; // Start from the beginning again
-        nanosleep(&pause_duration, NULL);
-    }
-
-    // stop threads
-    for ( i = 0; i < nProcs; i++ )
+    // the AIGs are processed by the shared pool of worker threads
+    pThData = ABC_CALLOC( Par_ScorrThData_t, Vec_PtrSize(vGias) );
+    vData   = Vec_PtrAlloc( Vec_PtrSize(vGias) );
+    Vec_PtrForEachEntry( Gia_Man_t *, vGias, pGia, i )
     {
-        ThData[i].p = NULL;
-        atomic_store_explicit(&ThData[i].fWorking, true, memory_order_release);
+        pThData[i].CorPars = *pCorPars;
+        pThData[i].p       = pGia;
+        Vec_PtrPush( vData, pThData + i );
     }
-
-    // Join threads
-    for ( i = 0; i < nProcs; i++ )
-        pthread_join( WorkerThread[i], NULL );
+    Util_ProcessThreads( Ssw_GiaWorkerTask, vData, pPars->nProcs, 0, pPars->fVerbose );
+    Vec_PtrFree( vData );
+    ABC_FREE( pThData );
 }
 
 #endif // pthreads are used
@@ -150,8 +150,10 @@ struct Bmc_AndPar_t_
     int         fDumpFrames;    // dump unrolled timeframes
     int         fUseSynth;      // use synthesis
     int         fUseOldCnf;     // use old CNF construction
+    int         fUseIncCnf;     // use incremental CNF construction
     int         fUseGlucose;    // use Glucose 3.0 as the default solver
     int         fUseEliminate;  // use variable elimination
+    int         fUseShare;      // use the portfolio of solvers sharing learned clauses
     int         fVerbose;       // verbose 
     int         fVeryVerbose;   // very verbose 
     int         fNotVerbose;    // skip line-by-line print-out 
@@ -162,6 +164,25 @@ struct Bmc_AndPar_t_
     void (*pFuncOnFrameDone)(int, int, int); // callback on each frame status (frame, po, statuss)
 };
   
+typedef struct Bmc_PortPar_t_ Bmc_PortPar_t;
+struct Bmc_PortPar_t_
+{
+    int         nSolvers;       // the number of solvers
+    int         nShareSize;     // the max size of a shared clause
+    int         nShareLbd;      // the max LBD of a shared clause
+    int         nBufferSize;    // the number of clauses in the exchange buffer
+    int         nConfLimit;     // the conflict limit of one solver in one call
+    int         nTimeOut;       // the timeout in seconds
+    int         fNoShare;       // disables clause sharing
+    int         fVerbose;       // verbose output
+};
+
+typedef struct Bmc_Port_t_ Bmc_Port_t;
+
+typedef struct Bmc_CnfInc_t_ Bmc_CnfInc_t;
+// adds a clause to a solver that should have at least nVars variables; returns 0 if the solver became UNSAT
+typedef int (*Bmc_CnfIncAddClause_f)( void * pSat, int * pLits, int nLits, int nVars );
+
 typedef struct Bmc_BCorePar_t_ Bmc_BCorePar_t;
 struct Bmc_BCorePar_t_
 {
@@ -245,9 +266,32 @@ extern Abc_Cex_t *       Saig_ManCexMinPerform( Aig_Man_t * pAig, Abc_Cex_t * pC
 extern void              Bmc_CexPrint( Abc_Cex_t * pCex, int nRealPis, int fVerbose );
 extern int               Bmc_CexVerify( Gia_Man_t * p, Abc_Cex_t * pCex, Abc_Cex_t * pCexCare );
 extern int               Bmc_CexVerifyAnyPo( Gia_Man_t * p, Abc_Cex_t * pCex, Abc_Cex_t * pCexCare );
+/*=== bmcCnfInc.c ==========================================================*/
+extern Bmc_CnfInc_t *    Bmc_CnfIncStart( Gia_Man_t * pGia );
+extern void              Bmc_CnfIncStop( Bmc_CnfInc_t * p );
+extern void              Bmc_CnfIncAddSolver( Bmc_CnfInc_t * p, void * pSat, Bmc_CnfIncAddClause_f pFunc );
+extern int               Bmc_CnfIncPoLit( Bmc_CnfInc_t * p, int iPo, int f );
+extern int               Bmc_CnfIncPiVar( Bmc_CnfInc_t * p, int iPi, int f );
+extern int               Bmc_CnfIncVarNum( Bmc_CnfInc_t * p );
+extern int               Bmc_CnfIncClauseNum( Bmc_CnfInc_t * p );
+extern int               Bmc_CnfIncIsUnsat( Bmc_CnfInc_t * p );
+extern double            Bmc_CnfIncMemory( Bmc_CnfInc_t * p );
 /*=== bmcICheck.c ==========================================================*/
 extern void              Bmc_PerformICheck( Gia_Man_t * p, int nFramesMax, int nTimeOut, int fEmpty, int fVerbose );
 extern Vec_Int_t *       Bmc_PerformISearch( Gia_Man_t * p, int nFramesMax, int nTimeOut, int fReverse, int fBackTopo, int fDump, int fVerbose );
+/*=== bmcPort.c ==========================================================*/
+extern void              Bmc_PortSetDefaultParams( Bmc_PortPar_t * p );
+extern Bmc_Port_t *      Bmc_PortStart( Bmc_PortPar_t * pPars );
+extern void              Bmc_PortStop( Bmc_Port_t * p );
+extern int               Bmc_PortAddVar( Bmc_Port_t * p );
+extern void              Bmc_PortSetNVars( Bmc_Port_t * p, int nVars );
+extern int               Bmc_PortVarNum( Bmc_Port_t * p );
+extern int               Bmc_PortAddClause( Bmc_Port_t * p, int * pLits, int nLits );
+extern int               Bmc_PortSolve( Bmc_Port_t * p, int * pLits, int nLits );
+extern int               Bmc_PortVarValue( Bmc_Port_t * p, int iVar );
+extern int               Bmc_PortWinner( Bmc_Port_t * p );
+extern int               Bmc_PortImportNum( Bmc_Port_t * p );
+extern void              Bmc_PortPrintStats( Bmc_Port_t * p );
 /*=== bmcUnroll.c ==========================================================*/
 extern Unr_Man_t *       Unr_ManUnrollStart( Gia_Man_t * pGia, int fVerbose );
 extern Gia_Man_t *       Unr_ManUnrollFrame( Unr_Man_t * p, int f );
@@ -41,6 +41,8 @@ struct Bmcg_Man_t_
     Vec_Int_t         vFr2Sat;             // mapping of objects in pFrames into SAT variables
     Vec_Int_t         vCiMap;              // maps CIs of pFrames into CIs/frames of GIA
     bmcg_sat_solver * pSats[PAR_THR_MAX];  // concurrent SAT solvers
+    Bmc_CnfInc_t *    pCnfInc;             // incremental CNF of the timeframes
+    Vec_Int_t         vPoLits;             // SAT literals of the POs in the new timeframes
     int               nSatVars;            // number of SAT variables used
     int               nOldFrPis;           // number of primary inputs
     int               nOldFrPos;           // number of primary output
@@ -94,6 +96,8 @@ Bmcg_Man_t * Bmcg_ManStart( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
         bmcg_sat_solver_addclause( p->pSats[i], &Lit, 1 );  
         bmcg_sat_solver_set_stop( p->pSats[i], &p->fStopNow );
     }
+    if ( pPars->fUseIncCnf && !pPars->fUseEliminate )
+        p->pCnfInc = Bmc_CnfIncStart( pGia );
     p->nSatVars = 1;
     return p;
 }
@@ -106,6 +110,9 @@ void Bmcg_ManStop( Bmcg_Man_t * p )
     Vec_PtrErase( &p->vGia2Fr );
     Vec_IntErase( &p->vFr2Sat );
     Vec_IntErase( &p->vCiMap );
+    Vec_IntErase( &p->vPoLits );
+    if ( p->pCnfInc )
+        Bmc_CnfIncStop( p->pCnfInc );
     for ( i = 0; i < p->pPars->nProcs; i++ )
         if ( p->pSats[i] ) 
             bmcg_sat_solver_stop( p->pSats[i] );
@@ -286,7 +293,7 @@ void Bmcg_ManPrintFrame( Bmcg_Man_t * p, int f, int nClauses, int Solver, abctim
     Abc_Print( 1, "Conf =%9.0f.  ", (double)bmcg_sat_solver_conflictnum(p->pSats[0]) );  
     if ( p->pPars->nProcs > 1 )
         Abc_Print( 1, "S = %3d. ",  Solver );
-    Abc_Print( 1, "%4.0f MB",       1.0*((int)Gia_ManMemory(p->pFrames) + Vec_IntMemory(&p->vFr2Sat))/(1<<20) );
+    Abc_Print( 1, "%4.0f MB",       1.0*((int)Gia_ManMemory(p->pFrames) + Vec_IntMemory(&p->vFr2Sat) + (p->pCnfInc ? Bmc_CnfIncMemory(p->pCnfInc) : 0))/(1<<20) );
     Abc_Print( 1, "%9.2f sec  ",    (float)(Abc_Clock() - clkStart)/(float)(CLOCKS_PER_SEC) );
     printf( "\n" );
     fflush( stdout );
@@ -307,6 +314,18 @@ Abc_Cex_t * Bmcg_ManGenerateCex( Bmcg_Man_t * p, int i, int f, int s )
 {
     Abc_Cex_t * pCex = Abc_CexMakeTriv( Gia_ManRegNum(p->pGia), Gia_ManPiNum(p->pGia), Gia_ManPoNum(p->pGia), f*Gia_ManPoNum(p->pGia)+i );
     Gia_Obj_t * pObj;  int k;
+    if ( p->pCnfInc )
+    {
+        int iFrame;
+        for ( iFrame = 0; iFrame <= f; iFrame++ )
+        for ( k = 0; k < Gia_ManPiNum(p->pGia); k++ )
+        {
+            int iSatVar = Bmc_CnfIncPiVar( p->pCnfInc, k, iFrame );
+            if ( iSatVar > 0 && bmcg_sat_solver_read_cex_varvalue(p->pSats[s], iSatVar) ) // 1 bit
+                Abc_InfoSetBit( pCex->pData, Gia_ManRegNum(p->pGia) + iFrame * Gia_ManPiNum(p->pGia) + k );
+        }
+        return pCex;
+    }
     Gia_ManForEachPi( p->pFrames, pObj, k )
     {
         int iSatVar = Vec_IntEntry( &p->vFr2Sat, Gia_ObjId(p->pFrames, pObj) );
@@ -354,6 +373,66 @@ void Bmcg_ManAddCnf( Bmcg_Man_t * p, bmcg_sat_solver * pSat, Cnf_Dat_t * pCnf )
             Vec_IntWriteEntry( &p->vFr2Sat, i, -1 );
     p->timeSmp += Abc_Clock() - clk;
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the CNF of the new timeframes to the solver.]
+
+  Description [Returns the number of new clauses or -1 if the outputs
+  of the new timeframes are constant 0. The SAT literals of the outputs
+  are stored in p->vPoLits.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmcg_ManAddClause( void * pSat, int * pLits, int nLits, int nVars )
+{
+    bmcg_sat_solver_set_nvars( (bmcg_sat_solver *)pSat, nVars );
+    return nLits == 0 || bmcg_sat_solver_addclause( (bmcg_sat_solver *)pSat, pLits, nLits );
+}
+int Bmcg_ManAddNewFrames( Bmcg_Man_t * p, int f, int nFramesAdd )
+{
+    abctime clk = Abc_Clock();
+    int i, k, iLit, nClauses, fTrivial = 1;
+    Vec_IntClear( &p->vPoLits );
+    if ( p->pCnfInc == NULL )
+    {
+        Cnf_Dat_t * pCnf = Bmcg_ManAddNewCnf( p, f, nFramesAdd );
+        if ( pCnf == NULL )
+            return -1;
+        Bmcg_ManAddCnf( p, p->pSats[0], pCnf );
+        nClauses = pCnf->nClauses;
+        Cnf_DataFree( pCnf );
+        assert( Gia_ManPoNum(p->pFrames) == (f + nFramesAdd) * Gia_ManPoNum(p->pGia) );
+        for ( k = 0; k < nFramesAdd; k++ )
+        for ( i = 0; i < Gia_ManPoNum(p->pGia); i++ )
+        {
+            int iObj = Gia_ObjId( p->pFrames, Gia_ManCo(p->pFrames, (f+k) * Gia_ManPoNum(p->pGia) + i) );
+            Vec_IntPush( &p->vPoLits, Abc_Var2Lit(Vec_IntEntry(&p->vFr2Sat, iObj), 0) );
+        }
+        return nClauses;
+    }
+    // the solver receives the clauses as they are generated
+    if ( f == 0 )
+        Bmc_CnfIncAddSolver( p->pCnfInc, p->pSats[0], Bmcg_ManAddClause );
+    nClauses = Bmc_CnfIncClauseNum( p->pCnfInc );
+    for ( k = 0; k < nFramesAdd; k++ )
+    for ( i = 0; i < Gia_ManPoNum(p->pGia); i++ )
+    {
+        iLit = Bmc_CnfIncPoLit( p->pCnfInc, i, f+k );
+        Vec_IntPush( &p->vPoLits, iLit );
+        fTrivial &= (iLit == 0);
+    }
+    // some PI variables may not appear in the clauses
+    p->nSatVars = Bmc_CnfIncVarNum( p->pCnfInc );
+    Bmcg_ManAddClause( p->pSats[0], NULL, 0, p->nSatVars );
+    // the outputs cannot be satisfied if the solver became UNSAT
+    fTrivial |= Bmc_CnfIncIsUnsat( p->pCnfInc );
+    p->timeCnf += Abc_Clock() - clk;
+    return fTrivial ? -1 : Bmc_CnfIncClauseNum( p->pCnfInc ) - nClauses;
+}
 int Bmcg_ManPerformOne( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
 {
     abctime clkStart = Abc_Clock();
@@ -362,8 +441,8 @@ int Bmcg_ManPerformOne( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
     Abc_CexFreeP( &pGia->pCexSeq );
     for ( f = 0; !pPars->nFramesMax || f < pPars->nFramesMax; f += pPars->nFramesAdd )
     {
-        Cnf_Dat_t * pCnf = Bmcg_ManAddNewCnf( p, f, pPars->nFramesAdd );
-        if ( pCnf == NULL )
+        int nClausesNew = Bmcg_ManAddNewFrames( p, f, pPars->nFramesAdd );
+        if ( nClausesNew == -1 )
         {
             Bmcg_ManPrintFrame( p, f, nClauses, -1, clkStart );
             if( pPars->pFuncOnFrameDone )
@@ -372,17 +451,13 @@ int Bmcg_ManPerformOne( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
                     pPars->pFuncOnFrameDone(f+k, i, 0);
             continue;
         }
-        nClauses += pCnf->nClauses;
-        Bmcg_ManAddCnf( p, p->pSats[0], pCnf );
-        Cnf_DataFree( pCnf );
-        assert( Gia_ManPoNum(p->pFrames) == (f + pPars->nFramesAdd) * Gia_ManPoNum(pGia) );
+        nClauses += nClausesNew;
         for ( k = 0; k < pPars->nFramesAdd; k++ )
         {
             for ( i = 0; i < Gia_ManPoNum(pGia); i++ )
             {
                 abctime clk = Abc_Clock();
-                int iObj = Gia_ObjId( p->pFrames, Gia_ManCo(p->pFrames, (f+k) * Gia_ManPoNum(pGia) + i) );
-                int iLit = Abc_Var2Lit( Vec_IntEntry(&p->vFr2Sat, iObj), 0 );
+                int iLit = Vec_IntEntry( &p->vPoLits, k * Gia_ManPoNum(pGia) + i );
                 if ( pPars->nTimeOut && (Abc_Clock() - clkStart)/CLOCKS_PER_SEC >= pPars->nTimeOut )
                     break;
                 status = bmcg_sat_solver_solve( p->pSats[0], &iLit, 1 );
@@ -77,6 +77,9 @@ struct Bmcs_Man_t_
     Vec_Int_t         vFr2Sat;             // mapping of objects in pFrames into SAT variables
     Vec_Int_t         vCiMap;              // maps CIs of pFrames into CIs/frames of GIA
     bmc_sat_solver *  pSats[PAR_THR_MAX];  // concurrent SAT solvers
+    Bmc_Port_t *      pPort;               // portfolio of solvers sharing learned clauses
+    Bmc_CnfInc_t *    pCnfInc;             // incremental CNF of the timeframes
+    Vec_Int_t         vPoLits;             // SAT literals of the POs in the new timeframes
     int               nSatVars;            // number of SAT variables used
     int               nSatVarsOld;         // number of SAT variables used
     int               fStopNow;            // signal when it is time to stop
@@ -381,7 +384,17 @@ Bmcs_Man_t * Bmcs_ManStart( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
     Vec_IntGrow( &p->vFr2Sat, 3*Gia_ManCiNum(pGia) );  
     Vec_IntPush( &p->vFr2Sat, 0 );
     Vec_IntGrow( &p->vCiMap, 3*Gia_ManCiNum(pGia) );
-    for ( i = 0; i < pPars->nProcs; i++ )
+    if ( pPars->fUseShare )
+    {
+        Bmc_PortPar_t ParsPort, * pParsPort = &ParsPort;
+        Bmc_PortSetDefaultParams( pParsPort );
+        pParsPort->nSolvers   = pPars->nProcs;
+        pParsPort->nConfLimit = pPars->nConfLimit;
+        p->pPort = Bmc_PortStart( pParsPort );
+        Bmc_PortAddVar( p->pPort );
+        Bmc_PortAddClause( p->pPort, &Lit, 1 );
+    }
+    for ( i = 0; !pPars->fUseShare && i < pPars->nProcs; i++ )
     {
         // modify parameters to get different SAT solvers
         opts.f_rst = 0.8 - i * 0.05;
@@ -398,6 +411,10 @@ Bmcs_Man_t * Bmcs_ManStart( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
         bmc_sat_solver_addclause( p->pSats[i], &Lit, 1 );  
         bmc_sat_solver_setstop( p->pSats[i], &p->fStopNow );
     }
+#ifndef ABC_USE_EXT_SOLVERS
+    if ( pPars->fUseIncCnf )
+        p->pCnfInc = Bmc_CnfIncStart( pGia );
+#endif
     p->nSatVars = 1;
     return p;
 }
@@ -410,9 +427,14 @@ void Bmcs_ManStop( Bmcs_Man_t * p )
     Vec_PtrErase( &p->vGia2Fr );
     Vec_IntErase( &p->vFr2Sat );
     Vec_IntErase( &p->vCiMap );
+    Vec_IntErase( &p->vPoLits );
+    if ( p->pCnfInc )
+        Bmc_CnfIncStop( p->pCnfInc );
     for ( i = 0; i < p->pPars->nProcs; i++ )
         if ( p->pSats[i] ) 
             bmc_sat_solver_stop( p->pSats[i] );
+    if ( p->pPort )
+        Bmc_PortStop( p->pPort );
     ABC_FREE( p );
 }
 
@@ -583,17 +605,25 @@ void Bmcs_ManPrintFrame( Bmcs_Man_t * p, int f, int nClauses, int Solver, abctim
         return;
     Abc_Print( 1, "%4d %s : ", f,   fUnfinished ? "-" : "+" );
 #ifndef ABC_USE_EXT_SOLVERS
+    if ( p->pPort )
+    {
+    Abc_Print( 1, "Var =%8.0f.  ",  (double)Bmc_PortVarNum(p->pPort) ); 
+    Abc_Print( 1, "Cla =%9.0f.  ",  (double)nClauses );  
+    }
+    else
+    {
     Abc_Print( 1, "Var =%8.0f.  ",  (double)satoko_varnum(p->pSats[0]) ); 
     Abc_Print( 1, "Cla =%9.0f.  ",  (double)satoko_clausenum(p->pSats[0]) );  
     Abc_Print( 1, "Learn =%9.0f.  ",(double)satoko_learntnum(p->pSats[0]) );  
     Abc_Print( 1, "Conf =%9.0f.  ", (double)satoko_conflictnum(p->pSats[0]) );  
+    }
 #else
     Abc_Print( 1, "Var =%8.0f.  ",  (double)p->nSatVars ); 
     Abc_Print( 1, "Cla =%9.0f.  ",  (double)nClauses );  
 #endif
     if ( p->pPars->nProcs > 1 )
         Abc_Print( 1, "S = %3d. ",  Solver );
-    Abc_Print( 1, "%4.0f MB",       1.0*((int)Gia_ManMemory(p->pFrames) + Vec_IntMemory(&p->vFr2Sat))/(1<<20) );
+    Abc_Print( 1, "%4.0f MB",       1.0*((int)Gia_ManMemory(p->pFrames) + Vec_IntMemory(&p->vFr2Sat) + (p->pCnfInc ? Bmc_CnfIncMemory(p->pCnfInc) : 0))/(1<<20) );
     Abc_Print( 1, "%9.2f sec  ",    (float)(Abc_Clock() - clkStart)/(float)(CLOCKS_PER_SEC) );
     printf( "\n" );
     fflush( stdout );
@@ -613,10 +643,22 @@ Abc_Cex_t * Bmcs_ManGenerateCex( Bmcs_Man_t * p, int i, int f, int s )
 {
     Abc_Cex_t * pCex = Abc_CexMakeTriv( Gia_ManRegNum(p->pGia), Gia_ManPiNum(p->pGia), Gia_ManPoNum(p->pGia), f*Gia_ManPoNum(p->pGia)+i );
     Gia_Obj_t * pObj;  int k;
+    if ( p->pCnfInc )
+    {
+        int iFrame;
+        for ( iFrame = 0; iFrame <= f; iFrame++ )
+        for ( k = 0; k < Gia_ManPiNum(p->pGia); k++ )
+        {
+            int iSatVar = Bmc_CnfIncPiVar( p->pCnfInc, k, iFrame );
+            if ( iSatVar > 0 && (p->pPort ? Bmc_PortVarValue(p->pPort, iSatVar) : bmc_sat_solver_read_cex_varvalue(p->pSats[s], iSatVar)) ) // 1 bit
+                Abc_InfoSetBit( pCex->pData, Gia_ManRegNum(p->pGia) + iFrame * Gia_ManPiNum(p->pGia) + k );
+        }
+        return pCex;
+    }
     Gia_ManForEachPi( p->pFrames, pObj, k )
     {
         int iSatVar = Vec_IntEntry( &p->vFr2Sat, Gia_ObjId(p->pFrames, pObj) );
-        if ( iSatVar > 0 && bmc_sat_solver_read_cex_varvalue(p->pSats[s], iSatVar) ) // 1 bit
+        if ( iSatVar > 0 && (p->pPort ? Bmc_PortVarValue(p->pPort, iSatVar) : bmc_sat_solver_read_cex_varvalue(p->pSats[s], iSatVar)) ) // 1 bit
         {
             int iCiId   = Vec_IntEntry( &p->vCiMap, 2*k+0 );
             int iFrame  = Vec_IntEntry( &p->vCiMap, 2*k+1 );
@@ -634,6 +676,95 @@ void Bmcs_ManAddCnf( Bmcs_Man_t * p, bmc_sat_solver * pSat, Cnf_Dat_t * pCnf )
         if ( !bmc_sat_solver_addclause( pSat, pCnf->pClauses[i], pCnf->pClauses[i+1]-pCnf->pClauses[i] ) )
             assert( 0 );
 }
+void Bmcs_ManAddCnfPort( Bmcs_Man_t * p, Cnf_Dat_t * pCnf )
+{
+    int i;
+    Bmc_PortSetNVars( p->pPort, p->nSatVars );
+    for ( i = 0; i < pCnf->nClauses; i++ )
+        if ( !Bmc_PortAddClause( p->pPort, pCnf->pClauses[i], pCnf->pClauses[i+1]-pCnf->pClauses[i] ) )
+            assert( 0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the CNF of the new timeframes to the solvers.]
+
+  Description [Returns the number of new clauses or -1 if the outputs
+  of the new timeframes are constant 0. The SAT literals of the outputs
+  are stored in p->vPoLits.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifndef ABC_USE_EXT_SOLVERS
+int Bmcs_ManAddClauseSatoko( void * pSat, int * pLits, int nLits, int nVars )
+{
+    while ( satoko_varnum((satoko_t *)pSat) < nVars )
+        satoko_add_variable( (satoko_t *)pSat, 0 );
+    return nLits == 0 || satoko_add_clause( (satoko_t *)pSat, pLits, nLits );
+}
+int Bmcs_ManAddClausePort( void * pPort, int * pLits, int nLits, int nVars )
+{
+    Bmc_PortSetNVars( (Bmc_Port_t *)pPort, nVars );
+    return nLits == 0 || Bmc_PortAddClause( (Bmc_Port_t *)pPort, pLits, nLits );
+}
+#endif
+int Bmcs_ManAddNewFrames( Bmcs_Man_t * p, int f, int nFramesAdd, int nSolvers )
+{
+    abctime clk = Abc_Clock();
+    int i, k, iLit, nClauses, fTrivial = 1;
+    Vec_IntClear( &p->vPoLits );
+    if ( p->pCnfInc == NULL )
+    {
+        Cnf_Dat_t * pCnf = Bmcs_ManAddNewCnf( p, f, nFramesAdd );
+        if ( pCnf == NULL )
+            return -1;
+        if ( p->pPort )
+            Bmcs_ManAddCnfPort( p, pCnf );
+        else
+            for ( i = 0; i < nSolvers; i++ )
+                Bmcs_ManAddCnf( p, p->pSats[i], pCnf );
+        p->nSatVarsOld = p->nSatVars;
+        nClauses = pCnf->nClauses;
+        Cnf_DataFree( pCnf );
+        assert( Gia_ManPoNum(p->pFrames) == (f + nFramesAdd) * Gia_ManPoNum(p->pGia) );
+        for ( k = 0; k < nFramesAdd; k++ )
+        for ( i = 0; i < Gia_ManPoNum(p->pGia); i++ )
+        {
+            int iObj = Gia_ObjId( p->pFrames, Gia_ManCo(p->pFrames, (f+k) * Gia_ManPoNum(p->pGia) + i) );
+            Vec_IntPush( &p->vPoLits, Abc_Var2Lit(Vec_IntEntry(&p->vFr2Sat, iObj), 0) );
+        }
+        return nClauses;
+    }
+#ifndef ABC_USE_EXT_SOLVERS
+    // the solvers receive the clauses as they are generated
+    if ( f == 0 && p->pPort )
+        Bmc_CnfIncAddSolver( p->pCnfInc, p->pPort, Bmcs_ManAddClausePort );
+    for ( i = 0; f == 0 && !p->pPort && i < nSolvers; i++ )
+        Bmc_CnfIncAddSolver( p->pCnfInc, p->pSats[i], Bmcs_ManAddClauseSatoko );
+    nClauses = Bmc_CnfIncClauseNum( p->pCnfInc );
+    for ( k = 0; k < nFramesAdd; k++ )
+    for ( i = 0; i < Gia_ManPoNum(p->pGia); i++ )
+    {
+        iLit = Bmc_CnfIncPoLit( p->pCnfInc, i, f+k );
+        Vec_IntPush( &p->vPoLits, iLit );
+        fTrivial &= (iLit == 0);
+    }
+    // some PI variables may not appear in the clauses
+    p->nSatVars = Bmc_CnfIncVarNum( p->pCnfInc );
+    if ( p->pPort )
+        Bmcs_ManAddClausePort( p->pPort, NULL, 0, p->nSatVars );
+    for ( i = 0; !p->pPort && i < nSolvers; i++ )
+        Bmcs_ManAddClauseSatoko( p->pSats[i], NULL, 0, p->nSatVars );
+    // the outputs cannot be satisfied if the solvers became UNSAT
+    fTrivial |= Bmc_CnfIncIsUnsat( p->pCnfInc );
+    nClauses = Bmc_CnfIncClauseNum( p->pCnfInc ) - nClauses;
+#endif
+    p->timeCnf += Abc_Clock() - clk;
+    return fTrivial ? -1 : nClauses;
+}
 int Bmcs_ManPerformOne( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
 {
     abctime clkStart = Abc_Clock();
@@ -642,8 +773,8 @@ int Bmcs_ManPerformOne( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
     Abc_CexFreeP( &pGia->pCexSeq );
     for ( f = 0; !pPars->nFramesMax || f < pPars->nFramesMax; f += pPars->nFramesAdd )
     {
-        Cnf_Dat_t * pCnf = Bmcs_ManAddNewCnf( p, f, pPars->nFramesAdd );
-        if ( pCnf == NULL )
+        int nClausesNew = Bmcs_ManAddNewFrames( p, f, pPars->nFramesAdd, 1 );
+        if ( nClausesNew == -1 )
         {
             Bmcs_ManPrintFrame( p, f, nClauses, -1, clkStart );
             if( pPars->pFuncOnFrameDone)
@@ -652,26 +783,21 @@ int Bmcs_ManPerformOne( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
                     pPars->pFuncOnFrameDone(f+k, i, 0);
             continue;
         }
-        nClauses += pCnf->nClauses;
-        Bmcs_ManAddCnf( p, p->pSats[0], pCnf );
-        p->nSatVarsOld = p->nSatVars;
-        Cnf_DataFree( pCnf );
-        assert( Gia_ManPoNum(p->pFrames) == (f + pPars->nFramesAdd) * Gia_ManPoNum(pGia) );
+        nClauses += nClausesNew;
         for ( k = 0; k < pPars->nFramesAdd; k++ )
         {
             for ( i = 0; i < Gia_ManPoNum(pGia); i++ )
             {
                 abctime clk = Abc_Clock();
-                int iObj = Gia_ObjId( p->pFrames, Gia_ManCo(p->pFrames, (f+k) * Gia_ManPoNum(pGia) + i) );
-                int iLit = Abc_Var2Lit( Vec_IntEntry(&p->vFr2Sat, iObj), 0 );
+                int iLit = Vec_IntEntry( &p->vPoLits, k * Gia_ManPoNum(pGia) + i );
                 if ( pPars->nTimeOut && (Abc_Clock() - clkStart)/CLOCKS_PER_SEC >= pPars->nTimeOut )
                     break;
-                status = bmc_sat_solver_solve( p->pSats[0], &iLit, 1 );
+                status = p->pPort ? Bmc_PortSolve( p->pPort, &iLit, 1 ) : bmc_sat_solver_solve( p->pSats[0], &iLit, 1 );
                 p->timeSat += Abc_Clock() - clk;
                 if ( status == l_False ) // unsat
                 {
                     if ( i == Gia_ManPoNum(pGia)-1 )
-                        Bmcs_ManPrintFrame( p, f+k, nClauses, -1, clkStart );
+                        Bmcs_ManPrintFrame( p, f+k, nClauses, p->pPort ? Bmc_PortWinner(p->pPort) : -1, clkStart );
                     if( pPars->pFuncOnFrameDone)
                         pPars->pFuncOnFrameDone(f+k, i, 0);
                     continue;
@@ -682,7 +808,7 @@ int Bmcs_ManPerformOne( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
                     pPars->iFrame = f+k;
                     pGia->pCexSeq = Bmcs_ManGenerateCex( p, i, f+k, 0 );
                     pPars->nFailOuts++;
-                    Bmcs_ManPrintFrame( p, f+k, nClauses, -1, clkStart );
+                    Bmcs_ManPrintFrame( p, f+k, nClauses, p->pPort ? Bmc_PortWinner(p->pPort) : -1, clkStart );
                     if ( !pPars->fNotVerbose )
                     {
                         int nOutDigits = Abc_Base10Log( Gia_ManPoNum(pGia) );
@@ -706,6 +832,8 @@ int Bmcs_ManPerformOne( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
         printf( "No output failed in %d frames.  ", f + (k < pPars->nFramesAdd ? k+1 : 0) );
     Abc_PrintTime( 1, "Time", Abc_Clock() - clkStart );
     Bmcs_ManPrintTime( p );
+    if ( p->pPort && pPars->fVerbose )
+        Bmc_PortPrintStats( p->pPort );
     Bmcs_ManStop( p );
     return RetValue;
 }
@@ -830,8 +958,9 @@ int Bmcs_ManPerformMulti( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
     // solve properties in each timeframe
     for ( f = 0; !pPars->nFramesMax || f < pPars->nFramesMax; f += pPars->nFramesAdd )
     {
-        Cnf_Dat_t * pCnf = Bmcs_ManAddNewCnf( p, f, pPars->nFramesAdd );
-        if ( pCnf == NULL )
+        // load CNF into solvers
+        int nClausesNew = Bmcs_ManAddNewFrames( p, f, pPars->nFramesAdd, pPars->nProcs );
+        if ( nClausesNew == -1 )
         {
             Bmcs_ManPrintFrame( p, f, nClauses, 0, clkStart );
             if( pPars->pFuncOnFrameDone )
@@ -840,21 +969,14 @@ int Bmcs_ManPerformMulti( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
                     pPars->pFuncOnFrameDone(f+k, i, 0);
             continue;
         }
-        // load CNF into solvers
-        nClauses += pCnf->nClauses;
-        for ( i = 0; i < pPars->nProcs; i++ )
-            Bmcs_ManAddCnf( p, p->pSats[i], pCnf );
-        p->nSatVarsOld = p->nSatVars;
-        Cnf_DataFree( pCnf );
+        nClauses += nClausesNew;
         // solve outputs
-        assert( Gia_ManPoNum(p->pFrames) == (f + pPars->nFramesAdd) * Gia_ManPoNum(pGia) );
         for ( k = 0; k < pPars->nFramesAdd; k++ )
         {
             for ( i = 0; i < Gia_ManPoNum(pGia); i++ )
             {
                 abctime clk = Abc_Clock();
-                int iObj = Gia_ObjId( p->pFrames, Gia_ManCo(p->pFrames, (f+k) * Gia_ManPoNum(pGia) + i) );
-                int iLit = Abc_Var2Lit( Vec_IntEntry(&p->vFr2Sat, iObj), 0 );
+                int iLit = Vec_IntEntry( &p->vPoLits, k * Gia_ManPoNum(pGia) + i );
                 if ( pPars->nTimeOut && (Abc_Clock() - clkStart)/CLOCKS_PER_SEC >= pPars->nTimeOut )
                     break;
                 status = Bmcs_ManPerform_Solve( p, iLit, WorkerThread, ThData, pPars->nProcs, &Solver );
@@ -925,7 +1047,7 @@ int Bmcs_ManPerformMulti( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
 int Bmcs_ManPerform( Gia_Man_t * pGia, Bmc_AndPar_t * pPars ) 
 { 
     assert( pPars->nProcs < PAR_THR_MAX );
-    if ( pPars->nProcs == 1 )
+    if ( pPars->nProcs == 1 || pPars->fUseShare )
         return Bmcs_ManPerformOne( pGia, pPars );
     else
         return Bmcs_ManPerformMulti( pGia, pPars );
@@ -0,0 +1,393 @@
+/**CFile****************************************************************
+
+  FileName    [bmcCnfInc.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [SAT-based bounded model checking.]
+
+  Synopsis    [Incremental CNF generation for growing unrollings.]
+
+  Author      [agent <agent@local>]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: bmcCnfInc.c,v 1.00 2026/10/17 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "bmc.h"
+#include "sat/cnf/cnf.h"
+#include "misc/vec/vecHsh.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define BMC_CNF_INC_SOLVERS 16
+
+// The sequential AIG is mapped once and the CNF of each mapped node is
+// kept as a template whose variables are object IDs. A timeframe is built
+// by instantiating the templates of the nodes in the cone of the requested
+// outputs, after substituting the literals of the fanins in this frame.
+// Constant fanins are propagated, so the nodes that become constant under
+// the initial state do not get SAT variables. SAT variable 0 is reserved
+// for constant 0 and the solvers are expected to assert its negation.
+// The literals are hashed by object and timeframe, so the memory is
+// proportional to the size of the cones rather than the size of the AIG.
+
+struct Bmc_CnfInc_t_
+{
+    Gia_Man_t *      pGia;         // copy of the user's AIG
+    Cnf_Dat_t *      pCnf;         // CNF templates (variables are object IDs)
+    Hsh_IntMan_t *   pHash;        // hash table of (object, timeframe) pairs
+    Vec_Int_t *      vKeys;        // the pairs with literals
+    Vec_Int_t *      vObjLits;     // the literals of the pairs
+    Vec_Int_t *      vStack;       // objects to visit (object and timeframe)
+    Vec_Int_t *      vLits;        // literals of one clause
+    Vec_Int_t *      vClas;        // clauses of one node (size followed by literals)
+    int              nVars;        // the number of SAT variables used
+    int              nClauses;     // the number of clauses generated
+    int              fUnsat;       // one of the solvers became UNSAT
+    int              nSolvers;     // the number of registered solvers
+    void *           pSats[BMC_CNF_INC_SOLVERS];  // registered solvers
+    Bmc_CnfIncAddClause_f pFuncs[BMC_CNF_INC_SOLVERS]; // their clause adding functions
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the incremental CNF builder.]
+
+  Description [Maps the AIG once into LUTs of at most 8 inputs.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Bmc_CnfInc_t * Bmc_CnfIncStart( Gia_Man_t * pGia )
+{
+    Bmc_CnfInc_t * p;
+    assert( Gia_ManRegNum(pGia) > 0 );
+    p = ABC_CALLOC( Bmc_CnfInc_t, 1 );
+    p->pGia     = Gia_ManDup( pGia );
+    p->pCnf     = (Cnf_Dat_t *)Mf_ManGenerateCnf( p->pGia, 8, 1, 0, 0, 0 );
+    p->pGia->pData = NULL;
+    p->vKeys    = Vec_IntAlloc( 2 * Gia_ManObjNum(p->pGia) );
+    p->vObjLits = Vec_IntAlloc( Gia_ManObjNum(p->pGia) );
+    p->pHash    = Hsh_IntManStart( p->vKeys, 2, Gia_ManObjNum(p->pGia) );
+    p->vStack   = Vec_IntAlloc( 1000 );
+    p->vLits    = Vec_IntAlloc( 16 );
+    p->vClas    = Vec_IntAlloc( 1000 );
+    p->nVars    = 1;
+    return p;
+}
+void Bmc_CnfIncStop( Bmc_CnfInc_t * p )
+{
+    Gia_ManStop( p->pGia );
+    Cnf_DataFree( p->pCnf );
+    Hsh_IntManStop( p->pHash );
+    Vec_IntFree( p->vKeys );
+    Vec_IntFree( p->vObjLits );
+    Vec_IntFree( p->vStack );
+    Vec_IntFree( p->vLits );
+    Vec_IntFree( p->vClas );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Registers a solver to receive the clauses.]
+
+  Description [The solver should contain variable 0 set to constant 0.
+  Only the clauses generated after the registration are added.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmc_CnfIncAddSolver( Bmc_CnfInc_t * p, void * pSat, Bmc_CnfIncAddClause_f pFunc )
+{
+    assert( p->nSolvers < BMC_CNF_INC_SOLVERS );
+    p->pSats[p->nSolvers]    = pSat;
+    p->pFuncs[p->nSolvers++] = pFunc;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reading statistics.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmc_CnfIncVarNum( Bmc_CnfInc_t * p )
+{
+    return p->nVars;
+}
+int Bmc_CnfIncClauseNum( Bmc_CnfInc_t * p )
+{
+    return p->nClauses;
+}
+int Bmc_CnfIncIsUnsat( Bmc_CnfInc_t * p )
+{
+    return p->fUnsat;
+}
+double Bmc_CnfIncMemory( Bmc_CnfInc_t * p )
+{
+    double Mem = sizeof(Bmc_CnfInc_t);
+    Mem += Gia_ManMemory( p->pGia );
+    Mem += 4.0 * p->pCnf->nLiterals + 8.0 * p->pCnf->nClauses;
+    Mem += Vec_IntMemory( p->vKeys ) + Vec_IntMemory( p->vObjLits );
+    Mem += Vec_IntMemory( p->pHash->vTable ) + Vec_WrdMemory( p->pHash->vObjs );
+    return Mem;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the literal of the object in the given frame.]
+
+  Description [Returns -1 if the literal is not derived yet.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Bmc_CnfIncLit( Bmc_CnfInc_t * p, int iObj, int f )
+{
+    int Key[2] = { iObj, f };
+    int * pPlace = Hsh_IntManLookup( p->pHash, (unsigned *)Key );
+    return *pPlace == -1 ? -1 : Vec_IntEntry( p->vObjLits, Hsh_IntObj(p->pHash, *pPlace)->iData );
+}
+static inline void Bmc_CnfIncSetLit( Bmc_CnfInc_t * p, int iObj, int f, int iLit )
+{
+    Vec_IntPushTwo( p->vKeys, iObj, f );
+    Vec_IntPush( p->vObjLits, iLit );
+    Hsh_IntManAdd( p->pHash, Vec_IntSize(p->vObjLits) - 1 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Sends one clause to the registered solvers.]
+
+  Description [Marks the instance UNSAT if one of the solvers became UNSAT.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Bmc_CnfIncEmit( Bmc_CnfInc_t * p, int * pLits, int nLits )
+{
+    int i;
+    for ( i = 0; i < p->nSolvers; i++ )
+        if ( !p->pFuncs[i]( p->pSats[i], pLits, nLits, p->nVars ) )
+            p->fUnsat = 1;
+    p->nClauses++;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Instantiates the CNF template of one node.]
+
+  Description [The literals of the fanins in this frame should be known.
+  Returns the literal of the node, which may be constant.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Bmc_CnfIncNode( Bmc_CnfInc_t * p, int iObj, int f )
+{
+    int * pClause, * pStop, * pLit, * pClas;
+    int i, k, iLit, iVar, fSat, iFirst = p->pCnf->pObj2Clause[iObj];
+    int iLimit = iFirst + p->pCnf->pObj2Count[iObj];
+    // substitute into the clauses, which start with the literal of the node
+    Vec_IntClear( p->vClas );
+    for ( i = iFirst; i < iLimit; i++ )
+    {
+        pClause = p->pCnf->pClauses[i];
+        pStop   = p->pCnf->pClauses[i+1];
+        assert( Abc_Lit2Var(pClause[0]) == iObj );
+        Vec_IntClear( p->vLits );
+        for ( fSat = 0, pLit = pClause + 1; pLit < pStop; pLit++ )
+        {
+            iLit = Bmc_CnfIncLit( p, Abc_Lit2Var(*pLit), f );
+            assert( iLit >= 0 );
+            iLit = Abc_LitNotCond( iLit, Abc_LitIsCompl(*pLit) );
+            if ( iLit == 1 )
+                break;
+            if ( iLit > 1 )
+                Vec_IntPush( p->vLits, iLit );
+        }
+        if ( pLit < pStop )
+            continue;
+        // remove duplicated literals and skip tautologies
+        Vec_IntUniqify( p->vLits );
+        for ( k = 1; k < Vec_IntSize(p->vLits); k++ )
+            if ( Vec_IntEntry(p->vLits, k-1) == Abc_LitNot(Vec_IntEntry(p->vLits, k)) )
+                fSat = 1;
+        if ( fSat )
+            continue;
+        // the node is constant if the clause reduces to its own literal
+        if ( Vec_IntSize(p->vLits) == 0 )
+            return !Abc_LitIsCompl(pClause[0]);
+        Vec_IntPush( p->vClas, Vec_IntSize(p->vLits) + 1 );
+        Vec_IntPush( p->vClas, Abc_LitIsCompl(pClause[0]) );
+        Vec_IntAppend( p->vClas, p->vLits );
+    }
+    // create the variable and add the clauses
+    iVar  = p->nVars++;
+    pClas = Vec_IntArray( p->vClas );
+    for ( i = 0; i < Vec_IntSize(p->vClas); i += pClas[i] + 1 )
+    {
+        pClas[i+1] = Abc_Var2Lit( iVar, pClas[i+1] );
+        Bmc_CnfIncEmit( p, pClas + i + 1, pClas[i] );
+    }
+    return Abc_Var2Lit( iVar, 0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the literal of the object in the given frame.]
+
+  Description [Returns -1 after pushing the fanins whose literals are
+  not known on the stack.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Bmc_CnfIncObjTry( Bmc_CnfInc_t * p, int iObj, int f )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p->pGia, iObj );
+    int * pLit, i, iFanin, iLit, iFirst, iLimit, nPushed = 0;
+    if ( iObj == 0 )
+        return 0;
+    if ( Gia_ObjIsPi(p->pGia, pObj) )
+        return Abc_Var2Lit( p->nVars++, 0 );
+    if ( Gia_ObjIsCi(pObj) )
+    {
+        // flops are initialized to zero
+        if ( f == 0 )
+            return 0;
+        iFanin = Gia_ObjId( p->pGia, Gia_ObjRoToRi(p->pGia, pObj) );
+        if ( (iLit = Bmc_CnfIncLit(p, iFanin, f-1)) == -1 )
+            Vec_IntPushTwo( p->vStack, iFanin, f-1 );
+        return iLit;
+    }
+    if ( Gia_ObjIsCo(pObj) )
+    {
+        iFanin = Gia_ObjFaninId0p( p->pGia, pObj );
+        if ( (iLit = Bmc_CnfIncLit(p, iFanin, f)) == -1 )
+            Vec_IntPushTwo( p->vStack, iFanin, f );
+        return iLit == -1 ? -1 : Abc_LitNotCond( iLit, Gia_ObjFaninC0(pObj) );
+    }
+    // the node is ready when the fanins of its clauses are known
+    assert( p->pCnf->pObj2Count[iObj] > 0 );
+    iFirst = p->pCnf->pObj2Clause[iObj];
+    iLimit = iFirst + p->pCnf->pObj2Count[iObj];
+    for ( i = iFirst; i < iLimit; i++ )
+        for ( pLit = p->pCnf->pClauses[i] + 1; pLit < p->pCnf->pClauses[i+1]; pLit++ )
+            if ( Bmc_CnfIncLit(p, Abc_Lit2Var(*pLit), f) == -1 )
+            {
+                Vec_IntPushTwo( p->vStack, Abc_Lit2Var(*pLit), f );
+                nPushed++;
+            }
+    return nPushed ? -1 : Bmc_CnfIncNode( p, iObj, f );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the literal of the object in the given frame.]
+
+  Description [Visits the objects without literals using an explicit
+  stack because the unrolled cones may be very deep. Literals 0 and 1
+  stand for the constants.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Bmc_CnfIncObjLit( Bmc_CnfInc_t * p, int iObj, int f )
+{
+    int iLit, iTop, fTop;
+    if ( (iLit = Bmc_CnfIncLit(p, iObj, f)) >= 0 )
+        return iLit;
+    Vec_IntClear( p->vStack );
+    Vec_IntPushTwo( p->vStack, iObj, f );
+    while ( Vec_IntSize(p->vStack) > 0 )
+    {
+        iTop = Vec_IntEntry( p->vStack, Vec_IntSize(p->vStack) - 2 );
+        fTop = Vec_IntEntryLast( p->vStack );
+        // the object may have been pushed more than once
+        if ( Bmc_CnfIncLit(p, iTop, fTop) == -1 )
+        {
+            if ( (iLit = Bmc_CnfIncObjTry(p, iTop, fTop)) == -1 )
+                continue;
+            Bmc_CnfIncSetLit( p, iTop, fTop, iLit );
+        }
+        Vec_IntShrink( p->vStack, Vec_IntSize(p->vStack) - 2 );
+    }
+    return Bmc_CnfIncLit( p, iObj, f );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the literal of the PO in the given frame.]
+
+  Description [Generates the clauses of its cone not generated before.
+  Literals 0 and 1 stand for the constants. The solvers should have
+  Bmc_CnfIncVarNum() variables before solving because some PI variables
+  may not appear in the clauses.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmc_CnfIncPoLit( Bmc_CnfInc_t * p, int iPo, int f )
+{
+    return Bmc_CnfIncObjLit( p, Gia_ObjId(p->pGia, Gia_ManPo(p->pGia, iPo)), f );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the SAT variable of the PI in the given frame.]
+
+  Description [Returns -1 if the PI was not used in this frame.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmc_CnfIncPiVar( Bmc_CnfInc_t * p, int iPi, int f )
+{
+    int iLit = Bmc_CnfIncLit( p, Gia_ObjId(p->pGia, Gia_ManPi(p->pGia, iPi)), f );
+    return iLit > 1 ? Abc_Lit2Var(iLit) : -1;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
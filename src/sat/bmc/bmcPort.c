@@ -0,0 +1,654 @@
+/**CFile****************************************************************
+
+  FileName    [bmcPort.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [SAT-based bounded model checking.]
+
+  Synopsis    [Portfolio of SAT solvers sharing learned clauses.]
+
+  Author      [agent <agent@local>]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: bmcPort.c,v 1.00 2026/10/17 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#ifdef ABC_USE_PTHREADS
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+#endif
+
+#include "bmc.h"
+#include "sat/bsat/satSolver.h"
+#include "sat/satoko/satoko.h"
+#include "sat/glucose/AbcGlucose.h"
+#include "misc/util/utilPool.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The solvers work on identical copies of the CNF (the same clauses and the same
+// variable numbering), so a clause learned by one of them is implied by the CNF
+// of any other and can be added to it without changing the result.
+// The learned clauses are exchanged through a ring of fixed-size slots.  A writer
+// takes a ticket by incrementing the head counter, claims the slot of the ticket by
+// marking its sequence number odd, copies the clause, and publishes it by writing
+// the even sequence number of the ticket.  Each solver reads the ring at its own
+// position and re-checks the sequence number after copying the clause, so that
+// slots overwritten by faster writers are detected and skipped (seqlock).
+// No locks are taken on this path, except in the fallback for compilers without
+// atomic built-ins.
+
+#define BMC_PORT_MAX    16      // the max number of solvers
+#define BMC_PORT_LITS   30      // the max number of literals in a shared clause
+
+#if defined(__GNUC__) || defined(__clang__)
+#define BMC_PORT_ATOMICS
+#endif
+
+enum { BMC_PORT_SATOKO, BMC_PORT_BSAT, BMC_PORT_GLUCOSE };
+
+typedef struct Bmc_PortSlot_t_ Bmc_PortSlot_t;
+struct Bmc_PortSlot_t_
+{
+    word             Seq;          // 2*t+1 while clause t is written; 2*t+2 when it is ready
+    int              iSolver;      // the solver that learned the clause
+    int              nLits;        // the number of literals
+    int              pLits[BMC_PORT_LITS]; // the literals
+};
+
+typedef struct Bmc_PortSat_t_ Bmc_PortSat_t;
+struct Bmc_PortSat_t_
+{
+    Bmc_Port_t *     pPort;        // the portfolio
+    void *           pSat;         // the solver
+    int              Type;         // the solver type
+    int              iSolver;      // the solver index
+    int              status;       // the result of the last call
+    word             iRead;        // the next ticket to read from the ring
+    Vec_Int_t        vAssump;      // the assumptions of the current call
+    int              pBuffer[BMC_PORT_LITS]; // the clause being imported
+    // statistics
+    word             nExported;    // the number of exported clauses
+    word             nImported;    // the number of imported clauses
+    word             nLost;        // the number of clauses overwritten before reading
+    word             nDropped;     // the number of clauses not written into a busy slot
+    int              nWins;        // the number of calls solved by this solver
+};
+
+struct Bmc_Port_t_
+{
+    Bmc_PortPar_t    Pars;         // parameters
+    Bmc_PortSlot_t * pSlots;       // the exchange buffer
+    word             Mask;         // the number of slots minus one
+    word             Head;         // the next ticket
+    Bmc_PortSat_t *  pSats;        // the solvers
+    int              nSats;        // the number of solvers
+    int              nVars;        // the number of variables
+    int              fUnsat;       // the CNF is UNSAT
+    int              fStop;        // the stop flag polled by the solvers
+    int              iWinner;      // the solver that decided the last call
+    Vec_Int_t        vTemp;        // temporary clause
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t  Mutex;        // the lock to select the winner
+    Util_Pool_t *    pPool;        // the worker threads running the solvers
+#endif
+    // statistics
+    int              nCalls;       // the number of calls
+    abctime          timeSolve;    // the solving time
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Atomic access to the counters of the exchange buffer.]
+
+  Description [Without atomic built-ins, the accesses are serialized by
+  the portfolio mutex, which also orders the surrounding memory accesses.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline word Bmc_PortLoad( Bmc_Port_t * p, word * pVal )
+{
+#if defined(BMC_PORT_ATOMICS)
+    return __atomic_load_n( pVal, __ATOMIC_ACQUIRE );
+#elif defined(ABC_USE_PTHREADS)
+    word Val;
+    pthread_mutex_lock( &p->Mutex );
+    Val = *pVal;
+    pthread_mutex_unlock( &p->Mutex );
+    return Val;
+#else
+    return *pVal;
+#endif
+}
+static inline word Bmc_PortReload( Bmc_Port_t * p, word * pVal )
+{
+#if defined(BMC_PORT_ATOMICS)
+    __atomic_thread_fence( __ATOMIC_ACQUIRE );
+    return __atomic_load_n( pVal, __ATOMIC_RELAXED );
+#else
+    return Bmc_PortLoad( p, pVal );
+#endif
+}
+static inline void Bmc_PortStore( Bmc_Port_t * p, word * pVal, word Val )
+{
+#if defined(BMC_PORT_ATOMICS)
+    __atomic_store_n( pVal, Val, __ATOMIC_RELEASE );
+#elif defined(ABC_USE_PTHREADS)
+    pthread_mutex_lock( &p->Mutex );
+    *pVal = Val;
+    pthread_mutex_unlock( &p->Mutex );
+#else
+    *pVal = Val;
+#endif
+}
+static inline word Bmc_PortFetchInc( Bmc_Port_t * p, word * pVal )
+{
+#if defined(BMC_PORT_ATOMICS)
+    return __atomic_fetch_add( pVal, 1, __ATOMIC_ACQ_REL );
+#elif defined(ABC_USE_PTHREADS)
+    word Val;
+    pthread_mutex_lock( &p->Mutex );
+    Val = (*pVal)++;
+    pthread_mutex_unlock( &p->Mutex );
+    return Val;
+#else
+    return (*pVal)++;
+#endif
+}
+static inline int Bmc_PortCas( Bmc_Port_t * p, word * pVal, word Old, word New )
+{
+#if defined(BMC_PORT_ATOMICS)
+    return __atomic_compare_exchange_n( pVal, &Old, New, 0, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED );
+#else
+    int RetValue = 0;
+#if defined(ABC_USE_PTHREADS)
+    pthread_mutex_lock( &p->Mutex );
+#endif
+    if ( *pVal == Old )
+        *pVal = New, RetValue = 1;
+#if defined(ABC_USE_PTHREADS)
+    pthread_mutex_unlock( &p->Mutex );
+#endif
+    return RetValue;
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Exports a learned clause into the exchange buffer.]
+
+  Description [Called by the solver after learning a clause. Only short
+  clauses and clauses with low LBD are shared.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Bmc_PortExport( void * pArg, int * pLits, int nLits, int Lbd )
+{
+    Bmc_PortSat_t * pSat = (Bmc_PortSat_t *)pArg;
+    Bmc_Port_t * p = pSat->pPort;
+    Bmc_PortSlot_t * pSlot;
+    word Ticket, Seq;
+    if ( nLits > BMC_PORT_LITS || (nLits > p->Pars.nShareSize && Lbd > p->Pars.nShareLbd) )
+        return;
+    Ticket = Bmc_PortFetchInc( p, &p->Head );
+    pSlot  = p->pSlots + (Ticket & p->Mask);
+    Seq    = Bmc_PortLoad( p, &pSlot->Seq );
+    // give up if the slot is being written or was claimed by a later ticket
+    if ( (Seq & 1) || Seq > 2*Ticket || !Bmc_PortCas( p, &pSlot->Seq, Seq, 2*Ticket+1 ) )
+    {
+        pSat->nDropped++;
+        return;
+    }
+    pSlot->iSolver = pSat->iSolver;
+    pSlot->nLits   = nLits;
+    memcpy( pSlot->pLits, pLits, sizeof(int) * nLits );
+    Bmc_PortStore( p, &pSlot->Seq, 2*Ticket+2 );
+    pSat->nExported++;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the next clause learned by another solver.]
+
+  Description [Called by the solver at a restart. Returns the number of
+  literals and sets the pointer to them, or returns -1 if there are no new
+  clauses. The literals may be reordered by the caller.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Bmc_PortImport( void * pArg, int ** ppLits )
+{
+    Bmc_PortSat_t * pSat = (Bmc_PortSat_t *)pArg;
+    Bmc_Port_t * p = pSat->pPort;
+    Bmc_PortSlot_t * pSlot;
+    word Head, Ticket, Seq;
+    int iSolver, nLits;
+    while ( 1 )
+    {
+        Head = Bmc_PortLoad( p, &p->Head );
+        if ( pSat->iRead >= Head )
+            return -1;
+        // skip the clauses overwritten before this solver got to them
+        if ( Head - pSat->iRead > p->Mask + 1 )
+        {
+            pSat->nLost += Head - (p->Mask + 1) - pSat->iRead;
+            pSat->iRead  = Head - (p->Mask + 1);
+        }
+        Ticket = pSat->iRead;
+        pSlot  = p->pSlots + (Ticket & p->Mask);
+        Seq    = Bmc_PortLoad( p, &pSlot->Seq );
+        // wait for the clause that is not claimed or not written yet;
+        // if the exporter dropped it, the slot is skipped above once
+        // the head is a full buffer ahead
+        if ( Seq < 2*Ticket+2 )
+            return -1;
+        pSat->iRead++;
+        // skip the clause that was overwritten by a later ticket
+        if ( Seq > 2*Ticket+2 )
+        {
+            pSat->nLost++;
+            continue;
+        }
+        iSolver = pSlot->iSolver;
+        nLits   = pSlot->nLits;
+        if ( nLits >= 0 && nLits <= BMC_PORT_LITS )
+            memcpy( pSat->pBuffer, pSlot->pLits, sizeof(int) * nLits );
+        // skip the clause that was overwritten while being copied
+        if ( Bmc_PortReload( p, &pSlot->Seq ) != Seq || nLits < 0 || nLits > BMC_PORT_LITS )
+        {
+            pSat->nLost++;
+            continue;
+        }
+        if ( iSolver == pSat->iSolver )
+            continue;
+        pSat->nImported++;
+        *ppLits = pSat->pBuffer;
+        return nLits;
+    }
+    return -1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Sets default parameters.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmc_PortSetDefaultParams( Bmc_PortPar_t * p )
+{
+    memset( p, 0, sizeof(Bmc_PortPar_t) );
+    p->nSolvers    =    3;  // the number of solvers
+    p->nShareSize  =    8;  // the max size of a shared clause
+    p->nShareLbd   =    2;  // the max LBD of a shared clause
+    p->nBufferSize = 4096;  // the number of clauses in the exchange buffer
+    p->nConfLimit  =    0;  // the conflict limit of one solver in one call
+    p->nTimeOut    =    0;  // the timeout in seconds
+    p->fNoShare    =    0;  // disables clause sharing
+    p->fVerbose    =    0;  // verbose output
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the portfolio.]
+
+  Description [Solver i is Satoko, MiniSat (bsat) or Glucose depending on
+  i % 3; the copies of one solver use different random seeds or restart
+  parameters.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Bmc_Port_t * Bmc_PortStart( Bmc_PortPar_t * pPars )
+{
+    Bmc_Port_t * p = ABC_CALLOC( Bmc_Port_t, 1 );
+    abctime nTimeToStop = pPars->nTimeOut ? pPars->nTimeOut * CLOCKS_PER_SEC + Abc_Clock() : 0;
+    int i, nSlots = 1 << Abc_Base2Log( Abc_MaxInt(pPars->nBufferSize, 2) );
+    assert( pPars->nSolvers >= 1 && pPars->nSolvers <= BMC_PORT_MAX );
+    p->Pars    = *pPars;
+    p->Mask    = (word)(nSlots - 1);
+    p->pSlots  = ABC_CALLOC( Bmc_PortSlot_t, nSlots );
+    p->nSats   = pPars->nSolvers;
+    p->pSats   = ABC_CALLOC( Bmc_PortSat_t, p->nSats );
+    p->iWinner = -1;
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_init( &p->Mutex, NULL );
+#endif
+    for ( i = 0; i < p->nSats; i++ )
+    {
+        Bmc_PortSat_t * pSat = p->pSats + i;
+        pSat->pPort   = p;
+        pSat->iSolver = i;
+        pSat->Type    = i % 3;
+        if ( pSat->Type == BMC_PORT_SATOKO )
+        {
+            satoko_t * pSatoko = satoko_create();
+            satoko_opts_t opts;
+            satoko_default_opts( &opts );
+            opts.f_rst -= (i / 3) * 0.05;
+            opts.b_rst -= (i / 3) * 0.05;
+            opts.garbage_max_ratio += (float)((i / 3) * 0.05);
+            satoko_configure( pSatoko, &opts );
+            satoko_set_stop( pSatoko, &p->fStop );
+            satoko_set_runtime_limit( pSatoko, nTimeToStop );
+            if ( !pPars->fNoShare )
+                satoko_set_share( pSatoko, pSat, Bmc_PortExport, Bmc_PortImport );
+            pSat->pSat = pSatoko;
+        }
+        else if ( pSat->Type == BMC_PORT_BSAT )
+        {
+            sat_solver * pBsat = sat_solver_new();
+            pBsat->random_seed += i / 3;
+            sat_solver_set_stop( pBsat, &p->fStop );
+            sat_solver_set_runtime_limit( pBsat, nTimeToStop );
+            if ( !pPars->fNoShare )
+                sat_solver_set_share( pBsat, pSat, Bmc_PortExport, Bmc_PortImport );
+            pSat->pSat = pBsat;
+        }
+        else
+        {
+            bmcg_sat_solver * pGluco = bmcg_sat_solver_start();
+            bmcg_sat_solver_set_stop( pGluco, &p->fStop );
+            bmcg_sat_solver_set_runtime_limit( pGluco, nTimeToStop );
+            if ( !pPars->fNoShare )
+                bmcg_sat_solver_set_share( pGluco, pSat, Bmc_PortExport, Bmc_PortImport );
+            pSat->pSat = pGluco;
+        }
+    }
+#ifdef ABC_USE_PTHREADS
+    // the calling thread runs one of the solvers in Bmc_PortSolve()
+    if ( p->nSats > 1 )
+        p->pPool = Util_PoolStart( p->nSats - 1 );
+#endif
+    return p;
+}
+void Bmc_PortStop( Bmc_Port_t * p )
+{
+    int i;
+#ifdef ABC_USE_PTHREADS
+    Util_PoolStop( p->pPool );
+#endif
+    for ( i = 0; i < p->nSats; i++ )
+    {
+        Bmc_PortSat_t * pSat = p->pSats + i;
+        if ( pSat->Type == BMC_PORT_SATOKO )
+            satoko_destroy( (satoko_t *)pSat->pSat );
+        else if ( pSat->Type == BMC_PORT_BSAT )
+            sat_solver_delete( (sat_solver *)pSat->pSat );
+        else
+            bmcg_sat_solver_stop( (bmcg_sat_solver *)pSat->pSat );
+        Vec_IntErase( &pSat->vAssump );
+    }
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_destroy( &p->Mutex );
+#endif
+    Vec_IntErase( &p->vTemp );
+    ABC_FREE( p->pSlots );
+    ABC_FREE( p->pSats );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds variables and clauses to all solvers.]
+
+  Description [Returns 0 if the CNF is found UNSAT.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmc_PortAddVar( Bmc_Port_t * p )
+{
+    int i;
+    for ( i = 0; i < p->nSats; i++ )
+    {
+        Bmc_PortSat_t * pSat = p->pSats + i;
+        if ( pSat->Type == BMC_PORT_SATOKO )
+            satoko_add_variable( (satoko_t *)pSat->pSat, 0 );
+        else if ( pSat->Type == BMC_PORT_BSAT )
+            sat_solver_setnvars( (sat_solver *)pSat->pSat, p->nVars + 1 );
+        else
+            bmcg_sat_solver_addvar( (bmcg_sat_solver *)pSat->pSat );
+    }
+    return p->nVars++;
+}
+void Bmc_PortSetNVars( Bmc_Port_t * p, int nVars )
+{
+    while ( p->nVars < nVars )
+        Bmc_PortAddVar( p );
+}
+int Bmc_PortVarNum( Bmc_Port_t * p )
+{
+    return p->nVars;
+}
+int Bmc_PortAddClause( Bmc_Port_t * p, int * pLits, int nLits )
+{
+    int i, k, * pArray, RetValue = 1;
+    for ( k = 0; k < nLits; k++ )
+        Bmc_PortSetNVars( p, Abc_Lit2Var(pLits[k]) + 1 );
+    for ( i = 0; i < p->nSats; i++ )
+    {
+        Bmc_PortSat_t * pSat = p->pSats + i;
+        // the solvers may reorder the literals in place
+        Vec_IntClear( &p->vTemp );
+        Vec_IntPushArray( &p->vTemp, pLits, nLits );
+        pArray = Vec_IntArray( &p->vTemp );
+        if ( pSat->Type == BMC_PORT_SATOKO )
+            RetValue &= (satoko_add_clause( (satoko_t *)pSat->pSat, pArray, nLits ) == SATOKO_OK);
+        else if ( pSat->Type == BMC_PORT_BSAT )
+            RetValue &= sat_solver_addclause( (sat_solver *)pSat->pSat, pArray, pArray + nLits );
+        else
+            RetValue &= bmcg_sat_solver_addclause( (bmcg_sat_solver *)pSat->pSat, pArray, nLits );
+    }
+    if ( !RetValue )
+        p->fUnsat = 1;
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs one solver on the current problem.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Bmc_PortSolveOne( Bmc_PortSat_t * pSat )
+{
+    int nConfLimit = pSat->pPort->Pars.nConfLimit;
+    int * pLits = Vec_IntArray( &pSat->vAssump ), nLits = Vec_IntSize( &pSat->vAssump );
+    if ( pSat->Type == BMC_PORT_SATOKO )
+        return satoko_solve_assumptions_limit( (satoko_t *)pSat->pSat, pLits, nLits, nConfLimit );
+    if ( pSat->Type == BMC_PORT_BSAT )
+        return sat_solver_solve( (sat_solver *)pSat->pSat, pLits, pLits + nLits, (ABC_INT64_T)nConfLimit, 0, 0, 0 );
+    bmcg_sat_solver_set_conflict_budget( (bmcg_sat_solver *)pSat->pSat, nConfLimit );
+    return bmcg_sat_solver_solve( (bmcg_sat_solver *)pSat->pSat, pLits, nLits );
+}
+static void Bmc_PortSetWinner( Bmc_PortSat_t * pSat )
+{
+    Bmc_Port_t * p = pSat->pPort;
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock( &p->Mutex );
+#endif
+    if ( p->iWinner == -1 )
+    {
+        p->iWinner = pSat->iSolver;
+        p->fStop = 1;
+    }
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_unlock( &p->Mutex );
+#endif
+}
+#ifdef ABC_USE_PTHREADS
+static int Bmc_PortWorkerTask( void * pArg )
+{
+    Bmc_PortSat_t * pSat = (Bmc_PortSat_t *)pArg;
+    pSat->status = Bmc_PortSolveOne( pSat );
+    if ( pSat->status != l_Undef )
+        Bmc_PortSetWinner( pSat );
+    return 1;
+}
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the problem under assumptions.]
+
+  Description [Runs all solvers in parallel on the worker threads of the
+  portfolio, which are started once by Bmc_PortStart(); the first solver
+  that decides the problem stops the others. Returns l_True (1) if SAT,
+  l_False (-1) if UNSAT, and l_Undef (0) if the limits were reached.
+  Without pthreads, only the first solver is used.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmc_PortSolve( Bmc_Port_t * p, int * pLits, int nLits )
+{
+    abctime clk = Abc_Clock();
+    int i, status = l_Undef;
+    p->nCalls++;
+    p->iWinner = -1;
+    if ( p->fUnsat )
+        return l_False;
+    for ( i = 0; i < p->nSats; i++ )
+    {
+        Vec_IntClear( &p->pSats[i].vAssump );
+        Vec_IntPushArray( &p->pSats[i].vAssump, pLits, nLits );
+        p->pSats[i].status = l_Undef;
+    }
+    p->fStop = 0;
+#ifdef ABC_USE_PTHREADS
+    if ( p->pPool )
+    {
+        Util_PoolGroup_t * pGroup = Util_PoolGroupStart( p->pPool, 0 );
+        for ( i = 0; i < p->nSats; i++ )
+            Util_PoolSubmit( pGroup, Bmc_PortWorkerTask, (void *)(p->pSats + i) );
+        Util_PoolGroupWait( pGroup );
+        Util_PoolGroupStop( pGroup );
+    }
+    else
+#endif
+    {
+        p->pSats[0].status = Bmc_PortSolveOne( p->pSats );
+        if ( p->pSats[0].status != l_Undef )
+            Bmc_PortSetWinner( p->pSats );
+    }
+    p->fStop = 0;
+    if ( p->iWinner >= 0 )
+    {
+        status = p->pSats[p->iWinner].status;
+        p->pSats[p->iWinner].nWins++;
+    }
+    p->timeSolve += Abc_Clock() - clk;
+    return status;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the results of the last call.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmc_PortVarValue( Bmc_Port_t * p, int iVar )
+{
+    Bmc_PortSat_t * pSat = p->pSats + p->iWinner;
+    assert( p->iWinner >= 0 && pSat->status == l_True );
+    if ( pSat->Type == BMC_PORT_SATOKO )
+        return satoko_read_cex_varvalue( (satoko_t *)pSat->pSat, iVar );
+    if ( pSat->Type == BMC_PORT_BSAT )
+        return sat_solver_var_value( (sat_solver *)pSat->pSat, iVar );
+    return bmcg_sat_solver_read_cex_varvalue( (bmcg_sat_solver *)pSat->pSat, iVar );
+}
+int Bmc_PortWinner( Bmc_Port_t * p )
+{
+    return p->iWinner;
+}
+int Bmc_PortImportNum( Bmc_Port_t * p )
+{
+    int i, nImported = 0;
+    for ( i = 0; i < p->nSats; i++ )
+        nImported += (int)p->pSats[i].nImported;
+    return nImported;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints statistics.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmc_PortPrintStats( Bmc_Port_t * p )
+{
+    char * pNames[3] = { "Satoko", "MiniSat", "Glucose" };
+    int i;
+    printf( "Portfolio of %d solvers: Calls = %d. Vars = %d. Shared = %.0f.  ",
+        p->nSats, p->nCalls, p->nVars, (double)p->Head );
+    Abc_PrintTime( 1, "Time", p->timeSolve );
+    for ( i = 0; i < p->nSats; i++ )
+    {
+        Bmc_PortSat_t * pSat = p->pSats + i;
+        int nConfs = pSat->Type == BMC_PORT_SATOKO ? satoko_conflictnum( (satoko_t *)pSat->pSat ) :
+                     pSat->Type == BMC_PORT_BSAT   ? sat_solver_nconflicts( (sat_solver *)pSat->pSat ) :
+                                                     bmcg_sat_solver_conflictnum( (bmcg_sat_solver *)pSat->pSat );
+        printf( "%2d %-8s: Wins = %5d. Confs = %9d. Exported = %8.0f. Imported = %8.0f. Lost = %6.0f. Dropped = %6.0f.\n",
+            i, pNames[pSat->Type], pSat->nWins, nConfs, (double)pSat->nExported, (double)pSat->nImported,
+            (double)pSat->nLost, (double)pSat->nDropped );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -59,13 +59,21 @@ struct clause_t
 // learned clauses have "hidden" literal (c->lits[c->size]) to store clause ID
 
 // data-structure for logging entries
-// memory is allocated in 2^nPageSize word-sized pages
-// the first 'word' of each page are stores the word limit
+// original and learned clauses are stored in two contiguous arenas
+// the arenas are aligned to the cache line and grow by doubling,
+// which relocates the clauses but keeps their handles valid;
+// while the arena is copied, the old and the new arenas are both allocated,
+// so the peak memory is about three times the size of the old arena;
+// an arena cannot exceed 2^SAT_MEM_LRN_SHIFT ints (4 GB), after which
+// the clauses are not added and the solvers report a resource limit
 
 // although clause memory pieces are aligned to 64-bit words
 // the integer clause handles are in terms of 32-bit unsigneds
 // allowing for the first bit to be used for labeling 2-lit clauses
+// and the bit SAT_MEM_LRN_SHIFT to be used for labeling learned clauses
 
+#define SAT_MEM_LRN_SHIFT  30
+#define SAT_MEM_LRN_MASK   (1 << SAT_MEM_LRN_SHIFT)
 
 typedef struct Sat_Mem_t_ Sat_Mem_t;
 struct Sat_Mem_t_
@@ -73,60 +81,51 @@ struct Sat_Mem_t_
     int                 nEntries[2];  // entry count
     int                 BookMarkH[2]; // bookmarks for handles
     int                 BookMarkE[2]; // bookmarks for entries
-    int                 iPage[2];     // current memory page
-    int                 nPageSize;    // page log size in terms of ints
-    unsigned            uPageMask;    // page mask
-    unsigned            uLearnedMask; // learned mask
-    int                 nPagesAlloc;  // page count allocated
-    int **              pPages;       // page pointers
+    int                 nSize[2];     // used ints in each arena
+    int                 nCap[2];      // allocated ints in each arena
+    int *               pArena[2];    // arenas (aligned)
+    char *              pAlloc[2];    // arenas (as allocated)
 }; 
 
-static inline int       Sat_MemLimit( int * p )                      { return p[0];                                 }
-static inline int       Sat_MemIncLimit( int * p, int nInts )        { return p[0] += nInts;                        }
-static inline void      Sat_MemWriteLimit( int * p, int nInts )      { p[0] = nInts;                                }
-
-static inline int       Sat_MemHandPage( Sat_Mem_t * p, cla h )      { return h >> p->nPageSize;                    }
-static inline int       Sat_MemHandShift( Sat_Mem_t * p, cla h )     { return h & p->uPageMask;                     }
+static inline int       Sat_MemHandLrn( cla h )                      { return (h & SAT_MEM_LRN_MASK) > 0;           }
+static inline int       Sat_MemHandShift( cla h )                    { return h & (SAT_MEM_LRN_MASK - 1);           }
 
 //static inline int       Sat_MemIntSize( int size, int lrn )          { return (size + 2 + lrn) & ~01;               }
 static inline int       Sat_MemIntSize( int size, int lrn )          { return 2*((size + 2 + lrn)/2);               }
 static inline int       Sat_MemClauseSize( clause * p )              { return Sat_MemIntSize(p->size, p->lrn);      }
 static inline int       Sat_MemClauseSize2( clause * p )             { return Sat_MemIntSize(p->size, 1);           }
 
-//static inline clause *  Sat_MemClause( Sat_Mem_t * p, int i, int k ) { assert(i <= p->iPage[i&1] && k <= Sat_MemLimit(p->pPages[i]));  return (clause *)(p->pPages[i] + k ); }
-static inline clause *  Sat_MemClause( Sat_Mem_t * p, int i, int k ) { assert( k ); return (clause *)(p->pPages[i] + k);         }
-//static inline clause *  Sat_MemClauseHand( Sat_Mem_t * p, cla h )    { assert(Sat_MemHandPage(p, h) <= p->iPage[(h & p->uLearnedMask) > 0]); assert(Sat_MemHandShift(p, h) >= 2 && Sat_MemHandShift(p, h) < (int)p->uLearnedMask); return Sat_MemClause( p, Sat_MemHandPage(p, h), Sat_MemHandShift(p, h) );     }
-static inline clause *  Sat_MemClauseHand( Sat_Mem_t * p, cla h )    { return h ? Sat_MemClause( p, Sat_MemHandPage(p, h), Sat_MemHandShift(p, h) ) : NULL;                  }
+static inline clause *  Sat_MemClause( Sat_Mem_t * p, int i, int k ) { assert( k >= 2 && k < p->nSize[i] ); return (clause *)(p->pArena[i] + k);                        }
+static inline clause *  Sat_MemClauseHand( Sat_Mem_t * p, cla h )    { return h ? Sat_MemClause( p, Sat_MemHandLrn(h), Sat_MemHandShift(h) ) : NULL;                         }
 static inline int       Sat_MemEntryNum( Sat_Mem_t * p, int lrn )    { return p->nEntries[lrn];                                                                              }
 
-static inline cla       Sat_MemHand( Sat_Mem_t * p, int i, int k )   { return (i << p->nPageSize) | k;                                                                       }
-static inline cla       Sat_MemHandCurrent( Sat_Mem_t * p, int lrn ) { return (p->iPage[lrn] << p->nPageSize) | Sat_MemLimit( p->pPages[p->iPage[lrn]] );                    }
+static inline cla       Sat_MemHand( Sat_Mem_t * p, int i, int k )   { return (i << SAT_MEM_LRN_SHIFT) | k;                                                                  }
+static inline cla       Sat_MemHandCurrent( Sat_Mem_t * p, int lrn ) { return Sat_MemHand( p, lrn, p->nSize[lrn] );                                                          }
 
-static inline int       Sat_MemClauseUsed( Sat_Mem_t * p, cla h )    { return h < p->BookMarkH[(h & p->uLearnedMask) > 0];                                                   }
+static inline int       Sat_MemClauseUsed( Sat_Mem_t * p, cla h )    { return h < p->BookMarkH[Sat_MemHandLrn(h)];                                                           }
 
-static inline double    Sat_MemMemoryHand( Sat_Mem_t * p, cla h )    { return 1.0 * ((Sat_MemHandPage(p, h) + 2)/2 * (1 << (p->nPageSize+2)) + Sat_MemHandShift(p, h) * 4);  }
-static inline double    Sat_MemMemoryUsed( Sat_Mem_t * p, int lrn )  { return Sat_MemMemoryHand( p, Sat_MemHandCurrent(p, lrn) );                                            }
+static inline double    Sat_MemMemoryUsed( Sat_Mem_t * p, int lrn )  { return 4.0 * p->nSize[lrn];                                                                           }
 static inline double    Sat_MemMemoryAllUsed( Sat_Mem_t * p )        { return Sat_MemMemoryUsed( p, 0 ) + Sat_MemMemoryUsed( p, 1 );                                         }
-static inline double    Sat_MemMemoryAll( Sat_Mem_t * p )            { return 1.0 * (p->iPage[0] + p->iPage[1] + 2) * (1 << (p->nPageSize+2));                               }
+static inline double    Sat_MemMemoryAll( Sat_Mem_t * p )            { return 4.0 * (p->nCap[0] + p->nCap[1]);                                                               }
 
 // p is memory storage
 // c is clause pointer
-// i is page number
-// k is page offset
+// i is arena number (0 = original, 1 = learned)
+// k is arena offset
 
 // print problem clauses NOT in proof mode
 #define Sat_MemForEachClause( p, c, i, k )      \
-    for ( i = 0; i <= p->iPage[0]; i += 2 )     \
-        for ( k = 2; k < Sat_MemLimit(p->pPages[i]) && ((c) = Sat_MemClause( p, i, k )); k += Sat_MemClauseSize(c) ) if ( i == 0 && k == 2 ) {} else
+    for ( i = 0; i < 1; i++ )                   \
+        for ( k = 2; k < p->nSize[0] && ((c) = Sat_MemClause( p, 0, k )); k += Sat_MemClauseSize(c) ) if ( k == 2 ) {} else
 
 // print problem clauses in proof mode
-#define Sat_MemForEachClause2( p, c, i, k )      \
-    for ( i = 0; i <= p->iPage[0]; i += 2 )     \
-        for ( k = 2; k < Sat_MemLimit(p->pPages[i]) && ((c) = Sat_MemClause( p, i, k )); k += Sat_MemClauseSize2(c) ) if ( i == 0 && k == 2 ) {} else
+#define Sat_MemForEachClause2( p, c, i, k )     \
+    for ( i = 0; i < 1; i++ )                   \
+        for ( k = 2; k < p->nSize[0] && ((c) = Sat_MemClause( p, 0, k )); k += Sat_MemClauseSize2(c) ) if ( k == 2 ) {} else
 
 #define Sat_MemForEachLearned( p, c, i, k )     \
-    for ( i = 1; i <= p->iPage[1]; i += 2 )     \
-        for ( k = 2; k < Sat_MemLimit(p->pPages[i]) && ((c) = Sat_MemClause( p, i, k )); k += Sat_MemClauseSize(c) )
+    for ( i = 1; i < 2; i++ )                   \
+        for ( k = 2; k < p->nSize[1] && ((c) = Sat_MemClause( p, 1, k )); k += Sat_MemClauseSize(c) )
 
 ////////////////////////////////////////////////////////////////////////
 ///                       GLOBAL VARIABLES                           ///
@@ -140,7 +139,7 @@ static inline int      clause_from_lit( lit l )                     { return l +
 static inline int      clause_is_lit( cla h )                       { return (h & 1);                              }
 static inline lit      clause_read_lit( cla h )                     { return (lit)(h >> 1);                        }
 
-static inline int      clause_learnt_h( Sat_Mem_t * p, cla h )      { return (h & p->uLearnedMask) > 0;            }
+static inline int      clause_learnt_h( Sat_Mem_t * p, cla h )      { return Sat_MemHandLrn(h);                    }
 static inline int      clause_learnt( clause * c )                  { return c->lrn;                               }
 static inline int      clause_id( clause * c )                      { return c->lits[c->size];                     }
 static inline void     clause_set_id( clause * c, int id )          { c->lits[c->size] = id;                       }
@@ -180,11 +179,46 @@ static inline int Sat_MemCountL( Sat_Mem_t * p )
     return Count;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Resizes one arena.]
+
+  Description [Moves the used part of the arena into a new piece of memory
+  aligned to the cache line. Handles remain valid, clause pointers do not.
+  Returns 0 if the arena would exceed the largest size allowed by the
+  handles, in which case it is not changed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Sat_MemGrow( Sat_Mem_t * p, int lrn, int nCapMin )
+{
+    char * pAlloc;
+    int * pArena, nCap = p->nCap[lrn];
+    if ( nCapMin <= nCap )
+        return 1;
+    if ( nCapMin > SAT_MEM_LRN_MASK )
+        return 0;
+    while ( nCap < nCapMin )
+        nCap = nCap < SAT_MEM_LRN_MASK / 2 ? 2 * nCap : SAT_MEM_LRN_MASK;
+    pAlloc = ABC_ALLOC( char, sizeof(int) * (size_t)nCap + 64 );
+    pArena = (int *)(pAlloc + ((64 - ((ABC_PTRUINT_T)pAlloc & 63)) & 63));
+    if ( p->pArena[lrn] )
+        memcpy( pArena, p->pArena[lrn], sizeof(int) * (size_t)p->nSize[lrn] );
+    ABC_FREE( p->pAlloc[lrn] );
+    p->pAlloc[lrn] = pAlloc;
+    p->pArena[lrn] = pArena;
+    p->nCap[lrn]   = nCap;
+    return 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Allocating vector.]
 
-  Description []
+  Description [The initial size of each arena is 2^nPageSize ints.]
 
   SideEffects []
 
@@ -193,19 +227,13 @@ static inline int Sat_MemCountL( Sat_Mem_t * p )
 ***********************************************************************/
 static inline void Sat_MemAlloc_( Sat_Mem_t * p, int nPageSize )
 {
-    assert( nPageSize > 8 && nPageSize < 32 );
+    assert( nPageSize > 8 && nPageSize < SAT_MEM_LRN_SHIFT );
     memset( p, 0, sizeof(Sat_Mem_t) );
-    p->nPageSize    = nPageSize;
-    p->uLearnedMask = (unsigned)(1 << nPageSize);
-    p->uPageMask    = (unsigned)((1 << nPageSize) - 1);
-    p->nPagesAlloc  = 256;
-    p->pPages       = ABC_CALLOC( int *, p->nPagesAlloc );
-    p->pPages[0]    = ABC_ALLOC( int, (int)(((word)1) << p->nPageSize) );
-    p->pPages[1]    = ABC_ALLOC( int, (int)(((word)1) << p->nPageSize) );
-    p->iPage[0]     = 0;
-    p->iPage[1]     = 1;
-    Sat_MemWriteLimit( p->pPages[0], 2 );
-    Sat_MemWriteLimit( p->pPages[1], 2 );
+    p->nCap[0]  = p->nCap[1] = 1 << (nPageSize - 1);
+    Sat_MemGrow( p, 0, 1 << nPageSize );
+    Sat_MemGrow( p, 1, 1 << nPageSize );
+    p->nSize[0] = 2;
+    p->nSize[1] = 2;
 }
 static inline Sat_Mem_t * Sat_MemAlloc( int nPageSize )
 {
@@ -230,10 +258,8 @@ static inline void Sat_MemRestart( Sat_Mem_t * p )
 {
     p->nEntries[0]  = 0;
     p->nEntries[1]  = 0;
-    p->iPage[0]     = 0;
-    p->iPage[1]     = 1;
-    Sat_MemWriteLimit( p->pPages[0], 2 );
-    Sat_MemWriteLimit( p->pPages[1], 2 );
+    p->nSize[0]     = 2;
+    p->nSize[1]     = 2;
 }
 
 /**Function*************************************************************
@@ -258,10 +284,8 @@ static inline void Sat_MemRollBack( Sat_Mem_t * p )
 {
     p->nEntries[0]  = p->BookMarkE[0];
     p->nEntries[1]  = p->BookMarkE[1];
-    p->iPage[0]     = Sat_MemHandPage( p, p->BookMarkH[0] );
-    p->iPage[1]     = Sat_MemHandPage( p, p->BookMarkH[1] );
-    Sat_MemWriteLimit( p->pPages[p->iPage[0]], Sat_MemHandShift( p, p->BookMarkH[0] ) );
-    Sat_MemWriteLimit( p->pPages[p->iPage[1]], Sat_MemHandShift( p, p->BookMarkH[1] ) );
+    p->nSize[0]     = Sat_MemHandShift( p->BookMarkH[0] );
+    p->nSize[1]     = Sat_MemHandShift( p->BookMarkH[1] );
 }
 
 /**Function*************************************************************
@@ -277,10 +301,9 @@ static inline void Sat_MemRollBack( Sat_Mem_t * p )
 ***********************************************************************/
 static inline void Sat_MemFree_( Sat_Mem_t * p )
 {
-    int i;
-    for ( i = 0; i < p->nPagesAlloc; i++ )
-        ABC_FREE( p->pPages[i] );
-    ABC_FREE( p->pPages );
+    ABC_FREE( p->pAlloc[0] );
+    ABC_FREE( p->pAlloc[1] );
+    p->pArena[0] = p->pArena[1] = NULL;
 }
 static inline void Sat_MemFree( Sat_Mem_t * p )
 {
@@ -292,7 +315,9 @@ static inline void Sat_MemFree( Sat_Mem_t * p )
 
   Synopsis    [Creates new clause.]
 
-  Description [The resulting clause is fully initialized.]
+  Description [The resulting clause is fully initialized. The arena may
+  be relocated, so the clause pointers taken before this call are stale.
+  Returns -1 if the arena has reached its largest size.]
 
   SideEffects []
 
@@ -302,26 +327,12 @@ static inline void Sat_MemFree( Sat_Mem_t * p )
 static inline int Sat_MemAppend( Sat_Mem_t * p, int * pArray, int nSize, int lrn, int fPlus1 )
 {
     clause * c;
-    int * pPage = p->pPages[p->iPage[lrn]];
     int nInts = Sat_MemIntSize( nSize, lrn | fPlus1 );
-    assert( nInts + 3 < (1 << p->nPageSize) );
-    // need two extra at the begining of the page and one extra in the end
-    if ( Sat_MemLimit(pPage) + nInts + 2 >= (1 << p->nPageSize) )
-    { 
-        p->iPage[lrn] += 2;
-        if ( p->iPage[lrn] >= p->nPagesAlloc )
-        {
-            p->pPages = ABC_REALLOC( int *, p->pPages, p->nPagesAlloc * 2 );
-            memset( p->pPages + p->nPagesAlloc, 0, sizeof(int *) * p->nPagesAlloc );
-            p->nPagesAlloc *= 2;
-        }
-        if ( p->pPages[p->iPage[lrn]] == NULL )
-            p->pPages[p->iPage[lrn]] = ABC_ALLOC( int, (int)(((word)1) << p->nPageSize) );
-        pPage = p->pPages[p->iPage[lrn]];
-        Sat_MemWriteLimit( pPage, 2 );
-    }
-    pPage[Sat_MemLimit(pPage)] = 0;
-    c = (clause *)(pPage + Sat_MemLimit(pPage));
+    int k = p->nSize[lrn];
+    if ( k + nInts > p->nCap[lrn] && !Sat_MemGrow( p, lrn, k + nInts ) )
+        return -1;
+    p->pArena[lrn][k] = 0;
+    c = (clause *)(p->pArena[lrn] + k);
     c->size = nSize;
     c->lrn = lrn;
     if ( pArray )
@@ -329,8 +340,8 @@ static inline int Sat_MemAppend( Sat_Mem_t * p, int * pArray, int nSize, int lrn
     if ( lrn | fPlus1 )
         c->lits[c->size] = p->nEntries[lrn];
     p->nEntries[lrn]++;
-    Sat_MemIncLimit( pPage, nInts );
-    return Sat_MemHandCurrent(p, lrn) - nInts;
+    p->nSize[lrn] += nInts;
+    return Sat_MemHand( p, lrn, k );
 }
 
 /**Function*************************************************************
@@ -348,8 +359,7 @@ static inline void Sat_MemShrink( Sat_Mem_t * p, int h, int lrn )
 {
     assert( clause_learnt_h(p, h) == lrn );
     assert( h && h <= Sat_MemHandCurrent(p, lrn) );
-    p->iPage[lrn] = Sat_MemHandPage(p, h);
-    Sat_MemWriteLimit( p->pPages[p->iPage[lrn]], Sat_MemHandShift(p, h) );
+    p->nSize[lrn] = Sat_MemHandShift( h );
 }
 
 
@@ -367,7 +377,7 @@ static inline void Sat_MemShrink( Sat_Mem_t * p, int h, int lrn )
 static inline int Sat_MemCompactLearned( Sat_Mem_t * p, int fDoMove )
 {
     clause * c, * cPivot = NULL;
-    int i, k, iNew = 1, kNew = 2, nInts, fStartLooking, Counter = 0;
+    int i, k, kNew = 2, nInts, fStartLooking, Counter = 0;
     int hLimit = Sat_MemHandCurrent(p, 1);
     if ( hLimit == Sat_MemHand(p, 1, 2) )
         return 0;
@@ -376,12 +386,14 @@ static inline int Sat_MemCompactLearned( Sat_Mem_t * p, int fDoMove )
         // move the pivot
         assert( p->BookMarkH[1] >= Sat_MemHand(p, 1, 2) && p->BookMarkH[1] <= hLimit );
         // get the pivot and remember it may be pointed offlimit
-        cPivot = Sat_MemClauseHand( p, p->BookMarkH[1] );
-        if ( p->BookMarkH[1] < hLimit && !cPivot->mark )
+        cPivot = p->BookMarkH[1] < hLimit ? Sat_MemClauseHand( p, p->BookMarkH[1] ) : NULL;
+        if ( cPivot && !cPivot->mark )
         {
             p->BookMarkH[1] = cPivot->lits[cPivot->size];
             cPivot = NULL;
         }
+        else if ( p->BookMarkH[1] == hLimit )
+            cPivot = (clause *)(p->pArena[1] + p->nSize[1]);
         // else find the next used clause after cPivot
     }
     // iterate through the learned clauses
@@ -409,36 +421,25 @@ static inline int Sat_MemCompactLearned( Sat_Mem_t * p, int fDoMove )
         // compute entry size
         nInts = Sat_MemClauseSize(c);
         assert( !(nInts & 1) );
-        // check if we need to scroll to the next page
-        if ( kNew + nInts >= (1 << p->nPageSize) )
-        {
-            // set the limit of the current page
-            if ( fDoMove )
-                Sat_MemWriteLimit( p->pPages[iNew], kNew );
-            // move writing position to the new page
-            iNew += 2;
-            kNew = 2;
-        }
         if ( fDoMove )
         {
             // make sure the result is the same as previous dry run
-            assert( c->lits[c->size] == Sat_MemHand(p, iNew, kNew) );
+            assert( c->lits[c->size] == Sat_MemHand(p, 1, kNew) );
             // only copy the clause if it has changed
-            if ( i != iNew || k != kNew )
+            if ( k != kNew )
             {
-                memmove( p->pPages[iNew] + kNew, c, sizeof(int) * nInts );
-//                c = Sat_MemClause( p, iNew, kNew ); // assersions do not hold during dry run
-                c = (clause *)(p->pPages[iNew] + kNew);
+                memmove( p->pArena[1] + kNew, c, sizeof(int) * nInts );
+                c = (clause *)(p->pArena[1] + kNew);
                 assert( nInts == Sat_MemClauseSize(c) );
             }
             // set the new ID value
             c->lits[c->size] = Counter;
         }
         else // remember the address of the clause in the new location
-            c->lits[c->size] = Sat_MemHand(p, iNew, kNew);
+            c->lits[c->size] = Sat_MemHand(p, 1, kNew);
         // update writing position
         kNew += nInts;
-        assert( iNew <= i && kNew < (1 << p->nPageSize) );
+        assert( kNew <= k + nInts );
         // update counter
         Counter++;
     }
@@ -446,14 +447,12 @@ static inline int Sat_MemCompactLearned( Sat_Mem_t * p, int fDoMove )
     {
         // update the counter
         p->nEntries[1] = Counter;
-        // update the page count
-        p->iPage[1] = iNew;
-        // set the limit of the last page
-        Sat_MemWriteLimit( p->pPages[iNew], kNew );
+        // set the limit of the arena
+        p->nSize[1] = kNew;
         // check if the pivot need to be updated
         if ( p->BookMarkH[1] )
         {
-            if ( cPivot )
+            if ( cPivot || fStartLooking )
             {
                 p->BookMarkH[1] = Sat_MemHandCurrent(p, 1);
                 p->BookMarkE[1] = p->nEntries[1];
@@ -466,7 +465,6 @@ static inline int Sat_MemCompactLearned( Sat_Mem_t * p, int fDoMove )
     return Counter;
 }
 
-
 ABC_NAMESPACE_HEADER_END
 
 #endif
@@ -133,6 +133,16 @@ int sat_solver_get_var_value(sat_solver* s, int v)
 static inline int      sat_solver_dl(sat_solver* s)                { return veci_size(&s->trail_lim); }
 static inline veci*    sat_solver_read_wlist(sat_solver* s, lit l) { return &s->wlists[l];            }
 
+// watchers of 2-lit clauses take one entry (the other literal, see clause_from_lit());
+// watchers of longer clauses take two entries: the clause handle and a blocker literal
+static inline int      sat_solver_watch_size(cla h)                 { return clause_is_lit(h) ? 1 : 2; }
+static inline void     sat_solver_watch_push(sat_solver* s, lit l, cla h, lit blocker)
+{
+    veci* ws = sat_solver_read_wlist(s, l);
+    veci_push(ws, h);
+    veci_push(ws, blocker);
+}
+
 //=================================================================================================
 // Variable order functions:
 
@@ -554,6 +564,11 @@ int sat_solver_clause_new(sat_solver* s, lit* begin, lit* end, int learnt)
     // create new clause
 //    h = Vec_SetAppend( &s->Mem, NULL, size + learnt + 1 + 1 ) << 1;
     h = Sat_MemAppend( &s->Mem, begin, size, learnt, 0 );
+    if ( h == -1 ) // the clause is not added, so the solver cannot continue
+    {
+        s->fMemOut = 1;
+        return -1;
+    }
     assert( !(h & 1) );
     if ( s->hLearnts == -1 && learnt )
         s->hLearnts = h;
@@ -585,10 +600,16 @@ int sat_solver_clause_new(sat_solver* s, lit* begin, lit* end, int learnt)
     assert(lit_neg(begin[0]) < s->size*2);
     assert(lit_neg(begin[1]) < s->size*2);
 
-    //veci_push(sat_solver_read_wlist(s,lit_neg(begin[0])),c);
-    //veci_push(sat_solver_read_wlist(s,lit_neg(begin[1])),c);
-    veci_push(sat_solver_read_wlist(s,lit_neg(begin[0])),(size > 2 ? h : clause_from_lit(begin[1])));
-    veci_push(sat_solver_read_wlist(s,lit_neg(begin[1])),(size > 2 ? h : clause_from_lit(begin[0])));
+    if ( size > 2 )
+    {
+        sat_solver_watch_push(s, lit_neg(begin[0]), h, begin[1]);
+        sat_solver_watch_push(s, lit_neg(begin[1]), h, begin[0]);
+    }
+    else
+    {
+        veci_push(sat_solver_read_wlist(s,lit_neg(begin[0])),clause_from_lit(begin[1]));
+        veci_push(sat_solver_read_wlist(s,lit_neg(begin[1])),clause_from_lit(begin[0]));
+    }
 
     return h;
 }
@@ -718,10 +739,14 @@ static void sat_solver_record(sat_solver* s, veci* cls)
     lit*    begin = veci_begin(cls);
     lit*    end   = begin + veci_size(cls);
     int     h     = (veci_size(cls) > 1) ? sat_solver_clause_new(s,begin,end,1) : 0;
+    if ( h == -1 )
+        return;
     sat_solver_enqueue(s,*begin,h);
     assert(veci_size(cls) > 0);
     if ( h == 0 )
         veci_push( &s->unit_lits, *begin );
+    if ( s->pFuncExport )
+        s->pFuncExport( s->pShareMan, begin, end - begin, h ? (int)clause_read(s, h)->lbd : 1 );
 
     ///////////////////////////////////
     // add clause to internal storage
@@ -1071,15 +1096,26 @@ int sat_solver_propagate(sat_solver* s)
                 *j++ = *i;
                 if (!sat_solver_enqueue(s,clause_read_lit(*i),clause_from_lit(p))){
                     hConfl = s->hBinary;
-                    (clause_begin(s->binary))[1] = lit_neg(p);
-                    (clause_begin(s->binary))[0] = clause_read_lit(*i++);
+                    (clause_begin(clause_read(s, s->hBinary)))[1] = lit_neg(p);
+                    (clause_begin(clause_read(s, s->hBinary)))[0] = clause_read_lit(*i++);
                     // Copy the remaining watches:
                     while (i < end)
                         *j++ = *i++;
                 }
+                else
+                    i++;
             }else{
 
-                clause* c = clause_read(s,*i);
+                clause* c;
+                lit blocker = i[1];
+                // If the blocker is true, then clause is already satisfied:
+                if (var_value(s, lit_var(blocker)) == lit_sign(blocker)){
+                    *j++ = *i++;
+                    *j++ = *i++;
+                    continue;
+                }
+
+                c = clause_read(s,*i);
                 lits = clause_begin(c);
 
                 // Make sure the false literal is data[1]:
@@ -1091,8 +1127,10 @@ int sat_solver_propagate(sat_solver* s)
                 assert(lits[1] == false_lit);
 
                 // If 0th watch is true, then clause is already satisfied.
-                if (var_value(s, lit_var(lits[0])) == lit_sign(lits[0]))
+                if (var_value(s, lit_var(lits[0])) == lit_sign(lits[0])){
                     *j++ = *i;
+                    *j++ = lits[0];
+                }
                 else{
                     // Look for new watch:
                     lit* stop = lits + clause_size(c);
@@ -1101,24 +1139,27 @@ int sat_solver_propagate(sat_solver* s)
                         if (var_value(s, lit_var(*k)) != !lit_sign(*k)){
                             lits[1] = *k;
                             *k = false_lit;
-                            veci_push(sat_solver_read_wlist(s,lit_neg(lits[1])),*i);
+                            sat_solver_watch_push(s,lit_neg(lits[1]),*i,lits[0]);
                             goto next; }
                     }
 
                     *j++ = *i;
+                    *j++ = lits[0];
                     // Clause is unit under assignment:
                     if ( c->lrn )
                         c->lbd = sat_clause_compute_lbd(s, c);
                     if (!sat_solver_enqueue(s,lits[0], *i)){
-                        hConfl = *i++;
+                        hConfl = *i;
+                        i += 2;
                         // Copy the remaining watches:
                         while (i < end)
                             *j++ = *i++;
+                        continue;
                     }
                 }
+            next:
+                i += 2;
             }
-        next:
-            i++;
         }
 
         s->stats.inspects += j - veci_begin(ws);
@@ -1142,7 +1183,6 @@ sat_solver* sat_solver_new(void)
     Sat_MemAlloc_(&s->Mem, 17);
     s->hLearnts = -1;
     s->hBinary = Sat_MemAppend( &s->Mem, NULL, 2, 0, 0 );
-    s->binary = clause_read( s, s->hBinary );
 
     s->nLearntStart = LEARNT_MAX_START_DEFAULT;  // starting learned clause limit
     s->nLearntDelta = LEARNT_MAX_INCRE_DEFAULT;  // delta of learned clause limit
@@ -1207,7 +1247,6 @@ sat_solver* zsat_solver_new_seed(double seed)
     Sat_MemAlloc_(&s->Mem, 15);
     s->hLearnts = -1;
     s->hBinary = Sat_MemAppend( &s->Mem, NULL, 2, 0, 0 );
-    s->binary = clause_read( s, s->hBinary );
 
     s->nLearntStart = LEARNT_MAX_START_DEFAULT;  // starting learned clause limit
     s->nLearntDelta = LEARNT_MAX_INCRE_DEFAULT;  // delta of learned clause limit
@@ -1392,7 +1431,7 @@ void sat_solver_restart( sat_solver* s )
     Sat_MemRestart( &s->Mem );
     s->hLearnts = -1;
     s->hBinary = Sat_MemAppend( &s->Mem, NULL, 2, 0, 0 );
-    s->binary = clause_read( s, s->hBinary );
+    s->fMemOut = 0;
 
     veci_resize(&s->trail_lim, 0);
     veci_resize(&s->order, 0);
@@ -1438,7 +1477,7 @@ void zsat_solver_restart_seed( sat_solver* s, double seed )
     Sat_MemRestart( &s->Mem );
     s->hLearnts = -1;
     s->hBinary = Sat_MemAppend( &s->Mem, NULL, 2, 0, 0 );
-    s->binary = clause_read( s, s->hBinary );
+    s->fMemOut = 0;
 
     veci_resize(&s->trail_lim, 0);
     veci_resize(&s->order, 0);
@@ -1608,17 +1647,23 @@ void sat_solver_reducedb(sat_solver* s)
     for ( i = 0; i < s->size*2; i++ )
     {
         pArray = veci_begin(&s->wlists[i]);
-        for ( j = k = 0; k < veci_size(&s->wlists[i]); k++ )
+        for ( j = k = 0; k < veci_size(&s->wlists[i]); k += sat_solver_watch_size(pArray[k]) )
         {
             if ( clause_is_lit(pArray[k]) ) // 2-lit clause
                 pArray[j++] = pArray[k];
             else if ( !clause_learnt_h(pMem, pArray[k]) ) // problem clause
+            {
                 pArray[j++] = pArray[k];
+                pArray[j++] = pArray[k+1];
+            }
             else 
             {
                 c = clause_read(s, pArray[k]);
                 if ( !c->mark ) // useful learned clause
+                {
                    pArray[j++] = clause_id(c); // updating handle here!!!
+                   pArray[j++] = pArray[k+1];
+                }
             }
         }
         veci_resize(&s->wlists[i],j);
@@ -1672,7 +1717,7 @@ void sat_solver_rollback( sat_solver* s )
     for ( i = 0; i < s->iVarPivot*2; i++ )
     {
         cla* pArray = veci_begin(&s->wlists[i]);
-        for ( j = k = 0; k < veci_size(&s->wlists[i]); k++ )
+        for ( j = k = 0; k < veci_size(&s->wlists[i]); k += sat_solver_watch_size(pArray[k]) )
         {
             if ( clause_is_lit(pArray[k]) )
             {
@@ -1680,7 +1725,10 @@ void sat_solver_rollback( sat_solver* s )
                     pArray[j++] = pArray[k];
             }
             else if ( Sat_MemClauseUsed(pMem, pArray[k]) )
+            {
                 pArray[j++] = pArray[k];
+                pArray[j++] = pArray[k+1];
+            }
         }
         veci_resize(&s->wlists[i],j);
     }
@@ -1691,8 +1739,9 @@ void sat_solver_rollback( sat_solver* s )
     // reset clause counts
     s->stats.clauses = pMem->BookMarkE[0];
     s->stats.learnts = pMem->BookMarkE[1];
-    // rollback clauses
+    // rollback clauses (the clause that did not fit was added after the bookmark)
     Sat_MemRollBack( pMem );
+    s->fMemOut = 0;
 
     // resize learned arrays
     veci_resize(&s->act_clas,  s->stats.learnts);
@@ -1867,6 +1916,10 @@ static lbool sat_solver_search(sat_solver* s, ABC_INT64_T nof_conflicts)
             blevel = s->root_level > blevel ? s->root_level : blevel;
             sat_solver_canceluntil(s,blevel);
             sat_solver_record(s,&learnt_clause);
+            if ( s->fMemOut ){
+                sat_solver_canceluntil(s,s->root_level);
+                veci_delete(&learnt_clause);
+                return l_Undef; }
 #ifdef SAT_USE_ANALYZE_FINAL
 //            if (learnt_clause.size() == 1) level[var(learnt_clause[0])] = 0;    // (this is ugly (but needed for 'analyzeFinal()') -- in future versions, we will backtrack past the 'root_level' and redo the assumptions)
             if ( learnt_clause.size == 1 ) 
@@ -1880,7 +1933,7 @@ static lbool sat_solver_search(sat_solver* s, ABC_INT64_T nof_conflicts)
             int next;
 
             // Reached bound on number of conflicts:
-            if ( (!s->fNoRestarts && nof_conflicts >= 0 && conflictC >= nof_conflicts) || (s->nRuntimeLimit && (s->stats.conflicts & 63) == 0 && Abc_Clock() > s->nRuntimeLimit)){
+            if ( (!s->fNoRestarts && nof_conflicts >= 0 && conflictC >= nof_conflicts) || (s->nRuntimeLimit && (s->stats.conflicts & 63) == 0 && Abc_Clock() > s->nRuntimeLimit) || (s->pstop && *s->pstop) ){
                 s->progress_estimate = sat_solver_progress(s);
                 sat_solver_canceluntil(s,s->root_level);
                 veci_delete(&learnt_clause);
@@ -1938,6 +1991,33 @@ static lbool sat_solver_search(sat_solver* s, ABC_INT64_T nof_conflicts)
     return l_Undef; // cannot happen
 }
 
+// imports the clauses learned by other solvers working on the same CNF
+static void sat_solver_import(sat_solver* s)
+{
+    int * pLits, nLits, nFree, i, Temp;
+    assert(s->root_level == sat_solver_dl(s));
+    while ( (nLits = s->pFuncImport(s->pShareMan, &pLits)) >= 0 )
+    {
+        // move the non-false literals to the front
+        for ( i = nFree = 0; i < nLits; i++ )
+        {
+            int v = lit_var(pLits[i]);
+            if ( v >= s->size || (var_value(s, v) == lit_sign(pLits[i]) && var_level(s, v) == 0) )
+                break;
+            if ( var_value(s, v) == varX || var_value(s, v) == lit_sign(pLits[i]) )
+                Temp = pLits[nFree], pLits[nFree++] = pLits[i], pLits[i] = Temp;
+        }
+        // skip unknown variables and clauses satisfied at the top level
+        if ( i < nLits )
+            continue;
+        // the clause can be watched if two of its literals are not false under the root assignment
+        if ( nFree >= 2 && sat_solver_clause_new(s, pLits, pLits + nLits, 1) == -1 )
+            break;
+        else if ( nFree == 1 && sat_solver_dl(s) == 0 && var_value(s, lit_var(pLits[0])) == varX )
+            sat_solver_enqueue(s, pLits[0], 0);
+    }
+}
+
 // internal call to the SAT solver
 int sat_solver_solve_internal(sat_solver* s)
 {
@@ -1945,6 +2025,9 @@ int sat_solver_solve_internal(sat_solver* s)
     int restart_iter = 0;
     veci_resize(&s->unit_lits, 0);
     s->nCalls++;
+    // a clause could not be added when the clause arena reached its largest size
+    if ( s->fMemOut )
+        return l_Undef;
 
     if (s->verbosity >= 1){
         printf("==================================[MINISAT]===================================\n");
@@ -1972,6 +2055,8 @@ int sat_solver_solve_internal(sat_solver* s)
                 s->progress_estimate*100);
             fflush(stdout);
         }
+        if ( s->pFuncImport )
+            sat_solver_import(s);
         nof_conflicts = (ABC_INT64_T)( 100 * luby(2, restart_iter++) );
         status = sat_solver_search(s, nof_conflicts);
         // quit the loop if reached an external limit
@@ -1983,6 +2068,10 @@ int sat_solver_solve_internal(sat_solver* s)
             break;
         if ( s->pFuncStop && s->pFuncStop(s->RunId) )
             break;
+        if ( s->pstop && *s->pstop )
+            break;
+        if ( s->fMemOut )
+            break;
     }
     if (s->verbosity >= 1)
         printf("==============================================================================\n");
@@ -2011,8 +2100,8 @@ int sat_solver_push(sat_solver* s, int p)
         {
             if (clause_is_lit(h))
             {
-                (clause_begin(s->binary))[1] = lit_neg(p);
-                (clause_begin(s->binary))[0] = clause_read_lit(h);
+                (clause_begin(clause_read(s, s->hBinary)))[1] = lit_neg(p);
+                (clause_begin(clause_read(s, s->hBinary)))[0] = clause_read_lit(h);
                 h = s->hBinary;
             }
             sat_solver_analyze_final(s, h, 1);
@@ -108,7 +108,6 @@ struct sat_solver_t
     Sat_Mem_t   Mem;
     int         hLearnts;      // the first learnt clause
     int         hBinary;       // the special binary clause
-    clause *    binary;
     veci*       wlists;        // watcher lists
 
     // rollback
@@ -187,6 +186,7 @@ struct sat_solver_t
     // clause store
     void *      pStore;
     int         fSolved;
+    int         fMemOut;       // the clause arena has reached its largest size
 
     // trace recording
     FILE *      pFile;
@@ -206,6 +206,12 @@ struct sat_solver_t
     // termination callback
     int         RunId;          // SAT id in this run
     int(*pFuncStop)(int);       // callback to terminate
+    int *       pstop;          // external flag to terminate
+
+    // clause sharing
+    void *      pShareMan;      // external clause exchange
+    void(*pFuncExport)(void *, int *, int, int); // exports a learned clause (lits, size, LBD)
+    int(*pFuncImport)(void *, int **);           // returns the size of the next clause to import or -1
 };
 
 static inline clause * clause_read( sat_solver * s, cla h )          
@@ -361,6 +367,16 @@ static inline void sat_solver_set_stop_func( sat_solver *s, int (*fnct)(int) )
 { 
     s->pFuncStop = fnct; 
 }
+static inline void sat_solver_set_stop( sat_solver *s, int * pstop ) 
+{ 
+    s->pstop = pstop; 
+}
+static inline void sat_solver_set_share( sat_solver *s, void * pMan, void (*pFuncExport)(void *, int *, int, int), int (*pFuncImport)(void *, int **) ) 
+{ 
+    s->pShareMan   = pMan; 
+    s->pFuncExport = pFuncExport; 
+    s->pFuncImport = pFuncImport; 
+}
 
 static inline int sat_solver_add_const( sat_solver * pSat, int iVar, int fCompl )
 {
@@ -415,6 +415,11 @@ static int clause2_create_new(sat_solver2* s, lit* begin, lit* end, int learnt,
     assert(size < 2 || lit_var(begin[1]) < s->size);
     // create new clause
     h = Sat_MemAppend( &s->Mem, begin, size, learnt, 1 );
+    if ( h == -1 ) // the clause is not added, so the solver cannot continue
+    {
+        s->fMemOut = 1;
+        return 0;
+    }
     assert( !(h & 1) );
     c = clause2_read( s, h );
     if (learnt)
@@ -542,6 +547,8 @@ static void solver2_record(sat_solver2* s, veci* cls, int proof_id)
     lit* begin = veci_begin(cls);
     lit* end   = begin + veci_size(cls);
     cla  Cid   = clause2_create_new(s,begin,end,1, proof_id);
+    if ( s->fMemOut )
+        return;
     assert(veci_size(cls) > 0);
     if ( veci_size(cls) == 1 )
     {
@@ -963,7 +970,7 @@ clause* solver2_propagate(sat_solver2* s)
                     // in this case, we should derive the empty clause here
                     if ( var_unit_clause(s, Var) == NULL )
                         var_set_unit_clause(s, Var, Cid);
-                    else{
+                    else if ( Cid ){
                         // Empty clause derived:
                         proof_chain_start( s, clause2_read(s,Cid) );
                         proof_chain_resolve( s, NULL, Var );
@@ -971,6 +978,8 @@ clause* solver2_propagate(sat_solver2* s)
                         s->hProofLast = proof_id;
 //                        clause2_create_new( s, &Lit, &Lit, 1, proof_id );
                     }
+                    // the clause arena may have moved
+                    c = clause2_read(s,*i);
                 }
 
                 *j++ = *i;
@@ -1039,6 +1048,10 @@ static lbool solver2_search(sat_solver2* s, ABC_INT64_T nof_conflicts)
             blevel = s->root_level > blevel ? s->root_level : blevel;
             solver2_canceluntil(s,blevel);
             solver2_record(s,&learnt_clause, proof_id);
+            if ( s->fMemOut ){
+                solver2_canceluntil(s,s->root_level);
+                veci_delete(&learnt_clause);
+                return l_Undef; }
             // if (learnt_clause.size() == 1) level[var(learnt_clause[0])] = 0;    
             // (this is ugly (but needed for 'analyzeFinal()') -- in future versions, we will backtrack past the 'root_level' and redo the assumptions)
             if ( learnt_clause.size == 1 )
@@ -1346,6 +1359,8 @@ int sat_solver2_addclause(sat_solver2* s, lit* begin, lit* end, int Id)
 
     // create a new clause
     Cid = clause2_create_new( s, begin, end, 0, 0 );
+    if ( s->fMemOut ) // the clause is dropped, the solver reports a resource limit
+        return 1;
     if ( Id )
         clause2_set_id( s, Cid, Id );
 
@@ -1628,8 +1643,9 @@ void sat_solver2_rollback( sat_solver2* s )
     // reset clause counts
     s->stats.clauses = pMem->BookMarkE[0];
     s->stats.learnts = pMem->BookMarkE[1];
-    // rollback clauses
+    // rollback clauses (the clause that did not fit was added after the bookmark)
     Sat_MemRollBack( pMem );
+    s->fMemOut = 0;
 
     // resize learned arrays
     veci_resize(&s->act_clas,  s->stats.learnts);
@@ -1842,6 +1858,9 @@ int sat_solver2_solve(sat_solver2* s, lit* begin, lit* end, ABC_INT64_T nConfLim
 
     s->hLearntLast = -1;
     s->hProofLast = -1;
+    // a clause could not be added when the clause arena reached its largest size
+    if ( s->fMemOut )
+        return l_Undef;
 
     // set the external limits
 //    s->nCalls++;
@@ -1971,6 +1990,8 @@ int sat_solver2_solve(sat_solver2* s, lit* begin, lit* end, ABC_INT64_T nConfLim
             break;
         if ( s->nInsLimit  && s->stats.propagations > s->nInsLimit )
             break;
+        if ( s->fMemOut )
+            break;
     }
     if (s->verbosity >= 1)
         Abc_Print(1,"==============================================================================\n");
@@ -127,6 +127,7 @@ struct sat_solver2_t
 
     // clauses
     Sat_Mem_t       Mem;
+    int             fMemOut;        // the clause arena has reached its largest size
     veci*           wlists;         // watcher lists (for each literal)
     veci            act_clas;       // clause activities
     veci            claProofs;      // clause proofs
@@ -535,6 +535,11 @@ int sat_solver3_clause_new(sat_solver3* s, lit* begin, lit* end, int learnt)
     // create new clause
 //    h = Vec_SetAppend( &s->Mem, NULL, size + learnt + 1 + 1 ) << 1;
     h = Sat_MemAppend( &s->Mem, begin, size, learnt, 0 );
+    if ( h == -1 ) // the clause is not added, so the solver cannot continue
+    {
+        s->fMemOut = 1;
+        return -1;
+    }
     assert( !(h & 1) );
     if ( s->hLearnts == -1 && learnt )
         s->hLearnts = h;
@@ -699,6 +704,8 @@ static void sat_solver3_record(sat_solver3* s, veci* cls)
     lit*    begin = veci_begin(cls);
     lit*    end   = begin + veci_size(cls);
     int     h     = (veci_size(cls) > 1) ? sat_solver3_clause_new(s,begin,end,1) : 0;
+    if ( h == -1 )
+        return;
     sat_solver3_enqueue(s,*begin,h);
     assert(veci_size(cls) > 0);
     if ( h == 0 )
@@ -1043,8 +1050,8 @@ int sat_solver3_propagate(sat_solver3* s)
                 *j++ = *i;
                 if (!sat_solver3_enqueue(s,clause_read_lit(*i),clause_from_lit(p))){
                     hConfl = s->hBinary;
-                    (clause_begin(s->binary))[1] = lit_neg(p);
-                    (clause_begin(s->binary))[0] = clause_read_lit(*i++);
+                    (clause_begin(clause_read(s, s->hBinary)))[1] = lit_neg(p);
+                    (clause_begin(clause_read(s, s->hBinary)))[0] = clause_read_lit(*i++);
                     // Copy the remaining watches:
                     while (i < end)
                         *j++ = *i++;
@@ -1114,7 +1121,6 @@ sat_solver3* sat_solver3_new(void)
     Sat_MemAlloc_(&s->Mem, 17);
     s->hLearnts = -1;
     s->hBinary = Sat_MemAppend( &s->Mem, NULL, 2, 0, 0 );
-    s->binary = clause_read( s, s->hBinary );
 
     s->nLearntStart = LEARNT_MAX_START_DEFAULT;  // starting learned clause limit
     s->nLearntDelta = LEARNT_MAX_INCRE_DEFAULT;  // delta of learned clause limit
@@ -1179,7 +1185,6 @@ sat_solver3* zsat_solver3_new_seed(double seed)
     Sat_MemAlloc_(&s->Mem, 15);
     s->hLearnts = -1;
     s->hBinary = Sat_MemAppend( &s->Mem, NULL, 2, 0, 0 );
-    s->binary = clause_read( s, s->hBinary );
 
     s->nLearntStart = LEARNT_MAX_START_DEFAULT;  // starting learned clause limit
     s->nLearntDelta = LEARNT_MAX_INCRE_DEFAULT;  // delta of learned clause limit
@@ -1355,7 +1360,7 @@ void sat_solver3_restart( sat_solver3* s )
     Sat_MemRestart( &s->Mem );
     s->hLearnts = -1;
     s->hBinary = Sat_MemAppend( &s->Mem, NULL, 2, 0, 0 );
-    s->binary = clause_read( s, s->hBinary );
+    s->fMemOut = 0;
 
     veci_resize(&s->trail_lim, 0);
     veci_resize(&s->order, 0);
@@ -1401,7 +1406,7 @@ void zsat_solver3_restart_seed( sat_solver3* s, double seed )
     Sat_MemRestart( &s->Mem );
     s->hLearnts = -1;
     s->hBinary = Sat_MemAppend( &s->Mem, NULL, 2, 0, 0 );
-    s->binary = clause_read( s, s->hBinary );
+    s->fMemOut = 0;
 
     veci_resize(&s->trail_lim, 0);
     veci_resize(&s->order, 0);
@@ -1654,8 +1659,9 @@ void sat_solver3_rollback( sat_solver3* s )
     // reset clause counts
     s->stats.clauses = pMem->BookMarkE[0];
     s->stats.learnts = pMem->BookMarkE[1];
-    // rollback clauses
+    // rollback clauses (the clause that did not fit was added after the bookmark)
     Sat_MemRollBack( pMem );
+    s->fMemOut = 0;
 
     // resize learned arrays
     veci_resize(&s->act_clas,  s->stats.learnts);
@@ -1821,6 +1827,10 @@ static lbool sat_solver3_search(sat_solver3* s, ABC_INT64_T nof_conflicts)
             blevel = s->root_level > blevel ? s->root_level : blevel;
             sat_solver3_canceluntil(s,blevel);
             sat_solver3_record(s,&learnt_clause);
+            if ( s->fMemOut ){
+                sat_solver3_canceluntil(s,s->root_level);
+                veci_delete(&learnt_clause);
+                return l_Undef; }
 #ifdef SAT_USE_ANALYZE_FINAL
 //            if (learnt_clause.size() == 1) level[var(learnt_clause[0])] = 0;    // (this is ugly (but needed for 'analyzeFinal()') -- in future versions, we will backtrack past the 'root_level' and redo the assumptions)
             if ( learnt_clause.size == 1 ) 
@@ -1899,6 +1909,9 @@ int sat_solver3_solve_internal(sat_solver3* s)
     int restart_iter = 0;
     veci_resize(&s->unit_lits, 0);
     s->nCalls++;
+    // a clause could not be added when the clause arena reached its largest size
+    if ( s->fMemOut )
+        return l_Undef;
 
     if (s->verbosity >= 1){
         printf("==================================[MINISAT]===================================\n");
@@ -1935,6 +1948,8 @@ int sat_solver3_solve_internal(sat_solver3* s)
             break;
         if ( s->nRuntimeLimit && Abc_Clock() > s->nRuntimeLimit )
             break;
+        if ( s->fMemOut )
+            break;
     }
     if (s->verbosity >= 1)
         printf("==============================================================================\n");
@@ -1956,8 +1971,8 @@ int sat_solver3_push(sat_solver3* s, int p)
         {
             if (clause_is_lit(h))
             {
-                (clause_begin(s->binary))[1] = lit_neg(p);
-                (clause_begin(s->binary))[0] = clause_read_lit(h);
+                (clause_begin(clause_read(s, s->hBinary)))[1] = lit_neg(p);
+                (clause_begin(clause_read(s, s->hBinary)))[0] = clause_read_lit(h);
                 h = s->hBinary;
             }
             sat_solver3_analyze_final(s, h, 1);
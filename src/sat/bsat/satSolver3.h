@@ -107,7 +107,6 @@ struct sat_solver3_t
     Sat_Mem_t   Mem;
     int         hLearnts;      // the first learnt clause
     int         hBinary;       // the special binary clause
-    clause *    binary;
     veci*       wlists;        // watcher lists
 
     // rollback
@@ -185,6 +184,7 @@ struct sat_solver3_t
     // clause store
     void *      pStore;
     int         fSolved;
+    int         fMemOut;       // the clause arena has reached its largest size
 
     // trace recording
     FILE *      pFile;
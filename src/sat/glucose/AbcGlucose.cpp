@@ -227,6 +227,13 @@ void bmcg_sat_solver_set_stop(bmcg_sat_solver* s, int * pstop)
     glucose_solver_setstop((Gluco::SimpSolver*)s, pstop);
 }
 
+void bmcg_sat_solver_set_share(bmcg_sat_solver* s, void * pman, void(*pexport)(void*, int*, int, int), int(*pimport)(void*, int**))
+{
+    ((Gluco::SimpSolver*)s)->pShareMan = pman;
+    ((Gluco::SimpSolver*)s)->pFuncExport = pexport;
+    ((Gluco::SimpSolver*)s)->pFuncImport = pimport;
+}
+
 abctime bmcg_sat_solver_set_runtime_limit(bmcg_sat_solver* s, abctime Limit)
 {
     abctime nRuntimeLimit = ((Gluco::SimpSolver*)s)->nRuntimeLimit;
@@ -566,6 +573,13 @@ void bmcg_sat_solver_set_stop(bmcg_sat_solver* s, int * pstop)
     glucose_solver_setstop((Gluco::Solver*)s, pstop);
 }
 
+void bmcg_sat_solver_set_share(bmcg_sat_solver* s, void * pman, void(*pexport)(void*, int*, int, int), int(*pimport)(void*, int**))
+{
+    ((Gluco::Solver*)s)->pShareMan = pman;
+    ((Gluco::Solver*)s)->pFuncExport = pexport;
+    ((Gluco::Solver*)s)->pFuncImport = pimport;
+}
+
 abctime bmcg_sat_solver_set_runtime_limit(bmcg_sat_solver* s, abctime Limit)
 {
     abctime nRuntimeLimit = ((Gluco::Solver*)s)->nRuntimeLimit;
@@ -96,6 +96,9 @@ Solver::Solver() :
     , nCallConfl(1000)
     , terminate_search_early(false)
     , pstop(NULL)
+    , pShareMan(NULL)
+    , pFuncExport(NULL)
+    , pFuncImport(NULL)
     , nRuntimeLimit(0)
 
     , verbosity      (0)
@@ -1022,6 +1025,46 @@ bool Solver::simplify()
 }
 
 
+/*_________________________________________________________________________________________________
+|
+|  importClauses : ()  ->  [void]
+|  
+|  Description:
+|    Imports the clauses learned by other solvers working on the same CNF. A clause is added
+|    as learnt if two of its literals are not false under the current (root) assignment, so
+|    that it can be watched without backtracking; a unit is only added at level zero.
+|________________________________________________________________________________________________@*/
+void Solver::importClauses()
+{
+    vec<Lit> lits;
+    int * pLits, nLits, nFree, i;
+    while ((nLits = pFuncImport(pShareMan, &pLits)) >= 0){
+        lits.clear();
+        for (i = nFree = 0; i < nLits; i++){
+            Lit p = toLit(pLits[i]);
+            if (var(p) >= nVars() || (value(p) == l_True && level(var(p)) == 0))
+                break;
+            lits.push(p);
+            if (value(p) != l_False){
+                lits[lits.size()-1] = lits[nFree];
+                lits[nFree++] = p;
+            }
+        }
+        // skip unknown variables and clauses satisfied at level zero
+        if (i < nLits)
+            continue;
+        if (nFree >= 2){
+            CRef cr = ca.alloc(lits, true);
+            ca[cr].setLBD(lits.size());
+            ca[cr].setSizeWithoutSelectors(lits.size());
+            learnts.push(cr);
+            attachClause(cr);
+            claBumpActivity(ca[cr]);
+        }else if (nFree == 1 && decisionLevel() == 0 && value(lits[0]) == l_Undef)
+            uncheckedEnqueue(lits[0]);
+    }
+}
+
 /*_________________________________________________________________________________________________
 |
 |  search : (nof_conflicts : int) (params : const SearchParams&)  ->  [lbool]
@@ -1044,6 +1087,8 @@ lbool Solver::search(int nof_conflicts)
     unsigned int nblevels,szWoutSelectors;
     bool blocked=false;
     starts++;
+    if (pFuncImport)
+      importClauses();
     for (;;){
         CRef confl = propagate();
         if (confl != CRef_Undef){
@@ -1077,6 +1122,8 @@ lbool Solver::search(int nof_conflicts)
 
             lbdQueue.push(nblevels);
             sumLBD += nblevels;
+            if (pFuncExport)
+              pFuncExport(pShareMan, (int *)(Lit *)learnt_clause, learnt_clause.size(), nblevels);
  
             cancelUntil(backtrack_level);
 
@@ -60,6 +60,9 @@ public:
     int nCallConfl;                      // callback will be called every this number of conflicts
     bool terminate_search_early;         // used to stop the solver early if it as instructed by an external caller
     int * pstop;                         // another callback
+    void * pShareMan;                    // external clause exchange
+    void(*pFuncExport)(void *, int *, int, int); // exports a learned clause (lits, size, LBD)
+    int(*pFuncImport)(void *, int **);   // returns the size of the next clause to import or -1
     uint64_t nRuntimeLimit;              // runtime limit
     vec<int> user_vec;
     vec<Lit> user_lits;
@@ -309,6 +312,7 @@ protected:
     void     analyzeFinal     (Lit p, vec<Lit>& out_conflict);                         // COULD THIS BE IMPLEMENTED BY THE ORDINARIY "analyze" BY SOME REASONABLE GENERALIZATION?
     bool     litRedundant     (Lit p, uint32_t abstract_levels);                       // (helper method for 'analyze()')
     lbool    search           (int nof_conflicts);                                     // Search for a given number of conflicts.
+    void     importClauses    ();                                                      // Import the clauses learned by other solvers.
     lbool    solve_           ();                                                      // Main solve method (assumptions given in 'assumptions').
     void     reduceDB         ();                                                      // Reduce the set of learnt clauses.
     void     removeSatisfied  (vec<CRef>& cs);                                         // Shrink 'cs' to contain only non-satisfied clauses.
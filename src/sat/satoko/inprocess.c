@@ -0,0 +1,760 @@
+//===--- inprocess.c --------------------------------------------------------===
+//
+//                     satoko: Satisfiability solver
+//
+// This file is distributed under the BSD 2-Clause License.
+// See LICENSE for details.
+//
+//===------------------------------------------------------------------------===
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <string.h>
+
+#include "solver.h"
+#include "utils/mem.h"
+
+#include "misc/util/abc_global.h"
+ABC_NAMESPACE_IMPL_START
+
+/**
+ *  Inprocessing runs at decision level zero between restarts. It consists of
+ *  three passes:
+ *   - subsumption and self-subsuming strengthening, using original clauses as
+ *     subsumers of both original and learnt clauses;
+ *   - bounded variable elimination of variables that are neither frozen nor
+ *     used as assumptions. The clauses of an eliminated variable are kept on
+ *     a stack, which is used to extend the model and to restore the variable
+ *     when the user refers to it again. The clauses of one variable are
+ *     consecutive on the stack, so that they can be found from the position
+ *     stored for the variable;
+ *   - clause vivification by propagating the negation of the literals of a
+ *     clause, one at a time.
+ *  The first two passes work on occurrence lists with the watches detached.
+ */
+
+/* Occurrence list of a literal */
+struct occ_list {
+    unsigned size;
+    unsigned cap;
+    unsigned *data;
+};
+
+/* Temporary data of the occurrence-based passes */
+struct inproc {
+    solver_t *s;
+    struct occ_list *occs; /* Occurrence lists indexed by literal */
+    char *lit_marks;       /* Literal marks used by subsumption and resolution */
+    unsigned i_qhead;      /* Head of the queue of level zero units */
+    long n_steps;          /* N.of literals visited */
+    vec_uint_t *pos;
+    vec_uint_t *neg;
+    vec_uint_t *resolvent;
+};
+
+/* Size mark of the clauses of restored variables left on the stack */
+#define ELIM_DEAD 0x80000000U
+
+/* Candidate for variable elimination */
+struct elim_cand {
+    unsigned cost;
+    unsigned var;
+};
+
+//===------------------------------------------------------------------------===
+// Clause helpers
+//===------------------------------------------------------------------------===
+static inline void occ_push(struct occ_list *occ, unsigned cref)
+{
+    if (occ->size == occ->cap) {
+        occ->cap = occ->cap < 4 ? 4 : 2 * occ->cap;
+        occ->data = satoko_realloc(unsigned, occ->data, occ->cap);
+    }
+    occ->data[occ->size++] = cref;
+}
+
+static inline int clause_has_lit(struct clause *clause, unsigned lit)
+{
+    unsigned i;
+    for (i = 0; i < clause->size; i++)
+        if (clause->data[i].lit == lit)
+            return 1;
+    return 0;
+}
+
+static inline void inproc_clause_delete(solver_t *s, unsigned cref)
+{
+    struct clause *clause = clause_fetch(s, cref);
+
+    assert(clause->f_mark == 0);
+    clause->f_mark = 1;
+    if (clause->f_learnt)
+        s->stats.n_learnt_lits -= clause->size;
+    else
+        s->stats.n_original_lits -= clause->size;
+    cdb_remove(s->all_clauses, clause);
+}
+
+/* Replaces the literals of the clause by a subset of them */
+static inline void inproc_clause_shrink(solver_t *s, struct clause *clause, unsigned *lits, unsigned size)
+{
+    unsigned n_removed = clause->size - size;
+
+    assert(size <= clause->size);
+    if (n_removed == 0)
+        return;
+    if (clause->f_learnt) {
+        clause_act_t act = clause->data[clause->size].act;
+        memmove(&(clause->data[0].lit), lits, sizeof(unsigned) * size);
+        clause->data[size].act = act;
+        if (clause->lbd > size)
+            clause->lbd = size;
+        s->stats.n_learnt_lits -= n_removed;
+    } else {
+        memmove(&(clause->data[0].lit), lits, sizeof(unsigned) * size);
+        s->stats.n_original_lits -= n_removed;
+    }
+    clause->size = size;
+    clause->f_vivified = 0;
+    s->all_clauses->wasted += n_removed;
+}
+
+static inline void inproc_clause_remove_lit(solver_t *s, struct clause *clause, unsigned lit)
+{
+    unsigned i;
+
+    for (i = 0; clause->data[i].lit != lit; i++);
+    assert(i < clause->size);
+    clause->data[i].lit = clause->data[clause->size - 1].lit;
+    inproc_clause_shrink(s, clause, &(clause->data[0].lit), clause->size - 1);
+}
+
+/* Assigns a literal at level zero; returns 0 if it is already false */
+static inline int inproc_assign(solver_t *s, unsigned lit)
+{
+    if (lit_value(s, lit) == SATOKO_LIT_TRUE)
+        return 1;
+    if (lit_value(s, lit) == SATOKO_LIT_FALSE)
+        return 0;
+    solver_enqueue(s, lit, UNDEF);
+    return 1;
+}
+
+static inline void solver_clear_level0_reasons(solver_t *s)
+{
+    unsigned i;
+    for (i = 0; i < vec_uint_size(s->trail); i++)
+        vec_uint_assign(s->reasons, lit2var(vec_uint_at(s->trail, i)), UNDEF);
+}
+
+static inline void solver_detach_all(solver_t *s)
+{
+    unsigned i;
+    for (i = 0; i < 2 * vec_char_size(s->assigns); i++) {
+        vec_wl_at(s->watches, i)->size = 0;
+        vec_wl_at(s->watches, i)->n_bin = 0;
+    }
+}
+
+static inline void solver_attach_all(solver_t *s)
+{
+    unsigned i, cref;
+    vec_uint_foreach(s->originals, cref, i)
+        clause_watch(s, cref);
+    vec_uint_foreach(s->learnts, cref, i)
+        clause_watch(s, cref);
+}
+
+/* Drops the deleted clauses from the vectors of clause references */
+static inline void solver_compact_clauses(solver_t *s, vec_uint_t *crefs)
+{
+    unsigned i, j, cref;
+    for (i = j = 0; i < vec_uint_size(crefs); i++) {
+        cref = vec_uint_at(crefs, i);
+        if (!clause_fetch(s, cref)->f_mark)
+            vec_uint_assign(crefs, j++, cref);
+    }
+    vec_uint_shrink(crefs, j);
+}
+
+//===------------------------------------------------------------------------===
+// Occurrence-based passes
+//===------------------------------------------------------------------------===
+static inline void inproc_occ_add(struct inproc *p, unsigned cref)
+{
+    struct clause *clause = clause_fetch(p->s, cref);
+    unsigned i;
+    for (i = 0; i < clause->size; i++)
+        occ_push(p->occs + clause->data[i].lit, cref);
+}
+
+/* Strengthens the clause by removing the literal; returns 0 on a conflict */
+static inline int inproc_strengthen(struct inproc *p, unsigned cref, unsigned lit)
+{
+    solver_t *s = p->s;
+    struct clause *clause = clause_fetch(s, cref);
+
+    inproc_clause_remove_lit(s, clause, lit);
+    if (clause->size > 1)
+        return 1;
+    inproc_clause_delete(s, cref);
+    return inproc_assign(s, clause->data[0].lit);
+}
+
+/* Propagates level zero units through the occurrence lists */
+static int inproc_propagate(struct inproc *p)
+{
+    solver_t *s = p->s;
+    unsigned i;
+
+    while (p->i_qhead < vec_uint_size(s->trail)) {
+        unsigned lit = vec_uint_at(s->trail, p->i_qhead++);
+        struct occ_list *occ = p->occs + lit;
+
+        for (i = 0; i < occ->size; i++) {
+            struct clause *clause = clause_fetch(s, occ->data[i]);
+            if (!clause->f_mark && clause_has_lit(clause, lit))
+                inproc_clause_delete(s, occ->data[i]);
+        }
+        occ = p->occs + lit_compl(lit);
+        for (i = 0; i < occ->size; i++) {
+            struct clause *clause = clause_fetch(s, occ->data[i]);
+            if (!clause->f_mark && clause_has_lit(clause, lit_compl(lit)) &&
+                !inproc_strengthen(p, occ->data[i], lit_compl(lit)))
+                return 0;
+        }
+    }
+    return 1;
+}
+
+/* Removes satisfied clauses and false literals, and builds the occurrence lists */
+static int inproc_occ_build(struct inproc *p, vec_uint_t *crefs)
+{
+    solver_t *s = p->s;
+    unsigned i, k, cref;
+
+    vec_uint_foreach(crefs, cref, i) {
+        struct clause *clause = clause_fetch(s, cref);
+
+        if (clause->f_mark)
+            continue;
+        for (k = 0; k < clause->size; k++)
+            if (lit_value(s, clause->data[k].lit) == SATOKO_LIT_TRUE)
+                break;
+        if (k < clause->size) {
+            inproc_clause_delete(s, cref);
+            continue;
+        }
+        for (k = 0; k < clause->size;)
+            if (lit_value(s, clause->data[k].lit) == SATOKO_LIT_FALSE)
+                inproc_clause_remove_lit(s, clause, clause->data[k].lit);
+            else
+                k++;
+        if (clause->size == 0)
+            return 0;
+        if (clause->size == 1) {
+            inproc_clause_delete(s, cref);
+            if (!inproc_assign(s, clause->data[0].lit))
+                return 0;
+            continue;
+        }
+        inproc_occ_add(p, cref);
+    }
+    return 1;
+}
+
+/**
+ *  Each original clause C is compared with the clauses containing the literal
+ *  of C with the fewest occurrences (in either polarity). A clause D that
+ *  contains C is removed. If D contains C with exactly one literal negated,
+ *  that literal is removed from D (self-subsuming resolution).
+ */
+static int inproc_subsume(struct inproc *p)
+{
+    solver_t *s = p->s;
+    long limit = p->n_steps + s->opts.inproc_step_limit;
+    unsigned i, j, k, pass, cref;
+
+    for (i = 0; i < vec_uint_size(s->originals) && p->n_steps < limit; i++) {
+        struct clause *clause;
+        unsigned best = UNDEF, best_cost = UNDEF;
+        int status = 1;
+
+        cref = vec_uint_at(s->originals, i);
+        clause = clause_fetch(s, cref);
+        if (clause->f_mark)
+            continue;
+        for (k = 0; k < clause->size; k++) {
+            unsigned lit = clause->data[k].lit;
+            unsigned cost = p->occs[lit].size + p->occs[lit_compl(lit)].size;
+            p->lit_marks[lit] = 1;
+            if (cost < best_cost) {
+                best_cost = cost;
+                best = lit;
+            }
+        }
+        for (pass = 0; pass < 2 && status; pass++) {
+            struct occ_list *occ = p->occs + (pass ? lit_compl(best) : best);
+            for (j = 0; j < occ->size && status; j++) {
+                unsigned dref = occ->data[j], n_match = 0, n_flip = 0, flip = UNDEF;
+                struct clause *other = clause_fetch(s, dref);
+
+                if (dref == cref || other->f_mark || other->size < clause->size)
+                    continue;
+                p->n_steps += other->size;
+                for (k = 0; k < other->size; k++) {
+                    unsigned lit = other->data[k].lit;
+                    if (p->lit_marks[lit])
+                        n_match++;
+                    else if (p->lit_marks[lit_compl(lit)]) {
+                        flip = lit;
+                        n_flip++;
+                    }
+                }
+                if (n_match == clause->size) {
+                    inproc_clause_delete(s, dref);
+                    s->stats.n_subsumed++;
+                } else if (n_flip == 1 && n_match + 1 == clause->size) {
+                    status = inproc_strengthen(p, dref, flip);
+                    s->stats.n_strengthened++;
+                }
+            }
+        }
+        for (k = 0; k < clause->size; k++)
+            p->lit_marks[clause->data[k].lit] = 0;
+        if (!status || !inproc_propagate(p))
+            return 0;
+    }
+    return 1;
+}
+
+/* Collects the live original clauses containing the literal */
+static inline void inproc_collect(struct inproc *p, unsigned lit, vec_uint_t *crefs)
+{
+    struct occ_list *occ = p->occs + lit;
+    unsigned i;
+
+    vec_uint_clear(crefs);
+    for (i = 0; i < occ->size; i++) {
+        struct clause *clause = clause_fetch(p->s, occ->data[i]);
+        if (!clause->f_mark && !clause->f_learnt && clause_has_lit(clause, lit))
+            vec_uint_push_back(crefs, occ->data[i]);
+    }
+}
+
+/* Computes the resolvent on the variable; returns 0 if it is a tautology */
+static inline int inproc_resolve(struct inproc *p, unsigned pos_cref, unsigned neg_cref, unsigned var)
+{
+    struct clause *pos = clause_fetch(p->s, pos_cref);
+    struct clause *neg = clause_fetch(p->s, neg_cref);
+    unsigned i, lit;
+    int status = 1;
+
+    vec_uint_clear(p->resolvent);
+    for (i = 0; i < pos->size; i++) {
+        lit = pos->data[i].lit;
+        if (lit2var(lit) == var)
+            continue;
+        p->lit_marks[lit] = 1;
+        vec_uint_push_back(p->resolvent, lit);
+    }
+    for (i = 0; i < neg->size && status; i++) {
+        lit = neg->data[i].lit;
+        if (lit2var(lit) == var || p->lit_marks[lit])
+            continue;
+        if (p->lit_marks[lit_compl(lit)])
+            status = 0;
+        else
+            vec_uint_push_back(p->resolvent, lit);
+    }
+    for (i = 0; i < pos->size; i++)
+        p->lit_marks[pos->data[i].lit] = 0;
+    p->n_steps += pos->size + neg->size;
+    return status;
+}
+
+static inline void inproc_push_elim_clause(solver_t *s, unsigned cref, unsigned var)
+{
+    struct clause *clause = clause_fetch(s, cref);
+    unsigned i;
+
+    vec_uint_push_back(s->elim_clauses, clause->size);
+    for (i = 0; i < clause->size; i++)
+        if (lit2var(clause->data[i].lit) == var)
+            vec_uint_push_back(s->elim_clauses, clause->data[i].lit);
+    for (i = 0; i < clause->size; i++)
+        if (lit2var(clause->data[i].lit) != var)
+            vec_uint_push_back(s->elim_clauses, clause->data[i].lit);
+}
+
+/* Returns 1 if the variable was eliminated, 0 if not, and -1 on a conflict */
+static int inproc_elim_var(struct inproc *p, unsigned var)
+{
+    solver_t *s = p->s;
+    unsigned i, j, k, cref, n_clauses, n_resolvents = 0;
+
+    inproc_collect(p, var2lit(var, 0), p->pos);
+    inproc_collect(p, var2lit(var, 1), p->neg);
+    n_clauses = vec_uint_size(p->pos) + vec_uint_size(p->neg);
+    if (n_clauses == 0 || n_clauses > s->opts.elim_max_occ)
+        return 0;
+    /* Check that the resolvents are few and short */
+    for (i = 0; i < vec_uint_size(p->pos); i++)
+        for (j = 0; j < vec_uint_size(p->neg); j++) {
+            if (!inproc_resolve(p, vec_uint_at(p->pos, i), vec_uint_at(p->neg, j), var))
+                continue;
+            if (++n_resolvents > n_clauses + s->opts.elim_grow ||
+                vec_uint_size(p->resolvent) > s->opts.elim_max_res_sz)
+                return 0;
+        }
+    /* Save the clauses of the variable and replace them by the resolvents */
+    vec_uint_assign(s->elim_start, var, vec_uint_size(s->elim_clauses));
+    vec_uint_foreach(p->pos, cref, i)
+        inproc_push_elim_clause(s, cref, var);
+    vec_uint_foreach(p->neg, cref, i)
+        inproc_push_elim_clause(s, cref, var);
+    for (i = 0; i < vec_uint_size(p->pos); i++)
+        for (j = 0; j < vec_uint_size(p->neg); j++) {
+            if (!inproc_resolve(p, vec_uint_at(p->pos, i), vec_uint_at(p->neg, j), var))
+                continue;
+            if (vec_uint_size(p->resolvent) == 0)
+                return -1;
+            if (vec_uint_size(p->resolvent) == 1) {
+                if (!inproc_assign(s, vec_uint_at(p->resolvent, 0)))
+                    return -1;
+                continue;
+            }
+            cref = solver_clause_create(s, p->resolvent, 0);
+            inproc_occ_add(p, cref);
+        }
+    vec_uint_foreach(p->pos, cref, i)
+        inproc_clause_delete(s, cref);
+    vec_uint_foreach(p->neg, cref, i)
+        inproc_clause_delete(s, cref);
+    /* Learnt clauses may not mention eliminated variables */
+    for (k = 0; k < 2; k++) {
+        struct occ_list *occ = p->occs + var2lit(var, (char)k);
+        for (i = 0; i < occ->size; i++) {
+            struct clause *clause = clause_fetch(s, occ->data[i]);
+            if (!clause->f_mark && clause_has_lit(clause, var2lit(var, (char)k)))
+                inproc_clause_delete(s, occ->data[i]);
+        }
+    }
+    vec_char_assign(s->eliminated, var, 1);
+    s->n_eliminated++;
+    s->stats.n_eliminated_vars++;
+    return inproc_propagate(p) ? 1 : -1;
+}
+
+static int elim_cand_compare(const void *p1, const void *p2)
+{
+    const struct elim_cand *c1 = (const struct elim_cand *)p1;
+    const struct elim_cand *c2 = (const struct elim_cand *)p2;
+    if (c1->cost != c2->cost)
+        return c1->cost < c2->cost ? -1 : 1;
+    return c1->var < c2->var ? -1 : (c1->var > c2->var);
+}
+
+static int inproc_elim(struct inproc *p)
+{
+    solver_t *s = p->s;
+    long limit = p->n_steps + s->opts.inproc_step_limit;
+    unsigned var, i, n_cands = 0;
+    struct elim_cand *cands = satoko_alloc(struct elim_cand, vec_char_size(s->assigns));
+    int status = 1;
+
+    /* Try the variables with the fewest occurrences first */
+    for (var = 0; var < vec_char_size(s->assigns); var++) {
+        unsigned n_pos = p->occs[var2lit(var, 0)].size;
+        unsigned n_neg = p->occs[var2lit(var, 1)].size;
+        if (var_value(s, var) != SATOKO_VAR_UNASSING || vec_uint_at(s->frozen, var) ||
+            vec_char_at(s->eliminated, var) || n_pos + n_neg == 0)
+            continue;
+        cands[n_cands].cost = n_pos * n_neg;
+        cands[n_cands].var = var;
+        n_cands++;
+    }
+    qsort((void *)cands, (size_t)n_cands, sizeof(struct elim_cand), elim_cand_compare);
+    for (i = 0; i < n_cands && p->n_steps < limit; i++) {
+        var = cands[i].var;
+        if (var_value(s, var) != SATOKO_VAR_UNASSING)
+            continue;
+        if (inproc_elim_var(p, var) < 0) {
+            status = 0;
+            break;
+        }
+    }
+    satoko_free(cands);
+    return status;
+}
+
+static int solver_inproc_occ(solver_t *s)
+{
+    struct inproc p;
+    unsigned i, n_lits = 2 * vec_char_size(s->assigns);
+    int status;
+
+    memset(&p, 0, sizeof(struct inproc));
+    p.s = s;
+    p.occs = satoko_calloc(struct occ_list, n_lits);
+    p.lit_marks = satoko_calloc(char, n_lits);
+    p.i_qhead = vec_uint_size(s->trail);
+    p.pos = vec_uint_alloc(0);
+    p.neg = vec_uint_alloc(0);
+    p.resolvent = vec_uint_alloc(0);
+
+    solver_detach_all(s);
+    status = inproc_occ_build(&p, s->originals) && inproc_occ_build(&p, s->learnts) && inproc_propagate(&p);
+    if (status && s->opts.inproc_subsume)
+        status = inproc_subsume(&p);
+    if (status && s->opts.inproc_elim)
+        status = inproc_elim(&p);
+    solver_compact_clauses(s, s->originals);
+    solver_compact_clauses(s, s->learnts);
+    solver_attach_all(s);
+    s->i_qhead = vec_uint_size(s->trail);
+
+    for (i = 0; i < n_lits; i++)
+        if (p.occs[i].data)
+            satoko_free(p.occs[i].data);
+    satoko_free(p.occs);
+    satoko_free(p.lit_marks);
+    vec_uint_free(p.pos);
+    vec_uint_free(p.neg);
+    vec_uint_free(p.resolvent);
+    return status;
+}
+
+//===------------------------------------------------------------------------===
+// Vivification
+//===------------------------------------------------------------------------===
+/* Returns 0 if the problem was found UNSAT */
+static int solver_vivify_clause(solver_t *s, unsigned cref)
+{
+    struct clause *clause = clause_fetch(s, cref);
+    unsigned i, lit;
+
+    for (i = 0; i < clause->size; i++)
+        if (lit_value(s, clause->data[i].lit) == SATOKO_LIT_TRUE) {
+            clause_unwatch(s, cref);
+            inproc_clause_delete(s, cref);
+            return 1;
+        }
+    clause_unwatch(s, cref);
+    vec_uint_clear(s->temp_lits);
+    for (i = 0; i < clause->size; i++) {
+        lit = clause->data[i].lit;
+        if (lit_value(s, lit) == SATOKO_LIT_FALSE)
+            continue;
+        vec_uint_push_back(s->temp_lits, lit);
+        if (lit_value(s, lit) == SATOKO_LIT_TRUE)
+            break;
+        vec_uint_push_back(s->trail_lim, vec_uint_size(s->trail));
+        solver_enqueue(s, lit_compl(lit), UNDEF);
+        if (solver_propagate(s) != UNDEF)
+            break;
+    }
+    solver_cancel_until(s, 0);
+    s->stats.n_vivified_lits += clause->size - vec_uint_size(s->temp_lits);
+    inproc_clause_shrink(s, clause, vec_uint_data(s->temp_lits), vec_uint_size(s->temp_lits));
+    clause->f_vivified = 1;
+    if (clause->size > 1) {
+        clause_watch(s, cref);
+        return 1;
+    }
+    inproc_clause_delete(s, cref);
+    if (clause->size == 0)
+        return 0;
+    solver_enqueue(s, clause->data[0].lit, UNDEF);
+    return solver_propagate(s) == UNDEF;
+}
+
+static int solver_vivify(solver_t *s)
+{
+    long n_props = s->stats.n_propagations;
+    long n_props_all = s->stats.n_propagations_all;
+    long limit = n_props + s->opts.vivify_prop_limit;
+    vec_char_t *polarity = vec_char_alloc(0);
+    unsigned i, k, cref;
+    int status = 1;
+
+    /* Keep the saved phases of the search */
+    vec_char_copy(polarity, s->polarity);
+    /* Recent learnt clauses first, then the original ones */
+    for (k = 0; k < 2 && status; k++) {
+        vec_uint_t *crefs = k ? s->originals : s->learnts;
+        for (i = vec_uint_size(crefs); i-- > 0 && status && s->stats.n_propagations < limit;) {
+            struct clause *clause;
+            cref = vec_uint_at(crefs, i);
+            clause = clause_fetch(s, cref);
+            if (clause->f_mark || clause->f_vivified || clause->size <= 2)
+                continue;
+            status = solver_vivify_clause(s, cref);
+        }
+    }
+    vec_char_copy(s->polarity, polarity);
+    vec_char_free(polarity);
+    for (i = 0; i < vec_uint_size(s->trail); i++)
+        vec_char_assign(s->polarity, lit2var(vec_uint_at(s->trail, i)), lit_polarity(vec_uint_at(s->trail, i)));
+    s->stats.n_propagations = n_props;
+    s->stats.n_propagations_all = n_props_all;
+    solver_compact_clauses(s, s->originals);
+    solver_compact_clauses(s, s->learnts);
+    return status;
+}
+
+//===------------------------------------------------------------------------===
+// Solver external functions
+//===------------------------------------------------------------------------===
+/* Performs one round of inprocessing; returns SATOKO_ERR if the problem is UNSAT */
+int solver_inprocess(solver_t *s)
+{
+    unsigned n_orig = vec_uint_size(s->originals);
+    unsigned n_lrnt = vec_uint_size(s->learnts);
+    int status;
+
+    assert(solver_can_inprocess(s));
+    solver_cancel_until(s, 0);
+    s->stats.n_inproc++;
+    status = (solver_propagate(s) == UNDEF);
+    solver_clear_level0_reasons(s);
+    if (status && (s->opts.inproc_subsume || s->opts.inproc_elim))
+        status = solver_inproc_occ(s);
+    if (status && s->opts.inproc_vivify)
+        status = solver_vivify(s);
+    solver_clear_level0_reasons(s);
+    solver_rebuild_order(s);
+    if (cdb_wasted(s->all_clauses) > cdb_size(s->all_clauses) * s->opts.garbage_max_ratio)
+        solver_garbage_collect(s);
+    if (s->opts.verbose) {
+        printf("inprocess: Clauses %7d -> %7d  Learnts %7d -> %7d  Eliminated vars %7d  Vivified lits %7ld\n",
+               n_orig, vec_uint_size(s->originals), n_lrnt, vec_uint_size(s->learnts),
+               s->n_eliminated, s->stats.n_vivified_lits);
+        fflush(stdout);
+    }
+    if (!status) {
+        s->status = SATOKO_ERR;
+        s->inproc_unsat = 1;
+    }
+    return status ? SATOKO_OK : SATOKO_ERR;
+}
+
+/* Adds back a clause of a restored variable at level zero */
+static void solver_add_restored(solver_t *s, unsigned *lits, unsigned size, vec_uint_t *temp)
+{
+    unsigned i, cref;
+
+    vec_uint_clear(temp);
+    for (i = 0; i < size; i++) {
+        if (lit_value(s, lits[i]) == SATOKO_LIT_TRUE)
+            return;
+        if (lit_value(s, lits[i]) != SATOKO_LIT_FALSE)
+            vec_uint_push_back(temp, lits[i]);
+    }
+    if (vec_uint_size(temp) == 0) {
+        s->status = SATOKO_ERR;
+        s->inproc_unsat = 1;
+        return;
+    }
+    if (vec_uint_size(temp) == 1) {
+        solver_enqueue(s, vec_uint_at(temp, 0), UNDEF);
+        if (solver_propagate(s) != UNDEF) {
+            s->status = SATOKO_ERR;
+            s->inproc_unsat = 1;
+        }
+        return;
+    }
+    cref = solver_clause_create(s, temp, 0);
+    clause_watch(s, cref);
+}
+
+/* Removes the clauses of the restored variables from the stack */
+static void solver_compact_elim_clauses(solver_t *s)
+{
+    unsigned *data = vec_uint_data(s->elim_clauses);
+    unsigned i, j, k, size, var, prev = UNDEF;
+
+    for (i = j = 0; i < vec_uint_size(s->elim_clauses); i += (size & ~ELIM_DEAD) + 1) {
+        size = data[i];
+        if (size & ELIM_DEAD)
+            continue;
+        var = lit2var(data[i + 1]);
+        if (var != prev)
+            vec_uint_assign(s->elim_start, var, j);
+        prev = var;
+        for (k = 0; k <= size; k++)
+            data[j + k] = data[i + k];
+        j += size + 1;
+    }
+    vec_uint_shrink(s->elim_clauses, j);
+    s->n_elim_dead = 0;
+}
+
+/* Brings back an eliminated variable together with its clauses */
+void solver_restore_var(solver_t *s, unsigned var)
+{
+    vec_uint_t *restored = vec_uint_alloc(0);
+    vec_uint_t *temp = vec_uint_alloc(0);
+    unsigned *data = vec_uint_data(s->elim_clauses);
+    unsigned i, k, size;
+
+    assert(var_eliminated(s, var));
+    solver_cancel_until(s, 0);
+    vec_char_assign(s->eliminated, var, 0);
+    s->n_eliminated--;
+    /* Take the clauses of the variable off the stack */
+    for (i = vec_uint_at(s->elim_start, var); i < vec_uint_size(s->elim_clauses); i += size + 1) {
+        size = data[i];
+        if ((size & ELIM_DEAD) || lit2var(data[i + 1]) != var)
+            break;
+        for (k = 0; k <= size; k++)
+            vec_uint_push_back(restored, data[i + k]);
+        data[i] |= ELIM_DEAD;
+        s->n_elim_dead += size + 1;
+    }
+    assert(vec_uint_size(restored) > 0);
+    if (2 * s->n_elim_dead > vec_uint_size(s->elim_clauses))
+        solver_compact_elim_clauses(s);
+    if (!heap_in_heap(s->var_order, var))
+        heap_insert(s->var_order, var);
+    for (i = 0; i < vec_uint_size(restored); i += size + 1) {
+        unsigned *lits = vec_uint_data(restored) + i + 1;
+        size = vec_uint_at(restored, i);
+        for (k = 1; k < size; k++)
+            if (var_eliminated(s, lit2var(lits[k])))
+                solver_restore_var(s, lit2var(lits[k]));
+        solver_add_restored(s, lits, size, temp);
+    }
+    vec_uint_free(restored);
+    vec_uint_free(temp);
+}
+
+/**
+ *  The clauses of the eliminated variables are visited in the reverse order of
+ *  elimination. If a clause is not satisfied, its first literal, which belongs
+ *  to the eliminated variable, is set to true. The values are written into the
+ *  saved phases, from which the model is read.
+ */
+void solver_extend_model(solver_t *s)
+{
+    vec_uint_t *starts = vec_uint_alloc(0);
+    unsigned i, k, size;
+
+    for (i = 0; i < vec_uint_size(s->elim_clauses); i += (size & ~ELIM_DEAD) + 1) {
+        size = vec_uint_at(s->elim_clauses, i);
+        if (!(size & ELIM_DEAD))
+            vec_uint_push_back(starts, i);
+    }
+    for (i = vec_uint_size(starts); i-- > 0;) {
+        unsigned *lits = vec_uint_data(s->elim_clauses) + vec_uint_at(starts, i);
+        size = *lits++;
+        for (k = 0; k < size; k++)
+            if (vec_char_at(s->polarity, lit2var(lits[k])) == lit_polarity(lits[k]))
+                break;
+        if (k == size)
+            vec_char_assign(s->polarity, lit2var(lits[0]), lit_polarity(lits[0]));
+    }
+    vec_uint_free(starts);
+}
+
+ABC_NAMESPACE_IMPL_END
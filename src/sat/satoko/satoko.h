@@ -65,6 +65,18 @@ struct satoko_opts {
     unsigned clause_max_sz_bin_resol;
     unsigned clause_min_lbd_bin_resol;
     float garbage_max_ratio;
+
+    /* Inprocessing */
+    unsigned inproc_interval;    /* N.of conflicts between inprocessing rounds (0 = disabled) */
+    unsigned inproc_inc;         /* Increment of the interval after each round */
+    char inproc_vivify;          /* Enables clause vivification */
+    char inproc_subsume;         /* Enables subsumption and self-subsuming strengthening */
+    char inproc_elim;            /* Enables bounded elimination of non-frozen variables */
+    unsigned vivify_prop_limit;  /* Limit on the n.of propagations spent on vivification per round */
+    unsigned inproc_step_limit;  /* Limit on the n.of literals visited by subsumption and elimination per round */
+    unsigned elim_max_occ;       /* Max n.of clauses containing a variable to be eliminated */
+    unsigned elim_max_res_sz;    /* Max size of a resolvent */
+    unsigned elim_grow;          /* Max increase of the n.of clauses when eliminating a variable */
     char verbose;
     char no_simplify;
 };
@@ -83,6 +95,12 @@ struct satoko_stats {
 
     long n_original_lits;
     long n_learnt_lits;
+
+    unsigned n_inproc;
+    long n_vivified_lits;
+    long n_subsumed;
+    long n_strengthened;
+    long n_eliminated_vars;
 };
 
 
@@ -100,6 +118,8 @@ extern int  satoko_add_clause(satoko_t *, int *, int);
 extern void satoko_assump_push(satoko_t *s, int);
 extern void satoko_assump_pop(satoko_t *s);
 extern int  satoko_simplify(satoko_t *);
+extern int  satoko_inprocess(satoko_t *);
+extern void satoko_freeze_var(satoko_t *, int, int);
 extern int  satoko_solve(satoko_t *);
 extern int  satoko_solve_assumptions(satoko_t *s, int * plits, int nlits);
 extern int  satoko_solve_assumptions_limit(satoko_t *s, int * plits, int nlits, int nconflim);
@@ -139,6 +159,7 @@ extern int satoko_conflictnum(satoko_t *);
 extern void satoko_set_stop(satoko_t *, int *);
 extern void satoko_set_stop_func(satoko_t *s, int (*fnct)(int));
 extern void satoko_set_runid(satoko_t *, int);
+extern void satoko_set_share(satoko_t *, void *, void (*)(void *, int *, int, int), int (*)(void *, int **));
 extern int satoko_read_cex_varvalue(satoko_t *, int);
 extern abctime satoko_set_runtime_limit(satoko_t *, abctime);
 extern char satoko_var_polarity(satoko_t *, unsigned);
@@ -349,6 +349,8 @@ static inline void solver_handle_conflict(solver_t *s, unsigned confl_cref)
     solver_analyze(s, confl_cref, s->temp_lits, &bt_level, &lbd);
     s->sum_lbd += lbd;
     b_queue_push(s->bq_lbd, lbd);
+    if (s->pFuncExport)
+        s->pFuncExport(s->pShareMan, (int *)vec_uint_data(s->temp_lits), vec_uint_size(s->temp_lits), lbd);
     solver_cancel_until(s, bt_level);
     cref = UNDEF;
     if (vec_uint_size(s->temp_lits) > 1) {
@@ -394,7 +396,7 @@ static inline void solver_analyze_final(solver_t *s, unsigned lit)
     // solver_debug_check_unsat(s);
 }
 
-static inline void solver_garbage_collect(solver_t *s)
+void solver_garbage_collect(solver_t *s)
 {
     unsigned i;
     unsigned *array;
@@ -496,6 +498,7 @@ unsigned solver_clause_create(solver_t *s, vec_uint_t *lits, unsigned f_learnt)
     clause->f_mark = 0;
     clause->f_reallocd = 0;
     clause->f_deletable = f_learnt;
+    clause->f_vivified = 0;
     clause->size = vec_uint_size(lits);
     memcpy(&(clause->data[0].lit), vec_uint_data(lits), sizeof(unsigned) * vec_uint_size(lits));
 
@@ -624,9 +627,44 @@ unsigned solver_propagate(solver_t *s)
     return conf_cref;
 }
 
+/* Imports the clauses learnt by other solvers working on the same CNF */
+static inline void solver_import(solver_t *s)
+{
+    int *lits, n_lits;
+    unsigned i, n_free, temp, cref;
+
+    while ((n_lits = s->pFuncImport(s->pShareMan, &lits)) >= 0) {
+        /* Move the non-false literals to the front */
+        for (i = n_free = 0; i < (unsigned)n_lits; i++) {
+            unsigned lit = (unsigned)lits[i];
+            if (lit2var(lit) >= vec_char_size(s->assigns) || var_eliminated(s, lit2var(lit)) ||
+                (lit_value(s, lit) == SATOKO_LIT_TRUE && lit_dlevel(s, lit) == 0))
+                break;
+            if (lit_value(s, lit) != SATOKO_LIT_FALSE) {
+                temp = lits[n_free];
+                lits[n_free++] = lit;
+                lits[i] = temp;
+            }
+        }
+        /* Skip unknown or eliminated variables and clauses satisfied at level zero */
+        if (i < (unsigned)n_lits)
+            continue;
+        if (n_free >= 2) {
+            vec_uint_clear(s->temp_lits);
+            for (i = 0; i < (unsigned)n_lits; i++)
+                vec_uint_push_back(s->temp_lits, (unsigned)lits[i]);
+            cref = solver_clause_create(s, s->temp_lits, 1);
+            clause_watch(s, cref);
+        } else if (n_free == 1 && solver_dlevel(s) == 0 && var_value(s, lit2var(lits[0])) == SATOKO_VAR_UNASSING)
+            solver_enqueue(s, (unsigned)lits[0], UNDEF);
+    }
+}
+
 char solver_search(solver_t *s)
 {
     s->stats.n_starts++;
+    if (s->pFuncImport)
+        solver_import(s);
     while (1) {
         unsigned confl_cref = solver_propagate(s);
         if (confl_cref != UNDEF) {
@@ -100,12 +100,31 @@ struct solver_t_ {
     /* Temporary data used for solving cones */
     vec_char_t *marks;
     
+    /* Inprocessing */
+    vec_uint_t *frozen;       /* N.of freezes of each variable; frozen variables
+                                 are never eliminated */
+    vec_char_t *eliminated;   /* Variables removed by variable elimination */
+    vec_uint_t *elim_clauses; /* Clauses of eliminated variables: size, then
+                                 literals, starting with the eliminated one */
+    vec_uint_t *elim_start;   /* Position of the clauses of each eliminated
+                                 variable on elim_clauses */
+    unsigned n_elim_dead;     /* N.of entries of restored variables on elim_clauses */
+    unsigned n_eliminated;
+    unsigned n_inproc_rounds;
+    char inproc_unsat;        /* Inprocessing derived the empty clause */
+    long n_confl_bfr_inproc;
+
     /* Callbacks to stop the solver */
     abctime nRuntimeLimit;
     int    *pstop;
     int     RunId;           
     int   (*pFuncStop)(int);  
 
+    /* Callbacks to share learnt clauses */
+    void   *pShareMan;
+    void  (*pFuncExport)(void *, int *, int, int);
+    int   (*pFuncImport)(void *, int **);
+
     struct satoko_stats stats;
     struct satoko_opts opts;
 };
@@ -115,6 +134,13 @@ extern unsigned solver_clause_create(solver_t *, vec_uint_t *, unsigned);
 extern char solver_search(solver_t *);
 extern void solver_cancel_until(solver_t *, unsigned);
 extern unsigned solver_propagate(solver_t *);
+extern void solver_garbage_collect(solver_t *);
+extern void solver_rebuild_order(solver_t *);
+
+/* Inprocessing */
+extern int solver_inprocess(solver_t *);
+extern void solver_restore_var(solver_t *, unsigned);
+extern void solver_extend_model(solver_t *);
 
 /* Debuging */
 extern void solver_debug_check(solver_t *, int);
@@ -162,6 +188,10 @@ static inline void var_clean_mark(solver_t *s, unsigned var)
 {
     vec_char_assign(s->marks, var, 0);
 }
+static inline int var_eliminated(solver_t *s, unsigned var)
+{
+    return s->n_eliminated && vec_char_at(s->eliminated, var);
+}
 //===------------------------------------------------------------------------===
 // Inline lit functions
 //===------------------------------------------------------------------------===
@@ -226,6 +256,13 @@ static inline int solver_stop(satoko_t *s)
     return s->pstop && *s->pstop;
 }
 
+/* Inprocessing rewrites the clause database, so it is skipped while the
+ * solver is bookmarked or works on a marked cone */
+static inline int solver_can_inprocess(satoko_t *s)
+{
+    return s->status == SATOKO_OK && !solver_has_marks(s) && !s->book_vars;
+}
+
 //===------------------------------------------------------------------------===
 // Inline clause functions
 //===------------------------------------------------------------------------===
@@ -21,13 +21,13 @@ ABC_NAMESPACE_IMPL_START
 //===------------------------------------------------------------------------===
 // Satoko internal functions
 //===------------------------------------------------------------------------===
-static inline void solver_rebuild_order(solver_t *s)
+void solver_rebuild_order(solver_t *s)
 {
     unsigned var;
     vec_uint_t *vars = vec_uint_alloc(vec_char_size(s->assigns));
 
     for (var = 0; var < vec_char_size(s->assigns); var++)
-        if (var_value(s, var) == SATOKO_VAR_UNASSING)
+        if (var_value(s, var) == SATOKO_VAR_UNASSING && !var_eliminated(s, var))
             vec_uint_push_back(vars, var);
     heap_build(s->var_order, vars);
     vec_uint_free(vars);
@@ -80,6 +80,13 @@ static inline void print_stats(solver_t *s)
     printf("conflicts     : %10ld\n", s->stats.n_conflicts);
     printf("decisions     : %10ld\n", s->stats.n_decisions);
     printf("propagations  : %10ld\n", s->stats.n_propagations);
+    if (s->stats.n_inproc) {
+        printf("inprocessing  : %10d\n", s->stats.n_inproc);
+        printf("  vivified    : %10ld lits\n", s->stats.n_vivified_lits);
+        printf("  subsumed    : %10ld\n", s->stats.n_subsumed);
+        printf("  strengthened: %10ld\n", s->stats.n_strengthened);
+        printf("  eliminated  : %10ld vars\n", s->stats.n_eliminated_vars);
+    }
 }
 
 //===------------------------------------------------------------------------===
@@ -126,6 +133,11 @@ solver_t * satoko_create()
     s->last_dlevel = vec_uint_alloc(0);
     /* Misc temporary */
     s->stamps = vec_uint_alloc(0);
+    /* Inprocessing */
+    s->frozen = vec_uint_alloc(0);
+    s->eliminated = vec_char_alloc(0);
+    s->elim_clauses = vec_uint_alloc(0);
+    s->elim_start = vec_uint_alloc(0);
     return s;
 }
 
@@ -153,6 +165,10 @@ void satoko_destroy(solver_t *s)
     vec_uint_free(s->stack);
     vec_uint_free(s->last_dlevel);
     vec_uint_free(s->stamps);
+    vec_uint_free(s->frozen);
+    vec_char_free(s->eliminated);
+    vec_uint_free(s->elim_clauses);
+    vec_uint_free(s->elim_start);
     if (s->marks)
         vec_char_free(s->marks);
     satoko_free(s);
@@ -188,6 +204,17 @@ void satoko_default_opts(satoko_opts_t *opts)
     opts->clause_min_lbd_bin_resol = 6;
 
     opts->garbage_max_ratio = (float) 0.3;
+    /* Inprocessing */
+    opts->inproc_interval = 0;
+    opts->inproc_inc = 5000;
+    opts->inproc_vivify = 1;
+    opts->inproc_subsume = 1;
+    opts->inproc_elim = 1;
+    opts->vivify_prop_limit = 2000000;
+    opts->inproc_step_limit = 20000000;
+    opts->elim_max_occ = 16;
+    opts->elim_max_res_sz = 20;
+    opts->elim_grow = 0;
 }
 
 /**
@@ -227,6 +254,30 @@ int satoko_simplify(solver_t * s)
     return SATOKO_OK;
 }
 
+int satoko_inprocess(solver_t *s)
+{
+    if (!solver_can_inprocess(s))
+        return s->status;
+    return solver_inprocess(s);
+}
+
+/* Freezes are counted: a variable frozen twice stays frozen until it is
+ * unfrozen twice. Unknown variables are added to the solver. */
+void satoko_freeze_var(solver_t *s, int var, int freeze)
+{
+    unsigned n_freezes;
+
+    assert(var >= 0);
+    satoko_setnvars(s, var + 1);
+    n_freezes = vec_uint_at(s->frozen, var);
+    if (freeze) {
+        if (var_eliminated(s, var))
+            solver_restore_var(s, var);
+        vec_uint_assign(s->frozen, var, n_freezes + 1);
+    } else if (n_freezes > 0)
+        vec_uint_assign(s->frozen, var, n_freezes - 1);
+}
+
 void satoko_setnvars(solver_t *s, int nvars)
 {
     int i;
@@ -246,6 +297,9 @@ int satoko_add_variable(solver_t *s, char sign)
     vec_uint_push_back(s->reasons, UNDEF);
     vec_uint_push_back(s->stamps, 0);
     vec_char_push_back(s->seen, 0);
+    vec_uint_push_back(s->frozen, 0);
+    vec_char_push_back(s->eliminated, 0);
+    vec_uint_push_back(s->elim_start, 0);
     heap_insert(s->var_order, var);
     if (s->marks)
         vec_char_push_back(s->marks, 0);
@@ -263,6 +317,10 @@ int satoko_add_clause(solver_t *s, int *lits, int size)
     max_var = lit2var(lits[size - 1]);
     while (max_var >= vec_act_size(s->activity))
         satoko_add_variable(s, SATOKO_LIT_FALSE);
+    /* Bring back the clauses of eliminated variables */
+    for (i = 0; s->n_eliminated && i < (unsigned)size; i++)
+        if (var_eliminated(s, lit2var(lits[i])))
+            solver_restore_var(s, lit2var(lits[i]));
 
     vec_uint_clear(s->temp_lits);
     j = 0;
@@ -299,16 +357,19 @@ void satoko_assump_push(solver_t *s, int lit)
 {
     assert(lit2var(lit) < (unsigned)satoko_varnum(s));
     // printf("[Satoko] Push assumption: %d\n", lit);
+    satoko_freeze_var(s, lit2var(lit), 1);
     vec_uint_push_back(s->assumptions, lit);
     vec_char_assign(s->polarity, lit2var(lit), lit_polarity(lit));
 }
 
 void satoko_assump_pop(solver_t *s)
 {
+    unsigned lit;
     assert(vec_uint_size(s->assumptions) > 0);
     // printf("[Satoko] Pop assumption: %d\n", vec_uint_pop_back(s->assumptions));
-    vec_uint_pop_back(s->assumptions);
+    lit = vec_uint_pop_back(s->assumptions);
     solver_cancel_until(s, vec_uint_size(s->assumptions));
+    satoko_freeze_var(s, lit2var(lit), 0);
 }
 
 int satoko_solve(solver_t *s)
@@ -319,6 +380,8 @@ int satoko_solve(solver_t *s)
     solver_clean_stats(s);
     //if (s->opts.verbose)
     //    print_opts(s);
+    if (s->status == SATOKO_ERR && s->inproc_unsat)
+        return SATOKO_UNSAT;
     if (s->status == SATOKO_ERR) {
         printf("Satoko in inconsistent state\n");
         return SATOKO_UNDEC;
@@ -328,7 +391,19 @@ int satoko_solve(solver_t *s)
         if (satoko_simplify(s) != SATOKO_OK)
             return SATOKO_UNDEC;
 
+    if (s->opts.inproc_interval && s->n_confl_bfr_inproc == 0)
+        s->n_confl_bfr_inproc = s->stats.n_conflicts_all + s->opts.inproc_interval;
     while (status == SATOKO_UNDEC) {
+        /* Inprocessing between restarts */
+        if (s->opts.inproc_interval && s->stats.n_conflicts_all >= s->n_confl_bfr_inproc && solver_can_inprocess(s)) {
+            s->n_inproc_rounds++;
+            s->n_confl_bfr_inproc = s->stats.n_conflicts_all + s->opts.inproc_interval + (long)s->n_inproc_rounds * s->opts.inproc_inc;
+            if (solver_inprocess(s) != SATOKO_OK) {
+                vec_uint_clear(s->final_conflict);
+                status = SATOKO_UNSAT;
+                break;
+            }
+        }
         status = solver_search(s);
         if (solver_check_limits(s) == 0 || solver_stop(s))
             break;
@@ -339,6 +414,8 @@ int satoko_solve(solver_t *s)
     }
     if (s->opts.verbose)
         print_stats(s);
+    if (status == SATOKO_SAT && s->n_eliminated)
+        solver_extend_model(s);
     
     solver_cancel_until(s, vec_uint_size(s->assumptions));
     return status;
@@ -443,8 +520,13 @@ satoko_opts_t * satoko_options(satoko_t *s)
 void satoko_bookmark(satoko_t *s)
 {
     // printf("[Satoko] Bookmark.\n");
+    unsigned var;
     assert(s->status == SATOKO_OK);
     assert(solver_dlevel(s) == 0);
+    /* Rolling back does not know about eliminated variables */
+    for (var = 0; s->n_eliminated && var < vec_char_size(s->assigns); var++)
+        if (var_eliminated(s, var))
+            solver_restore_var(s, var);
     s->book_cl_orig = vec_uint_size(s->originals);
     s->book_cl_lrnt = vec_uint_size(s->learnts);
     s->book_vars = vec_char_size(s->assigns);
@@ -491,6 +573,15 @@ void satoko_reset(satoko_t *s)
     vec_uint_clear(s->stack);
     vec_uint_clear(s->last_dlevel);
     vec_uint_clear(s->stamps);
+    vec_uint_clear(s->frozen);
+    vec_char_clear(s->eliminated);
+    vec_uint_clear(s->elim_clauses);
+    vec_uint_clear(s->elim_start);
+    s->n_elim_dead = 0;
+    s->n_eliminated = 0;
+    s->n_inproc_rounds = 0;
+    s->inproc_unsat = 0;
+    s->n_confl_bfr_inproc = 0;
     s->status = SATOKO_OK;
     s->var_act_inc = VAR_ACT_INIT_INC;
     s->clause_act_inc = CLAUSE_ACT_INIT_INC;
@@ -546,6 +637,9 @@ void satoko_rollback(satoko_t *s)
     vec_char_shrink(s->assigns, s->book_vars);
     vec_char_shrink(s->seen, s->book_vars);
     vec_char_shrink(s->polarity, s->book_vars);
+    vec_uint_shrink(s->frozen, s->book_vars);
+    vec_char_shrink(s->eliminated, s->book_vars);
+    vec_uint_shrink(s->elim_start, s->book_vars);
     solver_rebuild_order(s);
     /* Rewind solver and cancel level 0 assignments to the trail */
     solver_cancel_until(s, 0);
@@ -565,6 +659,8 @@ void satoko_mark_cone(satoko_t *s, int * pvars, int n_vars)
     if (!solver_has_marks(s))
         s->marks = vec_char_init(satoko_varnum(s), 0);
     for (i = 0; i < n_vars; i++) {
+        if (var_eliminated(s, pvars[i]))
+            solver_restore_var(s, pvars[i]);
         var_set_mark(s, pvars[i]);
         vec_sdbl_assign(s->activity, pvars[i], 0);
         if (!heap_in_heap(s->var_order, pvars[i]))
@@ -657,6 +753,13 @@ void satoko_set_runid(satoko_t *s, int id)
     s->RunId = id;
 }
 
+void satoko_set_share(satoko_t *s, void * pman, void (*pexport)(void *, int *, int, int), int (*pimport)(void *, int **))
+{
+    s->pShareMan = pman;
+    s->pFuncExport = pexport;
+    s->pFuncImport = pimport;
+}
+
 int satoko_read_cex_varvalue(satoko_t *s, int ivar)
 {
     return satoko_var_polarity(s, ivar) == SATOKO_LIT_TRUE;
@@ -0,0 +1,62 @@
+// Cut-enumeration benchmark of the mappers.
+//
+// usage: cut_bench [-K num] [-C num] [-E engines] file.aig ...
+//
+// Prints one CSV line per design and engine (see &cutbench) and
+// returns non-zero if a design cannot be read or an engine fails.
+
+#include "base/main/main.h"
+#include "map/mio/mio.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+ABC_NAMESPACE_USING_NAMESPACE
+
+// a small library so that the standard-cell mapper is benchmarked too
+static char s_BenchGenlib[] =
+    "GATE ZERO    0 O=CONST0;\n"
+    "GATE ONE     0 O=CONST1;\n"
+    "GATE BUF     1 O=a;        PIN * NONINV 1 999 1.0 0.0 1.0 0.0\n"
+    "GATE INV     1 O=!a;       PIN * INV    1 999 1.0 0.0 1.0 0.0\n"
+    "GATE AND2    2 O=a*b;      PIN * NONINV 1 999 1.0 0.0 1.0 0.0\n"
+    "GATE NAND2   2 O=!(a*b);   PIN * INV    1 999 1.0 0.0 1.0 0.0\n"
+    "GATE OR2     2 O=a+b;      PIN * NONINV 1 999 1.0 0.0 1.0 0.0\n"
+    "GATE NOR2    2 O=!(a+b);   PIN * INV    1 999 1.0 0.0 1.0 0.0\n";
+
+int main( int argc, char ** argv )
+{
+    char * pEngines = NULL;
+    int nLutSize = 6, nCutNum = 8, fHeader = 1, RetValue = 0, i;
+    Mio_Library_t * pLib;
+    Abc_Start();
+    pLib = Mio_LibraryRead( (char *)"bench.genlib", s_BenchGenlib, NULL, 0, 0 );
+    if ( pLib )
+        Mio_UpdateGenlib( pLib );
+    for ( i = 1; i < argc; i++ )
+    {
+        if ( !strcmp(argv[i], "-K") && i + 1 < argc )
+            nLutSize = atoi( argv[++i] );
+        else if ( !strcmp(argv[i], "-C") && i + 1 < argc )
+            nCutNum = atoi( argv[++i] );
+        else if ( !strcmp(argv[i], "-E") && i + 1 < argc )
+            pEngines = argv[++i];
+        else
+        {
+            Gia_Man_t * pGia = Gia_AigerRead( argv[i], 0, 0, 0 );
+            if ( pGia == NULL )
+            {
+                fprintf( stderr, "Cannot read AIG \"%s\".\n", argv[i] );
+                RetValue = 1;
+                continue;
+            }
+            if ( !Abc_GiaCutBench( pGia, NULL, pEngines, nLutSize, nCutNum, stdout, fHeader, 0 ) )
+                RetValue = 1;
+            fHeader = 0;
+            Gia_ManStop( pGia );
+        }
+    }
+    Abc_Stop();
+    return RetValue;
+}
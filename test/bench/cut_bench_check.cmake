@@ -0,0 +1,65 @@
+# Runs cut_bench on one design and checks the CSV it prints:
+# the header, one row per engine in the fixed order, the parameters,
+# the same node count in every row, at least one cut per node and
+# at most cut_limit+1 cuts per node (the trivial cut is counted).
+
+execute_process(
+    COMMAND ${CUT_BENCH} -K 6 -C 8 ${DESIGN}
+    OUTPUT_VARIABLE output
+    RESULT_VARIABLE result
+)
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "cut_bench exited with ${result}:\n${output}")
+endif()
+
+string(REGEX REPLACE "\n$" "" output "${output}")
+string(REPLACE "\n" ";" lines "${output}")
+list(LENGTH lines num_lines)
+if(NOT num_lines EQUAL 8)
+    message(FATAL_ERROR "expected a header and 7 rows, got ${num_lines} lines:\n${output}")
+endif()
+
+list(GET lines 0 header)
+if(NOT header STREQUAL "design,engine,lut_size,cut_limit,nodes,cuts,cuts_per_node,cut_time,cuts_per_sec,tt_time,mem_mb,status")
+    message(FATAL_ERROR "unexpected header: ${header}")
+endif()
+
+# the design is named by its file name without the extension
+get_filename_component(design_dir ${DESIGN} DIRECTORY)
+get_filename_component(design_name ${DESIGN} NAME_WE)
+set(design_name "${design_dir}/${design_name}")
+set(engines mf nf lf jf kf if cut)
+set(nodes_all "")
+foreach(i RANGE 1 7)
+    list(GET lines ${i} row)
+    string(REPLACE "," ";" fields "${row}")
+    list(LENGTH fields num_fields)
+    if(NOT num_fields EQUAL 12)
+        message(FATAL_ERROR "malformed row: ${row}")
+    endif()
+    math(EXPR k "${i} - 1")
+    list(GET engines ${k} engine_expected)
+    list(GET fields 0 design)
+    list(GET fields 1 engine)
+    list(GET fields 2 lut_size)
+    list(GET fields 3 cut_limit)
+    list(GET fields 4 nodes)
+    list(GET fields 5 cuts)
+    list(GET fields 11 status)
+    if(NOT design STREQUAL design_name OR NOT engine STREQUAL engine_expected
+       OR NOT lut_size EQUAL 6 OR NOT cut_limit EQUAL 8)
+        message(FATAL_ERROR "unexpected design, engine or parameters: ${row}")
+    endif()
+    if(NOT status STREQUAL "ok")
+        message(FATAL_ERROR "engine ${engine} did not finish: ${row}")
+    endif()
+    if(nodes_all STREQUAL "")
+        set(nodes_all ${nodes})
+    elseif(NOT nodes EQUAL nodes_all)
+        message(FATAL_ERROR "engine ${engine} reports ${nodes} nodes instead of ${nodes_all}")
+    endif()
+    math(EXPR cuts_max "${nodes} * 9")
+    if(cuts LESS nodes OR cuts GREATER cuts_max)
+        message(FATAL_ERROR "engine ${engine} reports ${cuts} cuts for ${nodes} nodes")
+    endif()
+endforeach()
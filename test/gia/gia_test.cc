@@ -1,6 +1,20 @@
 #include "gtest/gtest.h"
 
 #include "aig/gia/gia.h"
+#include "base/main/main.h"
+#include "base/cmd/cmd.h"
+#include "map/if/if.h"
+#include "misc/util/utilPool.h"
+#include "misc/util/utilSimd.h"
+#include "misc/zlib/zlib.h"
+#include "sat/bmc/bmc.h"
+#include "sat/bsat/satSolver.h"
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
 
 ABC_NAMESPACE_IMPL_START
 
@@ -51,4 +65,1015 @@ TEST(GiaTest, CanAddAnAndGate) {
   Gia_ManStop(aig_manager);
 }
 
+TEST(GiaTest, ParallelSimMatchesSerial) {
+  Gia_Man_t* aig_manager = Gia_ManStart(1000);
+  Vec_Int_t* lits = Vec_IntAlloc(100);
+  for (int i = 0; i < 16; i++)
+    Vec_IntPush(lits, Gia_ManAppendCi(aig_manager));
+  for (int i = 0; i < 500; i++) {
+    int lit0 = Vec_IntEntry(lits, (i * 7 + 3) % Vec_IntSize(lits));
+    int lit1 = Vec_IntEntry(lits, (i * 13 + 5) % Vec_IntSize(lits));
+    if (Abc_Lit2Var(lit0) == Abc_Lit2Var(lit1))
+      continue;
+    int lit = (i % 3 == 0) ? Gia_ManAppendXor(aig_manager, lit0, Abc_LitNot(lit1))
+                           : Gia_ManAppendAnd(aig_manager, Abc_LitNot(lit0), lit1);
+    Vec_IntPush(lits, lit);
+  }
+  for (int i = 0; i < 8; i++)
+    Gia_ManAppendCo(aig_manager, Vec_IntEntry(lits, Vec_IntSize(lits) - 1 - i));
+
+  Vec_Wrd_t* stimulus = Vec_WrdStartRandom(Gia_ManCiNum(aig_manager) * 37);
+  Vec_Wrd_t* serial = Gia_ManSimPatSimOut(aig_manager, stimulus, /*fouts*/0);
+  aig_manager->nSimThreads = 4;
+  Vec_Wrd_t* parallel = Gia_ManSimPatSimOut(aig_manager, stimulus, /*fouts*/0);
+
+  EXPECT_EQ(Vec_WrdSize(serial), Vec_WrdSize(parallel));
+  EXPECT_TRUE(Vec_WrdEqual(serial, parallel));
+  Vec_WrdFree(serial);
+  Vec_WrdFree(parallel);
+  Vec_WrdFree(stimulus);
+  Vec_IntFree(lits);
+  Gia_ManStop(aig_manager);
+}
+
+TEST(GiaTest, SimdKernelsMatchScalar) {
+  const int nWords = 37;
+  Vec_Wrd_t* inputs = Vec_WrdStartRandom(3 * nWords);
+  word* pIn0 = Vec_WrdEntryP(inputs, 0);
+  word* pIn1 = Vec_WrdEntryP(inputs, nWords);
+  word* pCtrl = Vec_WrdEntryP(inputs, 2 * nWords);
+  word pRef[3][nWords], pRes[3][nWords];
+  Abc_SimdLevel_t LevelMax = Abc_SimdDetect();
+  for (int Level = ABC_SIMD_NONE; Level <= LevelMax; Level++) {
+    for (int fCompl = 0; fCompl < 4; fCompl++) {
+      word Diff0 = (fCompl & 1) ? ~(word)0 : 0;
+      word Diff1 = (fCompl & 2) ? ~(word)0 : 0;
+      for (int w = 0; w < nWords; w++) {
+        pRef[0][w] = (pIn0[w] ^ Diff0) & (pIn1[w] ^ Diff1);
+        pRef[1][w] = (pIn0[w] ^ Diff0) ^ (pIn1[w] ^ Diff1);
+        pRef[2][w] = (pCtrl[w] & (pIn1[w] ^ Diff1)) | (~pCtrl[w] & (pIn0[w] ^ Diff0));
+      }
+      EXPECT_EQ(Abc_SimdSetLevel((Abc_SimdLevel_t)Level), Level);
+      const Abc_SimdKernels_t* pKer = Abc_SimdKernels();
+      Abc_SimdAnd(pKer, pRes[0], pIn0, pIn1, Diff0, Diff1, nWords);
+      Abc_SimdXor(pKer, pRes[1], pIn0, pIn1, Diff0, Diff1, nWords);
+      Abc_SimdMux(pKer, pRes[2], pCtrl, pIn1, pIn0, Diff1, Diff0, nWords);
+      for (int k = 0; k < 3; k++)
+        EXPECT_EQ(memcmp(pRef[k], pRes[k], sizeof(word) * nWords), 0);
+      // the 32-bit kernel over the same data viewed as unsigned words
+      unsigned uIn0[2 * nWords], uIn1[2 * nWords], uRes[2 * nWords];
+      memcpy(uIn0, pIn0, sizeof(word) * nWords);
+      memcpy(uIn1, pIn1, sizeof(word) * nWords);
+      Abc_SimdAnd32(pKer, uRes, uIn0, uIn1, (unsigned)Diff0, (unsigned)Diff1, 2 * nWords);
+      EXPECT_EQ(memcmp(pRef[0], uRes, sizeof(word) * nWords), 0);
+    }
+  }
+  Abc_SimdSetLevel(LevelMax);
+  Vec_WrdFree(inputs);
+}
+
+TEST(GiaTest, SimdCareSetPropagationMatchesScalar) {
+  Gia_Man_t* aig_manager = Gia_ManStart(1000);
+  Vec_Int_t* lits = Vec_IntAlloc(100);
+  for (int i = 0; i < 16; i++)
+    Vec_IntPush(lits, Gia_ManAppendCi(aig_manager));
+  for (int i = 0; i < 300; i++) {
+    int lit0 = Vec_IntEntry(lits, (i * 7 + 3) % Vec_IntSize(lits));
+    int lit1 = Vec_IntEntry(lits, (i * 13 + 5) % Vec_IntSize(lits));
+    if (Abc_Lit2Var(lit0) == Abc_Lit2Var(lit1))
+      continue;
+    int lit = (i % 3 == 0) ? Gia_ManAppendXor(aig_manager, lit0, Abc_LitNot(lit1))
+                           : Gia_ManAppendAnd(aig_manager, Abc_LitNot(lit0), lit1);
+    Vec_IntPush(lits, lit);
+  }
+  for (int i = 0; i < 8; i++)
+    Gia_ManAppendCo(aig_manager, Vec_IntEntry(lits, Vec_IntSize(lits) - 1 - i));
+
+  const int nWords = 9;
+  Vec_Wrd_t* stimulus = Vec_WrdStartRandom(Gia_ManCiNum(aig_manager) * nWords);
+  Vec_Wrd_t* sims = Gia_ManSimPatSimOut(aig_manager, stimulus, /*fouts*/0);
+  Vec_Wrd_t* careCi = Vec_WrdStartRandom(Gia_ManCiNum(aig_manager) * nWords);
+  // the reference computation uses the scalar formulas
+  Vec_Wrd_t* refIn = Vec_WrdStart(Vec_WrdSize(sims));
+  Vec_Wrd_t* refC = Vec_WrdStart(Vec_WrdSize(sims));
+  Gia_Obj_t* pObj;
+  int i, Id;
+  Gia_ManForEachCoDriverId(aig_manager, Id, i)
+    memset(Vec_WrdEntryP(refIn, Id * nWords), 0xFF, sizeof(word) * nWords);
+  Gia_ManForEachAndReverse(aig_manager, pObj, i) {
+    word Diff0 = Gia_ObjFaninC0(pObj) ? 0 : ~(word)0;
+    word Diff1 = Gia_ObjFaninC1(pObj) ? 0 : ~(word)0;
+    word* pSims0 = Vec_WrdEntryP(sims, nWords * Gia_ObjFaninId0(pObj, i));
+    word* pSims1 = Vec_WrdEntryP(sims, nWords * Gia_ObjFaninId1(pObj, i));
+    word* pSims2 = Vec_WrdEntryP(sims, nWords * i);
+    word* pC0 = Vec_WrdEntryP(refIn, nWords * Gia_ObjFaninId0(pObj, i));
+    word* pC1 = Vec_WrdEntryP(refIn, nWords * Gia_ObjFaninId1(pObj, i));
+    word* pC2 = Vec_WrdEntryP(refIn, nWords * i);
+    for (int w = 0; w < nWords; w++) {
+      pC0[w] |= Gia_ObjIsXor(pObj) ? pC2[w] : (pSims2[w] | (pSims0[w] ^ Diff0)) & pC2[w];
+      pC1[w] |= Gia_ObjIsXor(pObj) ? pC2[w] : (pSims2[w] | (pSims1[w] ^ Diff1)) & pC2[w];
+    }
+  }
+  memset(Vec_WrdEntryP(refC, 0), 0xFF, sizeof(word) * nWords);
+  Gia_ManForEachCiId(aig_manager, Id, i)
+    memcpy(Vec_WrdEntryP(refC, Id * nWords), Vec_WrdEntryP(careCi, i * nWords), sizeof(word) * nWords);
+  Gia_ManForEachAnd(aig_manager, pObj, i) {
+    word Diff0 = Gia_ObjFaninC0(pObj) ? 0 : ~(word)0;
+    word Diff1 = Gia_ObjFaninC1(pObj) ? 0 : ~(word)0;
+    word* pSims0 = Vec_WrdEntryP(sims, nWords * Gia_ObjFaninId0(pObj, i));
+    word* pSims1 = Vec_WrdEntryP(sims, nWords * Gia_ObjFaninId1(pObj, i));
+    word* pC0 = Vec_WrdEntryP(refC, nWords * Gia_ObjFaninId0(pObj, i));
+    word* pC1 = Vec_WrdEntryP(refC, nWords * Gia_ObjFaninId1(pObj, i));
+    word* pC2 = Vec_WrdEntryP(refC, nWords * i);
+    for (int w = 0; w < nWords; w++)
+      pC2[w] = Gia_ObjIsXor(pObj) ? pC0[w] & pC1[w]
+                                  : (pC0[w] & pC1[w]) | ((pSims0[w] ^ Diff0) & pC0[w]) | ((pSims1[w] ^ Diff1) & pC1[w]);
+  }
+
+  Abc_SimdLevel_t LevelMax = Abc_SimdDetect();
+  for (int Level = ABC_SIMD_NONE; Level <= LevelMax; Level++) {
+    Abc_SimdSetLevel((Abc_SimdLevel_t)Level);
+    Vec_Wrd_t* careIn = Gia_ManSimPatSimIn(aig_manager, sims, /*fIns*/0, NULL);
+    Vec_Wrd_t* care = Gia_ManSimPatSimC(aig_manager, sims, careCi);
+    EXPECT_TRUE(Vec_WrdEqual(careIn, refIn));
+    EXPECT_TRUE(Vec_WrdEqual(care, refC));
+    Vec_WrdFree(careIn);
+    Vec_WrdFree(care);
+  }
+  Abc_SimdSetLevel(LevelMax);
+  Vec_WrdFree(refIn);
+  Vec_WrdFree(refC);
+  Vec_WrdFree(careCi);
+  Vec_WrdFree(sims);
+  Vec_WrdFree(stimulus);
+  Vec_IntFree(lits);
+  Gia_ManStop(aig_manager);
+}
+
+TEST(GiaTest, SimdCanonicizerMatchesScalar) {
+  Abc_SimdLevel_t LevelMax = Abc_SimdDetect();
+  Abc_Random(1);
+  for (int i = 0; i < 20000; i++) {
+    // functions with some symmetric variables exercise the pairwise search
+    int nVars = 2 + i % 5;
+    word truth = Abc_RandomW(0) & (i & 1 ? Abc_RandomW(0) : ~(word)0);
+    if (i % 3 == 0)
+      truth = Abc_Tt6SwapAdjacent(truth, i % 4) | truth;
+    truth = Abc_Tt6Stretch(truth, nVars);
+    word ref = truth;
+    char permRef[16], perm[16];
+    Abc_SimdSetLevel(ABC_SIMD_NONE);
+    unsigned phaseRef = Abc_TtCanonicize(&ref, nVars, permRef);
+    for (int Level = ABC_SIMD_AVX2; Level <= LevelMax; Level++) {
+      word res = truth;
+      Abc_SimdSetLevel((Abc_SimdLevel_t)Level);
+      unsigned phase = Abc_TtCanonicize(&res, nVars, perm);
+      EXPECT_EQ(ref, res);
+      EXPECT_EQ(phaseRef, phase);
+      EXPECT_EQ(0, memcmp(permRef, perm, nVars));
+    }
+  }
+  Abc_SimdSetLevel(LevelMax);
+}
+
+TEST(GiaTest, SoaViewMatchesObjects) {
+  Gia_Man_t* aig_manager = Gia_ManStart(100);
+  int input1 = Gia_ManAppendCi(aig_manager);
+  int input2 = Gia_ManAppendCi(aig_manager);
+  int input3 = Gia_ManAppendCi(aig_manager);
+  int and_output = Gia_ManAppendAnd(aig_manager, input1, Abc_LitNot(input2));
+  int xor_output = Gia_ManAppendXorReal(aig_manager, and_output, input3);
+  Gia_ManAppendCo(aig_manager, Abc_LitNot(xor_output));
+  Gia_ManAppendCo(aig_manager, and_output);
+
+  Vec_Wrd_t* stimulus = Vec_WrdStartRandom(Gia_ManCiNum(aig_manager) * 8);
+  Vec_Wrd_t* plain = Gia_ManSimPatSimOut(aig_manager, stimulus, /*fouts*/1);
+  // the threaded simulator creates the view for the call and deletes it
+  aig_manager->nSimThreads = 2;
+  Vec_Wrd_t* threaded = Gia_ManSimPatSimOut(aig_manager, stimulus, /*fouts*/1);
+  aig_manager->nSimThreads = 0;
+  EXPECT_TRUE(Vec_WrdEqual(plain, threaded));
+  EXPECT_FALSE(Gia_ManHasSoa(aig_manager));
+  Vec_WrdFree(threaded);
+  Gia_ManSoaStart(aig_manager);
+  EXPECT_TRUE(Gia_ManHasSoa(aig_manager));
+  int nAnds = 0, nCos = 0, i;
+  Gia_ManForEachAndSoa(aig_manager, i) nAnds++;
+  Gia_ManForEachCoSoa(aig_manager, i) nCos++;
+  EXPECT_EQ(nAnds, Gia_ManAndNum(aig_manager));
+  EXPECT_EQ(nCos, Gia_ManCoNum(aig_manager));
+  EXPECT_TRUE(Gia_ObjSoaIsXor(aig_manager, Abc_Lit2Var(xor_output)));
+  EXPECT_FALSE(Gia_ObjSoaIsXor(aig_manager, Abc_Lit2Var(and_output)));
+  Vec_Wrd_t* soa = Gia_ManSimPatSimOut(aig_manager, stimulus, /*fouts*/1);
+  EXPECT_TRUE(Vec_WrdEqual(plain, soa));
+
+  // adding an object makes the view stale
+  Gia_ManAppendCo(aig_manager, input3);
+  EXPECT_FALSE(Gia_ManHasSoa(aig_manager));
+  Gia_ManSoaStart(aig_manager);
+  EXPECT_TRUE(Gia_ManHasSoa(aig_manager));
+
+  Gia_ObjSoaSetValue(aig_manager, Abc_Lit2Var(and_output), 123);
+  Gia_ObjSoaSetMark1(aig_manager, Abc_Lit2Var(and_output));
+  Gia_ManSoaStop(aig_manager, /*fUpdate*/1);
+  EXPECT_FALSE(Gia_ManHasSoa(aig_manager));
+  EXPECT_EQ(Gia_ManObj(aig_manager, Abc_Lit2Var(and_output))->Value, 123u);
+  EXPECT_EQ(Gia_ManObj(aig_manager, Abc_Lit2Var(and_output))->fMark1, 1u);
+
+  Vec_WrdFree(plain);
+  Vec_WrdFree(soa);
+  Vec_WrdFree(stimulus);
+  Gia_ManStop(aig_manager);
+}
+
+TEST(GiaTest, StrashFindsExistingNodesAcrossResizing) {
+  Gia_Man_t* aig_manager = Gia_ManStart(100);
+  Vec_Int_t* lits = Vec_IntAlloc(100);
+  Gia_ManHashAlloc(aig_manager);
+  for (int i = 0; i < 64; i++)
+    Vec_IntPush(lits, Gia_ManAppendCi(aig_manager));
+  // creates enough nodes to resize the table several times
+  for (int i = 0; i < 64; i++)
+    for (int k = i + 1; k < 64; k++)
+      Gia_ManHashAnd(aig_manager, Abc_LitNotCond(Vec_IntEntry(lits, i), k & 1), Vec_IntEntry(lits, k));
+  int nAnds = Gia_ManAndNum(aig_manager);
+  EXPECT_EQ(nAnds, 64 * 63 / 2);
+  for (int i = 0; i < 64; i++)
+    for (int k = i + 1; k < 64; k++) {
+      int lit0 = Abc_LitNotCond(Vec_IntEntry(lits, i), k & 1);
+      int lit1 = Vec_IntEntry(lits, k);
+      int lit = Gia_ManHashAndTry(aig_manager, lit1, lit0);
+      EXPECT_GT(lit, 1);
+      EXPECT_EQ(Gia_ManHashAnd(aig_manager, lit0, lit1), lit);
+    }
+  EXPECT_EQ(Gia_ManAndNum(aig_manager), nAnds);
+  Vec_IntFree(lits);
+  Gia_ManStop(aig_manager);
+}
+
+TEST(GiaTest, ParallelRebuildSharesOneHashTable) {
+  Gia_Man_t* aig_manager = Gia_ManStart(1000);
+  Vec_Int_t* lits = Vec_IntAlloc(1000);
+  Gia_ManHashAlloc(aig_manager);
+  for (int i = 0; i < 16; i++)
+    Vec_IntPush(lits, Gia_ManAppendCi(aig_manager));
+  // random logic with a lot of sharing between the outputs
+  Abc_Random(1);
+  for (int i = 0; i < 500; i++) {
+    int lit0 = Vec_IntEntry(lits, Abc_Random(0) % Vec_IntSize(lits));
+    int lit1 = Vec_IntEntry(lits, Abc_Random(0) % Vec_IntSize(lits));
+    Vec_IntPush(lits, Gia_ManHashAnd(aig_manager, Abc_LitNotCond(lit0, i & 1), Abc_LitNotCond(lit1, i & 2)));
+  }
+  for (int i = 0; i < 20; i++)
+    Gia_ManAppendCo(aig_manager, Vec_IntEntry(lits, Vec_IntSize(lits) - 1 - 7 * i));
+  Gia_ManHashStop(aig_manager);
+
+  Gia_Man_t* serial = Gia_ManDupDfs(aig_manager);
+  Gia_Man_t* parallel = Gia_ManDupDfsPar(aig_manager, 6, 4);
+  EXPECT_EQ(Gia_ManCiNum(parallel), Gia_ManCiNum(aig_manager));
+  EXPECT_EQ(Gia_ManCoNum(parallel), Gia_ManCoNum(aig_manager));
+  EXPECT_EQ(Gia_ManObjNum(serial), Gia_ManObjNum(parallel));
+  // the new manager can be hashed again without finding duplicates
+  Gia_ManHashStart(parallel);
+  Gia_ManHashStop(parallel);
+  // one thread balances the shared manager exactly as the serial balancing
+  Gia_Man_t* balanced1 = Gia_ManBalancePar(aig_manager, 0, 0, 6, 1, 0);
+  Gia_Man_t* reference = Gia_ManBalance(aig_manager, 0, 0, 0);
+  EXPECT_EQ(Gia_ManAndNum(balanced1), Gia_ManAndNum(reference));
+  EXPECT_EQ(Gia_ManLevelNum(balanced1), Gia_ManLevelNum(reference));
+  Gia_ManStop(balanced1);
+  Gia_ManStop(reference);
+  Gia_Man_t* balanced = Gia_ManBalancePar(aig_manager, 0, 0, 6, 4, 0);
+  EXPECT_EQ(Gia_ManCoNum(balanced), Gia_ManCoNum(aig_manager));
+  // the parts transformed by the threads share their logic in the result
+  Vec_Wec_t* groups = Gia_ManParGroupCos(aig_manager, 6);
+  Gia_Man_t* merged = Gia_ManParTransform(aig_manager, groups, [](Gia_Man_t* p, void*) { return p; }, NULL, 4, 0);
+  EXPECT_EQ(Gia_ManAndNum(merged), Gia_ManAndNum(serial));
+  Vec_WecFree(groups);
+
+  Vec_Wrd_t* stimulus = Vec_WrdStartRandom(Gia_ManCiNum(aig_manager) * 4);
+  Vec_Wrd_t* original = Gia_ManSimPatSimOut(aig_manager, stimulus, /*fouts*/1);
+  Vec_Wrd_t* rebuilt = Gia_ManSimPatSimOut(parallel, stimulus, /*fouts*/1);
+  EXPECT_TRUE(Vec_WrdEqual(original, rebuilt));
+  Vec_Wrd_t* rebalanced = Gia_ManSimPatSimOut(balanced, stimulus, /*fouts*/1);
+  EXPECT_TRUE(Vec_WrdEqual(original, rebalanced));
+  Vec_WrdFree(rebalanced);
+  Gia_ManStop(balanced);
+  Vec_Wrd_t* remerged = Gia_ManSimPatSimOut(merged, stimulus, /*fouts*/1);
+  EXPECT_TRUE(Vec_WrdEqual(original, remerged));
+  Vec_WrdFree(remerged);
+  Gia_ManStop(merged);
+
+  Vec_WrdFree(original);
+  Vec_WrdFree(rebuilt);
+  Vec_WrdFree(stimulus);
+  Gia_ManStop(serial);
+  Gia_ManStop(parallel);
+  Vec_IntFree(lits);
+  Gia_ManStop(aig_manager);
+}
+
+TEST(GiaTest, AigerReadsMappedAndCompressedFiles) {
+  Gia_Man_t* aig_manager = Gia_ManStart(100);
+  Vec_Int_t* lits = Vec_IntAlloc(100);
+  for (int i = 0; i < 8; i++)
+    Vec_IntPush(lits, Gia_ManAppendCi(aig_manager));
+  for (int i = 0; i < 200; i++) {
+    int lit0 = Vec_IntEntry(lits, (7 * i + 3) % Vec_IntSize(lits));
+    int lit1 = Vec_IntEntry(lits, (5 * i + 1) % Vec_IntSize(lits));
+    if (Abc_Lit2Var(lit0) != Abc_Lit2Var(lit1))
+      Vec_IntPush(lits, Gia_ManAppendAnd(aig_manager, Abc_LitNotCond(lit0, i & 1), lit1));
+  }
+  for (int i = 0; i < 5; i++)
+    Gia_ManAppendCo(aig_manager, Vec_IntEntry(lits, Vec_IntSize(lits) - 1 - i));
+  Gia_ManAppendCo(aig_manager, Vec_IntEntry(lits, 2));
+  Gia_ManAppendCi(aig_manager);
+  Gia_ManSetRegNum(aig_manager, 1);
+
+  std::string plain = testing::TempDir() + "gia_test_read.aig";
+  std::string gzipped = plain + ".gz";
+  Gia_AigerWrite(aig_manager, (char*)plain.c_str(), 0, 0, 0);
+  Vec_Str_t* contents = Gia_AigerWriteIntoMemoryStr(aig_manager);
+  gzFile file = gzopen(gzipped.c_str(), "wb");
+  ASSERT_TRUE(file != NULL);
+  gzwrite(file, Vec_StrArray(contents), Vec_StrSize(contents));
+  gzclose(file);
+
+  Vec_Wrd_t* stimulus = Vec_WrdStartRandom(Gia_ManCiNum(aig_manager) * 2);
+  Vec_Wrd_t* expected = Gia_ManSimPatSimOut(aig_manager, stimulus, /*fouts*/1);
+  const std::string* names[] = {&plain, &gzipped};
+  for (const std::string* name : names) {
+    Gia_Man_t* read = Gia_AigerRead((char*)name->c_str(), 0, 1, 0);
+    ASSERT_TRUE(read != nullptr);
+    EXPECT_EQ(Gia_ManCiNum(read), Gia_ManCiNum(aig_manager));
+    EXPECT_EQ(Gia_ManCoNum(read), Gia_ManCoNum(aig_manager));
+    EXPECT_EQ(Gia_ManRegNum(read), Gia_ManRegNum(aig_manager));
+    EXPECT_EQ(Gia_ManAndNum(read), Gia_ManAndNum(aig_manager));
+    EXPECT_EQ(std::string(read->pName), testing::TempDir() + "gia_test_read");
+    Vec_Wrd_t* actual = Gia_ManSimPatSimOut(read, stimulus, /*fouts*/1);
+    EXPECT_TRUE(Vec_WrdEqual(expected, actual));
+    Vec_WrdFree(actual);
+    Gia_ManStop(read);
+  }
+  remove(plain.c_str());
+  remove(gzipped.c_str());
+
+  Vec_WrdFree(expected);
+  Vec_WrdFree(stimulus);
+  Vec_StrFree(contents);
+  Vec_IntFree(lits);
+  Gia_ManStop(aig_manager);
+}
+
+static std::string ReadFileContents(const std::string& file_name) {
+  std::ifstream file(file_name, std::ios::binary);
+  return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+TEST(GiaTest, ParallelAigerWriterMatchesSerial) {
+  Gia_Man_t* aig_manager = Gia_ManStart(300000);
+  Vec_Int_t* lits = Vec_IntAlloc(300000);
+  for (int i = 0; i < 64; i++)
+    Vec_IntPush(lits, Gia_ManAppendCi(aig_manager));
+  // enough nodes for several chunks of the encoder
+  Abc_Random(1);
+  for (int i = 0; i < 200000; i++) {
+    int n = Vec_IntSize(lits);
+    int lit0 = Vec_IntEntry(lits, n - 1 - Abc_Random(0) % Abc_MinInt(n, 1000));
+    int lit1 = Vec_IntEntry(lits, Abc_Random(0) % n);
+    if (Abc_Lit2Var(lit0) != Abc_Lit2Var(lit1))
+      Vec_IntPush(lits, Gia_ManAppendAnd(aig_manager, Abc_LitNotCond(lit0, i & 1), lit1));
+  }
+  for (int i = 0; i < 16; i++)
+    Gia_ManAppendCo(aig_manager, Vec_IntEntry(lits, Vec_IntSize(lits) - 1 - i));
+
+  std::string serial = testing::TempDir() + "gia_test_write1.aig";
+  std::string parallel = testing::TempDir() + "gia_test_write4.aig";
+  std::string gzipped = parallel + ".gz";
+  Gia_AigerWriteMt(aig_manager, (char*)serial.c_str(), 0, 0, 0, 1, 1);
+  Gia_AigerWriteMt(aig_manager, (char*)parallel.c_str(), 0, 0, 0, 1, 4);
+  Gia_AigerWriteMt(aig_manager, (char*)gzipped.c_str(), 0, 0, 0, 1, 4);
+  EXPECT_EQ(ReadFileContents(serial), ReadFileContents(parallel));
+
+  Gia_Man_t* read = Gia_AigerRead((char*)gzipped.c_str(), 0, 1, 0);
+  ASSERT_TRUE(read != nullptr);
+  EXPECT_EQ(Gia_ManAndNum(read), Gia_ManAndNum(aig_manager));
+  Vec_Str_t* expected = Gia_AigerWriteIntoMemoryStr(aig_manager);
+  Vec_Str_t* actual = Gia_AigerWriteIntoMemoryStr(read);
+  EXPECT_EQ(Vec_StrSize(expected), Vec_StrSize(actual));
+  EXPECT_EQ(memcmp(Vec_StrArray(expected), Vec_StrArray(actual), Vec_StrSize(expected)), 0);
+  remove(serial.c_str());
+  remove(parallel.c_str());
+  remove(gzipped.c_str());
+
+  Vec_StrFree(expected);
+  Vec_StrFree(actual);
+  Gia_ManStop(read);
+  Vec_IntFree(lits);
+  Gia_ManStop(aig_manager);
+}
+
+TEST(GiaTest, SnapshotRestoresManager) {
+  Gia_Man_t* aig_manager = Gia_ManStart(100);
+  int input1 = Gia_ManAppendCi(aig_manager);
+  int input2 = Gia_ManAppendCi(aig_manager);
+  int input3 = Gia_ManAppendCi(aig_manager);
+  int and1 = Gia_ManAppendAnd(aig_manager, input1, Abc_LitNot(input2));
+  int and2 = Gia_ManAppendAnd(aig_manager, and1, input3);
+  int and3 = Gia_ManAppendAnd(aig_manager, input3, and1);
+  Gia_ManAppendCo(aig_manager, Abc_LitNot(and2));
+  Gia_ManAppendCo(aig_manager, and3);
+  aig_manager->pName = Abc_UtilStrsav((char*)"snap");
+  aig_manager->pSibls = ABC_CALLOC(int, Gia_ManObjNum(aig_manager));
+  aig_manager->pSibls[Abc_Lit2Var(and3)] = Abc_Lit2Var(and2);
+  aig_manager->vMapping = Vec_IntStart(Gia_ManObjNum(aig_manager));
+  Vec_IntPush(aig_manager->vMapping, 17);
+  EXPECT_EQ(Gia_ManLevelNum(aig_manager), 2);
+  aig_manager->vNamesIn = Vec_PtrAlloc(3);
+  for (int i = 0; i < 3; i++)
+    Vec_PtrPush(aig_manager->vNamesIn, Abc_UtilStrsav((char*)(i == 1 ? "b" : "a")));
+
+  std::string file_name = testing::TempDir() + "gia_test.snap";
+  EXPECT_EQ(Gia_ManSnapWrite(aig_manager, (char*)file_name.c_str()), 1);
+  EXPECT_EQ(Gia_ManSnapIsFile((char*)file_name.c_str()), 1);
+  Gia_Man_t* read = Gia_ManSnapRead((char*)file_name.c_str());
+  remove(file_name.c_str());
+  ASSERT_TRUE(read != nullptr);
+
+  EXPECT_STREQ(read->pName, "snap");
+  EXPECT_EQ(Gia_ManObjNum(read), Gia_ManObjNum(aig_manager));
+  EXPECT_EQ(memcmp(read->pObjs, aig_manager->pObjs, sizeof(Gia_Obj_t) * Gia_ManObjNum(read)), 0);
+  EXPECT_TRUE(Vec_IntEqual(read->vCis, aig_manager->vCis));
+  EXPECT_TRUE(Vec_IntEqual(read->vCos, aig_manager->vCos));
+  EXPECT_TRUE(Vec_IntEqual(read->vMapping, aig_manager->vMapping));
+  ASSERT_TRUE(read->pSibls != nullptr);
+  EXPECT_EQ(read->pSibls[Abc_Lit2Var(and3)], Abc_Lit2Var(and2));
+  ASSERT_TRUE(read->vNamesIn != nullptr);
+  EXPECT_STREQ((char*)Vec_PtrEntry(read->vNamesIn, 1), "b");
+  EXPECT_EQ(Gia_ObjCioId(Gia_ManCo(read, 1)), 1);
+  EXPECT_EQ(read->nLevels, 2);
+  EXPECT_TRUE(Vec_IntEqual(read->vLevels, aig_manager->vLevels));
+  Gia_ManStop(read);
+
+  // the snapshots referring to missing objects are rejected
+  for (int k = 0; k < 3; k++) {
+    Gia_Man_t* bad = Gia_ManDup(aig_manager);
+    bad->vMapping = Vec_IntDup(aig_manager->vMapping);
+    if (k == 0)
+      Vec_IntWriteEntry(bad->vCis, 1, 1000);
+    else if (k == 1)
+      Vec_IntWriteEntry(bad->vCos, 0, Vec_IntEntry(bad->vCos, 1));
+    else {
+      // the LUT of and1 has one fanin that does not exist
+      Vec_IntWriteEntry(bad->vMapping, Abc_Lit2Var(and1), Vec_IntSize(bad->vMapping));
+      Vec_IntPush(bad->vMapping, 1);
+      Vec_IntPush(bad->vMapping, 1000);
+      Vec_IntPush(bad->vMapping, Abc_Lit2Var(and1));
+    }
+    EXPECT_EQ(Gia_ManSnapWrite(bad, (char*)file_name.c_str()), 1);
+    EXPECT_TRUE(Gia_ManSnapRead((char*)file_name.c_str()) == nullptr);
+    remove(file_name.c_str());
+    Gia_ManStop(bad);
+  }
+  Gia_ManStop(aig_manager);
+}
+
+TEST(GiaTest, ArenaReleasesScratchToMark) {
+  Gia_Man_t* aig_manager = Gia_ManStart(100);
+  Gia_MmFlexMark_t outer, inner;
+
+  Gia_ManArenaMark(aig_manager, &outer);
+  Vec_Int_t* kept = Gia_ManArenaVecIntStart(aig_manager, 4);
+  Vec_IntWriteEntry(kept, 3, 42);
+  int used = Gia_MmFlexReadMemUsage(Gia_ManArena(aig_manager));
+
+  Gia_ManArenaMark(aig_manager, &inner);
+  Vec_Int_t* scratch = Gia_ManArenaVecIntAlloc(aig_manager, 2);
+  for (int i = 0; i < 100000; i++)
+    Gia_ManArenaVecIntPush(aig_manager, scratch, i);
+  EXPECT_EQ(Vec_IntSize(scratch), 100000);
+  EXPECT_EQ(Vec_IntEntry(scratch, 99999), 99999);
+  Vec_Wrd_t* sims = Gia_ManArenaVecWrdStart(aig_manager, 1 << 16);
+  EXPECT_EQ(Vec_WrdEntry(sims, (1 << 16) - 1), 0);
+  EXPECT_EQ((ABC_PTRUINT_T)Vec_WrdArray(sims) % 8, 0);
+  Gia_ManArenaRelease(aig_manager, &inner);
+
+  EXPECT_EQ(Gia_MmFlexReadMemUsage(Gia_ManArena(aig_manager)), used);
+  EXPECT_EQ(Vec_IntEntry(kept, 3), 42);
+  Gia_ManArenaRelease(aig_manager, &outer);
+  EXPECT_EQ(Gia_MmFlexReadMemUsage(Gia_ManArena(aig_manager)), 0);
+
+  Gia_ManStop(aig_manager);
+}
+
+TEST(GiaTest, IncrementalLevelsMatchRecomputation) {
+  Gia_Man_t* aig_manager = Gia_ManStart(1000);
+  unsigned seed = 1;
+  auto next_rand = [&seed]() { seed = seed * 1103515245 + 12345; return (int)((seed >> 8) & 0xFFFFFF); };
+  for (int i = 0; i < 16; i++)
+    Gia_ManAppendCi(aig_manager);
+  for (int i = 0; i < 300; i++) {
+    int obj_num = Gia_ManObjNum(aig_manager);
+    int var0 = 1 + next_rand() % (obj_num - 1);
+    int var1 = 1 + next_rand() % (obj_num - 1);
+    if (var0 == var1)
+      continue;
+    Gia_ManAppendAnd(aig_manager, Abc_Var2Lit(var0, next_rand() & 1), Abc_Var2Lit(var1, next_rand() & 1));
+  }
+  for (int i = 0; i < 8; i++)
+    Gia_ManAppendCo(aig_manager, Abc_Var2Lit(Gia_ManObjNum(aig_manager) - 1 - 5 * i, 0));
+
+  int first_co = Gia_ObjId(aig_manager, Gia_ManCo(aig_manager, 0));
+  Gia_ManLevelIncStart(aig_manager);
+  EXPECT_EQ(Gia_ManLevelIncVerify(aig_manager, 1), 0);
+  for (int step = 0; step < 200; step++) {
+    int obj = 1 + next_rand() % (Gia_ManObjNum(aig_manager) - 1);
+    Gia_Obj_t* pObj = Gia_ManObj(aig_manager, obj);
+    if (Gia_ObjIsAnd(pObj)) {
+      int fanin = next_rand() & 1;
+      int other = fanin ? Gia_ObjFaninId0(pObj, obj) : Gia_ObjFaninId1(pObj, obj);
+      int var = 1 + next_rand() % (obj - 1);
+      if (var == other || Gia_ObjIsCo(Gia_ManObj(aig_manager, var)))
+        continue;
+      Gia_ManLevelIncPatchFanin(aig_manager, obj, fanin, Abc_Var2Lit(var, next_rand() & 1));
+    } else if (Gia_ObjIsCo(pObj)) {
+      int var = 1 + next_rand() % (first_co - 1);
+      Gia_ManLevelIncPatchFanin(aig_manager, obj, 0, Abc_Var2Lit(var, 0));
+    } else {
+      int last = Gia_ManObjNum(aig_manager) - 1;
+      if (Gia_ObjIsCo(Gia_ManObj(aig_manager, last)))
+        last = first_co - 1;
+      int lit = Gia_ManAppendAnd(aig_manager, Abc_Var2Lit(obj, 0), Abc_Var2Lit(last, 1));
+      Gia_ManLevelIncAddObj(aig_manager, Abc_Lit2Var(lit));
+    }
+    ASSERT_EQ(Gia_ManLevelIncVerify(aig_manager, 1), 0);
+  }
+  int level_max = Gia_ManLevelIncMax(aig_manager);
+  Gia_ManLevelIncStop(aig_manager);
+  EXPECT_EQ(Gia_ManLevelNum(aig_manager), level_max);
+  Gia_ManStop(aig_manager);
+}
+
+// builds XOR(ci0, ..., ci4) AND ci1, with an AND node placed between the CIs,
+// so that the CI object IDs are not 1..5; fSwap exchanges CIs 0 and 1
+static Gia_Man_t* PatternStoreGia(int fSwap) {
+  Gia_Man_t* p = Gia_ManStart(100);
+  int pCis[5], iXor, iAnd;
+  pCis[0] = Gia_ManAppendCi(p);
+  pCis[1] = Gia_ManAppendCi(p);
+  iAnd = Gia_ManAppendAnd(p, pCis[fSwap], pCis[!fSwap]);
+  for (int i = 2; i < 5; i++)
+    pCis[i] = Gia_ManAppendCi(p);
+  if (fSwap)
+    ABC_SWAP(int, pCis[0], pCis[1]);
+  iXor = pCis[0];
+  for (int i = 1; i < 5; i++)
+    iXor = Gia_ManAppendXorReal(p, iXor, pCis[i]);
+  Gia_ManAppendCo(p, Gia_ManAppendAnd(p, iXor, pCis[1]));
+  Gia_ManAppendCo(p, iAnd);
+  return p;
+}
+
+TEST(GiaTest, PatternStoreKeepsPatternsAcrossManagers) {
+  Gia_Man_t* aig_manager = PatternStoreGia(0);
+  Gia_ManPatStoreStart(aig_manager, 64);
+  EXPECT_EQ(Gia_ManPatStoreNum(aig_manager), 0);
+
+  Vec_Int_t* vLits = Vec_IntAlloc(5);
+  for (int p = 0; p < 70; p++) {
+    Vec_IntClear(vLits);
+    for (int i = 0; i < 5; i++)
+      Vec_IntPush(vLits, Abc_Var2Lit(Gia_ManCiIdToId(aig_manager, i), (p >> i) & 1));
+    EXPECT_EQ(Gia_ManPatStoreAdd(aig_manager, vLits), p % 64);
+  }
+  EXPECT_EQ(Gia_ManPatStoreNum(aig_manager), 64);
+  // the oldest patterns were overwritten
+  for (int p = 0; p < 64; p++) {
+    int pat = p < 6 ? p + 64 : p;
+    for (int i = 0; i < 5; i++)
+      EXPECT_EQ(Abc_InfoHasBit((unsigned*)Gia_ManPatStoreCi(aig_manager, i), p), (pat >> i) & 1);
+  }
+
+  // the store is dropped if the CI order differs
+  Gia_Man_t* swapped_manager = PatternStoreGia(1);
+  Gia_Man_t* copy_manager = Gia_ManDup(aig_manager);
+  Gia_ManPatStoreStart(copy_manager, 64);
+  Gia_ManPatStoreTransfer(swapped_manager, copy_manager, 0);
+  EXPECT_EQ(Gia_ManPatStoreNum(copy_manager), 0);
+  EXPECT_EQ(swapped_manager->vPatStore, nullptr);
+  Gia_ManStop(copy_manager);
+  Gia_ManStop(swapped_manager);
+
+  // an equivalent copy with the same CI order receives the store
+  Gia_Man_t* other_manager = PatternStoreGia(0);
+  Gia_ManPatStoreTransfer(other_manager, aig_manager, 0);
+  EXPECT_EQ(Gia_ManPatStoreNum(aig_manager), 0);
+  EXPECT_EQ(Gia_ManPatStoreNum(other_manager), 64);
+
+  // the patterns are loaded into the simulation info of the CI objects
+  Vec_Wrd_t* sims = Vec_WrdStart(Gia_ManObjNum(other_manager));
+  EXPECT_EQ(Gia_ManPatStoreLoad(other_manager, 10, 100, Vec_WrdArray(sims), 1, 1), 54);
+  for (int i = 0; i < 5; i++)
+    for (int k = 0; k < 54; k++)
+      EXPECT_EQ((int)(Vec_WrdEntry(sims, Gia_ManCiIdToId(other_manager, i)) >> (1 + k)) & 1, ((10 + k) >> i) & 1);
+  Gia_Obj_t* pObj;
+  int i;
+  Gia_ManForEachAnd(other_manager, pObj, i)
+    EXPECT_EQ(Vec_WrdEntry(sims, i), 0u);
+
+  Vec_WrdFree(sims);
+  Vec_IntFree(vLits);
+  Gia_ManStop(aig_manager);
+  Gia_ManStop(other_manager);
+}
+
+struct PoolTestData {
+  Util_Pool_t* pool;
+  int result[8];
+};
+
+static int PoolTestInner(void* pArg) {
+  int* pSlot = (int*)pArg;
+  *pSlot += 1;
+  return 1;
+}
+
+static int PoolTestOuter(void* pArg) {
+  PoolTestData* pData = (PoolTestData*)pArg;
+  Util_PoolGroup_t* group = Util_PoolGroupStart(pData->pool, 0);
+  for (int i = 0; i < 8; i++)
+    Util_PoolSubmit(group, PoolTestInner, pData->result + i);
+  int fDone = Util_PoolGroupWait(group);
+  Util_PoolGroupStop(group);
+  return fDone;
+}
+
+TEST(GiaTest, WorkStealingPoolRunsNestedAndCanceledGroups) {
+  Util_Pool_t* pool = Util_PoolStart(3);
+  PoolTestData data[16];
+  Util_PoolGroup_t* group = Util_PoolGroupStart(pool, 0);
+  for (int k = 0; k < 16; k++) {
+    data[k].pool = pool;
+    for (int i = 0; i < 8; i++)
+      data[k].result[i] = 0;
+    Util_PoolSubmit(group, PoolTestOuter, data + k);
+  }
+  EXPECT_EQ(Util_PoolGroupWait(group), 1);
+  EXPECT_EQ(Util_PoolGroupDoneNum(group), 16);
+  Util_PoolGroupStop(group);
+  for (int k = 0; k < 16; k++)
+    for (int i = 0; i < 8; i++)
+      EXPECT_EQ(data[k].result[i], 1);
+
+  // the tasks of a canceled group are skipped
+  int slots[4] = {0};
+  group = Util_PoolGroupStart(pool, 0);
+  Util_PoolGroupCancel(group);
+  for (int i = 0; i < 4; i++)
+    Util_PoolSubmit(group, PoolTestInner, slots + i);
+  EXPECT_EQ(Util_PoolGroupWait(group), 0);
+  EXPECT_EQ(Util_PoolGroupSkippedNum(group), 4);
+  Util_PoolGroupStop(group);
+  for (int i = 0; i < 4; i++)
+    EXPECT_EQ(slots[i], 0);
+  Util_PoolStop(pool);
+}
+
+TEST(GiaTest, FramePoolIsNotRestartedWhileGroupsAreLive) {
+  Abc_Start();
+  Abc_Frame_t* pAbc = Abc_FrameGetGlobalFrame();
+  Cmd_CommandExecute(pAbc, "set threads 3");
+  Util_Pool_t* pool = (Util_Pool_t*)Abc_FrameReadPool();
+  EXPECT_EQ(Util_PoolThreadNum(pool), 2);
+  Util_PoolGroup_t* group = Util_PoolGroupStart(pool, 0);
+  EXPECT_EQ(Util_PoolGroupNum(pool), 1);
+  // the thread count changes while the group is live
+  Cmd_CommandExecute(pAbc, "set threads 5");
+  EXPECT_EQ((Util_Pool_t*)Abc_FrameReadPool(), pool);
+  EXPECT_EQ(Util_PoolThreadNum(pool), 2);
+  Util_PoolGroupStop(group);
+  EXPECT_EQ(Util_PoolGroupNum(pool), 0);
+  // the new count takes effect once the group is stopped
+  pool = (Util_Pool_t*)Abc_FrameReadPool();
+  EXPECT_EQ(Util_PoolThreadNum(pool), 4);
+  Abc_Stop();
+}
+
+TEST(GiaTest, ParallelMfCutsMatchSerial) {
+  Gia_Man_t* aig_manager = Gia_ManStart(50000);
+  Vec_Int_t* layer = Vec_IntAlloc(3000);
+  Vec_Int_t* next = Vec_IntAlloc(3000);
+  Gia_ManHashAlloc(aig_manager);
+  for (int i = 0; i < 3000; i++)
+    Vec_IntPush(layer, Gia_ManAppendCi(aig_manager));
+  // wide layers of random logic, so that each wavefront is split among threads
+  Abc_Random(1);
+  for (int l = 0; l < 8; l++) {
+    Vec_IntClear(next);
+    for (int i = 0; i < 3000; i++) {
+      int lit0 = Vec_IntEntry(layer, Abc_Random(0) % Vec_IntSize(layer));
+      int lit1 = Vec_IntEntry(layer, Abc_Random(0) % Vec_IntSize(layer));
+      Vec_IntPush(next, Gia_ManHashAnd(aig_manager, Abc_LitNotCond(lit0, i & 1), Abc_LitNotCond(lit1, i & 2)));
+    }
+    Vec_IntAppend(layer, next);
+  }
+  for (int i = 0; i < 3000; i++)
+    Gia_ManAppendCo(aig_manager, Vec_IntEntry(next, i));
+  Gia_ManHashStop(aig_manager);
+
+  Jf_Par_t pars;
+  Mf_ManSetDefaultPars(&pars);
+  Gia_Man_t* serial = Mf_ManPerformMapping(aig_manager, &pars);
+  pars.nProcNum = 4;
+  Gia_Man_t* parallel = Mf_ManPerformMapping(aig_manager, &pars);
+  ASSERT_TRUE(Gia_ManHasMapping(serial));
+  ASSERT_TRUE(Gia_ManHasMapping(parallel));
+  EXPECT_EQ(Gia_ManLutNum(serial), Gia_ManLutNum(parallel));
+  EXPECT_TRUE(Vec_IntEqual(serial->vMapping, parallel->vMapping));
+
+  Vec_IntFree(layer);
+  Vec_IntFree(next);
+  Gia_ManStop(serial);
+  Gia_ManStop(parallel);
+  Gia_ManStop(aig_manager);
+}
+
+TEST(GiaTest, ParallelIfMappingIsDeterministic) {
+  Gia_Man_t* aig_manager = Gia_ManStart(50000);
+  Vec_Int_t* layer = Vec_IntAlloc(3000);
+  Vec_Int_t* next = Vec_IntAlloc(3000);
+  Gia_ManHashAlloc(aig_manager);
+  for (int i = 0; i < 3000; i++)
+    Vec_IntPush(layer, Gia_ManAppendCi(aig_manager));
+  // wide layers of random logic, so that each level is split among threads
+  Abc_Random(1);
+  for (int l = 0; l < 8; l++) {
+    Vec_IntClear(next);
+    for (int i = 0; i < 3000; i++) {
+      int lit0 = Vec_IntEntry(layer, Abc_Random(0) % Vec_IntSize(layer));
+      int lit1 = Vec_IntEntry(layer, Abc_Random(0) % Vec_IntSize(layer));
+      Vec_IntPush(next, Gia_ManHashAnd(aig_manager, Abc_LitNotCond(lit0, i & 1), Abc_LitNotCond(lit1, i & 2)));
+    }
+    Vec_IntAppend(layer, next);
+  }
+  for (int i = 0; i < 3000; i++)
+    Gia_ManAppendCo(aig_manager, Vec_IntEntry(next, i));
+  Gia_ManHashStop(aig_manager);
+  // the mapper expects no dangling nodes
+  Gia_Man_t* cleaned = Gia_ManCleanup(aig_manager);
+
+  Gia_Man_t* mapped[3];
+  int procs[3] = {0, 2, 4};
+  for (int k = 0; k < 3; k++) {
+    If_Par_t pars;
+    Gia_ManSetIfParsDefault(&pars);
+    pars.nLutSize = 6;
+    pars.nProcs = procs[k];
+    mapped[k] = Gia_ManPerformMapping(cleaned, &pars);
+    ASSERT_TRUE(Gia_ManHasMapping(mapped[k]));
+  }
+  // the parallel result does not depend on the number of threads
+  EXPECT_TRUE(Vec_IntEqual(mapped[1]->vMapping, mapped[2]->vMapping));
+  // and its quality is close to that of the serial mapping
+  EXPECT_LE(Gia_ManLutNum(mapped[1]), Gia_ManLutNum(mapped[0]) * 21 / 20);
+  EXPECT_EQ(Gia_ManLutLevel(mapped[1], NULL), Gia_ManLutLevel(mapped[0], NULL));
+
+  // the same holds for SOP balancing, which shares truth tables and ISOPs among the threads
+  Gia_Man_t* balanced[3];
+  for (int k = 0; k < 3; k++) {
+    If_Par_t pars;
+    Gia_ManSetIfParsDefault(&pars);
+    pars.nLutSize = 6;
+    pars.fDelayOpt = 1;
+    pars.fTruth = 1;
+    pars.fCutMin = 1;
+    pars.fExpRed = 0;
+    pars.pLutLib = NULL;
+    pars.nProcs = procs[k];
+    balanced[k] = Gia_ManPerformMapping(cleaned, &pars);
+    ASSERT_TRUE(balanced[k] != NULL);
+  }
+  EXPECT_EQ(Gia_ManAndNum(balanced[1]), Gia_ManAndNum(balanced[2]));
+  EXPECT_LE(Gia_ManAndNum(balanced[1]), Gia_ManAndNum(balanced[0]) * 21 / 20);
+  EXPECT_EQ(Gia_ManLevelNum(balanced[1]), Gia_ManLevelNum(balanced[0]));
+  Vec_Wrd_t* stimulus = Vec_WrdStartRandom(Gia_ManCiNum(cleaned) * 2);
+  Vec_Wrd_t* original = Gia_ManSimPatSimOut(cleaned, stimulus, /*fouts*/1);
+  for (int k = 0; k < 3; k++) {
+    Vec_Wrd_t* result = Gia_ManSimPatSimOut(balanced[k], stimulus, /*fouts*/1);
+    EXPECT_TRUE(Vec_WrdEqual(original, result));
+    Vec_WrdFree(result);
+    Gia_ManStop(balanced[k]);
+  }
+  Vec_WrdFree(original);
+  Vec_WrdFree(stimulus);
+
+  Vec_IntFree(layer);
+  Vec_IntFree(next);
+  for (int k = 0; k < 3; k++)
+    Gia_ManStop(mapped[k]);
+  Gia_ManStop(cleaned);
+  Gia_ManStop(aig_manager);
+}
+
+TEST(GiaTest, BatchedTruthTableInsertMatchesSequential) {
+  // 4-word entries with many duplicates, added in batches of varying size,
+  // so that both the grouping and the resizing of the hash table are used
+  Vec_Mem_t* seq = Vec_MemAllocForTT(8, 0);
+  Vec_Mem_t* batch = Vec_MemAllocForTT(8, 0);
+  word truths[1000][4];
+  word* ptrs[1000];
+  int ids[1000];
+  Abc_Random(1);
+  for (int i = 0; i < 1000; i++) {
+    int base = Abc_Random(0) % 400;
+    for (int w = 0; w < 4; w++)
+      truths[i][w] = ((word)base << 32) | (word)(w * 7 + 2);
+    ptrs[i] = truths[i];
+  }
+  for (int i = 0, n = 1; i < 1000; i += n, n = n % 37 + 1) {
+    int nBatch = Abc_MinInt(n, 1000 - i);
+    Vec_MemHashInsertBatch(batch, ptrs + i, nBatch, ids + i);
+    for (int k = i; k < i + nBatch; k++)
+      EXPECT_EQ(Vec_MemHashInsert(seq, truths[k]), ids[k]);
+  }
+  EXPECT_EQ(Vec_MemEntryNum(batch), Vec_MemEntryNum(seq));
+  for (int i = 0; i < Vec_MemEntryNum(seq); i++)
+    EXPECT_EQ(memcmp(Vec_MemReadEntry(seq, i), Vec_MemReadEntry(batch, i), sizeof(word) * 4), 0);
+  Vec_MemHashFree(seq);
+  Vec_MemFree(seq);
+  Vec_MemHashFree(batch);
+  Vec_MemFree(batch);
+}
+
+TEST(GiaTest, TruthTableStoreCachesCanonicalForms) {
+  Dau_TtStore_t* store = Dau_TtStoreStart();
+  Abc_Random(1);
+  for (int nVars = 4; nVars <= 8; nVars += 4) {
+    int nWords = Abc_TtWordNum(nVars);
+    word truths[50][4], copy[4], canon[4];
+    int ids[50];
+    char perm[16], permStore[16];
+    for (int i = 0; i < 50; i++) {
+      for (int w = 0; w < nWords; w++)
+        truths[i][w] = Abc_RandomW(0);
+      if (nVars < 6)
+        truths[i][0] = Abc_Tt6Stretch(truths[i][0], nVars);
+      ids[i] = Dau_TtStoreInsert(store, nVars, truths[i]);
+    }
+    Vec_Mem_t* mem = Dau_TtStoreMem(store, nVars);
+    // the private copy used when the store is full keeps the IDs
+    Vec_Mem_t* copy_mem = Dau_TtStoreMemDup(store, nVars);
+    EXPECT_EQ(Vec_MemEntryNum(copy_mem), Vec_MemEntryNum(mem));
+    for (int i = 0; i < 50; i++)
+      EXPECT_EQ(Vec_MemHashInsert(copy_mem, truths[i]), ids[i]);
+    Vec_MemHashFree(copy_mem);
+    Vec_MemFree(copy_mem);
+    for (int i = 0; i < 50; i++) {
+      // the IDs are stable and point to the inserted functions
+      EXPECT_EQ(Dau_TtStoreInsert(store, nVars, truths[i]), ids[i]);
+      EXPECT_TRUE(Abc_TtEqual(Vec_MemReadEntry(mem, ids[i]), truths[i], nWords));
+      // the cached canonical form is the one computed by Abc_TtCanonicize
+      for (int k = 0; k < 2; k++) {
+        Abc_TtCopy(canon, truths[i], nWords, 0);
+        unsigned phase = Abc_TtCanonicize(canon, nVars, perm);
+        Abc_TtCopy(copy, truths[i], nWords, 0);
+        unsigned phaseStore = Dau_TtStoreCanonicize(store, copy, nVars, permStore);
+        EXPECT_EQ(phase, phaseStore);
+        EXPECT_EQ(0, memcmp(perm, permStore, nVars));
+        EXPECT_TRUE(Abc_TtEqual(canon, copy, nWords));
+      }
+      // the class of the function is the class of its canonical form
+      int iClass = Dau_TtStoreNpnClass(store, nVars, ids[i], NULL, NULL);
+      Dau_TtStoreNpnTruth(store, nVars, iClass, copy);
+      EXPECT_TRUE(Abc_TtEqual(canon, copy, nWords));
+    }
+    EXPECT_LE(Dau_TtStoreNpnClassNum(store, nVars), 50);
+  }
+  Dau_TtStoreStop(store);
+}
+
+TEST(GiaTest, ReservedTruthTablePagesDoNotMove) {
+  // two entries per page and four reserved pages
+  Vec_Mem_t* mem = Vec_MemAlloc(1, 1);
+  Vec_MemHashAlloc(mem, 4);
+  Vec_MemReservePages(mem, 4);
+  word** pages = mem->ppPages;
+  for (word i = 0; i < 8; i++)
+    EXPECT_EQ(Vec_MemHashInsert(mem, &i), (int)i);
+  EXPECT_EQ(pages, mem->ppPages);
+  EXPECT_EQ(Vec_MemMemoryFrom(mem, 5), 3.0 * sizeof(word));
+  // the ninth entry would need a fifth page, so it is refused
+  word extra = 8, known = 3;
+  EXPECT_TRUE(Vec_MemIsFull(mem));
+  EXPECT_EQ(Vec_MemHashInsert(mem, &extra), -1);
+  EXPECT_EQ(Vec_MemHashInsert(mem, &known), 3);
+  EXPECT_EQ(Vec_MemEntryNum(mem), 8);
+  EXPECT_TRUE(Vec_MemGetEntry(mem, 8) == NULL);
+  EXPECT_EQ(Vec_MemEntryNum(mem), 8);
+  // the batch marks the entries that did not fit
+  word* batch[2] = {&known, &extra};
+  int ids[2];
+  Vec_MemHashInsertBatch(mem, batch, 2, ids);
+  EXPECT_EQ(ids[0], 3);
+  EXPECT_EQ(ids[1], -1);
+  // more pages can be reserved while nobody reads the table
+  Vec_MemReserveEntries(mem, 1);
+  EXPECT_FALSE(Vec_MemIsFull(mem));
+  EXPECT_EQ(Vec_MemHashInsert(mem, &extra), 8);
+  EXPECT_EQ(*Vec_MemReadEntry(mem, 8), extra);
+  Vec_MemHashFree(mem);
+  Vec_MemFree(mem);
+}
+
+TEST(GiaTest, NpnCacheReusesCanonicalFormsFromFile) {
+  const char* file_name = "npn_cache_test.bin";
+  std::remove(file_name);
+  Abc_Random(1);
+  word truths[40][4];
+  for (int i = 0; i < 40; i++)
+    for (int w = 0; w < 4; w++)
+      truths[i][w] = Abc_RandomW(0);
+  // the first run computes the forms and writes them
+  Dau_NpnCache_t* cache = Dau_NpnCacheStart((char*)file_name);
+  for (int i = 0; i < 40; i++) {
+    word copy[4];
+    char perm[16];
+    Abc_TtCopy(copy, truths[i], 4, 0);
+    Dau_NpnCacheCanonicize(cache, DAU_NPN_ABC, copy, 8, perm);
+  }
+  EXPECT_EQ(Dau_NpnCacheEntryNum(cache, 0), 0);
+  EXPECT_EQ(Dau_NpnCacheEntryNum(cache, 1), 40);
+  ASSERT_TRUE(Dau_NpnCacheWrite(cache));
+  Dau_NpnCacheStop(cache);
+  // the second run finds them in the file
+  cache = Dau_NpnCacheStart((char*)file_name);
+  EXPECT_EQ(Dau_NpnCacheEntryNum(cache, 0), 40);
+  for (int i = 0; i < 40; i++) {
+    word canon[4], copy[4];
+    char perm[16], permCache[16];
+    Abc_TtCopy(canon, truths[i], 4, 0);
+    unsigned phase = Abc_TtCanonicize(canon, 8, perm);
+    Abc_TtCopy(copy, truths[i], 4, 0);
+    EXPECT_EQ(phase, Dau_NpnCacheCanonicize(cache, DAU_NPN_ABC, copy, 8, permCache));
+    EXPECT_EQ(0, memcmp(perm, permCache, 8));
+    EXPECT_TRUE(Abc_TtEqual(canon, copy, 4));
+  }
+  EXPECT_EQ(Dau_NpnCacheEntryNum(cache, 1), 0);
+  Dau_NpnCacheStop(cache);
+  std::remove(file_name);
+}
+
+// pigeon-hole clauses placing nPigeons into nHoles
+static std::vector<std::vector<int> > PigeonHoleClauses(int nPigeons, int nHoles) {
+  std::vector<std::vector<int> > clauses;
+  for (int p = 0; p < nPigeons; p++) {
+    std::vector<int> clause;
+    for (int h = 0; h < nHoles; h++)
+      clause.push_back(Abc_Var2Lit(p * nHoles + h, 0));
+    clauses.push_back(clause);
+  }
+  for (int h = 0; h < nHoles; h++)
+    for (int p = 0; p < nPigeons; p++)
+      for (int q = p + 1; q < nPigeons; q++)
+        clauses.push_back({Abc_Var2Lit(p * nHoles + h, 1), Abc_Var2Lit(q * nHoles + h, 1)});
+  return clauses;
+}
+
+TEST(GiaTest, SolverPortfolioMatchesSingleSolver) {
+  for (int nPigeons = 5; nPigeons <= 6; nPigeons++) {
+    std::vector<std::vector<int> > clauses = PigeonHoleClauses(nPigeons, 5);
+    for (int nSolvers = 1; nSolvers <= 3; nSolvers += 2) {
+      Bmc_PortPar_t Pars;
+      Bmc_PortSetDefaultParams(&Pars);
+      Pars.nSolvers = nSolvers;
+      Bmc_Port_t* port = Bmc_PortStart(&Pars);
+      for (size_t i = 0; i < clauses.size(); i++)
+        Bmc_PortAddClause(port, clauses[i].data(), (int)clauses[i].size());
+      int status = Bmc_PortSolve(port, NULL, 0);
+      EXPECT_EQ(status, nPigeons <= 5 ? l_True : l_False);
+      if (status == l_True) {
+        // the model of the winning solver satisfies every clause
+        for (size_t i = 0; i < clauses.size(); i++) {
+          int fSat = 0;
+          for (size_t k = 0; k < clauses[i].size(); k++)
+            fSat |= Bmc_PortVarValue(port, Abc_Lit2Var(clauses[i][k])) != Abc_LitIsCompl(clauses[i][k]);
+          EXPECT_TRUE(fSat);
+        }
+        // assuming the first pigeon out of every hole is UNSAT
+        std::vector<int> assumps;
+        for (int h = 0; h < 5; h++)
+          assumps.push_back(Abc_Var2Lit(h, 1));
+        EXPECT_EQ(Bmc_PortSolve(port, assumps.data(), (int)assumps.size()), l_False);
+        // the solvers remain usable after the UNSAT call
+        EXPECT_EQ(Bmc_PortSolve(port, NULL, 0), l_True);
+      }
+      // the solvers of the portfolio received clauses learned by the others
+      if (nSolvers > 1) {
+        EXPECT_GT(Bmc_PortImportNum(port), 0);
+      }
+      Bmc_PortStop(port);
+    }
+  }
+}
+
 ABC_NAMESPACE_IMPL_END
@@ -0,0 +1,82 @@
+#include "gtest/gtest.h"
+
+#include "aig/gia/gia.h"
+#include "aig/gia/giaAig.h"
+#include "aig/saig/saig.h"
+#include "base/main/main.h"
+#include "proof/pdr/pdr.h"
+
+#include <vector>
+
+// the counter is incremented when the PI is 1 and goes back to 0 after Limit;
+// the PO is 1 when the counter is equal to Target
+static Gia_Man_t* WrappingCounterGia(int nBits, int Limit, int Target) {
+  Gia_Man_t* p = Gia_ManStart(1000);
+  std::vector<int> ros, ris;
+  int iEnable = Gia_ManAppendCi(p);
+  for (int i = 0; i < nBits; i++)
+    ros.push_back(Gia_ManAppendCi(p));
+  Gia_ManHashStart(p);
+  int iCarry = iEnable, iLimit = 1, iTarget = 1;
+  for (int i = 0; i < nBits; i++) {
+    ris.push_back(Gia_ManHashXor(p, ros[i], iCarry));
+    iCarry = Gia_ManHashAnd(p, ros[i], iCarry);
+    iLimit = Gia_ManHashAnd(p, iLimit, Abc_LitNotCond(ros[i], !((Limit >> i) & 1)));
+    iTarget = Gia_ManHashAnd(p, iTarget, Abc_LitNotCond(ros[i], !((Target >> i) & 1)));
+  }
+  iLimit = Gia_ManHashAnd(p, iLimit, iEnable);
+  Gia_ManAppendCo(p, iTarget);
+  for (int i = 0; i < nBits; i++)
+    Gia_ManAppendCo(p, Gia_ManHashAnd(p, ris[i], Abc_LitNot(iLimit)));
+  Gia_ManHashStop(p);
+  Gia_ManSetRegNum(p, nBits);
+  return p;
+}
+
+static int PdrSolve(Gia_Man_t* p, int nProcs, Pdr_Par_t* pPars, int* pCexFrame) {
+  Aig_Man_t* pAig = Gia_ManToAig(p, 0);
+  Pdr_ManSetDefaultParams(pPars);
+  pPars->nProcs = nProcs;
+  pPars->fSilent = 1;
+  int RetValue = Pdr_ManSolve(pAig, pPars);
+  *pCexFrame = -1;
+  if (RetValue == 0) {
+    EXPECT_TRUE(pAig->pSeqModel != NULL);
+    if (pAig->pSeqModel) {
+      EXPECT_TRUE(Saig_ManVerifyCex(pAig, pAig->pSeqModel));
+      *pCexFrame = pAig->pSeqModel->iFrame;
+    }
+  }
+  Aig_ManStop(pAig);
+  return RetValue;
+}
+
+TEST(PdrTest, ConcurrentWorkersProveWithImportedClauses) {
+  // the states above the limit are unreachable
+  Gia_Man_t* p = WrappingCounterGia(7, 80, 100);
+  Pdr_Par_t Pars;
+  int iFrame;
+  // PDR records the invariant in the global frame
+  Abc_Start();
+  EXPECT_EQ(PdrSolve(p, 1, &Pars, &iFrame), 1);
+  EXPECT_EQ(Pars.nImports, 0);
+  EXPECT_EQ(PdrSolve(p, 4, &Pars, &iFrame), 1);
+  EXPECT_GT(Pars.nImports, 0);
+  Abc_Stop();
+  Gia_ManStop(p);
+}
+
+TEST(PdrTest, ConcurrentWorkersFindShortestCounterExample) {
+  // the target is reached after enabling the counter Target times
+  const int Target = 20;
+  Gia_Man_t* p = WrappingCounterGia(6, 40, Target);
+  Pdr_Par_t Pars;
+  int iFrame;
+  Abc_Start();
+  EXPECT_EQ(PdrSolve(p, 1, &Pars, &iFrame), 0);
+  EXPECT_EQ(iFrame, Target);
+  EXPECT_EQ(PdrSolve(p, 3, &Pars, &iFrame), 0);
+  EXPECT_EQ(iFrame, Target);
+  Abc_Stop();
+  Gia_ManStop(p);
+}
@@ -0,0 +1,351 @@
+#include "gtest/gtest.h"
+
+#include "aig/gia/gia.h"
+#include "sat/bmc/bmc.h"
+#include "sat/bsat/satSolver.h"
+#include "sat/satoko/satoko.h"
+
+#include <vector>
+
+static int SatokoAddClause(satoko_t* s, std::vector<int> clause) {
+  return satoko_add_clause(s, clause.data(), (int)clause.size()) == SATOKO_OK;
+}
+
+static bool SatokoModelSatisfies(satoko_t* s, const std::vector<std::vector<int> >& clauses) {
+  for (size_t i = 0; i < clauses.size(); i++) {
+    bool fSat = false;
+    for (size_t k = 0; k < clauses[i].size(); k++)
+      fSat |= satoko_read_cex_varvalue(s, Abc_Lit2Var(clauses[i][k])) != Abc_LitIsCompl(clauses[i][k]);
+    if (!fSat)
+      return false;
+  }
+  return true;
+}
+
+// the tests below have no resource limits, so every call is decided
+static int SatokoSolve(satoko_t* s, std::vector<int> assumps) {
+  int status = satoko_solve_assumptions(s, assumps.data(), (int)assumps.size());
+  EXPECT_NE(status, SATOKO_UNDEC);
+  return status;
+}
+
+// a solver that only eliminates variables when asked to
+static satoko_t* SatokoCreateElim(int nVars) {
+  satoko_t* s = satoko_create();
+  satoko_options(s)->inproc_vivify = 0;
+  satoko_options(s)->inproc_subsume = 0;
+  satoko_setnvars(s, nVars);
+  return s;
+}
+
+TEST(SatTest, SatokoRestoresEliminatedVariableForNewClause) {
+  // x = 0 is eliminated from (x + a)(!x + b), leaving (a + b)
+  std::vector<std::vector<int> > clauses = {
+      {Abc_Var2Lit(0, 0), Abc_Var2Lit(1, 0)}, {Abc_Var2Lit(0, 1), Abc_Var2Lit(2, 0)}};
+  satoko_t* s = SatokoCreateElim(3);
+  for (size_t i = 0; i < clauses.size(); i++)
+    ASSERT_TRUE(SatokoAddClause(s, clauses[i]));
+  satoko_freeze_var(s, 1, 1);
+  satoko_freeze_var(s, 2, 1);
+  ASSERT_EQ(satoko_inprocess(s), SATOKO_OK);
+  EXPECT_EQ(satoko_stats(s)->n_eliminated_vars, 1);
+  // the model is extended to the eliminated variable
+  EXPECT_EQ(SatokoSolve(s, {Abc_Var2Lit(1, 1)}), SATOKO_SAT);
+  EXPECT_TRUE(SatokoModelSatisfies(s, clauses));
+  // asserting x brings back (!x + b), so b cannot be false
+  ASSERT_TRUE(SatokoAddClause(s, {Abc_Var2Lit(0, 0)}));
+  EXPECT_EQ(SatokoSolve(s, {Abc_Var2Lit(2, 1)}), SATOKO_UNSAT);
+  EXPECT_EQ(SatokoSolve(s, {Abc_Var2Lit(2, 0)}), SATOKO_SAT);
+  satoko_destroy(s);
+}
+
+TEST(SatTest, SatokoRestoresChainOfEliminatedVariables) {
+  // the implications x0 -> x1 -> ... -> xn with only the ends frozen
+  const int n = 200;
+  std::vector<std::vector<int> > clauses;
+  for (int i = 0; i < n; i++)
+    clauses.push_back({Abc_Var2Lit(i, 1), Abc_Var2Lit(i + 1, 0)});
+  satoko_t* s = SatokoCreateElim(n + 2);
+  for (size_t i = 0; i < clauses.size(); i++)
+    ASSERT_TRUE(SatokoAddClause(s, clauses[i]));
+  satoko_freeze_var(s, 0, 1);
+  satoko_freeze_var(s, n, 1);
+  ASSERT_EQ(satoko_inprocess(s), SATOKO_OK);
+  EXPECT_EQ(satoko_stats(s)->n_eliminated_vars, n - 1);
+  EXPECT_EQ(SatokoSolve(s, {Abc_Var2Lit(0, 0), Abc_Var2Lit(n, 1)}), SATOKO_UNSAT);
+  // a clause with the middle variable brings back the implications around it
+  ASSERT_TRUE(SatokoAddClause(s, {Abc_Var2Lit(n / 2, 0), Abc_Var2Lit(n + 1, 0)}));
+  EXPECT_EQ(SatokoSolve(s, {Abc_Var2Lit(0, 0), Abc_Var2Lit(n / 2, 1)}), SATOKO_UNSAT);
+  EXPECT_EQ(SatokoSolve(s, {Abc_Var2Lit(n / 2, 0), Abc_Var2Lit(n, 1)}), SATOKO_UNSAT);
+  EXPECT_EQ(SatokoSolve(s, {Abc_Var2Lit(0, 1), Abc_Var2Lit(n / 2, 0)}), SATOKO_SAT);
+  EXPECT_TRUE(SatokoModelSatisfies(s, clauses));
+  satoko_destroy(s);
+}
+
+TEST(SatTest, SatokoFreezesAreCountedAndReleasedWithAssumptions) {
+  std::vector<std::vector<int> > clauses = {
+      {Abc_Var2Lit(0, 0), Abc_Var2Lit(1, 0)}, {Abc_Var2Lit(0, 1), Abc_Var2Lit(2, 0)}};
+  satoko_t* s = SatokoCreateElim(3);
+  for (size_t i = 0; i < clauses.size(); i++)
+    ASSERT_TRUE(SatokoAddClause(s, clauses[i]));
+  satoko_freeze_var(s, 1, 1);
+  satoko_freeze_var(s, 2, 1);
+  // the variable stays frozen until every freeze is released
+  satoko_freeze_var(s, 0, 1);
+  satoko_freeze_var(s, 0, 1);
+  satoko_freeze_var(s, 0, 0);
+  ASSERT_EQ(satoko_inprocess(s), SATOKO_OK);
+  EXPECT_EQ(satoko_stats(s)->n_eliminated_vars, 0);
+  // an assumption freezes the variable only while it is pushed
+  satoko_freeze_var(s, 0, 0);
+  EXPECT_EQ(SatokoSolve(s, {Abc_Var2Lit(0, 0)}), SATOKO_SAT);
+  ASSERT_EQ(satoko_inprocess(s), SATOKO_OK);
+  EXPECT_EQ(satoko_stats(s)->n_eliminated_vars, 1);
+  satoko_destroy(s);
+}
+
+TEST(SatTest, SatokoFreezeAddsUnknownVariables) {
+  satoko_t* s = satoko_create();
+  satoko_freeze_var(s, 5, 1);
+  EXPECT_EQ(satoko_varnum(s), 6);
+  EXPECT_EQ(SatokoSolve(s, {Abc_Var2Lit(5, 1)}), SATOKO_SAT);
+  satoko_destroy(s);
+}
+
+static int BsatAddClause(sat_solver* s, std::vector<int> clause) {
+  return sat_solver_addclause(s, clause.data(), clause.data() + clause.size());
+}
+
+static int BsatSolve(sat_solver* s, std::vector<int> assumps) {
+  return sat_solver_solve(s, assumps.data(), assumps.data() + assumps.size(), 0, 0, 0, 0);
+}
+
+TEST(SatTest, BsatBlockersAreDroppedWithRolledBackClauses) {
+  sat_solver* s = sat_solver_new();
+  sat_solver_setnvars(s, 4);
+  ASSERT_TRUE(BsatAddClause(s, {Abc_Var2Lit(3, 0), Abc_Var2Lit(2, 0), Abc_Var2Lit(1, 1)}));
+  sat_solver_bookmark(s);
+  // (a + b + c) is watched by a and b, each entry carrying the other one as the blocker
+  ASSERT_TRUE(BsatAddClause(s, {Abc_Var2Lit(0, 0), Abc_Var2Lit(1, 0), Abc_Var2Lit(2, 0)}));
+  EXPECT_EQ(BsatSolve(s, {Abc_Var2Lit(0, 1), Abc_Var2Lit(1, 1), Abc_Var2Lit(2, 1)}), l_False);
+  sat_solver_rollback(s);
+  EXPECT_EQ(BsatSolve(s, {Abc_Var2Lit(0, 1), Abc_Var2Lit(1, 1), Abc_Var2Lit(2, 1)}), l_True);
+  // (a + b + d) reuses the handle of the removed clause under the same watches
+  ASSERT_TRUE(BsatAddClause(s, {Abc_Var2Lit(0, 0), Abc_Var2Lit(1, 0), Abc_Var2Lit(3, 0)}));
+  EXPECT_EQ(BsatSolve(s, {Abc_Var2Lit(0, 1), Abc_Var2Lit(1, 1), Abc_Var2Lit(2, 1)}), l_True);
+  EXPECT_EQ(sat_solver_var_value(s, 3), 1);
+  EXPECT_EQ(BsatSolve(s, {Abc_Var2Lit(0, 1), Abc_Var2Lit(1, 1), Abc_Var2Lit(3, 1)}), l_False);
+  // the first clause is still watched: b = 1 and d = 0 force c
+  EXPECT_EQ(BsatSolve(s, {Abc_Var2Lit(1, 0), Abc_Var2Lit(3, 1), Abc_Var2Lit(2, 1)}), l_False);
+  sat_solver_delete(s);
+}
+
+TEST(SatTest, BsatClausesSurviveArenaGrowthAndRollback) {
+  // the chain (!x_i + x_i+1 + z) is several times larger than the initial arena
+  const int n = 50000, z = n + 1;
+  sat_solver* s = sat_solver_new();
+  sat_solver_setnvars(s, n + 2);
+  ASSERT_TRUE(BsatAddClause(s, {Abc_Var2Lit(0, 0), Abc_Var2Lit(n, 0), Abc_Var2Lit(z, 0)}));
+  sat_solver_bookmark(s);
+  double Memory = Sat_MemMemoryAll(&s->Mem);
+  for (int round = 0; round < 2; round++) {
+    for (int i = 0; i < n; i++)
+      ASSERT_TRUE(BsatAddClause(s, {Abc_Var2Lit(i, 1), Abc_Var2Lit(i + 1, 0), Abc_Var2Lit(z, 0)}));
+    EXPECT_GT(Sat_MemMemoryAll(&s->Mem), Memory);
+    EXPECT_EQ(BsatSolve(s, {Abc_Var2Lit(0, 0), Abc_Var2Lit(z, 1), Abc_Var2Lit(n, 1)}), l_False);
+    EXPECT_EQ(BsatSolve(s, {Abc_Var2Lit(0, 0), Abc_Var2Lit(z, 1)}), l_True);
+    EXPECT_EQ(sat_solver_var_value(s, n / 2), 1);
+    sat_solver_rollback(s);
+    // the chain is gone, only the clause added before the bookmark remains
+    EXPECT_EQ(BsatSolve(s, {Abc_Var2Lit(0, 0), Abc_Var2Lit(z, 1), Abc_Var2Lit(n / 2, 1)}), l_True);
+    EXPECT_EQ(BsatSolve(s, {Abc_Var2Lit(0, 1), Abc_Var2Lit(z, 1), Abc_Var2Lit(n, 1)}), l_False);
+  }
+  sat_solver_delete(s);
+}
+
+TEST(SatTest, BsatReportsResourceLimitWhenArenaIsFull) {
+  sat_solver* s = sat_solver_new();
+  sat_solver_setnvars(s, 3);
+  ASSERT_TRUE(BsatAddClause(s, {Abc_Var2Lit(0, 0), Abc_Var2Lit(1, 0)}));
+  sat_solver_bookmark(s);
+  // pretend the arena is at its largest size, so growing it is refused
+  int nSize = s->Mem.nSize[0];
+  s->Mem.nSize[0] = SAT_MEM_LRN_MASK - 2;
+  BsatAddClause(s, {Abc_Var2Lit(0, 1), Abc_Var2Lit(1, 1), Abc_Var2Lit(2, 0)});
+  s->Mem.nSize[0] = nSize;
+  EXPECT_TRUE(s->fMemOut);
+  EXPECT_EQ(BsatSolve(s, {}), l_Undef);
+  // dropping the clauses added after the bookmark makes the solver usable again
+  sat_solver_rollback(s);
+  EXPECT_FALSE(s->fMemOut);
+  EXPECT_EQ(BsatSolve(s, {Abc_Var2Lit(0, 1)}), l_True);
+  EXPECT_EQ(BsatSolve(s, {Abc_Var2Lit(0, 1), Abc_Var2Lit(1, 1)}), l_False);
+  sat_solver_delete(s);
+}
+
+// pigeons p = 0..nPigeons-1 and holes h = 0..nHoles-1 use the variable p * nHoles + h
+static void BsatAddPigeonHole(sat_solver* s, int nPigeons, int nHoles) {
+  for (int p = 0; p < nPigeons; p++) {
+    std::vector<int> clause;
+    for (int h = 0; h < nHoles; h++)
+      clause.push_back(Abc_Var2Lit(p * nHoles + h, 0));
+    ASSERT_TRUE(BsatAddClause(s, clause));
+  }
+  for (int h = 0; h < nHoles; h++)
+    for (int p = 0; p < nPigeons; p++)
+      for (int q = p + 1; q < nPigeons; q++)
+        ASSERT_TRUE(BsatAddClause(s, {Abc_Var2Lit(p * nHoles + h, 1), Abc_Var2Lit(q * nHoles + h, 1)}));
+}
+
+TEST(SatTest, BsatCompactsLearnedClausesAfterBookmark) {
+  // the pigeons are enabled by the activation literal of the last variable
+  const int nPigeons = 8, nHoles = 7, a = nPigeons * nHoles;
+  sat_solver* s = sat_solver_new();
+  // small learned clause limits make the database reduction run often
+  s->nLearntStart = s->nLearntMax = 20;
+  s->nLearntDelta = 5;
+  sat_solver_setnvars(s, a + 1);
+  BsatAddPigeonHole(s, nPigeons - 1, nHoles);
+  EXPECT_EQ(BsatSolve(s, {}), l_True);
+  sat_solver_bookmark(s);
+  std::vector<int> clause;
+  for (int h = 0; h < nHoles; h++)
+    clause.push_back(Abc_Var2Lit((nPigeons - 1) * nHoles + h, 0));
+  clause.push_back(Abc_Var2Lit(a, 1));
+  ASSERT_TRUE(BsatAddClause(s, clause));
+  for (int h = 0; h < nHoles; h++)
+    for (int p = 0; p < nPigeons - 1; p++)
+      ASSERT_TRUE(BsatAddClause(s, {Abc_Var2Lit(p * nHoles + h, 1), Abc_Var2Lit((nPigeons - 1) * nHoles + h, 1)}));
+  EXPECT_EQ(BsatSolve(s, {Abc_Var2Lit(a, 0)}), l_False);
+  EXPECT_GT(s->nDBreduces, 0);
+  EXPECT_EQ(BsatSolve(s, {Abc_Var2Lit(a, 1)}), l_True);
+  sat_solver_rollback(s);
+  EXPECT_EQ(BsatSolve(s, {}), l_True);
+  EXPECT_EQ(BsatSolve(s, {Abc_Var2Lit(a, 0)}), l_True);
+  sat_solver_delete(s);
+}
+
+static int SatokoAddClauseInc(void* pSat, int* pLits, int nLits, int nVars) {
+  while (satoko_varnum((satoko_t*)pSat) < nVars)
+    satoko_add_variable((satoko_t*)pSat, 0);
+  return nLits == 0 || satoko_add_clause((satoko_t*)pSat, pLits, nLits) == SATOKO_OK;
+}
+
+// a solver with the constant-0 variable expected by the incremental CNF
+static satoko_t* SatokoCreateInc(Bmc_CnfInc_t* pCnfInc) {
+  satoko_t* s = satoko_create();
+  int Lit = Abc_Var2Lit(0, 1);
+  satoko_add_variable(s, 0);
+  satoko_add_clause(s, &Lit, 1);
+  Bmc_CnfIncAddSolver(pCnfInc, s, SatokoAddClauseInc);
+  return s;
+}
+
+// the counter is incremented when the PI is 1 and the PO is 1 when it is equal to Target
+static Gia_Man_t* CounterGia(int nBits, int Target) {
+  Gia_Man_t* p = Gia_ManStart(1000);
+  std::vector<int> ros, ris;
+  int iEnable = Gia_ManAppendCi(p);
+  for (int i = 0; i < nBits; i++)
+    ros.push_back(Gia_ManAppendCi(p));
+  Gia_ManHashStart(p);
+  int iCarry = iEnable, iEqual = 1;
+  for (int i = 0; i < nBits; i++) {
+    ris.push_back(Gia_ManHashXor(p, ros[i], iCarry));
+    iCarry = Gia_ManHashAnd(p, ros[i], iCarry);
+    iEqual = Gia_ManHashAnd(p, iEqual, Abc_LitNotCond(ros[i], !((Target >> i) & 1)));
+  }
+  Gia_ManHashStop(p);
+  Gia_ManAppendCo(p, iEqual);
+  for (int i = 0; i < nBits; i++)
+    Gia_ManAppendCo(p, ris[i]);
+  Gia_ManSetRegNum(p, nBits);
+  return p;
+}
+
+TEST(SatTest, BmcCnfIncAddsFramesBetweenSolverCalls) {
+  const int nBits = 4, Target = 11;
+  Gia_Man_t* p = CounterGia(nBits, Target);
+  Bmc_CnfInc_t* pCnfInc = Bmc_CnfIncStart(p);
+  satoko_t* s = SatokoCreateInc(pCnfInc);
+  for (int f = 0; f < (1 << nBits); f++) {
+    int nClauses = Bmc_CnfIncClauseNum(pCnfInc);
+    int iLit = Bmc_CnfIncPoLit(pCnfInc, 0, f);
+    // the initial state makes the first frame constant
+    if (f == 0) {
+      EXPECT_EQ(iLit, 0);
+      continue;
+    }
+    EXPECT_GT(Bmc_CnfIncClauseNum(pCnfInc), nClauses);
+    // the frame is added after the solver has answered the previous ones
+    ASSERT_TRUE(SatokoAddClauseInc(s, NULL, 0, Bmc_CnfIncVarNum(pCnfInc)));
+    int status = SatokoSolve(s, {iLit});
+    EXPECT_EQ(status, f >= Target ? SATOKO_SAT : SATOKO_UNSAT);
+    if (status != SATOKO_SAT)
+      continue;
+    // the counter-example enables the counter exactly Target times
+    int nEnables = 0;
+    for (int k = 0; k < f; k++) {
+      int iVar = Bmc_CnfIncPiVar(pCnfInc, 0, k);
+      ASSERT_GT(iVar, 0);
+      nEnables += satoko_read_cex_varvalue(s, iVar);
+    }
+    EXPECT_EQ(nEnables, Target);
+  }
+  // the frames are not built again
+  int nClauses = Bmc_CnfIncClauseNum(pCnfInc);
+  Bmc_CnfIncPoLit(pCnfInc, 0, Target);
+  EXPECT_EQ(Bmc_CnfIncClauseNum(pCnfInc), nClauses);
+  satoko_destroy(s);
+  Bmc_CnfIncStop(pCnfInc);
+  Gia_ManStop(p);
+}
+
+TEST(SatTest, BmcCnfIncBuildsDeepFramesIteratively) {
+  // a shift register of length n whose input is the AND of two PIs
+  const int n = 20000;
+  Gia_Man_t* p = Gia_ManStart(3 * n + 10);
+  int iPi0 = Gia_ManAppendCi(p), iPi1 = Gia_ManAppendCi(p);
+  std::vector<int> ros;
+  for (int i = 0; i < n; i++)
+    ros.push_back(Gia_ManAppendCi(p));
+  int iAnd = Gia_ManAppendAnd(p, iPi0, iPi1);
+  Gia_ManAppendCo(p, ros[n - 1]);
+  Gia_ManAppendCo(p, iAnd);
+  for (int i = 1; i < n; i++)
+    Gia_ManAppendCo(p, ros[i - 1]);
+  Gia_ManSetRegNum(p, n);
+  Bmc_CnfInc_t* pCnfInc = Bmc_CnfIncStart(p);
+  satoko_t* s = SatokoCreateInc(pCnfInc);
+  // the first frame requested is the deepest one
+  int iLit = Bmc_CnfIncPoLit(pCnfInc, 0, n);
+  EXPECT_GT(iLit, 1);
+  EXPECT_EQ(Bmc_CnfIncPoLit(pCnfInc, 0, n - 1), 0);
+  // only the cone of the output is built
+  EXPECT_EQ(Bmc_CnfIncPiVar(pCnfInc, 0, 1), -1);
+  ASSERT_TRUE(SatokoAddClauseInc(s, NULL, 0, Bmc_CnfIncVarNum(pCnfInc)));
+  EXPECT_EQ(SatokoSolve(s, {iLit}), SATOKO_SAT);
+  EXPECT_EQ(satoko_read_cex_varvalue(s, Bmc_CnfIncPiVar(pCnfInc, 0, 0)), 1);
+  EXPECT_EQ(satoko_read_cex_varvalue(s, Bmc_CnfIncPiVar(pCnfInc, 1, 0)), 1);
+  EXPECT_EQ(SatokoSolve(s, {iLit, Abc_Var2Lit(Bmc_CnfIncPiVar(pCnfInc, 1, 0), 1)}), SATOKO_UNSAT);
+  satoko_destroy(s);
+  Bmc_CnfIncStop(pCnfInc);
+  Gia_ManStop(p);
+}
+
+static int RejectClause(void* pSat, int* pLits, int nLits, int nVars) {
+  return 0;
+}
+
+TEST(SatTest, BmcCnfIncMarksRejectedClauseAsUnsat) {
+  Gia_Man_t* p = CounterGia(4, 3);
+  Bmc_CnfInc_t* pCnfInc = Bmc_CnfIncStart(p);
+  Bmc_CnfIncAddSolver(pCnfInc, NULL, RejectClause);
+  EXPECT_EQ(Bmc_CnfIncPoLit(pCnfInc, 0, 0), 0);
+  EXPECT_FALSE(Bmc_CnfIncIsUnsat(pCnfInc));
+  Bmc_CnfIncPoLit(pCnfInc, 0, 3);
+  EXPECT_GT(Bmc_CnfIncClauseNum(pCnfInc), 0);
+  EXPECT_TRUE(Bmc_CnfIncIsUnsat(pCnfInc));
+  Bmc_CnfIncStop(pCnfInc);
+  Gia_ManStop(p);
+}